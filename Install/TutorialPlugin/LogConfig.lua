@@ -9,6 +9,13 @@ NF_LOG_LEVEL_ERROR = 4 --    err = 4,
 LogLevel = NF_LOG_LEVEL_DEBUG;				--log等级配置		当前日志输出级别，大于此等于级别的才会输出到console
 LogFlushLevel = NF_LOG_LEVEL_DEBUG;			--log刷新等级配置, 当前日志输出级别，大于此等于级别的才会刷新到LOG文件里
 
+--二进制异步log, 业务线程只拷贝格式串和参数, 格式化和写文件放到log线程
+LogBinary = {
+	open = false,							--是否开启
+	ringsize = 4,						--每个写log的线程的缓冲区大小(M)
+	policy = 0,							--缓冲区满了怎么办 0:丢弃并计数 1:等log线程腾出空间(最多100毫秒)
+};
+
 
 NFLogId = {
 	--0-100是基础框架层LOG
@@ -35,12 +35,13 @@ public:
 public:
 	CHMPoint GetPointByIndex(unsigned int uTraceId, unsigned int uIndex);
 	int GetTracePointCount(unsigned int uTraceId);
+	//批量计算鱼的位置时直接读取轨迹点
+	CHMTraceBin* GetTraceBin(uint32_t id);
 private:
 	bool ReadTracePack(const std::string& strPackFile);
 	bool ReadTraceBin(std::ifstream& tracdPackFile, CHMTraceBin& traceBin);
 	int GetBinLen(int iType);
 private:
-	CHMTraceBin* GetTraceBin(uint32_t id);
 	CHMTraceBin* InsertTraceBin(uint32_t id);
 private:
 	uint32_t m_roomId;
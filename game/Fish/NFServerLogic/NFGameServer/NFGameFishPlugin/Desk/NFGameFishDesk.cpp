@@ -71,11 +71,17 @@ int NFGameFishDesk::CreateInit()
 
     m_strLastWayBillName.CreateInit();
     m_bIsLastWayBillPrior = false;
+
+    m_bFishGridDirty = true;
+    m_ullFishGridTime = 0;
+    memset(m_aFishGridCellStart, 0, sizeof(m_aFishGridCellStart));
     return 0;
 }
 
 int NFGameFishDesk::ResumeInit()
 {
+    //网格里保存的是鱼的指针, 恢复后必须重建
+    m_bFishGridDirty = true;
     return 0;
 }
 
@@ -649,6 +655,8 @@ int NFGameFishDesk::OnTimer(int timeId, int callcount)
 
             CheckFishOverTime();
         }
+
+        RefreshFishGrid();
     }
 
     return 0;
@@ -1056,6 +1064,7 @@ NFGameFish *NFGameFishDesk::GetFish(uint32_t uFishId)
 void NFGameFishDesk::ClearFishes()
 {
     m_gameFishMap.clear();
+    MarkFishGridDirty();
 }
 
 int NFGameFishDesk::GetFishCount()
@@ -1066,37 +1075,15 @@ int NFGameFishDesk::GetFishCount()
 std::vector<NFGameFish *> NFGameFishDesk::GetFishesByKind(uint8_t nFishKind)
 {
     std::vector<NFGameFish *> vecFishes;
-    NFFishTraceConfig* pConfig = GetFishTraceConfig();
-    CHECK_EXPR(pConfig, vecFishes, "");
-    for (auto iter = m_gameFishMap.begin(); iter != m_gameFishMap.end(); iter++)
+    RefreshFishGrid();
+    //网格里只有屏幕内的鱼
+    for (int i = 0; i < m_aFishGridCellStart[GAME_FISH_GRID_CELL_COUNT]; i++)
     {
-        NFGameFish *pGameFish = &iter->second;
-        if (pGameFish == NULL)
-        {
-            continue;
-        }
-
-        if ((nFishKind == INVALID_FISHKIND || (pGameFish->m_nFishKind == nFishKind))
-            && pGameFish->IsAlive()
-            && IsPointInScreen(pGameFish->GetMyPoint(pConfig)))
+        NFGameFish *pGameFish = m_aFishGridItem[i].m_pFish;
+        if ((nFishKind == INVALID_FISHKIND || (pGameFish->m_nFishKind == nFishKind)) && pGameFish->IsAlive())
         {
             vecFishes.push_back(pGameFish);
         }
-        else
-        {
-            //if (pGameFish->m_nFishKind == nFishKind)
-            //{
-            //	int index = pGameFish->GetMyPointIndex();
-            //	CHMPoint point = NFIPluginManager::Instance()->FindModule<NFCFishTraceModule>()->GetPointByIndex(pGameFish->m_uTraceId, index);
-            //	CHMPoint pt = point.OffSet(pGameFish->m_nOffsetPosX, pGameFish->m_nOffsetPosY);
-
-            //	bool isInScreen = IsPointInScreen(pt);
-
-            //	NFLogTrace(NF_LOG_SYSTEMLOG, 0, "NFGameFishMgr::GetFishesByKind() pGameFish->m_uTraceId = {} , index = {} ,point.m_iPosX = {} , point.m_iPosY = {} , m_nOffsetPosX = {} , m_nOffsetPosY = {}, pt.m_iPosX = {} , pt.m_iPosY = {}", pGameFish->m_uTraceId, index, point.m_iPosX, point.m_iPosY, pGameFish->m_nOffsetPosX, pGameFish->m_nOffsetPosY, pt.m_iPosX, pt.m_iPosY);
-            //	NFLogTrace(NF_LOG_SYSTEMLOG, 0, "NFGameFishMgr::GetFishesByKind() pGameFish->m_nFishKind = {} , m_btFishType = {} , pt.x = {} , pt.y = {} , isInScreen = {}", pGameFish->m_nFishKind, pGameFish->m_fishKind.m_btFishType, pGameFish->GetMyPoint().m_iPosX, pGameFish->GetMyPoint().m_iPosY, isInScreen ? "1" : "0");
-
-            //}
-        }
     }
 
     return vecFishes;
@@ -1120,72 +1107,166 @@ std::vector<NFGameFish *> NFGameFishDesk::GetFishesByKinds(vector<uint8_t> &vecF
 std::vector<NFGameFish *> NFGameFishDesk::GetFishes(uint8_t nFishKind, CHMPoint ptCenter, int iRadius)
 {
     std::vector<NFGameFish *> vecFishes;
-    NFFishTraceConfig* pConfig = GetFishTraceConfig();
-    CHECK_EXPR(pConfig, vecFishes, "");
-    for (auto iter = m_gameFishMap.begin(); iter != m_gameFishMap.end(); iter++)
-    {
-        NFGameFish *pGameFish = &iter->second;
-        if (pGameFish == NULL) continue;
+    GetGridFishes(nFishKind, ptCenter, iRadius, -1, vecFishes);
+    return vecFishes;
+}
 
-        if ((nFishKind == INVALID_FISHKIND || (pGameFish->m_nFishKind == nFishKind)) && pGameFish->IsAlive())
-        {
-            CHMPoint fishPoint = pGameFish->GetMyPoint(pConfig);
-            double distance = HMDistance(ptCenter, fishPoint);
+std::vector<NFGameFish *> NFGameFishDesk::GetFishes(CHMPoint ptCenter, int iRadius, int iKillPercent)
+{
+    std::vector<NFGameFish *> vecFishes;
+    GetGridFishes(INVALID_FISHKIND, ptCenter, iRadius, iKillPercent, vecFishes);
+    return vecFishes;
+}
 
-            if (distance < iRadius && IsPointInScreen(fishPoint))
-            {
-                vecFishes.push_back(pGameFish);
-            }
+std::vector<NFGameFish *> NFGameFishDesk::GetFishesByType(uint8_t nFishType)
+{
+    std::vector<NFGameFish *> vecFishes;
+    RefreshFishGrid();
+    for (int i = 0; i < m_aFishGridCellStart[GAME_FISH_GRID_CELL_COUNT]; i++)
+    {
+        NFGameFish *pGameFish = m_aFishGridItem[i].m_pFish;
+        if (pGameFish->m_fishKind.m_btFishType == nFishType && pGameFish->IsAlive())
+        {
+            vecFishes.push_back(pGameFish);
         }
     }
 
     return vecFishes;
 }
 
-std::vector<NFGameFish *> NFGameFishDesk::GetFishes(CHMPoint ptCenter, int iRadius, int iKillPercent)
+void NFGameFishDesk::GetGridFishes(uint8_t nFishKind, CHMPoint ptCenter, int iRadius, int iKillPercent, std::vector<NFGameFish *> &vecFishes)
 {
-    std::vector<NFGameFish *> vecFishes;
-    NFFishTraceConfig* pConfig = GetFishTraceConfig();
-    CHECK_EXPR(pConfig, vecFishes, "");
-    for (auto iter = m_gameFishMap.begin(); iter != m_gameFishMap.end(); iter++)
+    RefreshFishGrid();
+    if (iRadius <= 0)
     {
-        NFGameFish *pGameFish = &iter->second;
-        if (pGameFish == NULL) continue;
+        return;
+    }
 
-        if (pGameFish->IsAlive())
-        {
-            CHMPoint fishPoint = pGameFish->GetMyPoint(pConfig);
-            double distance = HMDistance(ptCenter, fishPoint);
+    //圆的外接矩形和屏幕求交, 只遍历覆盖到的格子
+    int64_t llLeft = (int64_t) ptCenter.m_iPosX - iRadius;
+    int64_t llRight = (int64_t) ptCenter.m_iPosX + iRadius;
+    int64_t llTop = (int64_t) ptCenter.m_iPosY - iRadius;
+    int64_t llBottom = (int64_t) ptCenter.m_iPosY + iRadius;
+    if (llRight <= 0 || llLeft >= SCREEN_WIDTH || llBottom <= 0 || llTop >= SCREEN_HEIGHT)
+    {
+        return;
+    }
 
-            if (distance < iRadius && IsPointInScreen(fishPoint) && NFRandomInt(0, 100) < iKillPercent)
+    int iMinCol = llLeft <= 0 ? 0 : (int) (llLeft / GAME_FISH_GRID_CELL_SIZE);
+    int iMaxCol = llRight >= SCREEN_WIDTH ? GAME_FISH_GRID_COL - 1 : (int) (llRight / GAME_FISH_GRID_CELL_SIZE);
+    int iMinRow = llTop <= 0 ? 0 : (int) (llTop / GAME_FISH_GRID_CELL_SIZE);
+    int iMaxRow = llBottom >= SCREEN_HEIGHT ? GAME_FISH_GRID_ROW - 1 : (int) (llBottom / GAME_FISH_GRID_CELL_SIZE);
+    int64_t llRadiusSquare = (int64_t) iRadius * iRadius;
+
+    for (int iRow = iMinRow; iRow <= iMaxRow; iRow++)
+    {
+        for (int iCol = iMinCol; iCol <= iMaxCol; iCol++)
+        {
+            int iCell = iRow * GAME_FISH_GRID_COL + iCol;
+            for (int i = m_aFishGridCellStart[iCell]; i < m_aFishGridCellStart[iCell + 1]; i++)
             {
-                vecFishes.push_back(pGameFish);
+                const NFGameFishGridItem &item = m_aFishGridItem[i];
+                NFGameFish *pGameFish = item.m_pFish;
+                if ((nFishKind != INVALID_FISHKIND && pGameFish->m_nFishKind != nFishKind) || !pGameFish->IsAlive())
+                {
+                    continue;
+                }
+
+                int64_t llDiffX = item.m_iPosX - ptCenter.m_iPosX;
+                int64_t llDiffY = item.m_iPosY - ptCenter.m_iPosY;
+                if (llDiffX * llDiffX + llDiffY * llDiffY < llRadiusSquare && (iKillPercent < 0 || NFRandomInt(0, 100) < iKillPercent))
+                {
+                    vecFishes.push_back(pGameFish);
+                }
             }
         }
     }
-
-    return vecFishes;
 }
 
-std::vector<NFGameFish *> NFGameFishDesk::GetFishesByType(uint8_t nFishType)
+void NFGameFishDesk::RefreshFishGrid(bool bForce)
 {
-    std::vector<NFGameFish *> vecFishes;
-    NFFishTraceConfig* pConfig = GetFishTraceConfig();
-    CHECK_EXPR(pConfig, vecFishes, "");
-    for (auto iter = m_gameFishMap.begin(); iter != m_gameFishMap.end(); iter++)
+    uint64_t ullNow = NFTime::Now().UnixMSec();
+    if (!bForce && !m_bFishGridDirty && ullNow < m_ullFishGridTime + GAME_FISH_GRID_REFRESH_MS)
+    {
+        return;
+    }
+
+    m_bFishGridDirty = false;
+    m_ullFishGridTime = ullNow;
+    memset(m_aFishGridCellStart, 0, sizeof(m_aFishGridCellStart));
+
+    NFFishTraceConfig *pConfig = GetFishTraceConfig();
+    CHECK_EXPR_RE_VOID(pConfig, "");
+
+    NFGameFish *aFish[GAME_FISH_DESK_FISH_COUNT];
+    int aPosX[GAME_FISH_DESK_FISH_COUNT];
+    int aPosY[GAME_FISH_DESK_FISH_COUNT];
+    uint16_t aCell[GAME_FISH_DESK_FISH_COUNT];
+    uint16_t aCellCount[GAME_FISH_GRID_CELL_COUNT + 1];
+    memset(aCellCount, 0, sizeof(aCellCount));
+
+    //第一遍: 用同一个当前时间取出每条鱼的轨迹点, 同一鱼群的鱼通常共用轨迹, 复用上一次查到的轨迹
+    int iCount = 0;
+    CHMTraceBin *pTraceBin = NULL;
+    uint32_t uTraceId = 0;
+    for (auto iter = m_gameFishMap.begin(); iter != m_gameFishMap.end() && iCount < GAME_FISH_DESK_FISH_COUNT; iter++)
     {
         NFGameFish *pGameFish = &iter->second;
-        if (pGameFish == NULL) continue;
+        if (pTraceBin == NULL || uTraceId != pGameFish->m_uTraceId)
+        {
+            uTraceId = pGameFish->m_uTraceId;
+            pTraceBin = pConfig->GetTraceBin(uTraceId);
+        }
 
-        if (pGameFish->m_fishKind.m_btFishType == nFishType
-            && pGameFish->IsAlive()
-            && IsPointInScreen(pGameFish->GetMyPoint(pConfig)))
+        //与GetMyPoint一致, 取不到轨迹点时按原点加偏移处理
+        int iPosX = 0;
+        int iPosY = 0;
+        unsigned int uIndex = pGameFish->GetMyPointIndex(ullNow);
+        if (pTraceBin && uIndex < (unsigned int) pTraceBin->m_vecPoints.size())
         {
-            vecFishes.push_back(pGameFish);
+            const CHMPoint &point = pTraceBin->m_vecPoints[uIndex];
+            iPosX = point.m_iPosX;
+            iPosY = point.m_iPosY;
         }
+
+        aFish[iCount] = pGameFish;
+        aPosX[iCount] = iPosX + pGameFish->m_nOffsetPosX;
+        aPosY[iCount] = iPosY + pGameFish->m_nOffsetPosY;
+        iCount++;
     }
 
-    return vecFishes;
+    //第二遍: 屏幕判定和格子下标, 没有分支, 编译器可以向量化; 屏幕外的鱼落在最后一个桶里, 不进网格
+    for (int i = 0; i < iCount; i++)
+    {
+        int iPosX = aPosX[i];
+        int iPosY = aPosY[i];
+        int iInScreen = (iPosX > 0) & (iPosX < SCREEN_WIDTH) & (iPosY > 0) & (iPosY < SCREEN_HEIGHT);
+        int iCell = (iPosY / GAME_FISH_GRID_CELL_SIZE) * GAME_FISH_GRID_COL + iPosX / GAME_FISH_GRID_CELL_SIZE;
+        aCell[i] = iInScreen ? iCell : GAME_FISH_GRID_CELL_COUNT;
+    }
+
+    //第三遍: 按格子计数排序
+    for (int i = 0; i < iCount; i++)
+    {
+        aCellCount[aCell[i]]++;
+    }
+
+    for (int i = 0; i < GAME_FISH_GRID_CELL_COUNT; i++)
+    {
+        m_aFishGridCellStart[i + 1] = m_aFishGridCellStart[i] + aCellCount[i];
+        aCellCount[i] = m_aFishGridCellStart[i];
+    }
+
+    for (int i = 0; i < iCount; i++)
+    {
+        if (aCell[i] < GAME_FISH_GRID_CELL_COUNT)
+        {
+            NFGameFishGridItem &item = m_aFishGridItem[aCellCount[aCell[i]]++];
+            item.m_pFish = aFish[i];
+            item.m_iPosX = aPosX[i];
+            item.m_iPosY = aPosY[i];
+        }
+    }
 }
 
 std::vector<NFGameFish *> NFGameFishDesk::GetAllFishes()
@@ -1205,15 +1286,13 @@ std::vector<NFGameFish *> NFGameFishDesk::GetAllFishes()
 
 uint32_t NFGameFishDesk::GetFishForRobotLock()
 {
-    NFFishTraceConfig* pConfig = GetFishTraceConfig();
-    CHECK_EXPR(pConfig, 0, "");
-    for (auto iter = m_gameFishMap.begin(); iter != m_gameFishMap.end(); iter++)
+    RefreshFishGrid();
+    for (int i = 0; i < m_aFishGridCellStart[GAME_FISH_GRID_CELL_COUNT]; i++)
     {
-        NFGameFish *pGameFish = &iter->second;
-        if (pGameFish == NULL) continue;
-
+        const NFGameFishGridItem &item = m_aFishGridItem[i];
+        NFGameFish *pGameFish = item.m_pFish;
         if (pGameFish->m_nFishKind > 20 && pGameFish->IsAlive()
-            && IsPointInCenterScreen(pGameFish->GetMyPoint(pConfig)))
+            && IsPointInCenterScreen(CHMPoint(item.m_iPosX, item.m_iPosY)))
         {
             return pGameFish->m_uFishId;
         }
@@ -1293,6 +1372,11 @@ void NFGameFishDesk::CheckFishOverTime()
     {
         m_gameFishMap.erase(vecDel[i]);
     }
+
+    if (!vecDel.empty())
+    {
+        MarkFishGridDirty();
+    }
 }
 
 void NFGameFishDesk::SyncFishes(uint64_t playerId)
@@ -1750,6 +1834,7 @@ gamefish::FishList NFGameFishDesk::GetGroupFishList(vector<NFGameFish> &vecGroup
 
 int NFGameFishDesk::SaveGroupFishes(const std::vector<NFGameFish> &vecGroupFishes)
 {
+    MarkFishGridDirty();
     for (auto iter = vecGroupFishes.begin(); iter != vecGroupFishes.end(); iter++)
     {
         CHECK_EXPR(m_gameFishMap.size() < m_gameFishMap.max_size(), -1, "m_gameFishMap space not enough");
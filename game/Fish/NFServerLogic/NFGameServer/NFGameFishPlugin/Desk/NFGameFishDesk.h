@@ -28,6 +28,21 @@
 #define GAME_FISH_DESK_PLAYER_COUNT 4
 #define GAME_FISH_DESK_FISH_COUNT 1000
 
+//鱼的空间网格, 只收录在屏幕内的鱼, 按格子查询附近的鱼
+#define GAME_FISH_GRID_CELL_SIZE 120
+#define GAME_FISH_GRID_COL ((SCREEN_WIDTH + GAME_FISH_GRID_CELL_SIZE - 1) / GAME_FISH_GRID_CELL_SIZE)
+#define GAME_FISH_GRID_ROW ((SCREEN_HEIGHT + GAME_FISH_GRID_CELL_SIZE - 1) / GAME_FISH_GRID_CELL_SIZE)
+#define GAME_FISH_GRID_CELL_COUNT (GAME_FISH_GRID_COL * GAME_FISH_GRID_ROW)
+//鱼每100毫秒走一个轨迹点, 网格的刷新间隔与之相同
+#define GAME_FISH_GRID_REFRESH_MS 100
+
+struct NFGameFishGridItem
+{
+    NFGameFish *m_pFish;
+    int m_iPosX;
+    int m_iPosY;
+};
+
 class NFGameFishDesk : public NFShmObjTemplate<NFGameFishDesk, EOT_NFGameFishDesk_ID, NFIGameDeskImpl>
 {
 public:
@@ -338,6 +353,24 @@ public:
 
     void SetIsFreezs(bool isfreeze) { m_FishTypeMgr->SetIsFreezs(isfreeze); }
 
+    /**
+     * @brief 重建空间网格, 一次算出所有鱼的当前位置, 按格子做计数排序
+     * @param bForce 为false时, 网格没有变脏且距上次重建不到GAME_FISH_GRID_REFRESH_MS则直接返回
+     */
+    void RefreshFishGrid(bool bForce = false);
+
+    /**
+     * @brief 鱼的增删或冰冻时间变化后调用, 下次查询前重建网格
+     */
+    void MarkFishGridDirty() { m_bFishGridDirty = true; }
+
+private:
+    /**
+     * @brief 只遍历圆形范围覆盖到的格子
+     * @param iKillPercent 小于0表示不做随机筛选
+     */
+    void GetGridFishes(uint8_t nFishKind, CHMPoint ptCenter, int iRadius, int iKillPercent, std::vector<NFGameFish *> &vecFishes);
+
 public:
     int OnHandleFishGameStatus(uint64_t playerId, NFDataPackage &packet);
 
@@ -405,6 +438,12 @@ public:
     uint32_t m_maxFishId;
     NFShmHashMap<uint32_t, NFGameFish, GAME_FISH_DESK_FISH_COUNT> m_gameFishMap;
 
+    //空间网格, 格子cell里的鱼是m_aFishGridItem[m_aFishGridCellStart[cell], m_aFishGridCellStart[cell + 1])
+    bool m_bFishGridDirty;
+    uint64_t m_ullFishGridTime;
+    uint16_t m_aFishGridCellStart[GAME_FISH_GRID_CELL_COUNT + 1];
+    NFGameFishGridItem m_aFishGridItem[GAME_FISH_DESK_FISH_COUNT];
+
     NFShmPtr<NFFishTypeMgr> m_FishTypeMgr;
 
     NFRawShmPtr<CFishWayBill> m_pCurWayBill;
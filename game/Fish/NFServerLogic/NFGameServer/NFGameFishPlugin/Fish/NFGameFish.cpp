@@ -60,7 +60,12 @@ int NFGameFish::ResumeInit()
 
 int NFGameFish::WalkPointCount()
 {
-    int count = (NFTime::Now().UnixMSec() - m_uBirthTime - m_uFreezeTime - m_uBirthDelayMS) / 100;
+    return WalkPointCount(NFTime::Now().UnixMSec());
+}
+
+int NFGameFish::WalkPointCount(uint64_t ullNowMSec)
+{
+    int count = (ullNowMSec - m_uBirthTime - m_uFreezeTime - m_uBirthDelayMS) / 100;
     return count;
 }
 
@@ -79,14 +84,19 @@ int NFGameFish::GetCurBirthDelay()
 
 int NFGameFish::GetMyPointIndex()
 {
-    int walkPointCount = WalkPointCount();
+    return GetMyPointIndex(NFTime::Now().UnixMSec());
+}
+
+int NFGameFish::GetMyPointIndex(uint64_t ullNowMSec)
+{
+    int walkPointCount = WalkPointCount(ullNowMSec);
     if (walkPointCount < 0)
     {
         return m_nStartPointIndex;
     }
     else
     {
-        return m_nStartPointIndex + WalkPointCount();
+        return m_nStartPointIndex + walkPointCount;
     }
 }
 
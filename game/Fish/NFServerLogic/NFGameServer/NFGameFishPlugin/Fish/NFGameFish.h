@@ -177,10 +177,15 @@ public:
 
     int WalkPointCount();
 
+    int WalkPointCount(uint64_t ullNowMSec);
+
     int GetCurBirthDelay();
 
     int GetMyPointIndex();
 
+    //批量计算位置时传入同一个当前时间
+    int GetMyPointIndex(uint64_t ullNowMSec);
+
     CHMPoint GetMyPoint(NFFishTraceConfig* pTraceConfig);
 
     int GetBaseMul()
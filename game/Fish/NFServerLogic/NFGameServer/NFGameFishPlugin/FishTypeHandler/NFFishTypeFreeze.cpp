@@ -155,6 +155,7 @@ int NFFishTypeFreeze::OnTimer(int timeId, int callcount)
                 pGameFish->AddFreezeTime(uFreezeTime);
             }
         }
+        m_pDesk->MarkFishGridDirty();
 
         m_pDesk->SetIsFreezs(false);
     }
@@ -31,12 +31,17 @@ int NFISaveDB::CreateInit()
 {
     m_lastSavingDBTime = 0;
     m_saveDBTimer = INVALID_ID;
+    m_bNeedReloadDB = false;
     return 0;
 }
 
 
 int NFISaveDB::ResumeInit()
 {
+    if (NFShmMgr::Instance()->IsCheckpointRecover())
+    {
+        m_bNeedReloadDB = true;
+    }
     return 0;
 }
 
@@ -57,6 +62,11 @@ int NFISaveDB::SendTransToDB(TRANS_SAVEROLEDETAIL_REASON iReason)
 
 int NFISaveDB::SaveToDB(TRANS_SAVEROLEDETAIL_REASON iReason, bool bForce)
 {
+    if (m_bNeedReloadDB)
+    {
+        return 0;
+    }
+
     if (IsNeedSave())
     {
         if (bForce || NFTime::Now().UnixSec() - m_lastSavingDBTime >= LOGIC_SERVER_SAVE_PLAYER_TO_DB_TIME)
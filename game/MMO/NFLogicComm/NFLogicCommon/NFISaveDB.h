@@ -41,6 +41,12 @@ public:
 
     virtual bool IsNeedSave();
 
+    /**
+     * @brief shm recover from checkpoint, data may be older than db, must reload from db before save
+     * @return
+     */
+    bool IsNeedReloadDB() const { return m_bNeedReloadDB; }
+
     /**
      * @brief
      * @param iReason
@@ -77,4 +83,5 @@ public:
 protected:
     uint64_t m_lastSavingDBTime;
     int m_saveDBTimer;
+    bool m_bNeedReloadDB;
 };
\ No newline at end of file
@@ -556,6 +556,7 @@ int NFBattlePlayer::OnDisconnect()
 {
     m_proxyId = 0;
     SetPlayerStatus(proto_ff::PLAYER_STATUS_OFFLINE);
+    RefreshBroadTarget();
     SetLastDiconnectTime(NFTime::Now().UnixSec());
     
     StopMove();
@@ -681,90 +681,67 @@ int NFCreature::BroadCast(uint32_t nMsgId, const google::protobuf::Message &xDat
         return -1;
     }
 
-    MAP_UINT32_MAP_UINT32_SET_UINT64 mapZidGateRoleId;
-    uint64_t uid = 0;
-    uint32_t gateId = 0;
-    uint32_t zid = 0;
-
-    //MAP_UINT32_LST_UINT32 gateClientsMap;
-    if (IncludeMyself && m_kind == CREATURE_PLAYER)
+    const auto& broadTarget = m_visionData.GetBroadTarget();
+    bool bSendMyself = IncludeMyself && m_kind == CREATURE_PLAYER && GetProxyId() > 0;
+    if (broadTarget.empty() && !bSendMyself)
     {
-        zid = GetZid();
-        gateId = GetProxyId();
-        uid = GetUid();
-        if (gateId > 0)
-            mapZidGateRoleId[zid][gateId].insert(uid);
+        return 0;
     }
 
-    if (Kind() == CREATURE_PLAYER)
+    //消息只序列化一次, 所有网关共用同一份数据
+    NF_SHARE_PTR<std::string> pData = std::make_shared<std::string>();
+    xData.SerializePartialToString(pData.get());
+
+    NFIServerMessageModule* pMessageModule = FindModule<NFIServerMessageModule>();
+    std::vector<uint64_t> vecUid;
+    if (bSendMyself)
     {
-        for (auto iter = m_visionData.m_doublePVPSeeLst.begin(); iter != m_visionData.m_doublePVPSeeLst.end(); iter++)
-        {
-            NFCreatureVisionDataNode *pData = &(*iter);
-            if (pData)
-            {
-                NFScene* pScene = GetScene();
-                if (nullptr != pScene)
-                {
-                    NFCreature* pCreature = NFCreatureMgr::Instance(m_pObjPluginManager)->GetCreature(pData->creatureCid);
-                    if (nullptr != pCreature && pCreature->Kind() == CREATURE_PLAYER)
-                    {
-                        NFBattlePlayer *pPlayer = dynamic_cast<NFBattlePlayer *>(pCreature);
-                        if (pPlayer && pPlayer->IsCanSendMessage())
-                        {
-                            zid = pPlayer->GetZid();
-                            gateId = pPlayer->GetProxyId();
-                            uid= pPlayer->GetUid();
-                            if (gateId > 0)
-                                mapZidGateRoleId[zid][gateId].insert(uid);
-                        }
-                    }
-                }
-            }
-        }
+        vecUid.push_back(GetUid());
+        pMessageModule->AddRedirectMsgToProxyServer(NF_ST_GAME_SERVER, GetProxyId(), vecUid, nMsgId, pData);
+        vecUid.clear();
     }
-    else
+
+    //广播目标按(zid, gateId)排好序, 同一个网关的玩家是连续的
+    for (size_t i = 0; i < broadTarget.size();)
     {
-        for (auto iter = m_visionData.m_doublePVMSeeLst.begin(); iter != m_visionData.m_doublePVMSeeLst.end(); iter++)
+        uint32_t gateId = broadTarget[i].gateId;
+        size_t j = i;
+        for (; j < broadTarget.size() && broadTarget[j].zid == broadTarget[i].zid && broadTarget[j].gateId == gateId; ++j)
         {
-            NFCreatureVisionDataNode *pData = &(*iter);
-            if (pData)
-            {
-                NFScene* pScene = GetScene();
-                if (nullptr != pScene)
-                {
-                    NFCreature* pCreature = NFCreatureMgr::Instance(m_pObjPluginManager)->GetCreature(pData->creatureCid);
-                    if (nullptr != pCreature)
-                    {
-                        NFBattlePlayer *pPlayer = dynamic_cast<NFBattlePlayer *>(pCreature);
-                        if (pPlayer && pPlayer->IsCanSendMessage())
-                        {
-                            zid = pPlayer->GetZid();
-                            gateId = pPlayer->GetProxyId();
-                            uid = pPlayer->GetUid();
-                            if (gateId > 0)
-                                mapZidGateRoleId[zid][gateId].insert(uid);
-                        }
-                    }
-                }
-            }
+            vecUid.push_back(broadTarget[j].uid);
         }
+
+        pMessageModule->AddRedirectMsgToProxyServer(NF_ST_GAME_SERVER, gateId, vecUid, nMsgId, pData);
+        vecUid.clear();
+        i = j;
     }
 
-    if (mapZidGateRoleId.empty())
+    return 0;
+}
+
+//自己的网关或在线状态变化后, 刷新能看到自己的生物缓存的广播目标
+void NFCreature::RefreshBroadTarget()
+{
+    //视野列表是对称的, 自己列表里的生物就是能看到自己的生物
+    for (auto iter = m_visionData.m_doublePVPSeeLst.begin(); iter != m_visionData.m_doublePVPSeeLst.end(); iter++)
     {
-        return 0;
+        NFCreature* pCreature = NFCreatureMgr::Instance(m_pObjPluginManager)->GetCreature(iter->creatureCid);
+        if (pCreature)
+        {
+            pCreature->GetVisionData().DelBroadTarget(Cid());
+            pCreature->GetVisionData().AddBroadTarget(this);
+        }
     }
 
-    for (auto &iter: mapZidGateRoleId)
+    for (auto iter = m_visionData.m_doublePVMSeeLst.begin(); iter != m_visionData.m_doublePVMSeeLst.end(); iter++)
     {
-        for (auto &itergate: iter.second)
+        NFCreature* pCreature = NFCreatureMgr::Instance(m_pObjPluginManager)->GetCreature(iter->creatureCid);
+        if (pCreature)
         {
-            SendRedirectMsgToClient(iter.first, itergate.first, itergate.second, nMsgId, xData);
+            pCreature->GetVisionData().DelBroadTarget(Cid());
+            pCreature->GetVisionData().AddBroadTarget(this);
         }
     }
-
-    return 0;
 }
 
 int NFCreature::SendRedirectMsgToClient(uint32_t zid, uint32_t gateId, const std::unordered_set<uint64_t>& set, uint32_t nMsgId, const google::protobuf::Message &xData)
@@ -1573,6 +1550,8 @@ void NFCreature::NoticeNineGridLeave()
             continue;
         }
     }
+
+    m_visionData.ClearBroadTarget();
 }
 
 //是否可以添加新看到的生物
@@ -315,6 +315,9 @@ public:
     void SendAllSeeCreatureListToClient();
     
     void NoticeNineGridLeave();
+    
+    //自己的网关或在线状态变化后, 刷新能看到自己的生物缓存的广播目标
+    void RefreshBroadTarget();
 
 public:
     //判断是否能发送消息
@@ -9,6 +9,8 @@
 
 #include "NFCreatureVisionData.h"
 #include "NFCreature.h"
+#include "NFLogicCommon/NFSceneDefine.h"
+#include <algorithm>
 
 NFCreatureVisionDataNode::NFCreatureVisionDataNode()
 {
@@ -77,6 +79,7 @@ int NFCreatureVisionData::AddPVPSeeList(NFCreature *pCreature)
 
     iter->creatureCid = pCreature->Cid();
     NF_ASSERT(iter.m_node);
+    AddBroadTarget(pCreature);
     return iter.m_node->m_self;
 }
 
@@ -91,6 +94,7 @@ int NFCreatureVisionData::AddPVMSeeList(NFCreature *pCreature)
 
     iter->creatureCid = pCreature->Cid();
     NF_ASSERT(iter.m_node);
+    AddBroadTarget(pCreature);
     return iter.m_node->m_self;
 }
 
@@ -99,6 +103,10 @@ bool NFCreatureVisionData::DelPVMSeeList(int pos)
     if (pos >= 0)
     {
         auto iter = m_doublePVMSeeLst.GetIterator(pos);
+        if (iter != m_doublePVMSeeLst.end())
+        {
+            DelBroadTarget(iter->creatureCid);
+        }
         m_doublePVMSeeLst.erase(iter);
         return true;
     }
@@ -110,8 +118,49 @@ bool NFCreatureVisionData::DelPVPSeeList(int pos)
     if (pos >= 0)
     {
         auto iter = m_doublePVPSeeLst.GetIterator(pos);
+        if (iter != m_doublePVPSeeLst.end())
+        {
+            DelBroadTarget(iter->creatureCid);
+        }
         m_doublePVPSeeLst.erase(iter);
         return true;
     }
     return false;
 }
+
+void NFCreatureVisionData::AddBroadTarget(NFCreature* pCreature)
+{
+    if (pCreature == NULL || pCreature->Kind() != CREATURE_PLAYER || !pCreature->IsCanSendMessage() || pCreature->GetProxyId() == 0)
+    {
+        return;
+    }
+
+    CHECK_EXPR_RE_VOID(!m_broadTarget.full(), "broad target full, cid:{}", pCreature->Cid());
+
+    NFCreatureBroadTarget target;
+    target.cid = pCreature->Cid();
+    target.uid = pCreature->GetUid();
+    target.zid = pCreature->GetZid();
+    target.gateId = pCreature->GetProxyId();
+
+    //插到同网关的最后, 保持按网关分组
+    auto iter = std::upper_bound(m_broadTarget.begin(), m_broadTarget.end(), target);
+    m_broadTarget.insert(iter, target);
+}
+
+void NFCreatureVisionData::DelBroadTarget(uint64_t cid)
+{
+    for (auto iter = m_broadTarget.begin(); iter != m_broadTarget.end(); ++iter)
+    {
+        if (iter->cid == cid)
+        {
+            m_broadTarget.erase(iter);
+            return;
+        }
+    }
+}
+
+void NFCreatureVisionData::ClearBroadTarget()
+{
+    m_broadTarget.clear();
+}
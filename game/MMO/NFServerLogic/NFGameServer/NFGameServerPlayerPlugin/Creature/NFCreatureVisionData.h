@@ -15,6 +15,7 @@
 #include "NFComm/NFShmCore/NFISharedMemModule.h"
 #include "NFComm/NFShmCore/NFShmPtr.h"
 #include "NFComm/NFShmStl/NFShmList.h"
+#include "NFComm/NFShmStl/NFShmVector.h"
 
 class NFCreature;
 
@@ -67,6 +68,26 @@ public:
     int nMeInHisVisionPos;
 };
 
+//广播目标, 视野里可以收消息的玩家
+class NFCreatureBroadTarget
+{
+public:
+    NFCreatureBroadTarget() : cid(0), uid(0), zid(0), gateId(0)
+    {
+    }
+
+    bool operator<(const NFCreatureBroadTarget& other) const
+    {
+        if (zid != other.zid) return zid < other.zid;
+        return gateId < other.gateId;
+    }
+
+    uint64_t cid;
+    uint64_t uid;
+    uint32_t zid;
+    uint32_t gateId;
+};
+
 class NFCreatureVisionData
 {
 public:
@@ -82,8 +103,19 @@ public:
     int AddPVMSeeList(NFCreature* pCreature);
     bool DelPVMSeeList(int pos);
     bool DelPVPSeeList(int pos);
+public:
+    /**
+     * @brief 看见列表增删时同步更新, 按(zid, gateId)排序, 同一个网关的玩家连续存放, 广播时不用再查找生物
+     * @param pCreature 不是玩家或者不能收消息时不加入
+     */
+    void AddBroadTarget(NFCreature* pCreature);
+    void DelBroadTarget(uint64_t cid);
+    void ClearBroadTarget();
+    const NFShmVector<NFCreatureBroadTarget, MAX_SEE_CREATURE_COUNT_IN_THE_VISION * 2>& GetBroadTarget() const { return m_broadTarget; }
 public:
     NFShmList<NFCreatureVisionDataNode, MAX_SEE_CREATURE_COUNT_IN_THE_VISION>	m_doublePVPSeeLst;								//人和人的视野处理
     NFShmList<NFCreatureVisionDataNode, MAX_SEE_CREATURE_COUNT_IN_THE_VISION>	m_doublePVMSeeLst;								//这里只处理人和其他非人生物之间的视野管理， 怪物或NPC必须所有人都能看到
     int8_t	chVisionUnitType;		//用于记录此角色视野单元在进入别人视野处理的标记
+private:
+    NFShmVector<NFCreatureBroadTarget, MAX_SEE_CREATURE_COUNT_IN_THE_VISION * 2> m_broadTarget; //两个看见列表里可以收消息的玩家, 24字节*200, 每个生物多占约4.8KB共享内存
 };
\ No newline at end of file
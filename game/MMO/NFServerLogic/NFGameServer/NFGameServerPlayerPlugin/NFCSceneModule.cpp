@@ -126,6 +126,7 @@ int NFCSceneModule::OnRpcServiceEnterScene(proto_ff::EnterSceneReq &request, pro
     
     pPlayer->Init(request.proxy_id(), request.logic_id(), request.world_id(), request.sns_id(), request.data());
     pPlayer->SetPlayerStatus(proto_ff::PLAYER_STATUS_ONLINE);
+    pPlayer->RefreshBroadTarget();
     
     proto_ff::SceneTransParam transParam;
     transParam.set_trans_type(request.trans_type());
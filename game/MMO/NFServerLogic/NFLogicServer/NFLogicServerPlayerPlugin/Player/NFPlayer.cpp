@@ -467,6 +467,8 @@ bool NFPlayer::IsNeedSave()
 
 int NFPlayer::SendTransToDB(TRANS_SAVEROLEDETAIL_REASON iReason)
 {
+    CHECK_EXPR(!IsNeedReloadDB(), -1, "player:{} recover from checkpoint, need reload from db before save", m_cid);
+
     NFTransSaveDB* pSave = (NFTransSaveDB*)FindModule<NFISharedMemModule>()->CreateTrans(EOT_TRANS_SAVE_PLAYER);
     CHECK_EXPR(pSave, -1, "Create Trans:NFTransSaveDB Failed! ");
     
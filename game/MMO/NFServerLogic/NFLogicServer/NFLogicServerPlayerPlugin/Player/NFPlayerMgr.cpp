@@ -11,6 +11,7 @@
 #include "NFPlayer.h"
 #include "NFLogicCommon/NFLogicShmTypeDefines.h"
 #include "NFComm/NFPluginModule/NFError.h"
+#include "NFComm/NFPluginModule/NFICoroutineModule.h"
 #include <map>
 
 NFPlayerMgr::NFPlayerMgr() {
@@ -77,6 +78,11 @@ int NFPlayerMgr::Tick()
         {
             willRemovePlayer.push_back(pPlayer->GetCid());
         }
+        // 共享内存从镜像恢复的玩家比DB旧, 不能存盘, 直接删掉, 下次登录重新从DB加载
+        else if (pPlayer->IsNeedReloadDB() && !FindModule<NFICoroutineModule>()->IsExistUserCo(pPlayer->GetCid()))
+        {
+            willRemovePlayer.push_back(pPlayer->GetCid());
+        }
     }
 
     for(int i = 0; i < (int)willRemovePlayer.size(); i++)
@@ -12,6 +12,7 @@
 #include "NFLogicCommon/NFLogicCommon.h"
 #include "Login.pb.h"
 #include "ServerInternalCmd.pb.h"
+#include <google/protobuf/io/coded_stream.h>
 
 NFCProxyPlayerModule::NFCProxyPlayerModule(NFIPluginManager *p) : NFMMODynamicModule(p)
 {
@@ -487,9 +488,42 @@ int NFCProxyPlayerModule::OnHandleOtherServerToClientMsg(uint64_t unLinkId, NFDa
 
 int NFCProxyPlayerModule::OnHandleRedirectMsg(uint64_t unLinkId, NFDataPackage &packet)
 {
+    if (packet.nParam1 == 0)
+    {
+        proto_ff::Proto_SvrPkg xMsg;
+        CLIENT_MSG_PROCESS_WITH_PRINTF(packet, xMsg);
+        return HandleRedirectSvrPkg(unLinkId, packet, xMsg);
+    }
+
+    //合包格式, nParam1是消息个数, 包体是连续的(varint长度 + Proto_SvrPkg)
+    google::protobuf::io::CodedInputStream input(reinterpret_cast<const uint8_t*>(packet.GetBuffer()), static_cast<int>(packet.GetSize()));
     proto_ff::Proto_SvrPkg xMsg;
-    CLIENT_MSG_PROCESS_WITH_PRINTF(packet, xMsg);
+    for (uint64_t i = 0; i < packet.nParam1; i++)
+    {
+        uint32_t pkgSize = 0;
+        if (!input.ReadVarint32(&pkgSize))
+        {
+            NFLogError(NF_LOG_SYSTEMLOG, 0, "read redirect batch pkg size failed, index:{} packet:{}", i, packet.ToString());
+            return -1;
+        }
+
+        google::protobuf::io::CodedInputStream::Limit limit = input.PushLimit(static_cast<int>(pkgSize));
+        xMsg.Clear();
+        if (!xMsg.ParseFromCodedStream(&input) || !input.ConsumedEntireMessage())
+        {
+            NFLogError(NF_LOG_SYSTEMLOG, 0, "parse redirect batch pkg failed, index:{} packet:{}", i, packet.ToString());
+            return -1;
+        }
+        input.PopLimit(limit);
+
+        HandleRedirectSvrPkg(unLinkId, packet, xMsg);
+    }
 
+    return 0;
+}
+
+int NFCProxyPlayerModule::HandleRedirectSvrPkg(uint64_t unLinkId, NFDataPackage &packet, const proto_ff::Proto_SvrPkg &xMsg)
+{
     const ::proto_ff::Proto_RedirectInfo &redirectInfo = xMsg.redirect_info();
     if (redirectInfo.all() == false)
     {
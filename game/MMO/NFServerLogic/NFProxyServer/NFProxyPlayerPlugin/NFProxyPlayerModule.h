@@ -85,6 +85,8 @@ public:
     int OnHandleOtherServerToClientMsg(uint64_t unLinkId, NFDataPackage &packet);
 public:
     int OnHandleRedirectMsg(uint64_t unLinkId, NFDataPackage &packet);
+    //把一个转发包发给包里指定的玩家
+    int HandleRedirectSvrPkg(uint64_t unLinkId, NFDataPackage &packet, const proto_ff::Proto_SvrPkg &xMsg);
     int OnHandleNotifyPlayerEnterServer(uint64_t unLinkId, NFDataPackage &packet);
 public:
     /*
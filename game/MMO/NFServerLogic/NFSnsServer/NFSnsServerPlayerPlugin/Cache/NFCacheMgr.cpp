@@ -233,7 +233,14 @@ int NFCacheMgr::ReleaseDetailCount(int num)
 
 NFPlayerDetail *NFCacheMgr::GetPlayerDetail(uint64_t cid)
 {
-    return NFPlayerDetail::GetObjByHashKey(m_pObjPluginManager, cid);
+    NFPlayerDetail *pRoleDetail = NFPlayerDetail::GetObjByHashKey(m_pObjPluginManager, cid);
+    //shm recover from checkpoint, drop the old detail and load it from db again
+    if (pRoleDetail && pRoleDetail->IsNeedReloadDB() && !FindModule<NFICoroutineModule>()->IsExistUserCo(cid))
+    {
+        DeletePlayerDetail(pRoleDetail);
+        return NULL;
+    }
+    return pRoleDetail;
 }
 
 NFPlayerDetail *NFCacheMgr::CreatePlayerDetail(uint64_t cid)
@@ -372,6 +372,8 @@ bool NFPlayerDetail::IsNeedSave()
 
 int NFPlayerDetail::SendTransToDB(TRANS_SAVEROLEDETAIL_REASON iReason)
 {
+    CHECK_EXPR(!IsNeedReloadDB(), -1, "player detail:{} recover from checkpoint, need reload from db before save", m_cid);
+
     NFSnsTransSaveDetailDB* pSave = (NFSnsTransSaveDetailDB *)FindModule<NFISharedMemModule>()->CreateTrans(EOT_SNS_TRANS_SAVE_PLAYER_DETAIL);
     CHECK_EXPR(pSave, -1, "Create Trans:NFTransSaveDB Failed! ");
 
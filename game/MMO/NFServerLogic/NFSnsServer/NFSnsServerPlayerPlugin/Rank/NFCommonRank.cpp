@@ -138,7 +138,7 @@ void NFCommonRank::TryToAddNewNode(uint64_t charID, uint64_t nValue, const std::
     auto insert_iter = m_rankData.insert(std::make_pair(nValue, tNode));
     //ѯ
     m_cidInRank.insert(std::make_pair(charID, insert_iter));
-    MarkDirty();
+    MarkDirty(SEQOP_FIELD_MASK(proto_ff::tbSnsRank::kDataFieldNumber));
 }
 
 void NFCommonRank::UpdateNodeData(uint64_t charID, uint64_t nValue, const std::vector<int64_t>& paramIntVec, const std::vector<string>& paramStrVec)
@@ -169,7 +169,7 @@ bool NFCommonRank::DeleteNode(uint64_t cid)
     }
     //ɾѯ
     m_cidInRank.erase(cid);
-    MarkDirty();
+    MarkDirty(SEQOP_FIELD_MASK(proto_ff::tbSnsRank::kDataFieldNumber));
     return true;
 }
 
@@ -200,6 +200,16 @@ bool NFCommonRank::UpdateNode(uint64_t charID, uint64_t nValue, const std::vecto
     return true;
 }
 
+uint32_t NFCommonRank::GetRank(uint64_t cid)
+{
+    auto iter = m_cidInRank.find(cid);
+    if (iter == m_cidInRank.end())
+    {
+        return 0;
+    }
+    return m_rankData.RankOf(iter->second) + 1;
+}
+
 NFCommonRank::MapRankNode* NFCommonRank::GetNodeList()
 {
     return &m_rankData;
@@ -114,6 +114,8 @@ public:
     MapRankNode* GetNodeList();
     //ɾڵ
     bool DeleteNode(uint64_t cid);
+    //ȡΣ1ʼڰϷ0
+    uint32_t GetRank(uint64_t cid);
 protected:
     //ȡһֵ
     uint64_t GetLowestValue();
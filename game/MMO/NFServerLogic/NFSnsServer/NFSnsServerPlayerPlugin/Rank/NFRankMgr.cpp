@@ -132,12 +132,19 @@ int NFRankMgr::SendRankData(uint32_t nType, uint64_t charID, uint64_t selfValue,
     uint32_t nRank = 1;
     std::set<uint64_t> needDelete;
 
+    //Լڰϵλֱ, O(log n), ڱȽ
+    uint64_t selfId = nType == RANK_TYPE_GUILD ? unionId : charID;
+    uint32_t nSelfTreeRank = pRank->GetRank(selfId);
+    uint32_t nStaleBeforeSelf = 0; //Լǰ, ҪɾЧڵ
+    uint32_t nTreeRank = 0;
+
     for (auto iter = pRankData->begin(); iter != pRankData->end(); ++iter)
     {
         if (nRank > RANK_MAX_SIZE)
         {
             break;
         }
+        ++nTreeRank;
         //ýڵ
         if (nType == RANK_TYPE_GUILD)
         {
@@ -146,15 +153,14 @@ int NFRankMgr::SendRankData(uint32_t nType, uint64_t charID, uint64_t selfValue,
             if (nullptr == pUnion)
             {
                 needDelete.insert(iter->second.m_cid);
+                if (nTreeRank < nSelfTreeRank)
+                {
+                    ++nStaleBeforeSelf;
+                }
                 NFLogError(NF_LOG_SYSTEMLOG, charID, "[center] RankManager::SendRankData pUnion is nil delete from rank.....unionId:{}", iter->second.m_cid);
                 continue;
             }
 
-            if (iter->second.m_cid == unionId)
-            {
-                rankInfo->set_selfrank(nRank);
-            }
-
             auto pRankNode = rankInfo->add_ranklist();
             //Ƿ
             auto pLeaderCharacterData = NFCacheMgr::Instance(m_pObjPluginManager)->QueryPlayerSimpleByRpc(charID, pUnion->LeaderCid());
@@ -177,13 +183,13 @@ int NFRankMgr::SendRankData(uint32_t nType, uint64_t charID, uint64_t selfValue,
             if (nullptr == pOfflineCharacterData)
             {
                 needDelete.insert(iter->second.m_cid);
+                if (nTreeRank < nSelfTreeRank)
+                {
+                    ++nStaleBeforeSelf;
+                }
                 NFLogError(NF_LOG_SYSTEMLOG, charID, "[center] RankManager::SendRankData pOfflineCharacterData is nil delete from rank.....charID:%lu", iter->second.m_cid);
                 continue;
             }
-            if (iter->second.m_cid == charID)
-            {
-                rankInfo->set_selfrank(nRank);
-            }
             auto pRankNode = rankInfo->add_ranklist();
             pRankNode->set_online(pOfflineCharacterData->IsOnline());
             if (nRank == 1)
@@ -196,6 +202,12 @@ int NFRankMgr::SendRankData(uint32_t nType, uint64_t charID, uint64_t selfValue,
         }
         ++nRank;
     }
+
+    //ֻʾǰRANK_MAX_SIZE, ȥǰЧڵ
+    if (nSelfTreeRank > 0 && nSelfTreeRank <= nTreeRank)
+    {
+        rankInfo->set_selfrank(nSelfTreeRank - nStaleBeforeSelf);
+    }
     //Լ
     auto pSelfNode = rankInfo->mutable_selfdata();
     SetRankNodeProtoByCharId(pSelfNode, nType, rankInfo->selfrank(), charID, selfValue);
@@ -25,6 +25,9 @@
 #include "NFComm/NFPluginModule/NFIMemMngModule.h"
 #include "NFComm/NFPluginModule/NFIMessageModule.h"
 #include "NFServerComm/NFServerCommon/NFIServerMessageModule.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <thread>
 
 
 NFCDescStoreModule::NFCDescStoreModule(NFIPluginManager* p) : NFIDescStoreModule(p)
@@ -360,6 +363,18 @@ int NFCDescStoreModule::LoadAllFileDescStore()
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
 
+    int64_t startTime = NFGetTime();
+    std::vector<NFIDescStore*> vecDescStore;
+    for (int i = 0; i < (int)mDescStoreRegisterList.size(); i++)
+    {
+        NFIDescStore* pDescStore = mDescStoreMap[mDescStoreRegisterList[i]];
+        assert(pDescStore);
+        vecDescStore.push_back(pDescStore);
+    }
+
+    // 文件读取和protobuf解析在工作线程中并行, 写入共享内存仍然在主线程按注册顺序进行
+    int threadNum = PrefetchFileDescStore(vecDescStore, false);
+
     for (int i = 0; i < (int)mDescStoreRegisterList.size(); i++)
     {
         const std::string& name = mDescStoreRegisterList[i];
@@ -368,17 +383,86 @@ int NFCDescStoreModule::LoadAllFileDescStore()
 
         NFLogTrace(NF_LOG_DEFAULT, 0, "Desc Store Begin Load:{}", pDescStore->GetFileName());
 
+        int64_t loadTime = NFGetTime();
         pDescStore->SetLoaded(false);
         pDescStore->SetChecked(false);
         pDescStore->SetDBLoaded(true);
         int ret = LoadFileDescStore(pDescStore);
         NF_ASSERT_MSG(ret == 0, "Load Desc Store:" + pDescStore->GetFileName() + " Failed!");
-        NFLogTrace(NF_LOG_DEFAULT, 0, "Desc Store Load:{} Sucess", pDescStore->GetFileName());
+        NFLogInfo(NF_LOG_DEFAULT, 0, "Desc Store Load:{} Sucess, parse:{}ms load:{}ms", pDescStore->GetFileName(), GetPrefetchCost(pDescStore),
+                  NFGetTime() - loadTime);
     }
+
+    ClearPrefetch();
+    NFLogInfo(NF_LOG_DEFAULT, 0, "Load All Desc Store:{} thread:{} cost:{}ms", mDescStoreRegisterList.size(), threadNum, NFGetTime() - startTime);
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
     return 0;
 }
 
+int NFCDescStoreModule::PrefetchFileDescStore(const std::vector<NFIDescStore*>& vecDescStore, bool bReload)
+{
+    NFFileResDB* pFileResDB = dynamic_cast<NFFileResDB*>(m_pResFileDB);
+    CHECK_EXPR(pFileResDB, 0, "m_pResFileDB is not NFFileResDB");
+
+    // 上一次加载失败时可能有没有取用的结果
+    pFileResDB->ClearPrefetch();
+
+    for (int i = 0; i < (int)vecDescStore.size(); i++)
+    {
+        NFIDescStore* pDescStore = vecDescStore[i];
+        std::string msgName = pDescStore->GetTableMsgName();
+        if (msgName.empty())
+        {
+            continue;
+        }
+
+        const google::protobuf::Descriptor* pDescriptor = google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(msgName);
+        if (pDescriptor == NULL)
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "Desc Store:{} table msg:{} not find, load in main thread", pDescStore->GetFileName(), msgName);
+            continue;
+        }
+
+        const google::protobuf::Message* pPrototype = google::protobuf::MessageFactory::generated_factory()->GetPrototype(pDescriptor);
+        CHECK_EXPR_CONTINUE(pPrototype, "Desc Store:{} table msg:{} GetPrototype Failed", pDescStore->GetFileName(), msgName);
+
+        pFileResDB->AddPrefetch(pDescStore->GetFileName(), pPrototype, bReload ? pDescStore->GetFileMD5() : std::string());
+    }
+
+    int threadNum = static_cast<int>(std::thread::hardware_concurrency());
+    if (threadNum > DESC_STORE_LOAD_THREAD_MAX)
+    {
+        threadNum = DESC_STORE_LOAD_THREAD_MAX;
+    }
+    if (threadNum <= 0)
+    {
+        threadNum = 1;
+    }
+
+    int failedNum = pFileResDB->RunPrefetch(threadNum);
+    NFLogErrorIf(failedNum > 0, NF_LOG_DEFAULT, 0, "Prefetch Desc Store Failed Num:{}", failedNum);
+    return threadNum;
+}
+
+uint64_t NFCDescStoreModule::GetPrefetchCost(NFIDescStore* pDescStore)
+{
+    NFFileResDB* pFileResDB = dynamic_cast<NFFileResDB*>(m_pResFileDB);
+    if (pFileResDB == NULL)
+    {
+        return 0;
+    }
+    return pFileResDB->GetPrefetchCost(pDescStore->GetFileName());
+}
+
+void NFCDescStoreModule::ClearPrefetch()
+{
+    NFFileResDB* pFileResDB = dynamic_cast<NFFileResDB*>(m_pResFileDB);
+    if (pFileResDB)
+    {
+        pFileResDB->ClearPrefetch();
+    }
+}
+
 bool NFCDescStoreModule::HasDBDescStore()
 {
     for (auto iter = mDescStoreMap.begin(); iter != mDescStoreMap.end(); iter++)
@@ -473,6 +557,18 @@ int NFCDescStoreModule::ReLoadFileDescStore(NFIDescStore* pDescStore)
 
 int NFCDescStoreModule::ReLoadFileDescStore()
 {
+    int64_t startTime = NFGetTime();
+    std::vector<NFIDescStore*> vecDescStore;
+    for (int i = 0; i < (int)mDescStoreRegisterList.size(); i++)
+    {
+        NFIDescStore* pDescStore = mDescStoreMap[mDescStoreRegisterList[i]];
+        assert(pDescStore);
+        vecDescStore.push_back(pDescStore);
+    }
+
+    // 工作线程中计算所有文件的md5, 只解析有变化的文件
+    int threadNum = PrefetchFileDescStore(vecDescStore, true);
+
     for (int i = 0; i < (int)mDescStoreRegisterList.size(); i++)
     {
         const std::string& name = mDescStoreRegisterList[i];
@@ -483,6 +579,9 @@ int NFCDescStoreModule::ReLoadFileDescStore()
         CHECK_EXPR_ASSERT(ret == 0, ret, "ReLoad Desc Store Failed!");
     }
 
+    ClearPrefetch();
+    NFLogInfo(NF_LOG_DEFAULT, 0, "ReLoad All Desc Store:{} thread:{} cost:{}ms", mDescStoreRegisterList.size(), threadNum, NFGetTime() - startTime);
+
     for (int i = 0; i < (int)mDescStoreRegisterList.size(); i++)
     {
         const std::string& name = mDescStoreRegisterList[i];
@@ -648,6 +747,12 @@ int NFCDescStoreModule::GetFileContainMD5(const std::string& strFileName, std::s
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
 
+    NFFileResDB* pFileResDB = dynamic_cast<NFFileResDB*>(m_pResFileDB);
+    if (pFileResDB && pFileResDB->GetPrefetchMD5(strFileName, fileMd5))
+    {
+        return 0;
+    }
+
     bool exist = NFFileUtility::IsFileExist(strFileName);
     CHECK_EXPR(exist, -1, "strFileName:{} not exist", strFileName);
 
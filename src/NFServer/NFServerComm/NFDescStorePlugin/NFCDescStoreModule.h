@@ -96,6 +96,16 @@ public:
 	virtual bool IsAllDescStoreDBLoaded() override;
 
     virtual int LoadAllFileDescStore();
+
+    /**
+     * @brief 在工作线程中并行读取解析配置表文件, 结果在LoadFileDescStore/ReLoadFileDescStore中取用
+     * @param vecDescStore 需要加载的配置表
+     * @param bReload 重载时只解析md5有变化的文件
+     * @return 使用的线程数
+     */
+    int PrefetchFileDescStore(const std::vector<NFIDescStore*>& vecDescStore, bool bReload);
+    uint64_t GetPrefetchCost(NFIDescStore* pDescStore);
+    void ClearPrefetch();
     virtual int LoadDB();
 	virtual int Reload();
 
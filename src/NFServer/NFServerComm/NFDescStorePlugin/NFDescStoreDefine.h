@@ -13,6 +13,9 @@
 
 const int MAX_ITEM_HASH_NUM = 8887;
 
+//加载配置表时读取解析文件的最大线程数
+#define DESC_STORE_LOAD_THREAD_MAX 16
+
 enum {
 	MAX_ITEM_DESC_ID_VALUE = 100000,
 };
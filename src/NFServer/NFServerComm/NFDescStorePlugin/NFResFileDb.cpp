@@ -11,8 +11,12 @@
 #include "NFComm/NFPluginModule/NFLogMgr.h"
 #include "NFComm/NFPluginModule/NFCheck.h"
 #include "NFComm/NFPluginModule/NFIMessageModule.h"
+#include <atomic>
 #include <fstream>
+#include <sstream>
+#include <thread>
 #include "NFComm/NFCore/NFCommon.h"
+#include "NFComm/NFCore/NFMD5.h"
 
 NFFileResTable::NFFileResTable(NFIPluginManager* p, NFFileResDB* pFileResDB, const std::string& name):NFResTable(p)
 {
@@ -24,6 +28,13 @@ int NFFileResTable::FindAllRecord(const std::string &gamePath, google::protobuf:
 {
     CHECK_EXPR(pMessage, -1, "pMessage == NULL");
 
+    int iRet = m_pFileResDB->TakePrefetch(m_name, pMessage);
+    if (iRet <= 0)
+    {
+        CHECK_EXPR(iRet == 0, -1, "prefetch parse error, table:{}", m_name);
+        return 0;
+    }
+
     std::string szFileName = m_pFileResDB->GetPath() + "/" + m_name + ".bin";
     std::fstream input(szFileName.c_str(), std::ios::in | std::ios::binary);
     bool ok = pMessage->ParseFromIstream(&input);
@@ -69,4 +80,137 @@ NFResTable *NFFileResDB::GetTable(const std::string &name) {
     NFFileResTable *pTable = new NFFileResTable(m_pObjPluginManager, this, name);
     m_tablesMap.emplace(name, pTable);
     return pTable;
-}
\ No newline at end of file
+}
+void NFFileResDB::AddPrefetch(const std::string& name, const google::protobuf::Message* pPrototype, const std::string& oldMd5)
+{
+    CHECK_EXPR_RE_VOID(pPrototype, "pPrototype == NULL, table:{}", name);
+    CHECK_EXPR_RE_VOID(m_prefetchMap.find(name) == m_prefetchMap.end(), "table:{} prefetch exist", name);
+
+    auto pPrefetch = new NFFileResPrefetch();
+    pPrefetch->m_name = name;
+    pPrefetch->m_filePath = m_szResFilePath + "/" + name + ".bin";
+    pPrefetch->m_oldMd5 = oldMd5;
+    pPrefetch->m_pMessage.reset(pPrototype->New());
+    m_prefetchList.push_back(pPrefetch);
+    m_prefetchMap.emplace(name, pPrefetch);
+    m_prefetchFileMap.emplace(pPrefetch->m_filePath, pPrefetch);
+}
+
+void NFFileResDB::PrefetchOne(NFFileResPrefetch* pPrefetch)
+{
+    int64_t startTime = NFGetTime();
+    std::ifstream input(pPrefetch->m_filePath.c_str(), std::ios::in | std::ios::binary);
+    if (input)
+    {
+        std::stringstream content;
+        content << input.rdbuf();
+        std::string data = content.str();
+        pPrefetch->m_md5 = NFMD5::md5str(data);
+        if (pPrefetch->m_oldMd5.empty() || pPrefetch->m_oldMd5 != pPrefetch->m_md5)
+        {
+            pPrefetch->m_parsed = true;
+            pPrefetch->m_ok = pPrefetch->m_pMessage->ParseFromString(data);
+        }
+    }
+    pPrefetch->m_costMs = NFGetTime() - startTime;
+}
+
+int NFFileResDB::RunPrefetch(int threadNum)
+{
+    if (threadNum > static_cast<int>(m_prefetchList.size()))
+    {
+        threadNum = static_cast<int>(m_prefetchList.size());
+    }
+
+    // 工作线程只读写各自取到的表, 日志和结果统计都在主线程
+    std::atomic<int> nextIndex(0);
+    auto worker = [this, &nextIndex]()
+    {
+        int index = nextIndex++;
+        while (index < static_cast<int>(m_prefetchList.size()))
+        {
+            PrefetchOne(m_prefetchList[index]);
+            index = nextIndex++;
+        }
+    };
+
+    std::vector<std::thread> vecThread;
+    for (int i = 1; i < threadNum; i++)
+    {
+        vecThread.emplace_back(worker);
+    }
+    worker();
+    for (int i = 0; i < static_cast<int>(vecThread.size()); i++)
+    {
+        vecThread[i].join();
+    }
+
+    int failedNum = 0;
+    for (int i = 0; i < static_cast<int>(m_prefetchList.size()); i++)
+    {
+        NFFileResPrefetch* pPrefetch = m_prefetchList[i];
+        if (pPrefetch->m_parsed && !pPrefetch->m_ok)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "prefetch parse file:{} error:{}", pPrefetch->m_filePath, pPrefetch->m_pMessage->InitializationErrorString());
+            failedNum++;
+        }
+    }
+    return failedNum;
+}
+
+bool NFFileResDB::GetPrefetchMD5(const std::string& filePath, std::string& md5) const
+{
+    auto iter = m_prefetchFileMap.find(filePath);
+    if (iter == m_prefetchFileMap.end() || iter->second->m_md5.empty())
+    {
+        return false;
+    }
+    md5 = iter->second->m_md5;
+    return true;
+}
+
+int NFFileResDB::TakePrefetch(const std::string& name, google::protobuf::Message* pMessage)
+{
+    auto iter = m_prefetchMap.find(name);
+    if (iter == m_prefetchMap.end())
+    {
+        return 1;
+    }
+
+    NFFileResPrefetch* pPrefetch = iter->second;
+    if (!pPrefetch->m_parsed || !pPrefetch->m_pMessage || pPrefetch->m_pMessage->GetDescriptor() != pMessage->GetDescriptor())
+    {
+        return 1;
+    }
+
+    if (!pPrefetch->m_ok)
+    {
+        return -1;
+    }
+
+    pMessage->GetReflection()->Swap(pMessage, pPrefetch->m_pMessage.get());
+    pPrefetch->m_pMessage.reset();
+    NFLogTrace(NF_LOG_DEFAULT, 0, "take prefetch file:{} Success", pPrefetch->m_filePath);
+    return 0;
+}
+
+uint64_t NFFileResDB::GetPrefetchCost(const std::string& name) const
+{
+    auto iter = m_prefetchMap.find(name);
+    if (iter == m_prefetchMap.end())
+    {
+        return 0;
+    }
+    return iter->second->m_costMs;
+}
+
+void NFFileResDB::ClearPrefetch()
+{
+    for (int i = 0; i < static_cast<int>(m_prefetchList.size()); i++)
+    {
+        delete m_prefetchList[i];
+    }
+    m_prefetchList.clear();
+    m_prefetchMap.clear();
+    m_prefetchFileMap.clear();
+}
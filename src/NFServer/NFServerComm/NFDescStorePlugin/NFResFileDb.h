@@ -10,7 +10,9 @@
 #pragma once
 
 #include "NFComm/NFObjCommon/NFResDb.h"
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 const int C_READBUFFSIZE_MAX = 1024 * 1024 * 50;
 
@@ -31,13 +33,69 @@ private:
 	NFFileResDB* m_pFileResDB;
 };
 
+/**
+ * @brief 在工作线程中提前读取解析的配置表
+ */
+struct NFFileResPrefetch
+{
+	NFFileResPrefetch() : m_parsed(false), m_ok(false), m_costMs(0)
+	{
+	}
+
+	std::string m_name; //表名
+	std::string m_filePath; //文件全路径
+	std::string m_oldMd5; //不为空时, 只有文件md5变化才解析(重载)
+	std::unique_ptr<google::protobuf::Message> m_pMessage; //解析结果
+	std::string m_md5; //文件md5
+	bool m_parsed; //是否做了解析
+	bool m_ok; //读取解析是否成功
+	uint64_t m_costMs; //读取解析耗时
+};
+
 class NFFileResDB : public NFResDb
 {
 public:
 	NFFileResDB(NFIPluginManager* p, const std::string& szResFilePath);
 	virtual NFResTable *GetTable(const std::string& name);
 	const std::string& GetPath() { return m_szResFilePath; }
+
+	/**
+	 * @brief 添加一个需要提前读取解析的表
+	 * @param name 表名
+	 * @param pPrototype 表对应的protobuf消息原型
+	 * @param oldMd5 当前已加载文件的md5, 为空表示总是解析
+	 */
+	void AddPrefetch(const std::string& name, const google::protobuf::Message* pPrototype, const std::string& oldMd5);
+
+	/**
+	 * @brief 用threadNum个工作线程读取解析所有添加的表, 计算文件md5, 全部完成后返回
+	 * @return 解析失败的表数量
+	 */
+	int RunPrefetch(int threadNum);
+
+	/**
+	 * @brief 取出提前计算的文件md5
+	 */
+	bool GetPrefetchMD5(const std::string& filePath, std::string& md5) const;
+
+	/**
+	 * @brief 取出提前解析的结果, 消息类型一致时交换到pMessage中
+	 * @return 0成功, -1解析失败, 1没有提前解析的结果
+	 */
+	int TakePrefetch(const std::string& name, google::protobuf::Message* pMessage);
+
+	/**
+	 * @brief 读取解析耗时, 没有提前解析返回0
+	 */
+	uint64_t GetPrefetchCost(const std::string& name) const;
+
+	void ClearPrefetch();
+private:
+	static void PrefetchOne(NFFileResPrefetch* pPrefetch);
 private:
 	std::unordered_map<std::string, NFFileResTable*> m_tablesMap;
 	std::string m_szResFilePath;
+	std::vector<NFFileResPrefetch*> m_prefetchList;
+	std::unordered_map<std::string, NFFileResPrefetch*> m_prefetchMap;
+	std::unordered_map<std::string, NFFileResPrefetch*> m_prefetchFileMap;
 };
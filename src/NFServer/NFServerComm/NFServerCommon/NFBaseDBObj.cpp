@@ -9,6 +9,8 @@
 
 #include "NFBaseDBObj.h"
 #include "NFComm/NFPluginModule/NFIMemMngModule.h"
+#include "NFDBObjMgr.h"
+#include "NFComm/NFObjCommon/NFShmMgr.h"
 
 NFBaseDBObj::NFBaseDBObj()
 {
@@ -32,9 +34,25 @@ int NFBaseDBObj::CreateInit() {
     m_iRetryTimes = 0;
     m_bNeedInsertDB = false;
     m_iServerType = NF_ST_NONE;
+    m_bNeedReloadDB = false;
     return 0;
 }
 
 int NFBaseDBObj::ResumeInit() {
+    //热重启不清这个标记, 镜像恢复后还没重新加载就又热重启的对象也要重新加载
+    if (NFShmMgr::Instance()->IsCheckpointRecover() && m_bDataInited)
+    {
+        m_bNeedReloadDB = true;
+        //镜像里正在执行的存储/加载事务已经没有了
+        m_iTransID = 0;
+    }
     return 0;
 }
+
+void NFBaseDBObj::OnMarkDirty()
+{
+    if (m_bDataInited)
+    {
+        NFDBObjMgr::Instance()->MarkDirty(this);
+    }
+}
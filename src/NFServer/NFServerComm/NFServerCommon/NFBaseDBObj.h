@@ -14,6 +14,8 @@
 
 #define MAX_FAIL_RETRY_TIMES 100
 #define MAX_SAVED_OBJ_PRE_SEC 100
+//每秒存储的最大字节数, 平滑数据库写入
+#define MAX_SAVED_BYTES_PRE_SEC (8 * 1024 * 1024)
 
 // 对象初始化失败后的操作
 enum eDealWithLoadFailed
@@ -55,6 +57,8 @@ public:
     virtual google::protobuf::Message* CreateTempProtobufData() { return NULL; }
     virtual uint32_t GetSaveDis() { return 900; }
     virtual eDealWithLoadFailed DealWithFailed() { return EN_DW_RETRY; }
+    //加入存储队列
+    virtual void OnMarkDirty() override;
 public:
     void SetModeKey(uint64_t mod_key) { m_uModKey = mod_key; }
     uint64_t GetModeKey() { return m_uModKey; }
@@ -69,6 +73,9 @@ public:
     bool GetNeedInsertDB() const { return m_bNeedInsertDB; }
     void SetServerType(NF_SERVER_TYPE type) { m_iServerType = type; }
     NF_SERVER_TYPE GetServerType() const { return m_iServerType; }
+    //共享内存从写盘镜像恢复后, 数据可能比DB里的旧, NFDBObjMgr重新从DB加载完之前不能存盘
+    bool IsNeedReloadDB() const { return m_bNeedReloadDB; }
+    void SetNeedReloadDB(bool b) { m_bNeedReloadDB = b; }
 protected:
     bool m_bDataInited;
 protected:
@@ -78,4 +85,5 @@ protected:
     int      m_iRetryTimes;
     bool     m_bNeedInsertDB;
     NF_SERVER_TYPE m_iServerType;
+    bool     m_bNeedReloadDB;
 };
\ No newline at end of file
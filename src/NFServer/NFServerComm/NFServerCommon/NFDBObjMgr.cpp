@@ -15,6 +15,7 @@
 #include "NFComm/NFObjCommon/NFShmMgr.h"
 #include "NFComm/NFCore/NFTime.h"
 #include "NFComm/NFPluginModule/NFError.h"
+#include "NFComm/NFPluginModule/NFProtobufCommon.h"
 
 NFDBObjMgr::NFDBObjMgr()
 {
@@ -39,8 +40,15 @@ NFDBObjMgr::~NFDBObjMgr()
 
 int NFDBObjMgr::CreateInit()
 {
-    m_iLastSavingObjIndex = 0;
     m_iLastTickTime = 0;
+    m_iSaveObjPerTick = MAX_SAVED_OBJ_PRE_SEC;
+    m_iSaveBytesPerSec = MAX_SAVED_BYTES_PRE_SEC;
+    m_iCurSecSaveBytes = 0;
+    m_iCurSecSkipBytes = 0;
+    m_iLastTickSaveBytes = 0;
+    m_iLastTickSkipBytes = 0;
+    m_ullTotalSaveBytes = 0;
+    m_ullTotalSkipBytes = 0;
     m_iTransMngObjID = 0;
     m_iTimer = INVALID_ID;
     m_iTimer = SetTimer(1000, 0, 0, 0, 10, 0);
@@ -84,57 +92,137 @@ int NFDBObjMgr::Tick()
         }
     }
 
-    if (m_iLastSavingObjIndex >= (int)m_runningObjList.size())
+    ReloadRecoverObj();
+
+    SaveDueObj();
+
+    if (m_loadDBList.size() > 0 && m_loadDBList.size() == m_loadDBFinishList.size())
     {
-        m_iLastSavingObjIndex = 0;
+        m_loadDBList.clear();
+        m_loadDBFinishList.clear();
+        CheckWhenAllDataLoaded();
+        NFGlobalSystem::Instance()->GetGlobalPluginManager()->FinishAppTask(NF_ST_NONE, APP_INIT_LOAD_GLOBAL_DATA_DB, APP_INIT_TASK_GROUP_SERVER_LOAD_OBJ_FROM_DB);
     }
 
-    int iSavedObjNum = 0;
-    int idx = 0;
+    return 0;
+}
+
+void NFDBObjMgr::ReloadRecoverObj()
+{
+    int iReloadObjNum = 0;
+    for (auto iter = m_runningObjList.begin(); iter != m_runningObjList.end() && iReloadObjNum < MAX_SAVED_OBJ_PRE_SEC; iter++)
+    {
+        NFBaseDBObj* pObj = GetObj(*iter);
+        if (pObj && pObj->IsNeedReloadDB() && pObj->GetTransID() == 0)
+        {
+            ReloadFromDB(pObj);
+            ++iReloadObjNum;
+        }
+    }
+}
+
+void NFDBObjMgr::SaveDueObj()
+{
     uint64_t now = NF_ADJUST_TIMENOW();
-    for (auto iter = m_runningObjList.begin(); iter != m_runningObjList.end() && iSavedObjNum < MAX_SAVED_OBJ_PRE_SEC;)
+    if (m_iLastTickTime != (uint32_t)now)
+    {
+        if (m_iCurSecSaveBytes > 0)
+        {
+            NFLogDebug(NF_LOG_DEFAULT, 0, "db obj save bytes:{} delta skip bytes:{} last second, total save bytes:{} total skip bytes:{}", m_iCurSecSaveBytes, m_iCurSecSkipBytes,
+                       m_ullTotalSaveBytes, m_ullTotalSkipBytes);
+        }
+        m_iLastTickTime = (uint32_t)now;
+        m_iCurSecSaveBytes = 0;
+        m_iCurSecSkipBytes = 0;
+    }
+
+    m_iLastTickSaveBytes = 0;
+    m_iLastTickSkipBytes = 0;
+
+    int iSavedObjNum = 0;
+    while (!m_saveQueue.empty())
     {
-        if (idx < m_iLastSavingObjIndex)
+        if (m_iSaveObjPerTick > 0 && iSavedObjNum >= m_iSaveObjPerTick)
+        {
+            break;
+        }
+
+        if (m_iSaveBytesPerSec > 0 && m_iCurSecSaveBytes >= m_iSaveBytesPerSec)
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "save bytes:{} reach limit:{} this second, left obj:{}", m_iCurSecSaveBytes, m_iSaveBytesPerSec, m_saveQueue.size());
+            break;
+        }
+
+        SaveQueueNode node = m_saveQueue.top();
+        if (node.first >= now)
+        {
+            break;
+        }
+
+        m_saveQueue.pop();
+        m_saveQueueSet.erase(node.second);
+
+        NFBaseDBObj* pObj = GetObj(node.second);
+        if (pObj == NULL || !pObj->IsDataInited() || !pObj->IsUrgentNeedSave())
         {
-            ++idx;
-            ++iter;
             continue;
         }
 
-        NFBaseDBObj* pObj = GetObj(*iter);
-        if (pObj)
+        // 镜像恢复的对象重新加载完才能存, 加载完还有修改会重新加入队列
+        if (pObj->IsNeedReloadDB())
         {
-            // 不在存储中 + 有修改
-            if (pObj->GetTransID() == 0 && pObj->IsUrgentNeedSave())
-            {
-                if (pObj->GetLastDBOpTime() + pObj->GetSaveDis() < now)
-                {
-                    int iRet = SaveToDB(pObj);
-                    NFLogTrace(NF_LOG_DEFAULT, 0, "save obj ret:{} className{} key:{}", iRet, pObj->GetClassName(), pObj->GetModeKey());
+            continue;
+        }
 
-                    ++iSavedObjNum;
-                }
-            }
-            ++iter;
-            ++idx;
-            ++m_iLastSavingObjIndex;
+        // 正在存储中, 存储返回后如果还有修改会重新加入队列
+        if (pObj->GetTransID() != 0)
+        {
+            continue;
         }
-        else
+
+        // 入队后又存储过一次, 按新的时间重新排队
+        if (pObj->GetLastDBOpTime() + pObj->GetSaveDis() >= now)
         {
-            NFLogError(NF_LOG_DEFAULT, 0, "Remove running obj:{}", *iter);
-            iter = m_runningObjList.erase(iter);
+            MarkDirty(pObj);
+            continue;
         }
+
+        int iRet = SaveToDB(pObj);
+        NFLogTrace(NF_LOG_DEFAULT, 0, "save obj ret:{} className{} key:{}", iRet, pObj->GetClassName(), pObj->GetModeKey());
+        if (iRet != 0 && pObj->GetTransID() == 0)
+        {
+            // 下一次Tick重试
+            PushSaveQueue(pObj, now);
+        }
+
+        ++iSavedObjNum;
     }
+}
 
-    if (m_loadDBList.size() > 0 && m_loadDBList.size() == m_loadDBFinishList.size())
+void NFDBObjMgr::MarkDirty(NFBaseDBObj* pObj)
+{
+    CHECK_EXPR_RE_VOID(pObj, "pObj == NULL");
+    PushSaveQueue(pObj, pObj->GetLastDBOpTime() + pObj->GetSaveDis());
+}
+
+void NFDBObjMgr::PushSaveQueue(NFBaseDBObj* pObj, uint64_t saveTime)
+{
+    if (m_saveQueueSet.find(pObj->GetGlobalId()) != m_saveQueueSet.end())
     {
-        m_loadDBList.clear();
-        m_loadDBFinishList.clear();
-        CheckWhenAllDataLoaded();
-        NFGlobalSystem::Instance()->GetGlobalPluginManager()->FinishAppTask(NF_ST_NONE, APP_INIT_LOAD_GLOBAL_DATA_DB, APP_INIT_TASK_GROUP_SERVER_LOAD_OBJ_FROM_DB);
+        return;
     }
 
-    return 0;
+    CHECK_EXPR_RE_VOID(m_saveQueueSet.size() < m_saveQueueSet.max_size() && m_saveQueue.size() < m_saveQueueSet.max_size(), "save queue full, obj:{} className:{}",
+                       pObj->GetGlobalId(), pObj->GetClassName());
+
+    m_saveQueue.push(SaveQueueNode(saveTime, pObj->GetGlobalId()));
+    m_saveQueueSet.insert(pObj->GetGlobalId());
+}
+
+void NFDBObjMgr::SetSaveLimit(int iSaveObjPerTick, int iSaveBytesPerSec)
+{
+    m_iSaveObjPerTick = iSaveObjPerTick;
+    m_iSaveBytesPerSec = iSaveBytesPerSec;
 }
 
 int NFDBObjMgr::CheckWhenAllDataLoaded()
@@ -200,6 +288,70 @@ int NFDBObjMgr::LoadFromDB(NFBaseDBObj* pObj)
     return 0;
 }
 
+int NFDBObjMgr::ReloadFromDB(NFBaseDBObj* pObj)
+{
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--begin--");
+    CHECK_NULL(0, pObj);
+
+    NFDBObjTrans* pTrans = NFDBObjTrans::CreateTrans();
+    CHECK_EXPR(pTrans, -1, "Create NFDBObjTrans:EOT_TRANS_DB_OBJ Failed! use num:{}", NFDBObjTrans::GetStaticUsedCount());
+
+    int iRet = pTrans->Init(pObj->GetServerType(), pObj->GetGlobalId(), pObj->GetCurSeq());
+    CHECK_EXPR(iRet == 0, -1, "Init Trans Failed!");
+
+    google::protobuf::Message* pMessage = pObj->CreateTempProtobufData();
+    CHECK_NULL(0, pMessage);
+    iRet = pObj->MakeLoadData(pMessage);
+    if (iRet == 0)
+    {
+        pObj->SetLastDBOpTime(NF_ADJUST_TIMENOW());
+        pObj->SetTransID(pTrans->GetGlobalId());
+        iRet = pTrans->Load(pObj->GetModeKey(), pMessage);
+        if (iRet != 0)
+        {
+            // 下一次Tick重试
+            pObj->SetTransID(0);
+        }
+    }
+    NF_SAFE_DELETE(pMessage);
+    CHECK_RET(iRet, "Reload From DB Failed, key:{} className:{}", pObj->GetModeKey(), pObj->GetClassName());
+
+    NFLogInfo(NF_LOG_DEFAULT, 0, "reload checkpoint recover obj from db, key:{} className:{}", pObj->GetModeKey(), pObj->GetClassName());
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--end--");
+    return 0;
+}
+
+int NFDBObjMgr::OnDataReloaded(NFBaseDBObj* pObj, int32_t err_code, const google::protobuf::Message* pData)
+{
+    // 镜像里的修改都作废, 以DB里的数据为准
+    int iRet = -1;
+    if (err_code == 0)
+    {
+        pObj->ClearUrgent();
+        iRet = pObj->InitWithDBData(pData);
+    }
+    else if ((int)err_code == NFrame::ERR_CODE_STORESVR_ERRCODE_SELECT_EMPTY)
+    {
+        pObj->ClearUrgent();
+        pObj->SetNeedInsertDB(true);
+        iRet = pObj->InitWithoutDBData();
+    }
+
+    if (iRet != 0)
+    {
+        // 保留标记, 下一次Tick重试
+        NFLogError(NF_LOG_DEFAULT, 0, "className:{} key:{} reload failed! iRet:{} err_code:{}", pObj->GetClassName(), pObj->GetModeKey(), iRet, GetErrorStr(err_code));
+        return 0;
+    }
+
+    pObj->SetNeedReloadDB(false);
+    if (pObj->IsUrgentNeedSave())
+    {
+        MarkDirty(pObj);
+    }
+    return 0;
+}
+
 int NFDBObjMgr::OnDataLoaded(int iObjID, int32_t err_code, const google::protobuf::Message* pData)
 {
     NFLogDebug(NF_LOG_DEFAULT, 0, "objId:{} Date Loaded:{} err_code:{}", iObjID, pData->GetTypeName(), GetErrorStr(err_code));
@@ -207,6 +359,10 @@ int NFDBObjMgr::OnDataLoaded(int iObjID, int32_t err_code, const google::protobu
     CHECK_NULL(0, pObj);
 
     pObj->SetTransID(0);
+    if (pObj->IsNeedReloadDB())
+    {
+        return OnDataReloaded(pObj, err_code, pData);
+    }
     int iRet = 0;
     if (err_code == 0)
     {
@@ -273,6 +429,10 @@ int NFDBObjMgr::OnDataLoaded(int iObjID, int32_t err_code, const google::protobu
     {
         m_runningObjList.push_back(pObj->GetGlobalId());
         m_loadDBFinishList.insert(pObj->GetGlobalId());
+        if (pObj->IsUrgentNeedSave())
+        {
+            MarkDirty(pObj);
+        }
     }
 
     return 0;
@@ -285,8 +445,19 @@ int NFDBObjMgr::OnDataInserted(NFDBObjTrans* pTrans, bool success)
     NFBaseDBObj* pObj = GetObj(pTrans->GetLinkedObjID());
     CHECK_NULL(0, pObj);
 
+    // 镜像里恢复出来的旧事务, 对象已经不认它了
+    if (pObj->GetTransID() != pTrans->GetGlobalId())
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "obj:{} className:{} trans:{} not match:{}, ignore", pObj->GetGlobalId(), pObj->GetClassName(), pTrans->GetGlobalId(), pObj->GetTransID());
+        return 0;
+    }
+
     pObj->SetTransID(0);
-    if (success)
+    if (!success)
+    {
+        pObj->RestoreDirtyFieldMask(pTrans->GetSaveFieldMask());
+    }
+    else
     {
         pObj->SetLastDBOpTime(NF_ADJUST_TIMENOW());
         pObj->SetNeedInsertDB(false);
@@ -295,6 +466,11 @@ int NFDBObjMgr::OnDataInserted(NFDBObjTrans* pTrans, bool success)
             pObj->ClearUrgent();
         }
     }
+
+    if (pObj->IsUrgentNeedSave())
+    {
+        MarkDirty(pObj);
+    }
     return 0;
 }
 
@@ -304,8 +480,19 @@ int NFDBObjMgr::OnDataSaved(NFDBObjTrans* pTrans, bool success)
     NFBaseDBObj* pObj = GetObj(pTrans->GetLinkedObjID());
     CHECK_NULL(0, pObj);
 
+    // 镜像里恢复出来的旧事务, 对象已经不认它了
+    if (pObj->GetTransID() != pTrans->GetGlobalId())
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "obj:{} className:{} trans:{} not match:{}, ignore", pObj->GetGlobalId(), pObj->GetClassName(), pTrans->GetGlobalId(), pObj->GetTransID());
+        return 0;
+    }
+
     pObj->SetTransID(0);
-    if (success)
+    if (!success)
+    {
+        pObj->RestoreDirtyFieldMask(pTrans->GetSaveFieldMask());
+    }
+    else
     {
         pObj->SetLastDBOpTime(NF_ADJUST_TIMENOW());
         if (pTrans->GetObjSeqOP() == pObj->GetCurSeq())
@@ -313,6 +500,11 @@ int NFDBObjMgr::OnDataSaved(NFDBObjTrans* pTrans, bool success)
             pObj->ClearUrgent();
         }
     }
+
+    if (pObj->IsUrgentNeedSave())
+    {
+        MarkDirty(pObj);
+    }
     return 0;
 }
 
@@ -332,6 +524,13 @@ int NFDBObjMgr::SaveToDB(NFBaseDBObj* pObj)
         return -1;
     }
 
+    // 镜像里的旧数据会覆盖DB里更新的数据
+    if (pObj->IsNeedReloadDB())
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "obj:{} name:{} recover from checkpoint, need reload from db before save", pObj->GetGlobalId(), pObj->GetClassName())
+        return -1;
+    }
+
     NFDBObjTrans* pTrans = NFDBObjTrans::CreateTrans();
     CHECK_EXPR(pTrans, -1, "Create NFDBObjTrans:EOT_TRANS_DB_OBJ Failed! use num:{}", NFDBObjTrans::GetStaticUsedCount());
 
@@ -348,6 +547,25 @@ int NFDBObjMgr::SaveToDB(NFBaseDBObj* pObj)
         return iRet;
     }
 
+    uint64_t fieldMask = pObj->TakeDirtyFieldMask();
+    pTrans->SetSaveFieldMask(fieldMask);
+
+    int iFullBytes = pMessage->ByteSize();
+    std::vector<std::string> vecFields;
+    bool bDeltaSave = !pObj->GetNeedInsertDB() && fieldMask != SEQOP_FIELD_MASK_ALL && fieldMask != 0;
+    if (bDeltaSave)
+    {
+        bDeltaSave = NFProtobufCommon::MakeDeltaSaveData(pMessage, fieldMask, vecFields);
+    }
+
+    int iSaveBytes = bDeltaSave ? pMessage->ByteSize() : iFullBytes;
+    m_iCurSecSaveBytes += iSaveBytes;
+    m_iCurSecSkipBytes += iFullBytes - iSaveBytes;
+    m_iLastTickSaveBytes += iSaveBytes;
+    m_iLastTickSkipBytes += iFullBytes - iSaveBytes;
+    m_ullTotalSaveBytes += iSaveBytes;
+    m_ullTotalSkipBytes += iFullBytes - iSaveBytes;
+
     pObj->SetTransID(pTrans->GetGlobalId());
     if (pObj->GetNeedInsertDB())
     {
@@ -355,10 +573,14 @@ int NFDBObjMgr::SaveToDB(NFBaseDBObj* pObj)
     }
     else
     {
-        iRet = pTrans->Save(pObj->GetModeKey(), pMessage);
+        iRet = pTrans->Save(pObj->GetModeKey(), pMessage, vecFields);
     }
 
     NF_SAFE_DELETE(pMessage);
+    if (iRet != 0)
+    {
+        pObj->RestoreDirtyFieldMask(fieldMask);
+    }
     CHECK_RET(iRet, "SaveToDB Failed, key:{} pObj:{}", pObj->GetModeKey(), pObj->GetClassName());
     NFLogTrace(NF_LOG_DEFAULT, 0, "--end--");
     return 0;
@@ -371,8 +593,8 @@ bool NFDBObjMgr::CheckStopServer()
         NFBaseDBObj* pObj = GetObj(*iter);
         if (pObj)
         {
-            // 不在存储中 + 有修改
-            if (pObj->IsDataInited() && pObj->IsUrgentNeedSave())
+            // 不在存储中 + 有修改, 等重新加载的对象存不了, 不用等
+            if (pObj->IsDataInited() && !pObj->IsNeedReloadDB() && pObj->IsUrgentNeedSave())
             {
                 return false;
             }
@@ -396,7 +618,7 @@ bool NFDBObjMgr::StopServer()
         if (pObj)
         {
             // 不在存储中 + 有修改
-            if (pObj->IsDataInited() && pObj->GetTransID() == 0 && pObj->IsUrgentNeedSave())
+            if (pObj->IsDataInited() && pObj->GetTransID() == 0 && !pObj->IsNeedReloadDB() && pObj->IsUrgentNeedSave())
             {
                 int iRet = SaveToDB(pObj);
                 ++iSavedObjNum;
@@ -11,6 +11,8 @@
 
 #include <NFComm/NFShmStl/NFShmHashSet.h>
 #include <NFComm/NFShmStl/NFShmList.h>
+#include <NFComm/NFShmStl/NFShmPair.h>
+#include <NFComm/NFShmStl/NFShmPriorityQueue.h>
 
 #include "NFComm/NFObjCommon/NFObject.h"
 
@@ -32,12 +34,40 @@ public:
 public:
     NFBaseDBObj* GetObj(int iObjID);
     int LoadFromDB(NFBaseDBObj* pObj);
+    /**
+     * @brief 共享内存从写盘镜像恢复后, 重新从DB加载对象, 加载完清掉IsNeedReloadDB标记, 之后才能存盘
+     */
+    int ReloadFromDB(NFBaseDBObj* pObj);
     int OnDataLoaded(int iObjID, int32_t err_code, const google::protobuf::Message* pData);
     int OnDataInserted(NFDBObjTrans* trans, bool success);
     int OnDataSaved(NFDBObjTrans* trans, bool success);
     int SaveToDB(NFBaseDBObj* pObj);
     int Tick();
     int CheckWhenAllDataLoaded();
+    /**
+     * @brief 对象有修改, 按可以存储的时间(上次存储时间+存储间隔)加入存储队列, 已在队列中的忽略
+     */
+    void MarkDirty(NFBaseDBObj* pObj);
+    /**
+     * @brief 设置存储限流, 每次Tick最多存储的对象数, 每秒最多存储的字节数, 0表示不限制
+     */
+    void SetSaveLimit(int iSaveObjPerTick, int iSaveBytesPerSec);
+    /**
+     * @brief 上一次Tick存储的字节数, 以及按字段增量存储比整个对象存储少发的字节数
+     */
+    int GetLastTickSaveBytes() const { return m_iLastTickSaveBytes; }
+    int GetLastTickSkipBytes() const { return m_iLastTickSkipBytes; }
+    uint64_t GetTotalSaveBytes() const { return m_ullTotalSaveBytes; }
+    uint64_t GetTotalSkipBytes() const { return m_ullTotalSkipBytes; }
+private:
+    //重新加载镜像恢复出来的对象
+    void ReloadRecoverObj();
+    //重新加载的结果
+    int OnDataReloaded(NFBaseDBObj* pObj, int32_t err_code, const google::protobuf::Message* pData);
+    //按时间顺序存储到期的对象
+    void SaveDueObj();
+    //加入存储队列, saveTime之后才会存储
+    void PushSaveQueue(NFBaseDBObj* pObj, uint64_t saveTime);
 public:
     /*
      * 停服之前，检查服务器是否满足停服条件
@@ -49,7 +79,7 @@ public:
      * */
     virtual bool StopServer();
 private:
-    int m_iLastSavingObjIndex;
+    typedef NFShmPair<uint64_t, int> SaveQueueNode; //<可以存储的时间, 对象ID>
     uint32_t m_iLastTickTime;
     int m_iTransMngObjID;
     int m_iTimer;
@@ -57,4 +87,14 @@ private:
     NFShmList<int, 1024> m_failedObjList;
     NFShmHashSet<int, 1024> m_loadDBList;
     NFShmHashSet<int, 1024> m_loadDBFinishList;
+    NFShmPriorityQueue<SaveQueueNode, 1024, std::greater<SaveQueueNode>> m_saveQueue; //按可以存储的时间排序的小根堆
+    NFShmHashSet<int, 1024> m_saveQueueSet; //在存储队列中的对象
+    int m_iSaveObjPerTick;
+    int m_iSaveBytesPerSec;
+    int m_iCurSecSaveBytes; //当前这一秒已存储的字节数
+    int m_iCurSecSkipBytes; //当前这一秒增量存储少发的字节数
+    int m_iLastTickSaveBytes;
+    int m_iLastTickSkipBytes;
+    uint64_t m_ullTotalSaveBytes;
+    uint64_t m_ullTotalSkipBytes;
 };
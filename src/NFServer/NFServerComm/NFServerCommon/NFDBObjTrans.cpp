@@ -37,6 +37,7 @@ int NFDBObjTrans::CreateInit()
     m_iObjSeqOP = 0;
     m_iDBOP = 0;
     m_iServerType = NF_ST_NONE;
+    m_ullSaveFieldMask = 0;
     return 0;
 }
 
@@ -77,10 +78,10 @@ int NFDBObjTrans::Insert(uint64_t iModKey, google::protobuf::Message* data)
     return 0;
 }
 
-int NFDBObjTrans::Save(uint64_t iModKey, google::protobuf::Message* data)
+int NFDBObjTrans::Save(uint64_t iModKey, google::protobuf::Message* data, const std::vector<std::string>& vecFields)
 {
     CHECK_NULL(0, data);
-    NFLogTrace(NF_LOG_DEFAULT, 0, "SaveToDB, tableName:{} trans:{} ", data->GetTypeName(), GetGlobalId());
+    NFLogTrace(NF_LOG_DEFAULT, 0, "SaveToDB, tableName:{} trans:{} fields:{}", data->GetTypeName(), GetGlobalId(), vecFields.size());
 
     m_iDBOP = NFrame::NF_STORESVR_C2S_MODIFYOBJ;
     m_rpcId = FindModule<NFIServerMessageModule>()->GetRpcModifyObjService(m_iServerType, iModKey, *data, [this](int rpcRetCode)
@@ -91,7 +92,7 @@ int NFDBObjTrans::Save(uint64_t iModKey, google::protobuf::Message* data)
         }
 
         SetFinished(rpcRetCode);
-    });
+    }, 0, "", vecFields);
 
     if (m_rpcId == INVALID_ID)
     {
@@ -24,7 +24,7 @@ public:
 public:
     int Init(NF_SERVER_TYPE eType, int iObjID, uint32_t iSeqOP);
     int Insert(uint64_t iModKey, google::protobuf::Message* data);
-    int Save(uint64_t iModKey, google::protobuf::Message* data);
+    int Save(uint64_t iModKey, google::protobuf::Message* data, const std::vector<std::string>& vecFields);
     int Load(uint64_t iModKey, google::protobuf::Message* data);
 
     virtual int OnTimeOut();
@@ -32,9 +32,12 @@ public:
 
     int GetLinkedObjID() { return m_iLinkedObjID; }
     uint32_t GetObjSeqOP() { return m_iObjSeqOP; }
+    void SetSaveFieldMask(uint64_t fieldMask) { m_ullSaveFieldMask = fieldMask; }
+    uint64_t GetSaveFieldMask() const { return m_ullSaveFieldMask; }
 private:
     int m_iLinkedObjID;
     uint32_t m_iObjSeqOP;
     int m_iDBOP;
     NF_SERVER_TYPE m_iServerType;
+    uint64_t m_ullSaveFieldMask; //本次存储的字段, 存储失败时还给对象
 };
\ No newline at end of file
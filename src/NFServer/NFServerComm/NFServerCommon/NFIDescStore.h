@@ -82,6 +82,14 @@ public:
 
     virtual std::string GetFileName() = 0;
 
+    /**
+     * @brief 配置表对应的protobuf消息全名, 加载时在工作线程中提前读取解析, 返回空表示不提前解析
+     */
+    virtual std::string GetTableMsgName()
+    {
+        return "";
+    }
+
     virtual int GetResNum() const = 0;
 
     virtual int SaveDescStore() = 0;
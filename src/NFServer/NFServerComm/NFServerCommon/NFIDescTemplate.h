@@ -93,6 +93,19 @@ public:
     }
 
     virtual std::string GetFileName() override
+    {
+        return "E_" + GetDescShortName();
+    }
+
+    virtual std::string GetTableMsgName() override
+    {
+        return "proto_ff.Sheet_" + GetDescShortName();
+    }
+
+    /**
+     * @brief 去掉Desc后缀的类名, 例如AiAiDesc -> AiAi
+     */
+    static std::string GetDescShortName()
     {
         std::string strSubModuleName = typeid(className).name();
 
@@ -120,7 +133,6 @@ public:
         {
             strSubModuleName = strSubModuleName.substr(0, pos);
         }
-        strSubModuleName = "E_" + strSubModuleName;
         return strSubModuleName;
     }
 
@@ -28,6 +28,8 @@
 
 //#define TEST_SERVER_SEND_MSG
 #define TEST_SERVER_SEND_MSG_FRAME_COUNT 1
+//同一帧发给同一个网关的转发消息合成一个包, 单个合包的最大字节数
+#define NF_REDIRECT_BATCH_MAX_SIZE (1024 * 64)
 
 /// @brief 基于消息的通讯接口类
 class NFIServerMessageModule : public NFIDynamicModule
@@ -72,6 +74,20 @@ public:
 	virtual int SendRedirectMsgToAllProxyServer(NF_SERVER_TYPE eType, uint32_t nMsgId,
 	                                            const google::protobuf::Message& xData) = 0;
 
+	/**
+	 * @brief 转发消息先缓存到本帧结束, 同一个网关的消息合成一个NF_SERVER_REDIRECT_MSG_TO_PROXY_SERVER_CMD包发送
+	 *        合包时nParam1为消息个数, 包体是nParam1个(varint长度 + Proto_FramePkg), nParam1为0时包体就是一个Proto_FramePkg
+	 *        之后直接发给同一个网关的消息(SendMsgToProxyServer/SendProxyMsgByBusId等)会先把这个网关的缓存发出去, 不会超过前面的转发消息
+	 * @param pData 已经序列化好的消息, 广播给多个网关时共用一份
+	 */
+	virtual int AddRedirectMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, const std::vector<uint64_t>& ids, uint32_t nMsgId,
+	                                        const NF_SHARE_PTR<std::string>& pData) = 0;
+
+	/**
+	 * @brief 立即发送缓存的转发消息, 每帧所有插件Execute完之后(AfterExecute)也会调用
+	 */
+	virtual int FlushRedirectMsgToProxyServer() = 0;
+
 	virtual int SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nMsgId, const google::protobuf::Message& xData, uint64_t nParam1 = 0,
 	                                 uint64_t nParam2 = 0) = 0;
 
@@ -640,8 +656,12 @@ public:
 
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	///////////////////////store server modifyobj////////////////////////////////////////////////////////////////////////////
+	/**
+	 * @brief vecFields不为空时只存储这些顶层字段(data里只需要填这些字段和主键), store服务器只更新对应的列
+	 */
 	template <typename DataType>
-	int GetRpcModifyObjService(NF_SERVER_TYPE eType, uint64_t mod_key, const DataType& data, uint32_t dstBusId = 0, const std::string& dbname = "")
+	int GetRpcModifyObjService(NF_SERVER_TYPE eType, uint64_t mod_key, const DataType& data, uint32_t dstBusId = 0, const std::string& dbname = "",
+	                           const std::vector<std::string>& vecFields = std::vector<std::string>())
 	{
 		std::string tempDBName = dbname;
 		if (dbname.empty())
@@ -668,6 +688,10 @@ public:
 		std::string packageName = NFProtobufCommon::GetProtoPackageName(data);
 		CHECK_EXPR(!tbname.empty(), -1, "no tbname ........");
 		NFStoreProtoCommon::storesvr_modifyobj(selobj, tempDBName, tbname, mod_key, data, tbname, packageName);
+		for (size_t i = 0; i < vecFields.size(); i++)
+		{
+			selobj.mutable_baseinfo()->add_sel_fields(vecFields[i]);
+		}
 
 		NFrame::storesvr_modobj_res selobjRes;
 		int iRet = FindModule<NFIMessageModule>()->GetRpcService<NF_MODULE_FRAME, NFrame::NF_STORESVR_C2S_MODIFYOBJ>(eType, NF_ST_STORE_SERVER, dstBusId, selobj,
@@ -695,12 +719,12 @@ public:
 
 	template <class DataType>
 	int64_t GetRpcModifyObjService(NF_SERVER_TYPE eType, uint64_t mod_key, const DataType& data, const std::function<void(int)>& func,
-	                               uint32_t dstBusId = 0, const std::string& dbname = "")
+	                               uint32_t dstBusId = 0, const std::string& dbname = "", const std::vector<std::string>& vecFields = std::vector<std::string>())
 	{
 		int64_t iRet = FindModule<NFICoroutineModule>()->MakeCoroutine
 		([=, &data]()
 		{
-			int rpcRetCode = GetRpcModifyObjService(eType, mod_key, data, dstBusId, dbname);
+			int rpcRetCode = GetRpcModifyObjService(eType, mod_key, data, dstBusId, dbname, vecFields);
 			if (func)
 			{
 				func(rpcRetCode);
@@ -12,6 +12,8 @@
 #include "NFComm/NFPluginModule/NFIConfigModule.h"
 #include "NFComm/NFPluginModule/NFICoroutineModule.h"
 #include "NFComm/NFPluginModule/NFProtobufCommon.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 
 NFServerMessageModule::NFServerMessageModule(NFIPluginManager* pPluginManager) : NFIServerMessageModule(pPluginManager)
 {
@@ -21,6 +23,13 @@ NFServerMessageModule::~NFServerMessageModule()
 {
 }
 
+bool NFServerMessageModule::AfterExecute()
+{
+    // 游戏插件在NFServerCommonPlugin之后Execute, 放在帧末才能把本帧所有的广播一起发出去
+    FlushRedirectMsgToProxyServer();
+    return true;
+}
+
 int NFServerMessageModule::SendMsgToMasterServer(NF_SERVER_TYPE eSendType, uint32_t nMsgId, const google::protobuf::Message& xData, uint64_t nParam1,
                                                  uint64_t nParam2)
 {
@@ -50,6 +59,8 @@ int NFServerMessageModule::SendProxyMsgByBusId(NF_SERVER_TYPE eType, uint32_t nD
 int NFServerMessageModule::SendProxyMsgByBusId(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nModuleId, uint32_t nMsgId,
                                                const google::protobuf::Message& xData, uint64_t nParam1, uint64_t nParam2)
 {
+    FlushRedirectBatch(eType, nDstId);
+
     auto pConfig = FindModule<NFIConfigModule>()->GetAppConfig(eType);
     CHECK_EXPR(pConfig, -1, "pConfig == NULL");
 
@@ -69,6 +80,8 @@ int NFServerMessageModule::SendProxyMsgByBusId(NF_SERVER_TYPE eType, uint32_t nD
 int NFServerMessageModule::SendProxyMsgByBusId(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nModuleId, uint32_t nMsgId, const char* msg,
                                                uint32_t nLen, uint64_t nParam1, uint64_t nParam2)
 {
+    FlushRedirectBatch(eType, nDstId);
+
     auto pConfig = FindModule<NFIConfigModule>()->GetAppConfig(eType);
     CHECK_EXPR(pConfig, -1, "pConfig == NULL");
 
@@ -144,6 +157,120 @@ int NFServerMessageModule::SendRedirectMsgToAllProxyServer(NF_SERVER_TYPE eType,
     return 0;
 }
 
+int NFServerMessageModule::AddRedirectMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, const std::vector<uint64_t>& ids, uint32_t nMsgId,
+                                                       const NF_SHARE_PTR<std::string>& pData)
+{
+    CHECK_EXPR(pData, -1, "pData == NULL, msgId:{}", nMsgId);
+    if (ids.empty())
+    {
+        return 0;
+    }
+
+    uint64_t key = (static_cast<uint64_t>(eType) << 32) | nDstId;
+    RedirectBatch& batch = m_redirectBatch[key];
+    batch.m_serverType = eType;
+    batch.m_dstId = nDstId;
+
+    // 同一个消息连续发给这个网关的不同玩家, 合并到一条里
+    if (!batch.m_msgs.empty() && batch.m_msgs.back().m_msgId == nMsgId && batch.m_msgs.back().m_pData == pData)
+    {
+        RedirectMsg& last = batch.m_msgs.back();
+        last.m_ids.insert(last.m_ids.end(), ids.begin(), ids.end());
+        return 0;
+    }
+
+    batch.m_msgs.emplace_back();
+    RedirectMsg& msg = batch.m_msgs.back();
+    msg.m_msgId = nMsgId;
+    msg.m_pData = pData;
+    msg.m_ids = ids;
+    return 0;
+}
+
+int NFServerMessageModule::FlushRedirectMsgToProxyServer()
+{
+    for (auto iter = m_redirectBatch.begin(); iter != m_redirectBatch.end(); ++iter)
+    {
+        if (!iter->second.m_msgs.empty())
+        {
+            SendRedirectBatch(iter->second);
+        }
+    }
+    return 0;
+}
+
+void NFServerMessageModule::FlushRedirectBatch(NF_SERVER_TYPE eType, uint32_t nDstId)
+{
+    if (m_redirectBatch.empty())
+    {
+        return;
+    }
+
+    auto iter = m_redirectBatch.find((static_cast<uint64_t>(eType) << 32) | nDstId);
+    if (iter != m_redirectBatch.end() && !iter->second.m_msgs.empty())
+    {
+        SendRedirectBatch(iter->second);
+    }
+}
+
+void NFServerMessageModule::SendRedirectBatch(RedirectBatch& batch)
+{
+    // 先把缓存摘下来, 下面发送时再进入FlushRedirectBatch看到的是空的
+    std::vector<RedirectMsg> vecMsg;
+    vecMsg.swap(batch.m_msgs);
+
+    if (vecMsg.size() == 1)
+    {
+        RedirectMsg& msg = vecMsg[0];
+        NFrame::Proto_FramePkg svrPkg;
+        svrPkg.set_msg_id(msg.m_msgId);
+        svrPkg.set_msg_data(*msg.m_pData);
+        for (size_t i = 0; i < msg.m_ids.size(); i++)
+        {
+            svrPkg.mutable_redirect_info()->add_id(msg.m_ids[i]);
+        }
+
+        SendMsgToProxyServer(batch.m_serverType, batch.m_dstId, NF_MODULE_FRAME, NFrame::NF_SERVER_REDIRECT_MSG_TO_PROXY_SERVER_CMD, svrPkg);
+        return;
+    }
+
+    m_redirectBuffer.clear();
+    uint32_t count = 0;
+    NFrame::Proto_FramePkg svrPkg;
+    for (size_t i = 0; i < vecMsg.size(); i++)
+    {
+        RedirectMsg& msg = vecMsg[i];
+        svrPkg.Clear();
+        svrPkg.set_msg_id(msg.m_msgId);
+        svrPkg.set_msg_data(*msg.m_pData);
+        for (size_t j = 0; j < msg.m_ids.size(); j++)
+        {
+            svrPkg.mutable_redirect_info()->add_id(msg.m_ids[j]);
+        }
+
+        uint32_t pkgSize = static_cast<uint32_t>(svrPkg.ByteSizeLong());
+        if (count > 0 && m_redirectBuffer.size() + pkgSize + 5 > NF_REDIRECT_BATCH_MAX_SIZE)
+        {
+            SendMsgToProxyServer(batch.m_serverType, batch.m_dstId, NF_MODULE_FRAME, NFrame::NF_SERVER_REDIRECT_MSG_TO_PROXY_SERVER_CMD, m_redirectBuffer, count);
+            m_redirectBuffer.clear();
+            count = 0;
+        }
+
+        {
+            google::protobuf::io::StringOutputStream stream(&m_redirectBuffer);
+            google::protobuf::io::CodedOutputStream output(&stream);
+            output.WriteVarint32(pkgSize);
+            svrPkg.SerializeWithCachedSizes(&output);
+        }
+        count++;
+    }
+
+    if (count > 0)
+    {
+        SendMsgToProxyServer(batch.m_serverType, batch.m_dstId, NF_MODULE_FRAME, NFrame::NF_SERVER_REDIRECT_MSG_TO_PROXY_SERVER_CMD, m_redirectBuffer, count);
+    }
+}
+
 int NFServerMessageModule::SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nMsgId, const google::protobuf::Message& xData,
                                                 uint64_t nParam1, uint64_t nParam2)
 {
@@ -153,6 +280,8 @@ int NFServerMessageModule::SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t n
 int NFServerMessageModule::SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nModuleId, uint32_t nMsgId,
                                                 const google::protobuf::Message& xData, uint64_t nParam1, uint64_t nParam2)
 {
+    FlushRedirectBatch(eType, nDstId);
+
     auto pConfig = FindModule<NFIConfigModule>()->GetAppConfig(eType);
     CHECK_EXPR(pConfig, -1, "pConfig == NULL");
 
@@ -178,6 +307,8 @@ int NFServerMessageModule::SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t n
 int NFServerMessageModule::SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nModuleId, uint32_t nMsgId,
                                                 const std::string& xData, uint64_t nParam1, uint64_t nParam2)
 {
+    FlushRedirectBatch(eType, nDstId);
+
     auto pConfig = FindModule<NFIConfigModule>()->GetAppConfig(eType);
     CHECK_EXPR(pConfig, -1, "pConfig == NULL");
 
@@ -203,6 +334,8 @@ int NFServerMessageModule::SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t n
 int NFServerMessageModule::SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nModuleId, uint32_t nMsgId,
                                                 const char* pData, int dataLen, uint64_t nParam1, uint64_t nParam2)
 {
+    FlushRedirectBatch(eType, nDstId);
+
     auto pConfig = FindModule<NFIConfigModule>()->GetAppConfig(eType);
     CHECK_EXPR(pConfig, -1, "pConfig == NULL");
 
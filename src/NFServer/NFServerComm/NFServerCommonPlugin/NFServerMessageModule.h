@@ -20,6 +20,8 @@ public:
 	NFServerMessageModule(NFIPluginManager* pPluginManager);
 
 	virtual ~NFServerMessageModule();
+
+	virtual bool AfterExecute() override;
 public:
 	virtual int SendMsgToMasterServer(NF_SERVER_TYPE eSendTyp, uint32_t nMsgId, const google::protobuf::Message& xData, uint64_t nParam1 = 0,
 									  uint64_t nParam2 = 0) override;
@@ -50,6 +52,11 @@ public:
 	virtual int SendRedirectMsgToAllProxyServer(NF_SERVER_TYPE eType, uint32_t nMsgId,
 												const google::protobuf::Message& xData);
 
+	virtual int AddRedirectMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, const std::vector<uint64_t>& ids, uint32_t nMsgId,
+											const NF_SHARE_PTR<std::string>& pData) override;
+
+	virtual int FlushRedirectMsgToProxyServer() override;
+
 	virtual int SendMsgToProxyServer(NF_SERVER_TYPE eType, uint32_t nDstId, uint32_t nMsgId, const google::protobuf::Message& xData, uint64_t nParam1 = 0,
 									 uint64_t nParam2 = 0) override;
 
@@ -187,4 +194,27 @@ public:
 	virtual int SendModifyObjTrans(NF_SERVER_TYPE eType, uint64_t mod_key, google::protobuf::Message &data, uint32_t table_id = 0, int trans_id = 0, uint32_t seq = 0, uint32_t dstBusId = 0, const std::string &dbname = "") override;
 
 	virtual int SendDeleteObjTrans(NF_SERVER_TYPE eType, uint64_t mod_key, google::protobuf::Message &data, uint32_t table_id = 0, int trans_id = 0, uint32_t seq = 0, uint32_t dstBusId = 0, const std::string &dbname = "") override;
+private:
+	struct RedirectMsg
+	{
+		uint32_t m_msgId;
+		NF_SHARE_PTR<std::string> m_pData;
+		std::vector<uint64_t> m_ids;
+	};
+
+	struct RedirectBatch
+	{
+		NF_SERVER_TYPE m_serverType;
+		uint32_t m_dstId;
+		std::vector<RedirectMsg> m_msgs;
+	};
+
+	//把一个网关缓存的转发消息编码成一个或多个包发送
+	void SendRedirectBatch(RedirectBatch& batch);
+
+	//直接发给网关之前调用, 先发出这个网关本帧缓存的转发消息, 保证同一个网关的消息按调用顺序到达
+	void FlushRedirectBatch(NF_SERVER_TYPE eType, uint32_t nDstId);
+private:
+	std::unordered_map<uint64_t, RedirectBatch> m_redirectBatch; //(服务器类型<<32|网关busId) -> 本帧缓存的转发消息
+	std::string m_redirectBuffer;
 };
@@ -98,6 +98,48 @@ NFServer::PacketMsg PacketMsg::ToPb() const
     return cc;
 }
 
+bool PacketMsg::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::PacketMsg cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int PacketMsg::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool PacketMsg::ParseFrom(NFWireReader& reader)
+{
+    NFServer::PacketMsg cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool PacketMsg::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool PacketMsg::MergeFrom(NFWireReader& reader)
+{
+    NFServer::PacketMsg cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string PacketMsg::ShortDebugString() const
 {
     std::stringstream ss;
@@ -193,6 +235,48 @@ NFServer::ServerPacketMsg ServerPacketMsg::ToPb() const
     return cc;
 }
 
+bool ServerPacketMsg::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::ServerPacketMsg cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ServerPacketMsg::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ServerPacketMsg::ParseFrom(NFWireReader& reader)
+{
+    NFServer::ServerPacketMsg cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ServerPacketMsg::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ServerPacketMsg::MergeFrom(NFWireReader& reader)
+{
+    NFServer::ServerPacketMsg cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ServerPacketMsg::ShortDebugString() const
 {
     std::stringstream ss;
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include <pb.h>
 
 #include "ServerCommon.pb.h"
@@ -36,6 +37,11 @@ struct PacketMsg {
     bool FromPb(const NFServer::PacketMsg& cc);
     void ToPb(NFServer::PacketMsg* cc) const;
     NFServer::PacketMsg ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:PacketMsg) */
@@ -55,6 +61,11 @@ struct ServerPacketMsg {
     bool FromPb(const NFServer::ServerPacketMsg& cc);
     void ToPb(NFServer::ServerPacketMsg* cc) const;
     NFServer::ServerPacketMsg ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ServerPacketMsg) */
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include <pb.h>
 
 #include "ServerError.pb.h"
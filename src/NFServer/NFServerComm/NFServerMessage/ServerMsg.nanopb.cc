@@ -78,6 +78,48 @@ NFServer::CommonMsgRsp CommonMsgRsp::ToPb() const
     return cc;
 }
 
+bool CommonMsgRsp::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::CommonMsgRsp cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int CommonMsgRsp::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool CommonMsgRsp::ParseFrom(NFWireReader& reader)
+{
+    NFServer::CommonMsgRsp cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool CommonMsgRsp::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool CommonMsgRsp::MergeFrom(NFWireReader& reader)
+{
+    NFServer::CommonMsgRsp cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string CommonMsgRsp::ShortDebugString() const
 {
     std::stringstream ss;
@@ -156,6 +198,48 @@ NFServer::Proto_MasterTMonitorReloadReq Proto_MasterTMonitorReloadReq::ToPb() co
     return cc;
 }
 
+bool Proto_MasterTMonitorReloadReq::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MasterTMonitorReloadReq cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MasterTMonitorReloadReq::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MasterTMonitorReloadReq::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorReloadReq cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MasterTMonitorReloadReq::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MasterTMonitorReloadReq::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorReloadReq cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MasterTMonitorReloadReq::ShortDebugString() const
 {
     std::stringstream ss;
@@ -235,6 +319,48 @@ NFServer::Proto_MasterTMonitorRestartReq Proto_MasterTMonitorRestartReq::ToPb()
     return cc;
 }
 
+bool Proto_MasterTMonitorRestartReq::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MasterTMonitorRestartReq cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MasterTMonitorRestartReq::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MasterTMonitorRestartReq::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorRestartReq cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MasterTMonitorRestartReq::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MasterTMonitorRestartReq::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorRestartReq cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MasterTMonitorRestartReq::ShortDebugString() const
 {
     std::stringstream ss;
@@ -314,6 +440,48 @@ NFServer::Proto_MasterTMonitorStartReq Proto_MasterTMonitorStartReq::ToPb() cons
     return cc;
 }
 
+bool Proto_MasterTMonitorStartReq::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MasterTMonitorStartReq cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MasterTMonitorStartReq::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MasterTMonitorStartReq::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorStartReq cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MasterTMonitorStartReq::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MasterTMonitorStartReq::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorStartReq cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MasterTMonitorStartReq::ShortDebugString() const
 {
     std::stringstream ss;
@@ -393,6 +561,48 @@ NFServer::Proto_MasterTMonitorStopReq Proto_MasterTMonitorStopReq::ToPb() const
     return cc;
 }
 
+bool Proto_MasterTMonitorStopReq::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MasterTMonitorStopReq cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MasterTMonitorStopReq::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MasterTMonitorStopReq::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorStopReq cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MasterTMonitorStopReq::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MasterTMonitorStopReq::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MasterTMonitorStopReq cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MasterTMonitorStopReq::ShortDebugString() const
 {
     std::stringstream ss;
@@ -477,6 +687,48 @@ NFServer::Proto_MonitorTMasterReloadRsp Proto_MonitorTMasterReloadRsp::ToPb() co
     return cc;
 }
 
+bool Proto_MonitorTMasterReloadRsp::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MonitorTMasterReloadRsp cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MonitorTMasterReloadRsp::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MonitorTMasterReloadRsp::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterReloadRsp cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MonitorTMasterReloadRsp::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MonitorTMasterReloadRsp::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterReloadRsp cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MonitorTMasterReloadRsp::ShortDebugString() const
 {
     std::stringstream ss;
@@ -562,6 +814,48 @@ NFServer::Proto_MonitorTMasterRestartRsp Proto_MonitorTMasterRestartRsp::ToPb()
     return cc;
 }
 
+bool Proto_MonitorTMasterRestartRsp::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MonitorTMasterRestartRsp cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MonitorTMasterRestartRsp::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MonitorTMasterRestartRsp::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterRestartRsp cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MonitorTMasterRestartRsp::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MonitorTMasterRestartRsp::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterRestartRsp cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MonitorTMasterRestartRsp::ShortDebugString() const
 {
     std::stringstream ss;
@@ -647,6 +941,48 @@ NFServer::Proto_MonitorTMasterStartRsp Proto_MonitorTMasterStartRsp::ToPb() cons
     return cc;
 }
 
+bool Proto_MonitorTMasterStartRsp::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MonitorTMasterStartRsp cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MonitorTMasterStartRsp::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MonitorTMasterStartRsp::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterStartRsp cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MonitorTMasterStartRsp::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MonitorTMasterStartRsp::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterStartRsp cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MonitorTMasterStartRsp::ShortDebugString() const
 {
     std::stringstream ss;
@@ -732,6 +1068,48 @@ NFServer::Proto_MonitorTMasterStopRsp Proto_MonitorTMasterStopRsp::ToPb() const
     return cc;
 }
 
+bool Proto_MonitorTMasterStopRsp::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_MonitorTMasterStopRsp cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_MonitorTMasterStopRsp::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_MonitorTMasterStopRsp::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterStopRsp cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_MonitorTMasterStopRsp::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_MonitorTMasterStopRsp::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_MonitorTMasterStopRsp cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_MonitorTMasterStopRsp::ShortDebugString() const
 {
     std::stringstream ss;
@@ -806,6 +1184,48 @@ NFServer::Proto_STStoreCheckReq Proto_STStoreCheckReq::ToPb() const
     return cc;
 }
 
+bool Proto_STStoreCheckReq::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_STStoreCheckReq cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_STStoreCheckReq::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_STStoreCheckReq::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_STStoreCheckReq cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_STStoreCheckReq::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_STStoreCheckReq::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_STStoreCheckReq cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_STStoreCheckReq::ShortDebugString() const
 {
     std::stringstream ss;
@@ -877,6 +1297,48 @@ NFServer::Proto_StoreTSCheckRsp Proto_StoreTSCheckRsp::ToPb() const
     return cc;
 }
 
+bool Proto_StoreTSCheckRsp::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_StoreTSCheckRsp cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_StoreTSCheckRsp::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_StoreTSCheckRsp::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_StoreTSCheckRsp cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_StoreTSCheckRsp::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_StoreTSCheckRsp::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_StoreTSCheckRsp cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_StoreTSCheckRsp::ShortDebugString() const
 {
     std::stringstream ss;
@@ -959,6 +1421,48 @@ NFServer::Proto_TestSendProxyMsgToOtherServer Proto_TestSendProxyMsgToOtherServe
     return cc;
 }
 
+bool Proto_TestSendProxyMsgToOtherServer::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_TestSendProxyMsgToOtherServer cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_TestSendProxyMsgToOtherServer::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_TestSendProxyMsgToOtherServer::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestSendProxyMsgToOtherServer cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_TestSendProxyMsgToOtherServer::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_TestSendProxyMsgToOtherServer::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestSendProxyMsgToOtherServer cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_TestSendProxyMsgToOtherServer::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1044,6 +1548,48 @@ NFServer::Proto_TestOtherServerSendMsgToProxyServer Proto_TestOtherServerSendMsg
     return cc;
 }
 
+bool Proto_TestOtherServerSendMsgToProxyServer::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_TestOtherServerSendMsgToProxyServer cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_TestOtherServerSendMsgToProxyServer::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_TestOtherServerSendMsgToProxyServer::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestOtherServerSendMsgToProxyServer cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_TestOtherServerSendMsgToProxyServer::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_TestOtherServerSendMsgToProxyServer::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestOtherServerSendMsgToProxyServer cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_TestOtherServerSendMsgToProxyServer::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1129,6 +1675,48 @@ NFServer::Proto_TestSendWorldMsgToOtherServer Proto_TestSendWorldMsgToOtherServe
     return cc;
 }
 
+bool Proto_TestSendWorldMsgToOtherServer::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_TestSendWorldMsgToOtherServer cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_TestSendWorldMsgToOtherServer::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_TestSendWorldMsgToOtherServer::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestSendWorldMsgToOtherServer cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_TestSendWorldMsgToOtherServer::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_TestSendWorldMsgToOtherServer::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestSendWorldMsgToOtherServer cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_TestSendWorldMsgToOtherServer::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1214,6 +1802,48 @@ NFServer::Proto_TestOtherServerToWorldServer Proto_TestOtherServerToWorldServer:
     return cc;
 }
 
+bool Proto_TestOtherServerToWorldServer::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::Proto_TestOtherServerToWorldServer cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_TestOtherServerToWorldServer::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_TestOtherServerToWorldServer::ParseFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestOtherServerToWorldServer cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_TestOtherServerToWorldServer::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_TestOtherServerToWorldServer::MergeFrom(NFWireReader& reader)
+{
+    NFServer::Proto_TestOtherServerToWorldServer cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_TestOtherServerToWorldServer::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1291,6 +1921,48 @@ NFServer::RpcRequestGetServerInfo RpcRequestGetServerInfo::ToPb() const
     return cc;
 }
 
+bool RpcRequestGetServerInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::RpcRequestGetServerInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int RpcRequestGetServerInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool RpcRequestGetServerInfo::ParseFrom(NFWireReader& reader)
+{
+    NFServer::RpcRequestGetServerInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool RpcRequestGetServerInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool RpcRequestGetServerInfo::MergeFrom(NFWireReader& reader)
+{
+    NFServer::RpcRequestGetServerInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string RpcRequestGetServerInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1383,6 +2055,48 @@ NFServer::RpcWatchServerReqeust RpcWatchServerReqeust::ToPb() const
     return cc;
 }
 
+bool RpcWatchServerReqeust::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::RpcWatchServerReqeust cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int RpcWatchServerReqeust::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool RpcWatchServerReqeust::ParseFrom(NFWireReader& reader)
+{
+    NFServer::RpcWatchServerReqeust cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool RpcWatchServerReqeust::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool RpcWatchServerReqeust::MergeFrom(NFWireReader& reader)
+{
+    NFServer::RpcWatchServerReqeust cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string RpcWatchServerReqeust::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1463,6 +2177,48 @@ NFServer::RpcWatchServerRespone RpcWatchServerRespone::ToPb() const
     return cc;
 }
 
+bool RpcWatchServerRespone::SerializeTo(NFWireWriter& writer) const
+{
+    NFServer::RpcWatchServerRespone cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int RpcWatchServerRespone::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool RpcWatchServerRespone::ParseFrom(NFWireReader& reader)
+{
+    NFServer::RpcWatchServerRespone cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool RpcWatchServerRespone::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool RpcWatchServerRespone::MergeFrom(NFWireReader& reader)
+{
+    NFServer::RpcWatchServerRespone cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string RpcWatchServerRespone::ShortDebugString() const
 {
     std::stringstream ss;
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include <pb.h>
 
 #include "ServerMsg.pb.h"
@@ -48,6 +49,11 @@ struct Proto_STStoreCheckReq {
     bool FromPb(const NFServer::Proto_STStoreCheckReq& cc);
     void ToPb(NFServer::Proto_STStoreCheckReq* cc) const;
     NFServer::Proto_STStoreCheckReq ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_STStoreCheckReq) */
@@ -67,6 +73,11 @@ struct Proto_StoreTSCheckRsp {
     bool FromPb(const NFServer::Proto_StoreTSCheckRsp& cc);
     void ToPb(NFServer::Proto_StoreTSCheckRsp* cc) const;
     NFServer::Proto_StoreTSCheckRsp ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_StoreTSCheckRsp) */
@@ -86,6 +97,11 @@ struct CommonMsgRsp {
     bool FromPb(const NFServer::CommonMsgRsp& cc);
     void ToPb(NFServer::CommonMsgRsp* cc) const;
     NFServer::CommonMsgRsp ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:CommonMsgRsp) */
@@ -106,6 +122,11 @@ struct Proto_MasterTMonitorReloadReq {
     bool FromPb(const NFServer::Proto_MasterTMonitorReloadReq& cc);
     void ToPb(NFServer::Proto_MasterTMonitorReloadReq* cc) const;
     NFServer::Proto_MasterTMonitorReloadReq ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MasterTMonitorReloadReq) */
@@ -126,6 +147,11 @@ struct Proto_MasterTMonitorRestartReq {
     bool FromPb(const NFServer::Proto_MasterTMonitorRestartReq& cc);
     void ToPb(NFServer::Proto_MasterTMonitorRestartReq* cc) const;
     NFServer::Proto_MasterTMonitorRestartReq ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MasterTMonitorRestartReq) */
@@ -146,6 +172,11 @@ struct Proto_MasterTMonitorStartReq {
     bool FromPb(const NFServer::Proto_MasterTMonitorStartReq& cc);
     void ToPb(NFServer::Proto_MasterTMonitorStartReq* cc) const;
     NFServer::Proto_MasterTMonitorStartReq ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MasterTMonitorStartReq) */
@@ -166,6 +197,11 @@ struct Proto_MasterTMonitorStopReq {
     bool FromPb(const NFServer::Proto_MasterTMonitorStopReq& cc);
     void ToPb(NFServer::Proto_MasterTMonitorStopReq* cc) const;
     NFServer::Proto_MasterTMonitorStopReq ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MasterTMonitorStopReq) */
@@ -187,6 +223,11 @@ struct Proto_MonitorTMasterReloadRsp {
     bool FromPb(const NFServer::Proto_MonitorTMasterReloadRsp& cc);
     void ToPb(NFServer::Proto_MonitorTMasterReloadRsp* cc) const;
     NFServer::Proto_MonitorTMasterReloadRsp ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MonitorTMasterReloadRsp) */
@@ -208,6 +249,11 @@ struct Proto_MonitorTMasterRestartRsp {
     bool FromPb(const NFServer::Proto_MonitorTMasterRestartRsp& cc);
     void ToPb(NFServer::Proto_MonitorTMasterRestartRsp* cc) const;
     NFServer::Proto_MonitorTMasterRestartRsp ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MonitorTMasterRestartRsp) */
@@ -229,6 +275,11 @@ struct Proto_MonitorTMasterStartRsp {
     bool FromPb(const NFServer::Proto_MonitorTMasterStartRsp& cc);
     void ToPb(NFServer::Proto_MonitorTMasterStartRsp* cc) const;
     NFServer::Proto_MonitorTMasterStartRsp ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MonitorTMasterStartRsp) */
@@ -250,6 +301,11 @@ struct Proto_MonitorTMasterStopRsp {
     bool FromPb(const NFServer::Proto_MonitorTMasterStopRsp& cc);
     void ToPb(NFServer::Proto_MonitorTMasterStopRsp* cc) const;
     NFServer::Proto_MonitorTMasterStopRsp ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_MonitorTMasterStopRsp) */
@@ -271,6 +327,11 @@ struct Proto_TestOtherServerSendMsgToProxyServer {
     bool FromPb(const NFServer::Proto_TestOtherServerSendMsgToProxyServer& cc);
     void ToPb(NFServer::Proto_TestOtherServerSendMsgToProxyServer* cc) const;
     NFServer::Proto_TestOtherServerSendMsgToProxyServer ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_TestOtherServerSendMsgToProxyServer) */
@@ -292,6 +353,11 @@ struct Proto_TestOtherServerToWorldServer {
     bool FromPb(const NFServer::Proto_TestOtherServerToWorldServer& cc);
     void ToPb(NFServer::Proto_TestOtherServerToWorldServer* cc) const;
     NFServer::Proto_TestOtherServerToWorldServer ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_TestOtherServerToWorldServer) */
@@ -313,6 +379,11 @@ struct Proto_TestSendProxyMsgToOtherServer {
     bool FromPb(const NFServer::Proto_TestSendProxyMsgToOtherServer& cc);
     void ToPb(NFServer::Proto_TestSendProxyMsgToOtherServer* cc) const;
     NFServer::Proto_TestSendProxyMsgToOtherServer ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_TestSendProxyMsgToOtherServer) */
@@ -334,6 +405,11 @@ struct Proto_TestSendWorldMsgToOtherServer {
     bool FromPb(const NFServer::Proto_TestSendWorldMsgToOtherServer& cc);
     void ToPb(NFServer::Proto_TestSendWorldMsgToOtherServer* cc) const;
     NFServer::Proto_TestSendWorldMsgToOtherServer ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_TestSendWorldMsgToOtherServer) */
@@ -353,6 +429,11 @@ struct RpcRequestGetServerInfo {
     bool FromPb(const NFServer::RpcRequestGetServerInfo& cc);
     void ToPb(NFServer::RpcRequestGetServerInfo* cc) const;
     NFServer::RpcRequestGetServerInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:RpcRequestGetServerInfo) */
@@ -375,6 +456,11 @@ struct RpcWatchServerReqeust {
     bool FromPb(const NFServer::RpcWatchServerReqeust& cc);
     void ToPb(NFServer::RpcWatchServerReqeust* cc) const;
     NFServer::RpcWatchServerReqeust ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:RpcWatchServerReqeust) */
@@ -394,6 +480,11 @@ struct RpcWatchServerRespone {
     bool FromPb(const NFServer::RpcWatchServerRespone& cc);
     void ToPb(NFServer::RpcWatchServerRespone* cc) const;
     NFServer::RpcWatchServerRespone ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:RpcWatchServerRespone) */
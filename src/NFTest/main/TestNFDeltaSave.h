@@ -0,0 +1,181 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFDeltaSave.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/31
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFDeltaSave
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFObjCommon/NFSeqOP.h"
+#include "NFComm/NFPluginModule/NFProtobufCommon.h"
+#include "google/protobuf/descriptor.pb.h"
+#include "google/protobuf/dynamic_message.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * 按字段增量存储测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. MakeDeltaSaveData按字段修改掩码清空没改过的顶层字段, 主键和唯一索引一直保留
+ * 2. 没有主键的消息不做修改, 返回false
+ * 3. FilterDBFieldsByTopFields只保留属于修改字段的列(含展开的子字段), 主键列保留
+ ****************************************************************************/
+
+/**
+ * @brief 用DescriptorPool动态构造带nanopb db_type的存储消息, 不依赖业务的proto
+ *
+ * message tbDeltaTest {
+ *     optional uint64 id = 1 [(nanopb).db_type = E_FIELD_TYPE_PRIMARYKEY];
+ *     optional string name = 2 [(nanopb).db_type = E_FIELD_TYPE_UNIQUE_INDEX];
+ *     optional int32 level = 3;
+ *     optional int64 gold = 4;
+ *     optional bytes data = 70;
+ * }
+ */
+class NFDeltaSaveTestMsg
+{
+public:
+    explicit NFDeltaSaveTestMsg(bool bWithKey = true) : m_pool(google::protobuf::DescriptorPool::generated_pool())
+    {
+        google::protobuf::FileDescriptorProto file;
+        file.set_name(bWithKey ? "delta_test_key.proto" : "delta_test_nokey.proto");
+        file.set_package("delta_test");
+        google::protobuf::DescriptorProto* pMsg = file.add_message_type();
+        pMsg->set_name("tbDeltaTest");
+        AddField(pMsg, "id", 1, google::protobuf::FieldDescriptorProto::TYPE_UINT64, bWithKey ? E_FIELD_TYPE_PRIMARYKEY : E_FIELD_TYPE_NORMAL);
+        AddField(pMsg, "name", 2, google::protobuf::FieldDescriptorProto::TYPE_STRING, bWithKey ? E_FIELD_TYPE_UNIQUE_INDEX : E_FIELD_TYPE_NORMAL);
+        AddField(pMsg, "level", 3, google::protobuf::FieldDescriptorProto::TYPE_INT32, E_FIELD_TYPE_NORMAL);
+        AddField(pMsg, "gold", 4, google::protobuf::FieldDescriptorProto::TYPE_INT64, E_FIELD_TYPE_NORMAL);
+        AddField(pMsg, "data", 70, google::protobuf::FieldDescriptorProto::TYPE_BYTES, E_FIELD_TYPE_NORMAL);
+
+        const google::protobuf::FileDescriptor* pFile = m_pool.BuildFile(file);
+        m_pDesc = pFile ? pFile->FindMessageTypeByName("tbDeltaTest") : nullptr;
+        if (m_pDesc)
+        {
+            m_pMessage.reset(m_factory.GetPrototype(m_pDesc)->New());
+            const google::protobuf::Reflection* pReflect = m_pMessage->GetReflection();
+            pReflect->SetUInt64(m_pMessage.get(), m_pDesc->FindFieldByName("id"), 10001);
+            pReflect->SetString(m_pMessage.get(), m_pDesc->FindFieldByName("name"), "player");
+            pReflect->SetInt32(m_pMessage.get(), m_pDesc->FindFieldByName("level"), 30);
+            pReflect->SetInt64(m_pMessage.get(), m_pDesc->FindFieldByName("gold"), 123456);
+            pReflect->SetString(m_pMessage.get(), m_pDesc->FindFieldByName("data"), std::string(256, 'x'));
+        }
+    }
+
+    bool Has(const std::string& name) const
+    {
+        return m_pMessage->GetReflection()->HasField(*m_pMessage, m_pDesc->FindFieldByName(name));
+    }
+
+    const google::protobuf::Descriptor* m_pDesc;
+    std::unique_ptr<google::protobuf::Message> m_pMessage;
+
+private:
+    static void AddField(google::protobuf::DescriptorProto* pMsg, const std::string& name, int number, google::protobuf::FieldDescriptorProto::Type type, int dbType)
+    {
+        google::protobuf::FieldDescriptorProto* pField = pMsg->add_field();
+        pField->set_name(name);
+        pField->set_number(number);
+        pField->set_type(type);
+        pField->set_label(google::protobuf::FieldDescriptorProto::LABEL_OPTIONAL);
+        pField->mutable_options()->MutableExtension(nanopb)->set_db_type(static_cast<enum_field_type>(dbType));
+    }
+
+    google::protobuf::DescriptorPool m_pool;
+    google::protobuf::DynamicMessageFactory m_factory;
+};
+
+TEST(NFDeltaSaveTest, MakeDeltaSaveData)
+{
+    NFDeltaSaveTestMsg msg;
+    ASSERT_TRUE(msg.m_pDesc != nullptr);
+    int fullBytes = msg.m_pMessage->ByteSize();
+
+    std::vector<std::string> vecFields;
+    EXPECT_TRUE(NFProtobufCommon::MakeDeltaSaveData(msg.m_pMessage.get(), SEQOP_FIELD_MASK(3), vecFields));
+    ASSERT_EQ(1u, vecFields.size());
+    EXPECT_EQ("level", vecFields[0]);
+
+    //主键和唯一索引是更新条件, 一直保留
+    EXPECT_TRUE(msg.Has("id"));
+    EXPECT_TRUE(msg.Has("name"));
+    EXPECT_TRUE(msg.Has("level"));
+    EXPECT_FALSE(msg.Has("gold"));
+    EXPECT_FALSE(msg.Has("data"));
+    EXPECT_LT(msg.m_pMessage->ByteSize(), fullBytes);
+}
+
+TEST(NFDeltaSaveTest, MakeDeltaSaveDataHighFieldNumber)
+{
+    //编号大于等于63的字段共用最高位
+    NFDeltaSaveTestMsg msg;
+    ASSERT_TRUE(msg.m_pDesc != nullptr);
+    std::vector<std::string> vecFields;
+    EXPECT_TRUE(NFProtobufCommon::MakeDeltaSaveData(msg.m_pMessage.get(), SEQOP_FIELD_MASK(4) | SEQOP_FIELD_MASK(70), vecFields));
+    ASSERT_EQ(2u, vecFields.size());
+    EXPECT_EQ("gold", vecFields[0]);
+    EXPECT_EQ("data", vecFields[1]);
+    EXPECT_FALSE(msg.Has("level"));
+    EXPECT_TRUE(msg.Has("data"));
+    EXPECT_EQ(SEQOP_FIELD_MASK(63), SEQOP_FIELD_MASK(70));
+}
+
+TEST(NFDeltaSaveTest, MakeDeltaSaveDataNoKey)
+{
+    NFDeltaSaveTestMsg msg(false);
+    ASSERT_TRUE(msg.m_pDesc != nullptr);
+    std::string before = msg.m_pMessage->SerializeAsString();
+
+    std::vector<std::string> vecFields;
+    EXPECT_FALSE(NFProtobufCommon::MakeDeltaSaveData(msg.m_pMessage.get(), SEQOP_FIELD_MASK(3), vecFields));
+    EXPECT_TRUE(vecFields.empty());
+    EXPECT_EQ(before, msg.m_pMessage->SerializeAsString());
+}
+
+TEST(NFDeltaSaveTest, FilterDBFieldsByTopFields)
+{
+    std::map<std::string, std::string> keyMap;
+    keyMap["id"] = "10001";
+
+    std::map<std::string, std::string> kevValueMap;
+    kevValueMap["id"] = "10001";
+    kevValueMap["level"] = "30";
+    kevValueMap["levelup_time"] = "100";
+    kevValueMap["gold"] = "123456";
+    kevValueMap["base_hp"] = "10";
+    kevValueMap["base_mp"] = "20";
+    kevValueMap["base"] = "1";
+    kevValueMap["bag_1"] = "a";
+    kevValueMap["bag_2"] = "b";
+
+    google::protobuf::RepeatedPtrField<std::string> topFields;
+    *topFields.Add() = "level";
+    *topFields.Add() = "base";
+    *topFields.Add() = "bag";
+    NFProtobufCommon::FilterDBFieldsByTopFields(topFields, keyMap, kevValueMap);
+
+    //levelup_time只是前缀相同, 不属于level
+    std::map<std::string, std::string> expect;
+    expect["id"] = "10001";
+    expect["level"] = "30";
+    expect["base_hp"] = "10";
+    expect["base_mp"] = "20";
+    expect["base"] = "1";
+    expect["bag_1"] = "a";
+    expect["bag_2"] = "b";
+    EXPECT_EQ(expect, kevValueMap);
+
+    //没有指定字段时不过滤
+    google::protobuf::RepeatedPtrField<std::string> emptyFields;
+    std::map<std::string, std::string> all = expect;
+    NFProtobufCommon::FilterDBFieldsByTopFields(emptyFields, keyMap, all);
+    EXPECT_EQ(expect, all);
+}
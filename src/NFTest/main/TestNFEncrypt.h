@@ -0,0 +1,225 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFEncrypt.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/22
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFEncrypt
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFCommPlugin/NFNetPlugin/Encrypt.h"
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * 连接加密测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. ChaCha20结果和RFC 7539测试向量一致
+ * 2. 标量/SSE2/AVX2实现输出一致, 分多次处理和一次处理结果一致
+ * 3. 两端握手后能互相解密, 主密钥不同时解不出原文
+ * 4. 统计各实现对64B~64KB包的吞吐
+ ****************************************************************************/
+
+class NFEncryptTest : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        m_oldKernel = NFChaCha20::GetKernel();
+        for (int i = 0; i < NF_CHACHA20_KEY_SIZE; i++)
+        {
+            m_key[i] = i;
+        }
+        memset(m_nonce, 0, sizeof(m_nonce));
+        m_nonce[7] = 0x4a;
+    }
+
+    virtual void TearDown()
+    {
+        NFChaCha20::SetKernel(m_oldKernel);
+    }
+
+    //当前CPU支持的实现
+    std::vector<int> GetKernels()
+    {
+        std::vector<int> vecKernel;
+        for (int kernel = NF_CHACHA20_KERNEL_SCALAR; kernel <= NF_CHACHA20_KERNEL_AVX2; kernel++)
+        {
+            if (NFChaCha20::SetKernel(kernel) == 0)
+            {
+                vecKernel.push_back(kernel);
+            }
+        }
+        NFChaCha20::SetKernel(m_oldKernel);
+        return vecKernel;
+    }
+
+    std::string Encrypt(int kernel, const std::string& data, uint32_t counter)
+    {
+        NFChaCha20::SetKernel(kernel);
+        NFChaCha20 stream;
+        stream.Init(m_key, m_nonce, counter);
+        std::string out = data;
+        stream.Process(&out[0], out.size());
+        return out;
+    }
+
+    int m_oldKernel;
+    uint8_t m_key[NF_CHACHA20_KEY_SIZE];
+    uint8_t m_nonce[NF_CHACHA20_NONCE_SIZE];
+};
+
+//RFC 7539 2.4.2
+TEST_F(NFEncryptTest, Rfc7539Vector)
+{
+    std::string plain = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it.";
+    static const uint8_t cipher[] = {
+        0x6e, 0x2e, 0x35, 0x9a, 0x25, 0x68, 0xf9, 0x80, 0x41, 0xba, 0x07, 0x28, 0xdd, 0x0d, 0x69, 0x81,
+        0xe9, 0x7e, 0x7a, 0xec, 0x1d, 0x43, 0x60, 0xc2, 0x0a, 0x27, 0xaf, 0xcc, 0xfd, 0x9f, 0xae, 0x0b,
+        0xf9, 0x1b, 0x65, 0xc5, 0x52, 0x47, 0x33, 0xab, 0x8f, 0x59, 0x3d, 0xab, 0xcd, 0x62, 0xb3, 0x57,
+        0x16, 0x39, 0xd6, 0x24, 0xe6, 0x51, 0x52, 0xab, 0x8f, 0x53, 0x0c, 0x35, 0x9f, 0x08, 0x61, 0xd8,
+        0x07, 0xca, 0x0d, 0xbf, 0x50, 0x0d, 0x6a, 0x61, 0x56, 0xa3, 0x8e, 0x08, 0x8a, 0x22, 0xb6, 0x5e,
+        0x52, 0xbc, 0x51, 0x4d, 0x16, 0xcc, 0xf8, 0x06, 0x81, 0x8c, 0xe9, 0x1a, 0xb7, 0x79, 0x37, 0x36,
+        0x5a, 0xf9, 0x0b, 0xbf, 0x74, 0xa3, 0x5b, 0xe6, 0xb4, 0x0b, 0x8e, 0xed, 0xf2, 0x78, 0x5e, 0x42,
+        0x87, 0x4d,
+    };
+    ASSERT_EQ(plain.size(), sizeof(cipher));
+
+    std::vector<int> vecKernel = GetKernels();
+    for (size_t i = 0; i < vecKernel.size(); i++)
+    {
+        std::string out = Encrypt(vecKernel[i], plain, 1);
+        EXPECT_EQ(0, memcmp(out.data(), cipher, sizeof(cipher))) << "kernel:" << vecKernel[i];
+    }
+}
+
+TEST_F(NFEncryptTest, KernelsMatchScalar)
+{
+    std::mt19937 random(12345);
+    std::string data(64 * 1024 + 37, '\0');
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<char>(random());
+    }
+
+    std::string expect = Encrypt(NF_CHACHA20_KERNEL_SCALAR, data, 1);
+    std::vector<int> vecKernel = GetKernels();
+    for (size_t i = 0; i < vecKernel.size(); i++)
+    {
+        EXPECT_EQ(expect, Encrypt(vecKernel[i], data, 1)) << "kernel:" << vecKernel[i];
+
+        //切成长短不一的片段, 片段边界不对齐块
+        NFChaCha20::SetKernel(vecKernel[i]);
+        NFChaCha20 stream;
+        stream.Init(m_key, m_nonce, 1);
+        std::string out = data;
+        size_t pos = 0;
+        while (pos < out.size())
+        {
+            size_t len = std::min<size_t>(random() % 1500, out.size() - pos);
+            stream.Process(&out[pos], len);
+            pos += len;
+        }
+        EXPECT_EQ(expect, out) << "kernel:" << vecKernel[i];
+    }
+}
+
+//块计数溢出时进位到nonce, 批量实现在溢出前交给标量实现
+TEST_F(NFEncryptTest, CounterCarry)
+{
+    std::string data(1024, 'x');
+    std::string expect = Encrypt(NF_CHACHA20_KERNEL_SCALAR, data, 0xFFFFFFFC);
+    std::vector<int> vecKernel = GetKernels();
+    for (size_t i = 0; i < vecKernel.size(); i++)
+    {
+        EXPECT_EQ(expect, Encrypt(vecKernel[i], data, 0xFFFFFFFC)) << "kernel:" << vecKernel[i];
+    }
+
+    //进位后第5块等于nonce第一个字加1, 计数为0的块
+    NFChaCha20::SetKernel(NF_CHACHA20_KERNEL_SCALAR);
+    m_nonce[0] = 1;
+    std::string next = Encrypt(NF_CHACHA20_KERNEL_SCALAR, std::string(64, 'x'), 0);
+    EXPECT_EQ(next, expect.substr(4 * NF_CHACHA20_BLOCK_SIZE, NF_CHACHA20_BLOCK_SIZE));
+}
+
+TEST_F(NFEncryptTest, HelloRoundTrip)
+{
+    NFEncryptKey key("server_encrypt_key");
+    NFConnCipher client;
+    NFConnCipher server;
+    char clientHello[NF_ENCRYPT_HELLO_SIZE];
+    char serverHello[NF_ENCRYPT_HELLO_SIZE];
+    client.MakeHello(key, clientHello);
+    server.MakeHello(key, serverHello);
+    EXPECT_FALSE(server.IsRecvReady());
+    ASSERT_EQ(0, server.OnHello(key, clientHello));
+    ASSERT_EQ(0, client.OnHello(key, serverHello));
+    EXPECT_TRUE(server.IsRecvReady());
+
+    //两次连接的nonce不同
+    EXPECT_NE(0, memcmp(clientHello, serverHello, NF_ENCRYPT_HELLO_SIZE));
+
+    std::string plain(3000, 'a');
+    std::string data = plain;
+    client.Encrypt(&data[0], 1000);
+    client.Encrypt(&data[1000], 2000);
+    EXPECT_NE(plain, data);
+    server.Decrypt(&data[0], 1500);
+    server.Decrypt(&data[1500], 1500);
+    EXPECT_EQ(plain, data);
+
+    data = plain;
+    server.Encrypt(&data[0], data.size());
+    client.Decrypt(&data[0], data.size());
+    EXPECT_EQ(plain, data);
+
+    //主密钥不同
+    NFEncryptKey otherKey("other_key");
+    NFConnCipher other;
+    data = plain;
+    NFConnCipher sender;
+    char hello[NF_ENCRYPT_HELLO_SIZE];
+    sender.MakeHello(key, hello);
+    ASSERT_EQ(0, other.OnHello(otherKey, hello));
+    sender.Encrypt(&data[0], data.size());
+    other.Decrypt(&data[0], data.size());
+    EXPECT_NE(plain, data);
+
+    hello[0] ^= 1;
+    EXPECT_EQ(-1, other.OnHello(key, hello));
+}
+
+TEST_F(NFEncryptTest, BenchmarkFrameSize)
+{
+    static const size_t frameSize[] = {64, 256, 1024, 4096, 16384, 65536};
+    static const char* kernelName[] = {"scalar", "sse2", "avx2"};
+    std::vector<int> vecKernel = GetKernels();
+    std::string data(65536, 'b');
+    for (size_t k = 0; k < vecKernel.size(); k++)
+    {
+        NFChaCha20::SetKernel(vecKernel[k]);
+        NFChaCha20 stream;
+        stream.Init(m_key, m_nonce, 1);
+        for (size_t f = 0; f < sizeof(frameSize) / sizeof(frameSize[0]); f++)
+        {
+            //每种包长处理约16MB
+            size_t loop = 16 * 1024 * 1024 / frameSize[f];
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < loop; i++)
+            {
+                stream.Process(&data[0], frameSize[f]);
+            }
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            double bytes = static_cast<double>(loop * frameSize[f]);
+            printf("kernel:%-6s frame:%-6zu %.2fns/B %.1fMB/s\n", kernelName[vecKernel[k]], frameSize[f], ns / bytes, bytes / ns * 1000.0);
+        }
+    }
+}
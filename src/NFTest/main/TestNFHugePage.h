@@ -0,0 +1,269 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFHugePage.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/28
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFHugePage
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFCore/NFHugePage.h"
+
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+#include <chrono>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/ipc.h>
+#include <sys/mman.h>
+#include <sys/shm.h>
+#include <sys/syscall.h>
+
+/****************************************************************************
+ * 共享内存大页/NUMA/预缺页测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. /proc/meminfo解析, 大小对齐, smaps里按地址找页大小
+ * 2. Prefault之后所有页都已经分配, 数据不变
+ * 3. NUMA绑定参数检查
+ * 4. 对比普通页和大页下随机访问的耗时和dTLB miss(perf_event_open不可用时只输出耗时),
+ *    以及预缺页前后第一次访问的耗时
+ ****************************************************************************/
+
+TEST(NFHugePageTest, ParseMemInfo)
+{
+    std::string strMemInfo = "MemTotal:       32768000 kB\n"
+                             "HugePages_Total:      16\n"
+                             "HugePages_Free:       10\n"
+                             "Hugepagesize:       2048 kB\n";
+    EXPECT_EQ(2048u * 1024u, NFHugePage::ParseMemInfo(strMemInfo, "Hugepagesize"));
+    EXPECT_EQ(10u, NFHugePage::ParseMemInfo(strMemInfo, "HugePages_Free"));
+    EXPECT_EQ(32768000ull * 1024ull, NFHugePage::ParseMemInfo(strMemInfo, "MemTotal"));
+    EXPECT_EQ(0u, NFHugePage::ParseMemInfo(strMemInfo, "HugePages_F"));
+    EXPECT_EQ(0u, NFHugePage::ParseMemInfo(strMemInfo, "Hugetlb"));
+
+    EXPECT_EQ(0u, NFHugePage::AlignSize(0, 4096));
+    EXPECT_EQ(4096u, NFHugePage::AlignSize(1, 4096));
+    EXPECT_EQ(4096u, NFHugePage::AlignSize(4096, 4096));
+    EXPECT_EQ(4u * 1024 * 1024, NFHugePage::AlignSize(2 * 1024 * 1024 + 1, 2 * 1024 * 1024));
+    EXPECT_EQ(100u, NFHugePage::AlignSize(100, 0));
+    EXPECT_GE(NFHugePage::GetNumaNodeCount(), 1);
+}
+
+TEST(NFHugePageTest, ParseSmapsPageSize)
+{
+    std::string strSmaps = "7f0000000000-7f0000200000 rw-s 00000000 00:0f 32768                      /SYSV00001234 (deleted)\n"
+                           "Size:               2048 kB\n"
+                           "KernelPageSize:     2048 kB\n"
+                           "MMUPageSize:        2048 kB\n"
+                           "VmFlags: rd wr sh mr mw me ms de ht sd\n"
+                           "7f0000200000-7f0000201000 rw-p 00000000 00:00 0\n"
+                           "Size:                  4 kB\n"
+                           "KernelPageSize:        4 kB\n";
+    EXPECT_EQ(2048u * 1024u, NFHugePage::ParseSmapsPageSize(strSmaps, 0x7f0000100000ull));
+    EXPECT_EQ(4096u, NFHugePage::ParseSmapsPageSize(strSmaps, 0x7f0000200000ull));
+    EXPECT_EQ(0u, NFHugePage::ParseSmapsPageSize(strSmaps, 0x7f0000201000ull));
+
+    //普通页的共享内存
+    int shmId = shmget(IPC_PRIVATE, 4 * 1024 * 1024, IPC_CREAT | 0600);
+    ASSERT_GE(shmId, 0);
+    void* pAddr = shmat(shmId, NULL, 0);
+    shmctl(shmId, IPC_RMID, NULL);
+    ASSERT_NE(reinterpret_cast<void*>(-1), pAddr);
+    EXPECT_FALSE(NFHugePage::IsHugeTlbMapping(pAddr));
+    shmdt(pAddr);
+}
+
+TEST(NFHugePageTest, PrefaultKeepData)
+{
+    const size_t size = 16 * 1024 * 1024;
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    int shmId = shmget(IPC_PRIVATE, size, IPC_CREAT | 0600);
+    ASSERT_GE(shmId, 0);
+    char* pAddr = static_cast<char*>(shmat(shmId, NULL, 0));
+    shmctl(shmId, IPC_RMID, NULL);
+    ASSERT_NE(reinterpret_cast<char*>(-1), pAddr);
+
+    //只写一半的页, 另一半还没分配物理页
+    for (size_t i = 0; i < size; i += pageSize * 2)
+    {
+        pAddr[i] = static_cast<char>(i / pageSize);
+    }
+
+    NFHugePage::Prefault(pAddr, size);
+
+    std::vector<unsigned char> vecResident(size / pageSize);
+    ASSERT_EQ(0, mincore(pAddr, size, vecResident.data()));
+    size_t resident = 0;
+    for (size_t i = 0; i < vecResident.size(); i++)
+    {
+        resident += vecResident[i] & 1;
+    }
+    EXPECT_EQ(vecResident.size(), resident);
+
+    for (size_t i = 0; i < size; i += pageSize)
+    {
+        char expect = (i / pageSize) % 2 == 0 ? static_cast<char>(i / pageSize) : 0;
+        ASSERT_EQ(expect, pAddr[i]);
+    }
+    shmdt(pAddr);
+}
+
+TEST(NFHugePageTest, BindNumaNode)
+{
+    const size_t size = 4 * 1024 * 1024;
+    void* pAddr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(MAP_FAILED, pAddr);
+
+    EXPECT_EQ(-1, NFHugePage::BindNumaNode(pAddr, size, -1));
+    EXPECT_EQ(-1, NFHugePage::BindNumaNode(pAddr, size, 100000));
+
+    //容器里mbind可能被禁掉
+    int ret = NFHugePage::BindNumaNode(pAddr, size, 0);
+    EXPECT_TRUE(ret == 0 || errno == EPERM || errno == ENOSYS) << strerror(errno);
+    munmap(pAddr, size);
+}
+
+/**
+ * @brief 用perf_event_open统计当前线程的dTLB读miss, 不可用时返回-1
+ */
+static int NFHugePageTestOpenDTLB()
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/**
+ * @brief 在pAddr上做count次随机读, 返回每次的纳秒数, dTLB miss数写进dtlbMiss(不可用时为-1)
+ */
+static double NFHugePageTestRandomRead(const char* pAddr, size_t size, size_t count, int64_t& dtlbMiss)
+{
+    int fd = NFHugePageTestOpenDTLB();
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    uint64_t seed = 88172645463325252ull;
+    uint64_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; i++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        sum += static_cast<unsigned char>(pAddr[seed % size]);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    dtlbMiss = -1;
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        long long value = 0;
+        if (read(fd, &value, sizeof(value)) == sizeof(value))
+        {
+            dtlbMiss = value;
+        }
+        close(fd);
+    }
+    //防止随机读被编译器优化掉
+    static volatile uint64_t s_sink = 0;
+    s_sink = sum;
+    return ns / count;
+}
+
+TEST(NFHugePageTest, Benchmark)
+{
+    const size_t size = 256 * 1024 * 1024;
+    const size_t count = 4 * 1000 * 1000;
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t hugePageSize = NFHugePage::GetHugePageSize();
+    printf("hugepagesize:%zuK free hugepage mem:%zuM numa node:%d\n", hugePageSize / 1024, NFHugePage::GetFreeHugePageMem() / 1024 / 1024,
+           NFHugePage::GetNumaNodeCount());
+
+    //第一次访问: 不预缺页时每页都要走一次缺页中断
+    char* pNormal = static_cast<char*>(mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_NE(MAP_FAILED, static_cast<void*>(pNormal));
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < size; i += pageSize)
+    {
+        pNormal[i] = 1;
+    }
+    double firstTouch = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    char* pPrefault = static_cast<char*>(mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_NE(MAP_FAILED, static_cast<void*>(pPrefault));
+    start = std::chrono::steady_clock::now();
+    NFHugePage::Prefault(pPrefault, size);
+    double prefault = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < size; i += pageSize)
+    {
+        pPrefault[i] = 1;
+    }
+    double afterPrefault = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    printf("256M first touch: %.1fms, prefault: %.1fms, touch after prefault: %.1fms\n", firstTouch, prefault, afterPrefault);
+    munmap(pPrefault, size);
+
+    int64_t dtlbMiss = 0;
+    double normalNs = NFHugePageTestRandomRead(pNormal, size, count, dtlbMiss);
+    printf("normal page      random read: %.2f ns/op, dTLB miss:%lld\n", normalNs, static_cast<long long>(dtlbMiss));
+    munmap(pNormal, size);
+
+    //透明大页: 地址要按大页对齐, 多申请一个大页再取对齐后的部分
+    size_t align = hugePageSize > 0 ? hugePageSize : 2 * 1024 * 1024;
+    char* pThpBase = static_cast<char*>(mmap(NULL, size + align, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_NE(MAP_FAILED, static_cast<void*>(pThpBase));
+    char* pThp = reinterpret_cast<char*>(NFHugePage::AlignSize(reinterpret_cast<size_t>(pThpBase), align));
+    if (NFHugePage::AdviseHugePage(pThp, size) == 0)
+    {
+        NFHugePage::Prefault(pThp, size);
+        double thpNs = NFHugePageTestRandomRead(pThp, size, count, dtlbMiss);
+        printf("transparent huge random read: %.2f ns/op, dTLB miss:%lld\n", thpNs, static_cast<long long>(dtlbMiss));
+    }
+    else
+    {
+        printf("transparent huge page not available: %s\n", strerror(errno));
+    }
+    munmap(pThpBase, size + align);
+
+    //大页池: 需要提前配置vm.nr_hugepages
+    if (hugePageSize > 0 && NFHugePage::GetFreeHugePageMem() >= size)
+    {
+        int shmId = shmget(IPC_PRIVATE, size, IPC_CREAT | SHM_HUGETLB | 0600);
+        if (shmId >= 0)
+        {
+            char* pHuge = static_cast<char*>(shmat(shmId, NULL, 0));
+            shmctl(shmId, IPC_RMID, NULL);
+            if (pHuge != reinterpret_cast<char*>(-1))
+            {
+                NFHugePage::Prefault(pHuge, size);
+                double hugeNs = NFHugePageTestRandomRead(pHuge, size, count, dtlbMiss);
+                printf("SHM_HUGETLB      random read: %.2f ns/op, dTLB miss:%lld\n", hugeNs, static_cast<long long>(dtlbMiss));
+                shmdt(pHuge);
+            }
+        }
+    }
+    else
+    {
+        printf("hugetlb pool not enough, skip SHM_HUGETLB\n");
+    }
+}
+
+#endif
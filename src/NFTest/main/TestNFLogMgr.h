@@ -0,0 +1,433 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFLogMgr.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/8
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFLogMgr
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFPluginModule/NFLogMgr.h"
+#include "NFComm/NFPluginModule/NFServerDefine.h"
+#include "NFComm/NFCore/NFServerIDUtil.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/****************************************************************************
+ * NFLogMgr log宏惰性求值测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 不输出的(等级, logId), 宏不求值参数也不格式化
+ * 2. 输出的log行为不变
+ * 3. 对比route server转发日志每个包的开销(原来先格式化再判断 / 现在先查位图)
+ * 4. 二进制log: 业务线程只写参数, 取出后格式化结果与fmt::format一致, 缓冲区满了按策略丢弃或等待
+ ****************************************************************************/
+
+/**
+ * @brief 测试用的log模块, 只计数不落盘
+ *
+ * m_bCheckLevel为false时IsLogIdEnable不看等级, 和原来一样格式化完再由logger按等级丢弃
+ */
+class NFTestLogModule : public NFILogModule
+{
+public:
+    NFTestLogModule() : NFILogModule(nullptr), m_iLevel(NLL_INFO_NORMAL), m_bCheckLevel(true), m_iLogCount(0), m_iWriteCount(0)
+    {
+    }
+
+    void InitLogSystem() override
+    {
+    }
+
+    void LogDefault(NF_LOG_LEVEL log_level, const NFSourceLoc& loc, uint32_t logId, uint64_t guid, const std::string& log) override
+    {
+        Write(log_level, log);
+    }
+
+    void LogDefault(NF_LOG_LEVEL log_level, const NFSourceLoc& loc, uint32_t logId, uint64_t guid, uint32_t module, const std::string& log) override
+    {
+        Write(log_level, log);
+    }
+
+    void LogBehaviour(NF_LOG_LEVEL log_level, uint32_t logId, const std::string& log) override
+    {
+        Write(log_level, log);
+    }
+
+    void LogDefault(NF_LOG_LEVEL log_level, uint32_t logId, uint64_t guid, const std::string& log) override
+    {
+        Write(log_level, log);
+    }
+
+    void SetDefaultLogConfig() override
+    {
+    }
+
+    bool IsLogIdEnable(NF_LOG_LEVEL log_level, uint32_t logId) override
+    {
+        if (logId != NF_LOG_DEFAULT)
+        {
+            return false;
+        }
+        return !m_bCheckLevel || static_cast<int>(log_level) >= m_iLevel;
+    }
+
+    void Write(NF_LOG_LEVEL log_level, const std::string& log)
+    {
+        m_iLogCount++;
+        //相当于spdlog的logger按等级丢弃
+        if (static_cast<int>(log_level) >= m_iLevel)
+        {
+            m_iWriteCount++;
+        }
+    }
+
+    int m_iLevel;
+    bool m_bCheckLevel;
+    int m_iLogCount;
+    int m_iWriteCount;
+};
+
+class NFLogMgrTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        NFLogMgr::Instance()->Init(&m_logModule);
+        NFLogMgr::Instance()->UpdateLogEnable();
+    }
+
+    void TearDown() override
+    {
+        NFLogMgr::Instance()->DisableBinLog();
+        ConsumeBinLog(nullptr);
+        NFLogMgr::Instance()->UnInit();
+    }
+
+    /**
+     * @brief 代替log线程取出所有记录并格式化
+     */
+    static int ConsumeBinLog(std::vector<std::string>* pVecLog)
+    {
+        return NFLogMgr::Instance()->ConsumeBinLog([pVecLog](const NFBinLogRecord* pRecord)
+        {
+            if (pVecLog == nullptr)
+            {
+                return;
+            }
+
+            const char* pData = pRecord->GetData();
+            if (pRecord->m_type == NF_BIN_LOG_RECORD_FORMAT)
+            {
+                pVecLog->push_back(pRecord->m_formatFunc(pData, pRecord->m_dataLen, pData + pRecord->m_dataLen));
+            }
+            else
+            {
+                pVecLog->push_back(std::string(pData + pRecord->m_fileLen + pRecord->m_funcLen, pRecord->m_dataLen));
+            }
+        });
+    }
+
+    NFTestLogModule m_logModule;
+};
+
+static std::string NFTestLogArg(int& iEvalCount)
+{
+    iEvalCount++;
+    return "arg";
+}
+
+TEST_F(NFLogMgrTest, DisabledLogSkipsArguments)
+{
+    int iEvalCount = 0;
+    NFLogTrace(NF_LOG_DEFAULT, 0, "trace:{}", NFTestLogArg(iEvalCount));
+    NFLogDebug(NF_LOG_DEFAULT, 0, "debug:{}", NFTestLogArg(iEvalCount));
+    NFLogInfo(NF_LOG_STATISTIC, 0, "info:{}", NFTestLogArg(iEvalCount));
+    EXPECT_EQ(iEvalCount, 0);
+    EXPECT_EQ(m_logModule.m_iLogCount, 0);
+
+    NFLogInfo(NF_LOG_DEFAULT, 0, "info:{}", NFTestLogArg(iEvalCount));
+    NFLogError(NF_LOG_DEFAULT, 0, "error:{}", NFTestLogArg(iEvalCount));
+    EXPECT_EQ(iEvalCount, 2);
+    EXPECT_EQ(m_logModule.m_iLogCount, 2);
+    EXPECT_EQ(m_logModule.m_iWriteCount, 2);
+}
+
+TEST_F(NFLogMgrTest, BitmapFollowsConfig)
+{
+    EXPECT_FALSE(NFLogMgr::Instance()->IsLogEnable(NLL_DEBUG_NORMAL, NF_LOG_DEFAULT));
+    EXPECT_TRUE(NFLogMgr::Instance()->IsLogEnable(NLL_INFO_NORMAL, NF_LOG_DEFAULT));
+    EXPECT_FALSE(NFLogMgr::Instance()->IsLogEnable(NLL_ERROR_NORMAL, NF_LOG_STATISTIC));
+
+    //配置改了以后重新生成位图
+    m_logModule.m_iLevel = NLL_TRACE_NORMAL;
+    NFLogMgr::Instance()->UpdateLogEnable();
+    EXPECT_TRUE(NFLogMgr::Instance()->IsLogEnable(NLL_TRACE_NORMAL, NF_LOG_DEFAULT));
+
+    //超出位图的logId交给LogFormat判断
+    EXPECT_TRUE(NFLogMgr::Instance()->IsLogEnable(NLL_TRACE_NORMAL, NF_LOG_ENABLE_BITMAP_BITS));
+}
+
+TEST_F(NFLogMgrTest, BenchmarkRouteServerPacketLog)
+{
+    const int PACKET_COUNT = 200000;
+    NFDataPackage packet;
+    packet.mModuleId = 1;
+    packet.nMsgId = 1001;
+    packet.nParam1 = 123456789;
+    packet.nMsgLen = 256;
+    uint32_t fromBusId = NFServerIDUtil::GetBusID("1.1.5.1");
+    uint32_t destBusId = NFServerIDUtil::GetBusID("1.1.7.1");
+
+    //原来的做法: 参数先求值, 格式化完再由logger按等级丢弃
+    m_logModule.m_iLevel = NLL_WARING_NORMAL;
+    m_logModule.m_bCheckLevel = false;
+    NFLogMgr::Instance()->UpdateLogEnable();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < PACKET_COUNT; i++)
+    {
+        packet.nMsgSeq = i;
+        NFLogMgr::Instance()->LogFormat(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, 0, 0, 0,
+                                        "--trans msg from {} to {}, packet:{} --", NFServerIDUtil::GetBusNameFromBusID(fromBusId), NFServerIDUtil::GetBusNameFromBusID(destBusId), packet.ToString());
+    }
+    auto eagerEnd = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(m_logModule.m_iLogCount, PACKET_COUNT);
+    EXPECT_EQ(m_logModule.m_iWriteCount, 0);
+
+    //现在: 宏先查位图, info没开就不求值参数
+    m_logModule.m_bCheckLevel = true;
+    NFLogMgr::Instance()->UpdateLogEnable();
+    for (int i = 0; i < PACKET_COUNT; i++)
+    {
+        packet.nMsgSeq = i;
+        NFLogInfo(NF_LOG_DEFAULT, 0, "--trans msg from {} to {}, packet:{} --", NFServerIDUtil::GetBusNameFromBusID(fromBusId), NFServerIDUtil::GetBusNameFromBusID(destBusId), packet.ToString());
+    }
+    auto lazyEnd = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(m_logModule.m_iLogCount, PACKET_COUNT);
+
+    printf("route packet log packets:%d eager:%lldns/packet lazy:%lldns/packet\n", PACKET_COUNT,
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(eagerEnd - start).count() / PACKET_COUNT),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(lazyEnd - eagerEnd).count() / PACKET_COUNT));
+}
+
+TEST_F(NFLogMgrTest, BinLogDefersFormatting)
+{
+    NFLogMgr::Instance()->EnableBinLog(NF_BIN_LOG_MIN_RING_SIZE, NF_BIN_LOG_POLICY_DROP);
+
+    std::string name = "route";
+    char buf[16] = "buffer";
+    NFLogInfo(NF_LOG_DEFAULT, 0, "id:{} name:{} lit:{} buf:{} rate:{:.2f} ok:{} level:{} ch:{}", 123456789012LL, name, "literal", buf, 1.5, true, NLL_INFO_NORMAL, 'x');
+    NFLogError(NF_LOG_DEFAULT, 0, "no args");
+    //业务线程不格式化, 没有调到log模块
+    EXPECT_EQ(m_logModule.m_iLogCount, 0);
+
+    std::vector<std::string> vecLog;
+    EXPECT_EQ(ConsumeBinLog(&vecLog), 2);
+    ASSERT_EQ(vecLog.size(), 2U);
+    EXPECT_EQ(vecLog[0], fmt::format("id:{} name:{} lit:{} buf:{} rate:{:.2f} ok:{} level:{} ch:{}", 123456789012LL, name, "literal", buf, 1.5, true, NLL_INFO_NORMAL, 'x'));
+    EXPECT_EQ(vecLog[1], "no args");
+
+    //格式化好的字符串也走缓冲区
+    EXPECT_TRUE(NFLogMgr::Instance()->LogBinaryString(NF_BIN_LOG_KIND_LOC, NLL_INFO_NORMAL, NFSourceLoc{"file.cpp", 1, "func"}, NF_LOG_DEFAULT, 0, 0, "preformatted"));
+    vecLog.clear();
+    EXPECT_EQ(ConsumeBinLog(&vecLog), 1);
+    ASSERT_EQ(vecLog.size(), 1U);
+    EXPECT_EQ(vecLog[0], "preformatted");
+}
+
+TEST_F(NFLogMgrTest, BinLogUnsupportedArgFallsBack)
+{
+    NFLogMgr::Instance()->EnableBinLog(NF_BIN_LOG_MIN_RING_SIZE, NF_BIN_LOG_POLICY_DROP);
+
+    //指针不能按原始字节存, 整条log在业务线程格式化
+    int value = 0;
+    NFLogInfo(NF_LOG_DEFAULT, 0, "ptr:{}", static_cast<const void*>(&value));
+    EXPECT_EQ(m_logModule.m_iLogCount, 1);
+    EXPECT_EQ(ConsumeBinLog(nullptr), 0);
+}
+
+TEST_F(NFLogMgrTest, BinLogDropWhenFull)
+{
+    NFLogMgr::Instance()->EnableBinLog(NF_BIN_LOG_MIN_RING_SIZE, NF_BIN_LOG_POLICY_DROP);
+    ConsumeBinLog(nullptr);
+
+    NFBinLogStat before;
+    NFLogMgr::Instance()->GetBinLogStat(before);
+
+    const int LOG_COUNT = 5000;
+    std::string payload(64, 'a');
+    for (int i = 0; i < LOG_COUNT; i++)
+    {
+        NFLogInfo(NF_LOG_DEFAULT, 0, "seq:{} payload:{}", i, payload);
+    }
+
+    NFBinLogStat after;
+    NFLogMgr::Instance()->GetBinLogStat(after);
+    uint64_t writeCount = after.m_writeCount - before.m_writeCount;
+    uint64_t dropCount = after.m_dropCount - before.m_dropCount;
+    EXPECT_GT(dropCount, 0U);
+    EXPECT_EQ(writeCount + dropCount, static_cast<uint64_t>(LOG_COUNT));
+    //缓冲区大小固定, 内存不会涨
+    EXPECT_LE(after.m_usedSize, static_cast<uint64_t>(NF_BIN_LOG_MIN_RING_SIZE));
+
+    //没丢的按顺序取出来
+    std::vector<std::string> vecLog;
+    while (ConsumeBinLog(&vecLog) > 0)
+    {
+    }
+    ASSERT_EQ(vecLog.size(), writeCount);
+    for (size_t i = 0; i < vecLog.size(); i++)
+    {
+        EXPECT_EQ(vecLog[i], fmt::format("seq:{} payload:{}", i, payload));
+    }
+}
+
+TEST_F(NFLogMgrTest, BinLogBlockAcrossThreads)
+{
+    NFLogMgr::Instance()->EnableBinLog(NF_BIN_LOG_MIN_RING_SIZE, NF_BIN_LOG_POLICY_BLOCK);
+    ConsumeBinLog(nullptr);
+
+    NFBinLogStat before;
+    NFLogMgr::Instance()->GetBinLogStat(before);
+
+    //小缓冲区多次绕回, block策略下一条都不丢, 同一个线程的log保持顺序
+    const int LOG_COUNT = 100000;
+    std::thread producer([]()
+    {
+        for (int i = 0; i < LOG_COUNT; i++)
+        {
+            NFLogInfo(NF_LOG_DEFAULT, 0, "seq:{} name:{}", i, std::string(i % 100, 'b'));
+        }
+    });
+
+    std::vector<std::string> vecLog;
+    while (static_cast<int>(vecLog.size()) < LOG_COUNT)
+    {
+        if (ConsumeBinLog(&vecLog) == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    ASSERT_EQ(vecLog.size(), static_cast<size_t>(LOG_COUNT));
+    for (int i = 0; i < LOG_COUNT; i++)
+    {
+        ASSERT_EQ(vecLog[i], fmt::format("seq:{} name:{}", i, std::string(i % 100, 'b')));
+    }
+
+    //线程退出后缓冲区被回收, 统计还在
+    ConsumeBinLog(nullptr);
+    NFBinLogStat after;
+    NFLogMgr::Instance()->GetBinLogStat(after);
+    EXPECT_EQ(after.m_ringCount, before.m_ringCount);
+    EXPECT_EQ(after.m_writeCount - before.m_writeCount, static_cast<uint64_t>(LOG_COUNT));
+    EXPECT_EQ(after.m_dropCount, before.m_dropCount);
+}
+
+TEST_F(NFLogMgrTest, BinLogWaitConsumed)
+{
+    NFLogMgr::Instance()->EnableBinLog(NF_BIN_LOG_MIN_RING_SIZE, NF_BIN_LOG_POLICY_DROP);
+    ConsumeBinLog(nullptr);
+    EXPECT_TRUE(NFLogMgr::Instance()->WaitBinLogConsumed(0));
+
+    for (int i = 0; i < 3; i++)
+    {
+        NFLogInfo(NF_LOG_DEFAULT, 0, "seq:{}", i);
+    }
+    //没有log线程取, 等不到
+    EXPECT_FALSE(NFLogMgr::Instance()->WaitBinLogConsumed(10));
+
+    //卸载插件时的情况: log线程在跑, 等到调用前写进去的记录都格式化完
+    std::atomic<bool> bStop(false);
+    std::vector<std::string> vecLog;
+    std::thread consumer([&]()
+    {
+        while (!bStop)
+        {
+            if (ConsumeBinLog(&vecLog) == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    });
+
+    EXPECT_TRUE(NFLogMgr::Instance()->WaitBinLogConsumed(NF_BIN_LOG_DRAIN_TIMEOUT_MS));
+    bStop = true;
+    consumer.join();
+    ASSERT_EQ(vecLog.size(), 3U);
+    EXPECT_EQ(vecLog[2], "seq:2");
+}
+
+TEST_F(NFLogMgrTest, BenchmarkBinLogRouteServerPacketLog)
+{
+    const int PACKET_COUNT = 200000;
+    NFDataPackage packet;
+    packet.mModuleId = 1;
+    packet.nMsgId = 1001;
+    packet.nParam1 = 123456789;
+    packet.nMsgLen = 256;
+    uint32_t fromBusId = NFServerIDUtil::GetBusID("1.1.5.1");
+    uint32_t destBusId = NFServerIDUtil::GetBusID("1.1.7.1");
+
+    //info打开, 原来在业务线程格式化
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < PACKET_COUNT; i++)
+    {
+        NFLogInfo(NF_LOG_DEFAULT, 0, "--trans msg from {} to {}, module:{} msgId:{} param:{} len:{} seq:{} --", fromBusId, destBusId, packet.mModuleId, packet.nMsgId, packet.nParam1, packet.nMsgLen, i);
+    }
+    auto eagerEnd = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(m_logModule.m_iWriteCount, PACKET_COUNT);
+
+    //二进制log, 业务线程只拷贝参数, 格式化放到log线程
+    //每次写一批缓冲区放得下的log, 只统计业务线程的耗时, 不算等log线程的时间
+    const int BATCH_COUNT = 10000;
+    NFLogMgr::Instance()->EnableBinLog(NF_BIN_LOG_DEFAULT_RING_SIZE, NF_BIN_LOG_POLICY_DROP);
+    int64_t binNs = 0;
+    std::atomic<int> batchDone(0);
+    std::atomic<int> batchConsumed(0);
+    std::thread producer([&]()
+    {
+        for (int batch = 0; batch < PACKET_COUNT / BATCH_COUNT; batch++)
+        {
+            auto binStart = std::chrono::high_resolution_clock::now();
+            for (int i = batch * BATCH_COUNT; i < (batch + 1) * BATCH_COUNT; i++)
+            {
+                NFLogInfo(NF_LOG_DEFAULT, 0, "--trans msg from {} to {}, module:{} msgId:{} param:{} len:{} seq:{} --", fromBusId, destBusId, packet.mModuleId, packet.nMsgId, packet.nParam1, packet.nMsgLen, i);
+            }
+            binNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - binStart).count();
+            batchDone = batch + 1;
+            while (batchConsumed != batch + 1)
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<std::string> vecLog;
+    for (int batch = 0; batch < PACKET_COUNT / BATCH_COUNT; batch++)
+    {
+        while (batchDone != batch + 1)
+        {
+            std::this_thread::yield();
+        }
+        while (ConsumeBinLog(&vecLog) > 0)
+        {
+        }
+        batchConsumed = batch + 1;
+    }
+    producer.join();
+    EXPECT_EQ(vecLog.size(), static_cast<size_t>(PACKET_COUNT));
+    EXPECT_EQ(m_logModule.m_iWriteCount, PACKET_COUNT);
+
+    printf("route packet log packets:%d eager:%lldns/packet binary:%lldns/packet\n", PACKET_COUNT,
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(eagerEnd - start).count() / PACKET_COUNT),
+           static_cast<long long>(binNs / PACKET_COUNT));
+}
@@ -0,0 +1,312 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFMysqlRowDecoder.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/31
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFMysqlRowDecoder
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFPluginModule/NFProtobufCommon.h"
+#include "NFCommPlugin/NFDBPlugin/NFCMysqlRowDecoder.h"
+#include "google/protobuf/descriptor.pb.h"
+#include "google/protobuf/dynamic_message.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * mysql结果行解码测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 文本协议的一行, NFCMysqlRowDecoder和GetDBMessageFromMapFields解出来的message完全一样
+ * 2. db_message_expand子message, repeated "字段_下标", repeated message "字段_下标_子字段"都按同样规则展开
+ * 3. repeated末尾的空元素和全空的子message被去掉, NULL列和空串一样处理
+ * 4. 二进制协议下整数和浮点列直接给数值, 结果与文本协议一致
+ * 5. 结果集里缺少的列不设置
+ ****************************************************************************/
+
+/**
+ * @brief 用DescriptorPool动态构造带nanopb展开选项的存储消息, 不依赖业务的proto
+ *
+ * message tbRowSub {
+ *     optional int32 attr = 1;
+ *     optional string value = 2;
+ * }
+ *
+ * message tbRowTest {
+ *     optional uint64 id = 1;
+ *     optional string name = 2;
+ *     optional int32 level = 3;
+ *     optional tbRowSub base = 4 [(nanopb).db_message_expand = true];
+ *     repeated int32 items = 5 [(nanopb).db_max_count = 3];
+ *     repeated tbRowSub attrs = 6 [(nanopb).db_max_count = 2];
+ *     optional double score = 7;
+ *     optional bool flag = 8;
+ *     optional tbRowSub blob = 9;
+ * }
+ */
+class NFMysqlRowDecoderTestMsg
+{
+public:
+    NFMysqlRowDecoderTestMsg() : m_pDesc(nullptr), m_pool(google::protobuf::DescriptorPool::generated_pool())
+    {
+        google::protobuf::FileDescriptorProto file;
+        file.set_name("row_decoder_test.proto");
+        file.set_package("row_decoder_test");
+
+        google::protobuf::DescriptorProto* pSub = file.add_message_type();
+        pSub->set_name("tbRowSub");
+        AddField(pSub, "attr", 1, google::protobuf::FieldDescriptorProto::TYPE_INT32);
+        AddField(pSub, "value", 2, google::protobuf::FieldDescriptorProto::TYPE_STRING);
+
+        google::protobuf::DescriptorProto* pMsg = file.add_message_type();
+        pMsg->set_name("tbRowTest");
+        AddField(pMsg, "id", 1, google::protobuf::FieldDescriptorProto::TYPE_UINT64);
+        AddField(pMsg, "name", 2, google::protobuf::FieldDescriptorProto::TYPE_STRING);
+        AddField(pMsg, "level", 3, google::protobuf::FieldDescriptorProto::TYPE_INT32);
+        AddField(pMsg, "base", 4, google::protobuf::FieldDescriptorProto::TYPE_MESSAGE)->mutable_options()->MutableExtension(nanopb)->set_db_message_expand(true);
+        AddField(pMsg, "items", 5, google::protobuf::FieldDescriptorProto::TYPE_INT32, true)->mutable_options()->MutableExtension(nanopb)->set_db_max_count(3);
+        AddField(pMsg, "attrs", 6, google::protobuf::FieldDescriptorProto::TYPE_MESSAGE, true)->mutable_options()->MutableExtension(nanopb)->set_db_max_count(2);
+        AddField(pMsg, "score", 7, google::protobuf::FieldDescriptorProto::TYPE_DOUBLE);
+        AddField(pMsg, "flag", 8, google::protobuf::FieldDescriptorProto::TYPE_BOOL);
+        AddField(pMsg, "blob", 9, google::protobuf::FieldDescriptorProto::TYPE_MESSAGE);
+
+        const google::protobuf::FileDescriptor* pFile = m_pool.BuildFile(file);
+        if (pFile)
+        {
+            m_pDesc = pFile->FindMessageTypeByName("tbRowTest");
+            m_pSubDesc = pFile->FindMessageTypeByName("tbRowSub");
+        }
+    }
+
+    google::protobuf::Message* New()
+    {
+        return m_factory.GetPrototype(m_pDesc)->New();
+    }
+
+    //序列化好的tbRowSub, 存在blob列里
+    std::string MakeBlob(int attr, const std::string& value)
+    {
+        std::unique_ptr<google::protobuf::Message> pSub(m_factory.GetPrototype(m_pSubDesc)->New());
+        const google::protobuf::Reflection* pReflect = pSub->GetReflection();
+        pReflect->SetInt32(pSub.get(), m_pSubDesc->FindFieldByName("attr"), attr);
+        pReflect->SetString(pSub.get(), m_pSubDesc->FindFieldByName("value"), value);
+        return pSub->SerializeAsString();
+    }
+
+    const google::protobuf::Descriptor* m_pDesc;
+    const google::protobuf::Descriptor* m_pSubDesc;
+
+private:
+    static google::protobuf::FieldDescriptorProto* AddField(google::protobuf::DescriptorProto* pMsg, const std::string& name, int number, google::protobuf::FieldDescriptorProto::Type type, bool bRepeated = false)
+    {
+        google::protobuf::FieldDescriptorProto* pField = pMsg->add_field();
+        pField->set_name(name);
+        pField->set_number(number);
+        pField->set_type(type);
+        pField->set_label(bRepeated ? google::protobuf::FieldDescriptorProto::LABEL_REPEATED : google::protobuf::FieldDescriptorProto::LABEL_OPTIONAL);
+        if (type == google::protobuf::FieldDescriptorProto::TYPE_MESSAGE)
+        {
+            pField->set_type_name(".row_decoder_test.tbRowSub");
+        }
+        return pField;
+    }
+
+    google::protobuf::DescriptorPool m_pool;
+    google::protobuf::DynamicMessageFactory m_factory;
+};
+
+/**
+ * @brief 一行结果, 同时给出文本协议的map和解码器用的列数组
+ */
+class NFMysqlRowDecoderTestRow
+{
+public:
+    enum
+    {
+        COL_TEXT = 0, //文本协议
+        COL_NULL = 1, //NULL列, map里是空串
+        COL_INT = 2, //二进制协议的有符号整数
+        COL_UINT = 3, //二进制协议的无符号整数
+        COL_DOUBLE = 4, //二进制协议的浮点数
+    };
+
+    void Add(const std::string& name, const std::string& text, int type = COL_TEXT)
+    {
+        m_vecName.push_back(name);
+        m_vecText.push_back(type == COL_NULL ? std::string() : text);
+        m_vecType.push_back(type);
+    }
+
+    std::map<std::string, std::string> ToMap() const
+    {
+        std::map<std::string, std::string> result;
+        for (size_t i = 0; i < m_vecName.size(); i++)
+        {
+            result.emplace(m_vecName[i], m_vecText[i]);
+        }
+        return result;
+    }
+
+    std::vector<NFMysqlColumnValue> ToColumns() const
+    {
+        std::vector<NFMysqlColumnValue> vecColumn(m_vecName.size());
+        for (size_t i = 0; i < m_vecName.size(); i++)
+        {
+            NFMysqlColumnValue& column = vecColumn[i];
+            column.m_bNull = m_vecType[i] == COL_NULL;
+            switch (m_vecType[i])
+            {
+                case COL_INT:
+                    column.m_iType = NFMysqlColumnValue::VALUE_INT;
+                    column.m_iValue = strtoll(m_vecText[i].c_str(), nullptr, 10);
+                    break;
+                case COL_UINT:
+                    column.m_iType = NFMysqlColumnValue::VALUE_UINT;
+                    column.m_uValue = strtoull(m_vecText[i].c_str(), nullptr, 10);
+                    break;
+                case COL_DOUBLE:
+                    column.m_iType = NFMysqlColumnValue::VALUE_DOUBLE;
+                    column.m_dValue = strtod(m_vecText[i].c_str(), nullptr);
+                    break;
+                default:
+                    column.m_iType = NFMysqlColumnValue::VALUE_TEXT;
+                    column.m_pData = m_vecText[i].data();
+                    column.m_iLength = m_vecText[i].length();
+                    break;
+            }
+        }
+        return vecColumn;
+    }
+
+    std::vector<std::string> m_vecName;
+    std::vector<std::string> m_vecText;
+    std::vector<int> m_vecType;
+};
+
+/**
+ * @brief 解码器和GetDBMessageFromMapFields各解一次, 返回两边序列化后的结果
+ */
+static void NFMysqlRowDecoderTestDecode(NFMysqlRowDecoderTestMsg& msg, const NFMysqlRowDecoderTestRow& row, std::string& decoded, std::string& expected)
+{
+    NFCMysqlRowDecoder decoder;
+    ASSERT_EQ(0, decoder.Compile(msg.m_pDesc, row.m_vecName));
+    EXPECT_EQ(row.m_vecName.size(), decoder.GetColumnCount());
+
+    std::vector<NFMysqlColumnValue> vecColumn = row.ToColumns();
+    std::unique_ptr<google::protobuf::Message> pDecoded(msg.New());
+    decoder.Decode(vecColumn.data(), pDecoded.get());
+
+    std::unique_ptr<google::protobuf::Message> pExpected(msg.New());
+    NFProtobufCommon::GetDBMessageFromMapFields(row.ToMap(), pExpected.get());
+
+    decoded = pDecoded->DebugString();
+    expected = pExpected->DebugString();
+}
+
+TEST(NFMysqlRowDecoderTest, TextRowMatchesMapFields)
+{
+    NFMysqlRowDecoderTestMsg msg;
+    ASSERT_TRUE(msg.m_pDesc != nullptr);
+
+    NFMysqlRowDecoderTestRow row;
+    row.Add("id", "10001");
+    row.Add("name", "player");
+    row.Add("level", "30");
+    row.Add("base_attr", "7");
+    row.Add("base_value", "hp");
+    row.Add("items_0", "1");
+    row.Add("items_1", "2");
+    row.Add("items_2", "3");
+    row.Add("attrs_0_attr", "11");
+    row.Add("attrs_0_value", "a");
+    row.Add("attrs_1_attr", "12");
+    row.Add("attrs_1_value", "b");
+    row.Add("score", "1.5");
+    row.Add("flag", "1");
+    row.Add("blob", msg.MakeBlob(5, "blob"));
+
+    std::string decoded, expected;
+    NFMysqlRowDecoderTestDecode(msg, row, decoded, expected);
+    EXPECT_EQ(expected, decoded);
+    EXPECT_NE(std::string::npos, decoded.find("value: \"blob\""));
+}
+
+TEST(NFMysqlRowDecoderTest, TrailingEmptyAndNull)
+{
+    NFMysqlRowDecoderTestMsg msg;
+    ASSERT_TRUE(msg.m_pDesc != nullptr);
+
+    //items末尾两个是空串和NULL, attrs第二个元素全空, 都要去掉; 中间的空元素保留
+    NFMysqlRowDecoderTestRow row;
+    row.Add("id", "10002");
+    row.Add("name", "", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("level", "");
+    row.Add("base_attr", "", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("base_value", "");
+    row.Add("items_0", "");
+    row.Add("items_1", "4");
+    row.Add("items_2", "", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("attrs_0_attr", "");
+    row.Add("attrs_0_value", "c");
+    row.Add("attrs_1_attr", "", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("attrs_1_value", "");
+    row.Add("score", "", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("flag", "0");
+    row.Add("blob", "", NFMysqlRowDecoderTestRow::COL_NULL);
+
+    std::string decoded, expected;
+    NFMysqlRowDecoderTestDecode(msg, row, decoded, expected);
+    EXPECT_EQ(expected, decoded);
+}
+
+TEST(NFMysqlRowDecoderTest, BinaryRowMatchesMapFields)
+{
+    NFMysqlRowDecoderTestMsg msg;
+    ASSERT_TRUE(msg.m_pDesc != nullptr);
+
+    //预处理语句的结果, 数值列直接是int64/uint64/double
+    NFMysqlRowDecoderTestRow row;
+    row.Add("id", "18446744073709551615", NFMysqlRowDecoderTestRow::COL_UINT);
+    row.Add("name", "player");
+    row.Add("level", "-3", NFMysqlRowDecoderTestRow::COL_INT);
+    row.Add("base_attr", "7", NFMysqlRowDecoderTestRow::COL_INT);
+    row.Add("base_value", "hp");
+    row.Add("items_0", "1", NFMysqlRowDecoderTestRow::COL_INT);
+    row.Add("items_1", "0", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("items_2", "0", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("attrs_0_attr", "11", NFMysqlRowDecoderTestRow::COL_INT);
+    row.Add("attrs_0_value", "a");
+    row.Add("attrs_1_attr", "0", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("attrs_1_value", "", NFMysqlRowDecoderTestRow::COL_NULL);
+    row.Add("score", "2.25", NFMysqlRowDecoderTestRow::COL_DOUBLE);
+    row.Add("flag", "1", NFMysqlRowDecoderTestRow::COL_INT);
+
+    std::string decoded, expected;
+    NFMysqlRowDecoderTestDecode(msg, row, decoded, expected);
+    EXPECT_EQ(expected, decoded);
+}
+
+TEST(NFMysqlRowDecoderTest, MissingColumns)
+{
+    NFMysqlRowDecoderTestMsg msg;
+    ASSERT_TRUE(msg.m_pDesc != nullptr);
+
+    //只查了部分列, 列的顺序和字段顺序不同
+    NFMysqlRowDecoderTestRow row;
+    row.Add("items_1", "9");
+    row.Add("level", "8");
+    row.Add("attrs_1_value", "z");
+    row.Add("id", "1");
+
+    std::string decoded, expected;
+    NFMysqlRowDecoderTestDecode(msg, row, decoded, expected);
+    EXPECT_EQ(expected, decoded);
+    EXPECT_EQ(std::string::npos, decoded.find("name"));
+}
@@ -0,0 +1,388 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFPacketCompress.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/20
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFPacketCompress
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFCore/NFBuffer.h"
+#include "NFComm/NFCore/NFFileUtility.h"
+#include "NFComm/NFPluginModule/NFNetDefine.h"
+#include "NFCommPlugin/NFNetPlugin/InternalPacketParse.h"
+#include "NFCommPlugin/NFNetPlugin/NFPacketCompress.h"
+#include <chrono>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * 网络包压缩测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. lzf/zlib压缩解压结果一致, 压不小的包返回失败由调用方发原始数据
+ * 2. zlib预置字典对小包有效, 两端字典不一致时解压失败
+ * 3. InternalPacketParse编码时直接压缩到输出缓冲区, 解码时带出压缩标记
+ * 4. 统计各算法在快照包/小包样本上的压缩率和ns/byte,
+ *    设置环境变量NF_PACKET_CORPUS_DIR时额外统计目录下抓取的包(每个文件一个包体)
+ ****************************************************************************/
+
+/**
+ * @brief 按protobuf编码规则拼出的样本包, 字段分布参照背包/邮件/移动同步协议
+ */
+class NFTestPacketCorpus
+{
+public:
+    explicit NFTestPacketCorpus(uint32_t seed) : m_random(seed)
+    {
+    }
+
+    //背包列表快照, 几百个道具
+    std::string MakeBagList(int itemCount)
+    {
+        static const char* itemNames[] = {"potion_small", "potion_big", "iron_sword", "leather_armor", "gold_ring", "scroll_town", "gem_red", "gem_blue"};
+        std::string packet;
+        uint64_t guid = 7200000000000000000ull + m_random() % 100000;
+        for (int i = 0; i < itemCount; i++)
+        {
+            std::string item;
+            WriteVarintField(item, 1, 10000 + m_random() % 300);
+            WriteVarintField(item, 2, 1 + m_random() % 99);
+            WriteVarintField(item, 3, guid + i);
+            WriteStringField(item, 4, itemNames[m_random() % 8]);
+            WriteVarintField(item, 5, 1716000000 + m_random() % 86400);
+            WriteVarintField(item, 6, m_random() % 4);
+            WriteStringField(packet, 1, item);
+        }
+        WriteVarintField(packet, 2, itemCount);
+        return packet;
+    }
+
+    //邮件列表, 标题正文来自固定模板
+    std::string MakeMailList(int mailCount)
+    {
+        static const char* titles[] = {"Daily sign-in reward", "Arena season settlement", "System compensation", "Guild war reward"};
+        static const char* contents[] = {"Dear player, thanks for your support, here is your reward. Please claim the attachment before it expires.",
+                                         "Congratulations! You ranked in the top of this season, the rewards are attached to this mail.",
+                                         "Due to server maintenance we send you the following compensation, please check the attachment."};
+        std::string packet;
+        for (int i = 0; i < mailCount; i++)
+        {
+            std::string mail;
+            WriteVarintField(mail, 1, 900000 + i);
+            WriteStringField(mail, 2, titles[m_random() % 4]);
+            WriteStringField(mail, 3, contents[m_random() % 3]);
+            WriteVarintField(mail, 4, 1716000000 + m_random() % 604800);
+            for (int j = 0; j < 3; j++)
+            {
+                std::string attach;
+                WriteVarintField(attach, 1, 10000 + m_random() % 300);
+                WriteVarintField(attach, 2, 1 + m_random() % 10);
+                WriteStringField(mail, 5, attach);
+            }
+            WriteStringField(packet, 1, mail);
+        }
+        return packet;
+    }
+
+    //移动同步小包
+    std::string MakeMoveSync()
+    {
+        std::string packet;
+        int count = 2 + m_random() % 6;
+        for (int i = 0; i < count; i++)
+        {
+            std::string move;
+            WriteVarintField(move, 1, 1000000 + m_random() % 5000);
+            WriteVarintField(move, 2, m_random() % 20000);
+            WriteVarintField(move, 3, m_random() % 20000);
+            WriteVarintField(move, 4, m_random() % 360);
+            WriteVarintField(move, 5, 300);
+            WriteStringField(packet, 1, move);
+        }
+        return packet;
+    }
+
+    std::string MakeRandom(size_t len)
+    {
+        std::string packet(len, '\0');
+        for (size_t i = 0; i < len; i++)
+        {
+            packet[i] = static_cast<char>(m_random());
+        }
+        return packet;
+    }
+
+private:
+    static void WriteVarint(std::string& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<char>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    static void WriteVarintField(std::string& out, uint32_t field, uint64_t value)
+    {
+        WriteVarint(out, field << 3);
+        WriteVarint(out, value);
+    }
+
+    static void WriteStringField(std::string& out, uint32_t field, const std::string& value)
+    {
+        WriteVarint(out, (field << 3) | 2);
+        WriteVarint(out, value.size());
+        out.append(value);
+    }
+
+    std::mt19937 m_random;
+};
+
+class NFPacketCompressTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        NFPacketCompress::SetZlibDict("");
+    }
+
+    static std::string RoundTrip(uint32_t type, const std::string& packet, int& compressLen)
+    {
+        std::vector<char> compressBuffer(packet.size());
+        compressLen = NFPacketCompress::Compress(type, packet.data(), packet.size(), compressBuffer.data(), compressBuffer.size());
+        if (compressLen <= 0)
+        {
+            return std::string();
+        }
+
+        std::vector<char> rawBuffer(packet.size());
+        int rawLen = NFPacketCompress::Decompress(compressBuffer.data(), compressLen, rawBuffer.data(), rawBuffer.size());
+        if (rawLen < 0)
+        {
+            return std::string();
+        }
+        return std::string(rawBuffer.data(), rawLen);
+    }
+};
+
+TEST_F(NFPacketCompressTest, LzfAndZlibRoundTrip)
+{
+    NFTestPacketCorpus corpus(1);
+    std::string packet = corpus.MakeBagList(500);
+
+    int lzfLen = 0;
+    EXPECT_EQ(RoundTrip(NF_PACKET_COMPRESS_LZF, packet, lzfLen), packet);
+    EXPECT_LT(lzfLen, static_cast<int>(packet.size()));
+
+    int zlibLen = 0;
+    EXPECT_EQ(RoundTrip(NF_PACKET_COMPRESS_ZLIB, packet, zlibLen), packet);
+    EXPECT_LT(zlibLen, lzfLen);
+}
+
+TEST_F(NFPacketCompressTest, IncompressibleFails)
+{
+    NFTestPacketCorpus corpus(2);
+    std::string packet = corpus.MakeRandom(4096);
+
+    std::vector<char> buffer(packet.size());
+    EXPECT_EQ(NFPacketCompress::Compress(NF_PACKET_COMPRESS_LZF, packet.data(), packet.size(), buffer.data(), buffer.size()), -1);
+    EXPECT_EQ(NFPacketCompress::Compress(NF_PACKET_COMPRESS_ZLIB, packet.data(), packet.size(), buffer.data(), buffer.size()), -1);
+    EXPECT_EQ(NFPacketCompress::Compress(NF_PACKET_COMPRESS_NONE, packet.data(), packet.size(), buffer.data(), buffer.size()), -1);
+}
+
+TEST_F(NFPacketCompressTest, DecompressRejectsBadData)
+{
+    NFTestPacketCorpus corpus(3);
+    std::string packet = corpus.MakeMailList(20);
+
+    std::vector<char> compressBuffer(packet.size());
+    int compressLen = NFPacketCompress::Compress(NF_PACKET_COMPRESS_ZLIB, packet.data(), packet.size(), compressBuffer.data(), compressBuffer.size());
+    ASSERT_GT(compressLen, 0);
+
+    //输出缓冲区不够, 截断, 未知算法
+    std::vector<char> rawBuffer(packet.size());
+    EXPECT_EQ(NFPacketCompress::Decompress(compressBuffer.data(), compressLen, rawBuffer.data(), packet.size() - 1), -1);
+    EXPECT_EQ(NFPacketCompress::Decompress(compressBuffer.data(), compressLen / 2, rawBuffer.data(), rawBuffer.size()), -1);
+    compressBuffer[0] = NF_PACKET_COMPRESS_MAX;
+    EXPECT_EQ(NFPacketCompress::Decompress(compressBuffer.data(), compressLen, rawBuffer.data(), rawBuffer.size()), -1);
+}
+
+TEST_F(NFPacketCompressTest, ZlibDictHelpsSmallPacket)
+{
+    NFTestPacketCorpus corpus(4);
+    std::vector<std::string> vecSample;
+    for (int i = 0; i < 2000; i++)
+    {
+        vecSample.push_back(corpus.MakeMoveSync());
+        vecSample.push_back(corpus.MakeMailList(1));
+    }
+    std::string dict = NFPacketCompress::TrainZlibDict(vecSample, 4096);
+    EXPECT_GT(dict.size(), 0u);
+    EXPECT_LE(dict.size(), 4096u);
+
+    std::string packet = corpus.MakeMailList(2);
+    int noDictLen = 0;
+    EXPECT_EQ(RoundTrip(NF_PACKET_COMPRESS_ZLIB, packet, noDictLen), packet);
+
+    ASSERT_EQ(NFPacketCompress::SetZlibDict(dict), 0);
+    int dictLen = 0;
+    EXPECT_EQ(RoundTrip(NF_PACKET_COMPRESS_ZLIB, packet, dictLen), packet);
+    EXPECT_LT(dictLen, noDictLen);
+
+    //对端字典不一致
+    std::vector<char> compressBuffer(packet.size());
+    int compressLen = NFPacketCompress::Compress(NF_PACKET_COMPRESS_ZLIB, packet.data(), packet.size(), compressBuffer.data(), compressBuffer.size());
+    ASSERT_GT(compressLen, 0);
+    NFPacketCompress::SetZlibDict(dict.substr(1));
+    std::vector<char> rawBuffer(packet.size());
+    EXPECT_EQ(NFPacketCompress::Decompress(compressBuffer.data(), compressLen, rawBuffer.data(), rawBuffer.size()), -1);
+
+    EXPECT_EQ(NFPacketCompress::SetZlibDict(std::string(NF_PACKET_COMPRESS_MAX_DICT_SIZE + 1, 'a')), -1);
+}
+
+TEST_F(NFPacketCompressTest, InternalPacketParseCompress)
+{
+    NFTestPacketCorpus corpus(5);
+    std::string packet = corpus.MakeBagList(300);
+    InternalPacketParse parse;
+
+    NFDataPackage sendPackage;
+    sendPackage.mModuleId = NF_MODULE_CLIENT;
+    sendPackage.nMsgId = 1001;
+    sendPackage.nParam1 = 12345;
+    sendPackage.bCompress = true;
+    sendPackage.nCompressType = NF_PACKET_COMPRESS_LZF;
+
+    NFBuffer buffer;
+    int bodyLen = parse.EnCodeImpl(sendPackage, packet.data(), packet.size(), buffer);
+    EXPECT_LT(bodyLen, static_cast<int>(packet.size()));
+
+    char* outData = nullptr;
+    uint32_t outLen = 0;
+    uint32_t allLen = 0;
+    NFDataPackage recvPackage;
+    ASSERT_EQ(parse.DeCodeImpl(buffer.ReadAddr(), buffer.ReadableSize(), outData, outLen, allLen, recvPackage), 0);
+    EXPECT_EQ(allLen, buffer.ReadableSize());
+    EXPECT_TRUE(recvPackage.bCompress);
+    EXPECT_EQ(recvPackage.nMsgId, 1001u);
+    EXPECT_EQ(recvPackage.nParam1, 12345u);
+
+    std::vector<char> rawBuffer(MAX_RECV_BUFFER_SIZE);
+    int rawLen = parse.DecompressImpl(outData, outLen, rawBuffer.data(), rawBuffer.size());
+    ASSERT_EQ(rawLen, static_cast<int>(packet.size()));
+    EXPECT_EQ(std::string(rawBuffer.data(), rawLen), packet);
+
+    //压不小的包原样发送, 不带压缩标记
+    std::string randomPacket = corpus.MakeRandom(2048);
+    buffer.Clear();
+    EXPECT_EQ(parse.EnCodeImpl(sendPackage, randomPacket.data(), randomPacket.size(), buffer), static_cast<int>(randomPacket.size()));
+    recvPackage.Clear();
+    ASSERT_EQ(parse.DeCodeImpl(buffer.ReadAddr(), buffer.ReadableSize(), outData, outLen, allLen, recvPackage), 0);
+    EXPECT_FALSE(recvPackage.bCompress);
+    EXPECT_EQ(std::string(outData, outLen), randomPacket);
+}
+
+/**
+ * @brief 压缩率和ns/byte, 只打印不断言
+ */
+TEST_F(NFPacketCompressTest, BenchmarkCorpus)
+{
+    NFTestPacketCorpus corpus(6);
+    std::vector<std::pair<std::string, std::vector<std::string>>> vecCorpus;
+    vecCorpus.emplace_back("bag_snapshot", std::vector<std::string>());
+    vecCorpus.emplace_back("mail_list", std::vector<std::string>());
+    vecCorpus.emplace_back("move_sync", std::vector<std::string>());
+    for (int i = 0; i < 50; i++)
+    {
+        vecCorpus[0].second.push_back(corpus.MakeBagList(400 + i * 4));
+        vecCorpus[1].second.push_back(corpus.MakeMailList(50 + i));
+    }
+    for (int i = 0; i < 5000; i++)
+    {
+        vecCorpus[2].second.push_back(corpus.MakeMoveSync());
+    }
+
+    const char* corpusDir = getenv("NF_PACKET_CORPUS_DIR");
+    if (corpusDir && NFFileUtility::IsDir(corpusDir))
+    {
+        std::list<std::string> files;
+        NFFileUtility::GetFiles(corpusDir, files, false);
+        vecCorpus.emplace_back(corpusDir, std::vector<std::string>());
+        for (auto iter = files.begin(); iter != files.end(); ++iter)
+        {
+            std::string content;
+            if (NFFileUtility::ReadFileContent(*iter, content) && !content.empty() && content.size() < MAX_RECV_BUFFER_SIZE)
+            {
+                vecCorpus.back().second.push_back(content);
+            }
+        }
+    }
+
+    //字典用另一批样本训练, 避免测的就是训练集
+    NFTestPacketCorpus trainCorpus(7);
+    std::vector<std::string> vecSample;
+    for (int i = 0; i < 2000; i++)
+    {
+        vecSample.push_back(trainCorpus.MakeMoveSync());
+        vecSample.push_back(trainCorpus.MakeMailList(1));
+    }
+    std::string dict = NFPacketCompress::TrainZlibDict(vecSample, 8192);
+
+    struct BenchAlgo
+    {
+        const char* name;
+        uint32_t type;
+        bool useDict;
+    };
+    const BenchAlgo algos[] = {{"lzf", NF_PACKET_COMPRESS_LZF, false}, {"zlib", NF_PACKET_COMPRESS_ZLIB, false}, {"zlib+dict", NF_PACKET_COMPRESS_ZLIB, true}};
+
+    std::vector<char> compressBuffer(MAX_RECV_BUFFER_SIZE);
+    std::vector<char> rawBuffer(MAX_RECV_BUFFER_SIZE);
+    for (size_t c = 0; c < vecCorpus.size(); c++)
+    {
+        const std::vector<std::string>& vecPacket = vecCorpus[c].second;
+        for (size_t a = 0; a < sizeof(algos) / sizeof(algos[0]); a++)
+        {
+            NFPacketCompress::SetZlibDict(algos[a].useDict ? dict : "");
+            uint64_t rawBytes = 0;
+            uint64_t sendBytes = 0;
+            int64_t compressNs = 0;
+            int64_t decompressNs = 0;
+            int compressCount = 0;
+            for (size_t i = 0; i < vecPacket.size(); i++)
+            {
+                const std::string& packet = vecPacket[i];
+                auto start = std::chrono::steady_clock::now();
+                int compressLen = NFPacketCompress::Compress(algos[a].type, packet.data(), packet.size(), compressBuffer.data(), packet.size());
+                auto mid = std::chrono::steady_clock::now();
+                compressNs += std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count();
+                rawBytes += packet.size();
+                if (compressLen <= 0)
+                {
+                    sendBytes += packet.size();
+                    continue;
+                }
+
+                int rawLen = NFPacketCompress::Decompress(compressBuffer.data(), compressLen, rawBuffer.data(), rawBuffer.size());
+                decompressNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mid).count();
+                ASSERT_EQ(rawLen, static_cast<int>(packet.size()));
+                sendBytes += compressLen;
+                compressCount++;
+            }
+
+            printf("corpus:%-14s algo:%-9s packets:%zu avg:%lluB compressed:%d ratio:%.3f compress:%.2fns/B decompress:%.2fns/B\n", vecCorpus[c].first.c_str(), algos[a].name,
+                   vecPacket.size(), static_cast<unsigned long long>(rawBytes / (vecPacket.empty() ? 1 : vecPacket.size())), compressCount,
+                   rawBytes ? static_cast<double>(sendBytes) / rawBytes : 1.0, rawBytes ? static_cast<double>(compressNs) / rawBytes : 0.0,
+                   rawBytes ? static_cast<double>(decompressNs) / rawBytes : 0.0);
+        }
+    }
+}
@@ -0,0 +1,194 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFRedisPipeline.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/24
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFRedisPipeline
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFCommPlugin/NFDBPlugin/NFRedisDriver.h"
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * Redis流水线测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 流水线里的回复按发送顺序匹配回调
+ * 2. MULTI/EXEC在流水线里整体返回
+ * 3. 流水线未完成时同步命令先等流水线收完, 回复不会错位
+ * 4. 统计流水线深度1/16/128时的ops/sec
+ *
+ * 需要本地redis-server, 地址用环境变量NF_REDIS_TEST_ADDR(ip:port)指定, 默认127.0.0.1:6379,
+ * 连不上时跳过
+ ****************************************************************************/
+
+class NFRedisPipelineTest : public testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        std::string ip = "127.0.0.1";
+        int port = 6379;
+        const char* addr = getenv("NF_REDIS_TEST_ADDR");
+        if (addr != nullptr)
+        {
+            std::string strAddr(addr);
+            size_t pos = strAddr.find(':');
+            if (pos != std::string::npos)
+            {
+                ip = strAddr.substr(0, pos);
+                port = atoi(strAddr.c_str() + pos + 1);
+            }
+        }
+
+        m_connected = m_driver.Connect(ip, port) && m_driver.SelectDB(NFREDIS_DB15);
+        if (!m_connected)
+        {
+            printf("redis %s:%d not available, skip\n", ip.c_str(), port);
+        }
+    }
+
+    NFRedisDriver m_driver;
+    bool m_connected;
+};
+
+TEST_F(NFRedisPipelineTest, RepliesMatchInOrder)
+{
+    if (!m_connected)
+    {
+        return;
+    }
+
+    const int count = 200;
+    std::vector<std::string> vecValue(count);
+    for (int i = 0; i < count; i++)
+    {
+        NFRedisCommand cmd(GET_NAME(SET));
+        cmd << "nf_pipeline_" + std::to_string(i) << "value_" + std::to_string(i);
+        ASSERT_EQ(0, m_driver.PipelineCmd(cmd));
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        NFRedisCommand cmd(GET_NAME(GET));
+        cmd << "nf_pipeline_" + std::to_string(i);
+        std::string& value = vecValue[i];
+        ASSERT_EQ(0, m_driver.PipelineCmd(cmd, [&value](const NF_SHARE_PTR<redisReply>& pReply)
+        {
+            if (pReply && pReply->type == REDIS_REPLY_STRING)
+            {
+                value.assign(pReply->str, pReply->len);
+            }
+        }));
+    }
+
+    EXPECT_EQ(static_cast<size_t>(count * 2), m_driver.GetPipelineDepth());
+    ASSERT_EQ(0, m_driver.WaitPipeline());
+    EXPECT_EQ(0u, m_driver.GetPipelineDepth());
+    for (int i = 0; i < count; i++)
+    {
+        EXPECT_EQ("value_" + std::to_string(i), vecValue[i]);
+    }
+}
+
+TEST_F(NFRedisPipelineTest, MultiExec)
+{
+    if (!m_connected)
+    {
+        return;
+    }
+
+    std::vector<int> vecType;
+    long long incr = 0;
+    m_driver.PipelineCmd(NFRedisCommand(GET_NAME(MULTI)));
+    NFRedisCommand setCmd(GET_NAME(SET));
+    setCmd << "nf_pipeline_counter" << 10;
+    m_driver.PipelineCmd(setCmd);
+    NFRedisCommand incrCmd(GET_NAME(INCR));
+    incrCmd << "nf_pipeline_counter";
+    m_driver.PipelineCmd(incrCmd);
+    m_driver.PipelineCmd(NFRedisCommand(GET_NAME(EXEC)), [&](const NF_SHARE_PTR<redisReply>& pReply)
+    {
+        ASSERT_TRUE(pReply != nullptr);
+        ASSERT_EQ(REDIS_REPLY_ARRAY, pReply->type);
+        for (size_t i = 0; i < pReply->elements; i++)
+        {
+            vecType.push_back(pReply->element[i]->type);
+        }
+        if (pReply->elements == 2)
+        {
+            incr = pReply->element[1]->integer;
+        }
+    });
+
+    ASSERT_EQ(0, m_driver.WaitPipeline());
+    ASSERT_EQ(2u, vecType.size());
+    EXPECT_EQ(REDIS_REPLY_STATUS, vecType[0]);
+    EXPECT_EQ(REDIS_REPLY_INTEGER, vecType[1]);
+    EXPECT_EQ(11, incr);
+}
+
+TEST_F(NFRedisPipelineTest, SyncCmdAfterPipeline)
+{
+    if (!m_connected)
+    {
+        return;
+    }
+
+    bool bSet = false;
+    NFRedisCommand cmd(GET_NAME(SET));
+    cmd << "nf_pipeline_sync" << "1";
+    m_driver.PipelineCmd(cmd, [&bSet](const NF_SHARE_PTR<redisReply>& pReply)
+    {
+        bSet = pReply != nullptr;
+    });
+
+    //同步命令排在流水线后面, 不能拿到SET的回复
+    EXPECT_TRUE(m_driver.EXISTS("nf_pipeline_sync"));
+    EXPECT_TRUE(bSet);
+    EXPECT_EQ(0u, m_driver.GetPipelineDepth());
+    EXPECT_TRUE(m_driver.DEL("nf_pipeline_sync"));
+}
+
+TEST_F(NFRedisPipelineTest, BenchmarkDepth)
+{
+    if (!m_connected)
+    {
+        return;
+    }
+
+    static const int depth[] = {1, 16, 128};
+    const int total = 20000;
+    for (size_t d = 0; d < sizeof(depth) / sizeof(depth[0]); d++)
+    {
+        int done = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < total; i += depth[d])
+        {
+            for (int j = 0; j < depth[d]; j++)
+            {
+                NFRedisCommand cmd(GET_NAME(SET));
+                cmd << "nf_pipeline_bench_" + std::to_string(j) << i;
+                m_driver.PipelineCmd(cmd, [&done](const NF_SHARE_PTR<redisReply>& pReply)
+                {
+                    if (pReply)
+                    {
+                        done++;
+                    }
+                });
+            }
+            ASSERT_EQ(0, m_driver.WaitPipeline());
+        }
+        double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        printf("pipeline depth:%-4d ops:%d %.0f ops/sec\n", depth[d], done, done / sec);
+        EXPECT_GE(done, total);
+    }
+}
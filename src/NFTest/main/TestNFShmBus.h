@@ -0,0 +1,319 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFShmBus.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/30
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFShmBus
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFCore/NFBuffer.h"
+#include "NFCommPlugin/NFNetPlugin/Bus/NFIBusConnection.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * 共享内存bus通道测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. ShmSendBatch一次预留整批节点, 读端按发送顺序逐条收到, 和ShmSend写入的消息可以混读
+ * 2. 通道放不下整批时只发送前缀部分, sendCount返回实际发送的条数
+ * 3. 对比逐条ShmSend/ShmRecv和ShmSendBatch/ShmRecvBatch每秒收发的消息数
+ * 4. ShmPeek对无回绕的数据块直接返回通道内存, 回绕的数据块拷贝, ShmCommit之前不能再Peek
+ * 5. 64B~64KB的消息对比ShmRecv拷贝和ShmPeek/ShmCommit原地读取的吞吐
+ ****************************************************************************/
+
+/**
+ * @brief 直接在堆内存上初始化bus通道, 把protected的收发接口暴露给测试
+ */
+class NFShmBusTestConnection : public NFIBusConnection
+{
+public:
+    explicit NFShmBusTestConnection(size_t size) : NFIBusConnection(nullptr, NF_ST_NONE, NFMessageFlag()), m_vecMem(size / sizeof(uint64_t))
+    {
+        m_recvBuffer.AssureSpace(NFBUS_MACRO_MSG_LIMIT);
+    }
+
+    bool Send(NFDataPackage& packet, const char* msg, uint32_t nLen) override { return false; }
+    bool Send(NFDataPackage& packet, const google::protobuf::Message& xData) override { return false; }
+
+    int InitBuffer()
+    {
+        return InitShmBuffer(m_vecMem.data(), m_vecMem.size() * sizeof(uint64_t));
+    }
+
+    NFShmChannel* Channel()
+    {
+        return &reinterpret_cast<NFShmChannelHead*>(m_vecMem.data())->m_nShmChannel;
+    }
+
+    using NFIBusConnection::ShmSend;
+    using NFIBusConnection::ShmRecv;
+    using NFIBusConnection::ShmSendBatch;
+    using NFIBusConnection::ShmRecvBatch;
+    using NFIBusConnection::ShmPeek;
+    using NFIBusConnection::ShmCommit;
+
+    bool InChannel(const void* data)
+    {
+        return data >= static_cast<const void*>(m_vecMem.data()) && data < static_cast<const void*>(m_vecMem.data() + m_vecMem.size());
+    }
+
+    NFBuffer m_recvBuffer;
+private:
+    std::vector<uint64_t> m_vecMem;
+};
+
+/**
+ * @brief 第i条测试消息, 长度和内容都跟i有关
+ */
+static std::string NFShmBusTestMsg(size_t i, size_t len)
+{
+    std::string msg(len, static_cast<char>('a' + i % 26));
+    memcpy(&msg[0], &i, len < sizeof(i) ? len : sizeof(i));
+    return msg;
+}
+
+TEST(NFShmBusTest, SendBatchOrder)
+{
+    NFShmBusTestConnection conn(4 * 1024 * 1024);
+    ASSERT_EQ(0, conn.InitBuffer());
+    NFShmChannel* pChannel = conn.Channel();
+
+    //单条和批量交替写入, 长度跨过节点大小
+    std::vector<std::string> vecSend;
+    for (size_t round = 0; round < 20; round++)
+    {
+        vecSend.push_back(NFShmBusTestMsg(vecSend.size(), 10 + round * 37));
+        ASSERT_EQ(0, conn.ShmSend(pChannel, vecSend.back().data(), vecSend.back().size()));
+
+        std::vector<NFShmIoVec> vec;
+        size_t begin = vecSend.size();
+        for (size_t i = 0; i < 30; i++)
+        {
+            vecSend.push_back(NFShmBusTestMsg(vecSend.size(), 1 + (round * 131 + i * 97) % 3000));
+        }
+        for (size_t i = begin; i < vecSend.size(); i++)
+        {
+            NFShmIoVec io;
+            io.m_pData = vecSend[i].data();
+            io.m_nLen = vecSend[i].size();
+            vec.push_back(io);
+        }
+        size_t sendCount = 0;
+        ASSERT_EQ(0, conn.ShmSendBatch(pChannel, vec.data(), vec.size(), &sendCount));
+        ASSERT_EQ(vec.size(), sendCount);
+    }
+
+    //前一半逐条收, 后一半批量收
+    size_t index = 0;
+    for (; index < vecSend.size() / 2; index++)
+    {
+        size_t recvLen = 0;
+        conn.m_recvBuffer.Clear();
+        ASSERT_EQ(0, conn.ShmRecv(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &recvLen));
+        ASSERT_EQ(vecSend[index], std::string(conn.m_recvBuffer.WriteAddr(), recvLen));
+    }
+
+    size_t recvCount = 0;
+    EXPECT_EQ(0, conn.ShmRecvBatch(pChannel, conn.m_recvBuffer, [&](const char* data, size_t len)
+    {
+        ASSERT_LT(index, vecSend.size());
+        EXPECT_EQ(vecSend[index], std::string(data, len));
+        index++;
+    }, vecSend.size(), &recvCount));
+    EXPECT_EQ(vecSend.size() - vecSend.size() / 2, recvCount);
+    EXPECT_EQ(vecSend.size(), index);
+
+    size_t recvLen = 0;
+    EXPECT_EQ(NFrame::ERR_CODE_NFBUS_ERR_NO_DATA, conn.ShmRecv(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &recvLen));
+}
+
+TEST(NFShmBusTest, SendBatchPrefix)
+{
+    NFShmBusTestConnection conn(256 * 1024);
+    ASSERT_EQ(0, conn.InitBuffer());
+    NFShmChannel* pChannel = conn.Channel();
+
+    std::string msg = NFShmBusTestMsg(0, 4000);
+    std::vector<NFShmIoVec> vec(1000);
+    for (size_t i = 0; i < vec.size(); i++)
+    {
+        vec[i].m_pData = msg.data();
+        vec[i].m_nLen = msg.size();
+    }
+
+    size_t sendCount = 0;
+    EXPECT_EQ(0, conn.ShmSendBatch(pChannel, vec.data(), vec.size(), &sendCount));
+    EXPECT_GT(sendCount, 0u);
+    EXPECT_LT(sendCount, vec.size());
+
+    //通道已满, 一条也放不下
+    size_t fullCount = 0;
+    EXPECT_EQ(NFrame::ERR_CODE_NFBUS_ERR_BUFF_LIMIT, conn.ShmSendBatch(pChannel, vec.data(), vec.size(), &fullCount));
+    EXPECT_EQ(0u, fullCount);
+
+    size_t recvCount = 0;
+    EXPECT_EQ(0, conn.ShmRecvBatch(pChannel, conn.m_recvBuffer, [&](const char* data, size_t len)
+    {
+        EXPECT_EQ(msg, std::string(data, len));
+    }, vec.size(), &recvCount));
+    EXPECT_EQ(sendCount, recvCount);
+}
+
+TEST(NFShmBusTest, SendBatchBenchmark)
+{
+    const size_t msgLen = 64;
+    const size_t total = 2000000;
+    const size_t batch = NFBUS_MACRO_BATCH_LIMIT;
+    NFShmBusTestConnection conn(16 * 1024 * 1024);
+    ASSERT_EQ(0, conn.InitBuffer());
+    NFShmChannel* pChannel = conn.Channel();
+    std::string msg = NFShmBusTestMsg(1, msgLen);
+
+    //逐条: 每条一次CAS和一次读游标提交
+    size_t recvBytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t sent = 0; sent < total; sent += batch)
+    {
+        for (size_t i = 0; i < batch; i++)
+        {
+            conn.ShmSend(pChannel, msg.data(), msg.size());
+        }
+        for (size_t i = 0; i < batch; i++)
+        {
+            size_t recvLen = 0;
+            conn.ShmRecv(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &recvLen);
+            recvBytes += recvLen;
+        }
+    }
+    double singleSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(total * msgLen, recvBytes);
+
+    //批量: 每批一次CAS和一次读游标提交
+    std::vector<NFShmIoVec> vec(batch);
+    for (size_t i = 0; i < batch; i++)
+    {
+        vec[i].m_pData = msg.data();
+        vec[i].m_nLen = msg.size();
+    }
+    recvBytes = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t sent = 0; sent < total; sent += batch)
+    {
+        size_t sendCount = 0;
+        conn.ShmSendBatch(pChannel, vec.data(), vec.size(), &sendCount);
+        size_t recvCount = 0;
+        conn.ShmRecvBatch(pChannel, conn.m_recvBuffer, [&](const char* data, size_t len)
+        {
+            recvBytes += len;
+        }, batch, &recvCount);
+    }
+    double batchSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(total * msgLen, recvBytes);
+
+    printf("shm bus %zuB x %zu: single %.2fM msg/s, batch(%zu) %.2fM msg/s\n", msgLen, total, total / singleSec / 1e6, batch, total / batchSec / 1e6);
+}
+
+TEST(NFShmBusTest, PeekCommit)
+{
+    NFShmBusTestConnection conn(256 * 1024);
+    ASSERT_EQ(0, conn.InitBuffer());
+    NFShmChannel* pChannel = conn.Channel();
+
+    //通道很小, 发够多的消息保证数据块在末尾回绕
+    size_t inPlace = 0;
+    size_t copied = 0;
+    for (size_t i = 0; i < 2000; i++)
+    {
+        std::string msg = NFShmBusTestMsg(i, 100 + (i * 997) % 5000);
+        ASSERT_EQ(0, conn.ShmSend(pChannel, msg.data(), msg.size()));
+
+        const void* data = nullptr;
+        size_t dataSize = 0;
+        conn.m_recvBuffer.Clear();
+        ASSERT_EQ(0, conn.ShmPeek(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &data, &dataSize));
+        ASSERT_EQ(msg, std::string(static_cast<const char*>(data), dataSize));
+        if (conn.InChannel(data))
+        {
+            inPlace++;
+        }
+        else
+        {
+            EXPECT_EQ(static_cast<const void*>(conn.m_recvBuffer.WriteAddr()), data);
+            copied++;
+        }
+
+        //没有提交前不能再Peek, 读游标也没有移动
+        const void* again = nullptr;
+        size_t againSize = 0;
+        EXPECT_EQ(NFrame::ERR_CODE_NFBUS_ERR_PARAMS, conn.ShmPeek(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &again, &againSize));
+        ASSERT_EQ(0, conn.ShmCommit(pChannel));
+    }
+    EXPECT_GT(inPlace, 0u);
+    EXPECT_GT(copied, 0u);
+
+    const void* data = nullptr;
+    size_t dataSize = 0;
+    EXPECT_EQ(NFrame::ERR_CODE_NFBUS_ERR_NO_DATA, conn.ShmPeek(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &data, &dataSize));
+}
+
+TEST(NFShmBusTest, PeekThroughput)
+{
+    NFShmBusTestConnection conn(16 * 1024 * 1024);
+    ASSERT_EQ(0, conn.InitBuffer());
+    NFShmChannel* pChannel = conn.Channel();
+
+    const size_t sizes[] = {64, 256, 1024, 4096, 16384, 65536 - 1024};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        const size_t msgLen = sizes[s];
+        const size_t batch = 32;
+        const size_t total = std::max<size_t>(batch * 100, 256 * 1024 * 1024 / msgLen) / batch * batch;
+        std::string msg = NFShmBusTestMsg(s, msgLen);
+
+        //两种读法都让处理函数读一遍数据, 模拟解包
+        uint64_t sum = 0;
+        double sec[2] = {0, 0};
+        for (int mode = 0; mode < 2; mode++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t sent = 0; sent < total; sent += batch)
+            {
+                for (size_t i = 0; i < batch; i++)
+                {
+                    conn.ShmSend(pChannel, msg.data(), msg.size());
+                }
+                for (size_t i = 0; i < batch; i++)
+                {
+                    const void* data = nullptr;
+                    size_t dataSize = 0;
+                    if (mode == 0)
+                    {
+                        conn.ShmRecv(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &dataSize);
+                        data = conn.m_recvBuffer.WriteAddr();
+                        sum += static_cast<const unsigned char*>(data)[dataSize - 1];
+                    }
+                    else
+                    {
+                        conn.ShmPeek(pChannel, conn.m_recvBuffer.WriteAddr(), conn.m_recvBuffer.WritableSize(), &data, &dataSize);
+                        sum += static_cast<const unsigned char*>(data)[dataSize - 1];
+                        conn.ShmCommit(pChannel);
+                    }
+                }
+            }
+            sec[mode] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        EXPECT_EQ(2 * total * static_cast<unsigned char>(msg[msgLen - 1]), sum);
+
+        double mb = static_cast<double>(total) * msgLen / 1024 / 1024;
+        printf("shm bus %6zuB x %7zu: ShmRecv copy %8.1fMB/s %6.2fM msg/s, ShmPeek in place %8.1fMB/s %6.2fM msg/s\n", msgLen, total, mb / sec[0], total / sec[0] / 1e6,
+               mb / sec[1], total / sec[1] / 1e6);
+    }
+}
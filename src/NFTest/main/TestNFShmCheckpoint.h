@@ -0,0 +1,442 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFShmCheckpoint.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/29
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFShmCheckpoint
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFCore/NFPlatform.h"
+
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+#include "NFCommPlugin/NFShmPlugin/NFShmCheckpoint.h"
+#include <algorithm>
+#include <chrono>
+#include <fcntl.h>
+#include <string.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+
+/****************************************************************************
+ * 共享内存写盘镜像测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 写盘过程中主线程一直在改共享内存, 恢复出来的内容和进入提交那一刻的共享内存完全一致
+ * 2. 两个文件轮流写, 恢复时取序号大的; 最新的文件损坏或者未提交时退回上一个
+ * 3. 布局hash/大小不一致的镜像拒绝恢复
+ * 4. 后台追脏页时每轮都重写期间改过的页, 两个文件都写过一次后只写改过的页
+ * 5. 镜像数据被改坏时按每页CRC32发现, 退回另一个镜像
+ * 6. 进程里同时有多个实例时不用soft-dirty, 只剩一个时恢复
+ * 7. 统计整块写盘/增量写盘的吞吐和主线程停顿, 以及从镜像恢复的耗时
+ ****************************************************************************/
+
+/**
+ * @brief 测试用的共享内存, 析构时删除镜像文件
+ */
+class NFShmCheckpointTestEnv
+{
+public:
+    explicit NFShmCheckpointTestEnv(size_t size) : m_size(size), m_pAddr(nullptr), m_seed(0x9E3779B97F4A7C15ull)
+    {
+        m_strPath = "/tmp/nf_shm_checkpoint_test_" + std::to_string(getpid());
+        int shmId = shmget(IPC_PRIVATE, m_size, IPC_CREAT | 0600);
+        if (shmId >= 0)
+        {
+            void* pAddr = shmat(shmId, NULL, 0);
+            shmctl(shmId, IPC_RMID, NULL);
+            if (pAddr != reinterpret_cast<void*>(-1))
+            {
+                m_pAddr = static_cast<char*>(pAddr);
+            }
+        }
+    }
+
+    ~NFShmCheckpointTestEnv()
+    {
+        if (m_pAddr)
+        {
+            shmdt(m_pAddr);
+        }
+        unlink(NFShmCheckpoint::GetImageFile(m_strPath, 0).c_str());
+        unlink(NFShmCheckpoint::GetImageFile(m_strPath, 1).c_str());
+    }
+
+    uint64_t Rand()
+    {
+        m_seed ^= m_seed << 13;
+        m_seed ^= m_seed >> 7;
+        m_seed ^= m_seed << 17;
+        return m_seed;
+    }
+
+    void FillAll()
+    {
+        uint64_t* p = reinterpret_cast<uint64_t*>(m_pAddr);
+        for (size_t i = 0; i < m_size / sizeof(uint64_t); i++)
+        {
+            p[i] = Rand();
+        }
+    }
+
+    /**
+     * @brief 随机改count个位置, 模拟主线程的逻辑
+     */
+    void Mutate(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            m_pAddr[Rand() % m_size] = static_cast<char>(Rand());
+        }
+    }
+
+    /**
+     * @brief 做一次完整的写盘, 过程中每帧改mutate个位置, 返回进入提交那一刻的共享内存
+     */
+    std::vector<char> Checkpoint(NFShmCheckpoint& checkpoint, size_t mutate)
+    {
+        std::vector<char> vecExpect;
+        EXPECT_EQ(0, checkpoint.Start());
+        if (checkpoint.GetState() == NF_SHM_CHECKPOINT_COMMIT)
+        {
+            vecExpect.assign(m_pAddr, m_pAddr + m_size);
+        }
+
+        while (checkpoint.GetState() != NF_SHM_CHECKPOINT_IDLE)
+        {
+            Mutate(mutate);
+            NFShmCheckpointState state = checkpoint.GetState();
+            EXPECT_EQ(0, checkpoint.Tick());
+            if (state != NF_SHM_CHECKPOINT_COMMIT && checkpoint.GetState() == NF_SHM_CHECKPOINT_COMMIT)
+            {
+                vecExpect.assign(m_pAddr, m_pAddr + m_size);
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return vecExpect;
+    }
+
+    bool LoadEqual(const std::vector<char>& vecExpect, uint32_t hash, uint64_t& generation)
+    {
+        std::vector<char> vecLoad(m_size);
+        if (NFShmCheckpoint::Load(m_strPath, vecLoad.data(), m_size, hash, generation) != 0)
+        {
+            return false;
+        }
+        return vecLoad == vecExpect;
+    }
+
+    /**
+     * @brief 改镜像文件头, bCorrupt为true时只改内容不改校验和
+     */
+    void ModifyHeader(int index, bool bCorrupt)
+    {
+        std::string strFile = NFShmCheckpoint::GetImageFile(m_strPath, index);
+        int fd = open(strFile.c_str(), O_RDWR);
+        ASSERT_GE(fd, 0);
+        NFShmCheckpointHeader header;
+        ASSERT_EQ(static_cast<ssize_t>(sizeof(header)), pread(fd, &header, sizeof(header), 0));
+        header.m_uiCommitted = 0;
+        if (!bCorrupt)
+        {
+            header.m_uiCheckSum = NFShmCheckpoint::GetHeaderCheckSum(header);
+        }
+        ASSERT_EQ(static_cast<ssize_t>(sizeof(header)), pwrite(fd, &header, sizeof(header), 0));
+        close(fd);
+    }
+
+    /**
+     * @brief 改镜像文件里offset处的一个字节, 不动文件头
+     */
+    void CorruptFile(int index, size_t offset)
+    {
+        std::string strFile = NFShmCheckpoint::GetImageFile(m_strPath, index);
+        int fd = open(strFile.c_str(), O_RDWR);
+        ASSERT_GE(fd, 0);
+        char c = 0;
+        ASSERT_EQ(1, pread(fd, &c, 1, offset));
+        c = static_cast<char>(~c);
+        ASSERT_EQ(1, pwrite(fd, &c, 1, offset));
+        close(fd);
+    }
+
+public:
+    std::string m_strPath;
+    size_t m_size;
+    char* m_pAddr;
+    uint64_t m_seed;
+};
+
+/**
+ * @brief 用影子拷贝逐页比较代替soft-dirty, 内核不支持soft-dirty时也能测到后台追脏页的流程
+ */
+class NFShmCheckpointTestTracker : public NFShmCheckpoint
+{
+public:
+    int InitTracker(const std::string& strPath, char* pAddr, size_t siSize, uint32_t uiLayoutHash)
+    {
+        int iRet = Init(strPath, pAddr, siSize, uiLayoutHash, 0);
+        m_bSoftDirty = true;
+        m_vecShadow.assign(pAddr, pAddr + siSize);
+        return iRet;
+    }
+
+protected:
+    size_t CollectDirty(std::vector<uint64_t>& vecDirty) override
+    {
+        vecDirty.assign(GetWordCount(), 0);
+        size_t siDirty = 0;
+        for (size_t page = 0; page < GetPageCount(); page++)
+        {
+            size_t offset = page * m_siPageSize;
+            size_t len = std::min(m_siPageSize, m_siSize - offset);
+            if (memcmp(m_vecShadow.data() + offset, m_pAddr + offset, len) != 0)
+            {
+                memcpy(m_vecShadow.data() + offset, m_pAddr + offset, len);
+                vecDirty[page / 64] |= 1ULL << (page % 64);
+                siDirty++;
+            }
+        }
+        return siDirty;
+    }
+
+private:
+    std::vector<char> m_vecShadow;
+};
+
+TEST(NFShmCheckpointTest, ConsistentWhileMutating)
+{
+    NFShmCheckpointTestEnv env(8 * 1024 * 1024);
+    ASSERT_TRUE(env.m_pAddr != nullptr);
+    env.FillAll();
+
+    NFShmCheckpoint checkpoint;
+    ASSERT_EQ(0, checkpoint.Init(env.m_strPath, env.m_pAddr, env.m_size, 12345, 0));
+    std::vector<char> vecExpect = env.Checkpoint(checkpoint, 1000);
+    ASSERT_EQ(env.m_size, vecExpect.size());
+    EXPECT_EQ(1u, checkpoint.GetGeneration());
+    EXPECT_EQ(env.m_size, checkpoint.GetLastWriteSize());
+
+    uint64_t generation = 0;
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 12345, generation));
+    EXPECT_EQ(1u, generation);
+
+    //之后共享内存再怎么改都不影响已经提交的镜像
+    env.Mutate(10000);
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 12345, generation));
+}
+
+TEST(NFShmCheckpointTest, AlternateAndFallback)
+{
+    NFShmCheckpointTestEnv env(4 * 1024 * 1024);
+    ASSERT_TRUE(env.m_pAddr != nullptr);
+    env.FillAll();
+
+    std::vector<char> vecExpect[4];
+    {
+        NFShmCheckpoint checkpoint;
+        ASSERT_EQ(0, checkpoint.Init(env.m_strPath, env.m_pAddr, env.m_size, 1, 0));
+        for (int i = 1; i <= 3; i++)
+        {
+            vecExpect[i] = env.Checkpoint(checkpoint, 100);
+            EXPECT_EQ(static_cast<uint64_t>(i), checkpoint.GetGeneration());
+            if (i == 3 && checkpoint.IsSoftDirty())
+            {
+                //第三次每个文件都有过一次完整的内容, 只写改过的页
+                EXPECT_LT(checkpoint.GetLastWriteSize(), env.m_size);
+            }
+        }
+    }
+
+    uint64_t generation = 0;
+    EXPECT_TRUE(env.LoadEqual(vecExpect[3], 1, generation));
+    EXPECT_EQ(3u, generation);
+
+    //第3次写在文件0上, 文件头损坏时退回第2次
+    env.ModifyHeader(0, true);
+    EXPECT_TRUE(env.LoadEqual(vecExpect[2], 1, generation));
+    EXPECT_EQ(2u, generation);
+
+    //未提交的文件也不用
+    env.ModifyHeader(1, false);
+    std::vector<char> vecLoad(env.m_size);
+    EXPECT_EQ(-1, NFShmCheckpoint::Load(env.m_strPath, vecLoad.data(), env.m_size, 1, generation));
+
+    //重新打开后接着上次的序号写
+    NFShmCheckpoint checkpoint;
+    ASSERT_EQ(0, checkpoint.Init(env.m_strPath, env.m_pAddr, env.m_size, 1, 0));
+    EXPECT_EQ(0u, checkpoint.GetGeneration());
+    std::vector<char> vecNew = env.Checkpoint(checkpoint, 100);
+    EXPECT_TRUE(env.LoadEqual(vecNew, 1, generation));
+    EXPECT_EQ(1u, generation);
+}
+
+TEST(NFShmCheckpointTest, IncrementalRounds)
+{
+    NFShmCheckpointTestEnv env(32 * 1024 * 1024);
+    ASSERT_TRUE(env.m_pAddr != nullptr);
+    env.FillAll();
+
+    NFShmCheckpointTestTracker checkpoint;
+    ASSERT_EQ(0, checkpoint.InitTracker(env.m_strPath, env.m_pAddr, env.m_size, 2));
+
+    //每帧改的页超过最后一轮的大小, 要追几轮后强制提交
+    uint64_t generation = 0;
+    std::vector<char> vecExpect = env.Checkpoint(checkpoint, 6000);
+    EXPECT_GT(checkpoint.GetLastWriteSize(), env.m_size);
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 2, generation));
+
+    vecExpect = env.Checkpoint(checkpoint, 0);
+    EXPECT_GE(checkpoint.GetLastWriteSize(), env.m_size);
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 2, generation));
+
+    //文件0还要补上第一次提交后后台写盘期间改过的页
+    vecExpect = env.Checkpoint(checkpoint, 0);
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 2, generation));
+
+    //之后每个文件只写它上次提交以后改过的页
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    env.Mutate(100);
+    vecExpect = env.Checkpoint(checkpoint, 0);
+    EXPECT_LE(checkpoint.GetLastWriteSize(), 100 * pageSize);
+    EXPECT_GT(checkpoint.GetLastWriteSize(), 0u);
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 2, generation));
+    EXPECT_EQ(4u, generation);
+
+    env.Mutate(100);
+    vecExpect = env.Checkpoint(checkpoint, 0);
+    EXPECT_LE(checkpoint.GetLastWriteSize(), 200 * pageSize);
+    EXPECT_GT(checkpoint.GetLastWriteSize(), 100 * pageSize / 2);
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 2, generation));
+    EXPECT_EQ(5u, generation);
+}
+
+TEST(NFShmCheckpointTest, RejectIncompatible)
+{
+    NFShmCheckpointTestEnv env(1024 * 1024);
+    ASSERT_TRUE(env.m_pAddr != nullptr);
+    env.FillAll();
+
+    NFShmCheckpoint checkpoint;
+    ASSERT_EQ(0, checkpoint.Init(env.m_strPath, env.m_pAddr, env.m_size, 777, 0));
+    std::vector<char> vecExpect = env.Checkpoint(checkpoint, 0);
+
+    uint64_t generation = 0;
+    std::vector<char> vecLoad(env.m_size * 2);
+    EXPECT_EQ(-1, NFShmCheckpoint::Load(env.m_strPath, vecLoad.data(), env.m_size, 778, generation));
+    EXPECT_EQ(-1, NFShmCheckpoint::Load(env.m_strPath, vecLoad.data(), env.m_size * 2, 777, generation));
+    EXPECT_EQ(-1, NFShmCheckpoint::Load(env.m_strPath + ".none", vecLoad.data(), env.m_size, 777, generation));
+    EXPECT_TRUE(env.LoadEqual(vecExpect, 777, generation));
+}
+
+TEST(NFShmCheckpointTest, DataCheckSum)
+{
+    NFShmCheckpointTestEnv env(1024 * 1024);
+    ASSERT_TRUE(env.m_pAddr != nullptr);
+    env.FillAll();
+
+    std::vector<char> vecExpect[3];
+    {
+        NFShmCheckpoint checkpoint;
+        ASSERT_EQ(0, checkpoint.Init(env.m_strPath, env.m_pAddr, env.m_size, 3, 0));
+        vecExpect[1] = env.Checkpoint(checkpoint, 100);
+        vecExpect[2] = env.Checkpoint(checkpoint, 100);
+    }
+
+    uint64_t generation = 0;
+    EXPECT_TRUE(env.LoadEqual(vecExpect[2], 3, generation));
+    EXPECT_EQ(2u, generation);
+
+    //第2次写在文件1上, 数据坏了文件头还是好的, 按页校验发现后退回第1次
+    env.CorruptFile(1, NF_SHM_CHECKPOINT_HEADER_SIZE + env.m_size / 2);
+    EXPECT_TRUE(env.LoadEqual(vecExpect[1], 3, generation));
+    EXPECT_EQ(1u, generation);
+
+    //CRC32表坏了也不用
+    env.CorruptFile(0, NF_SHM_CHECKPOINT_HEADER_SIZE + env.m_size);
+    std::vector<char> vecLoad(env.m_size);
+    EXPECT_EQ(-1, NFShmCheckpoint::Load(env.m_strPath, vecLoad.data(), env.m_size, 3, generation));
+}
+
+TEST(NFShmCheckpointTest, MultiInstance)
+{
+    NFShmCheckpointTestEnv env(1024 * 1024);
+    ASSERT_TRUE(env.m_pAddr != nullptr);
+    env.FillAll();
+
+    NFShmCheckpointTestTracker checkpoint;
+    ASSERT_EQ(0, checkpoint.InitTracker(env.m_strPath, env.m_pAddr, env.m_size, 4));
+    EXPECT_TRUE(checkpoint.IsSoftDirty());
+
+    {
+        //clear_refs是整个进程的, 两个实例同时在时都不能用soft-dirty
+        NFShmCheckpointTestEnv other(1024 * 1024);
+        ASSERT_TRUE(other.m_pAddr != nullptr);
+        other.m_strPath += "_other";
+        other.FillAll();
+        NFShmCheckpointTestTracker otherCheckpoint;
+        ASSERT_EQ(0, otherCheckpoint.InitTracker(other.m_strPath, other.m_pAddr, other.m_size, 4));
+        EXPECT_FALSE(checkpoint.IsSoftDirty());
+        EXPECT_FALSE(otherCheckpoint.IsSoftDirty());
+
+        uint64_t generation = 0;
+        std::vector<char> vecExpect = env.Checkpoint(checkpoint, 100);
+        EXPECT_TRUE(env.LoadEqual(vecExpect, 4, generation));
+        vecExpect = other.Checkpoint(otherCheckpoint, 100);
+        EXPECT_TRUE(other.LoadEqual(vecExpect, 4, generation));
+    }
+
+    EXPECT_TRUE(checkpoint.IsSoftDirty());
+}
+
+TEST(NFShmCheckpointTest, Benchmark)
+{
+    NFShmCheckpointTestEnv env(256 * 1024 * 1024);
+    ASSERT_TRUE(env.m_pAddr != nullptr);
+    env.FillAll();
+
+    NFShmCheckpoint checkpoint;
+    ASSERT_EQ(0, checkpoint.Init(env.m_strPath, env.m_pAddr, env.m_size, 1, 0));
+    printf("shm 256M soft-dirty:%d\n", checkpoint.IsSoftDirty());
+
+    for (int i = 0; i < 3; i++)
+    {
+        env.Checkpoint(checkpoint, 1000);
+        double costSec = checkpoint.GetLastCostUs() / 1000000.0;
+        printf("  checkpoint %d: write %.1fM cost %.1fms %.1fM/s, main thread stall %.2fms\n", i + 1,
+               checkpoint.GetLastWriteSize() / 1024.0 / 1024.0, checkpoint.GetLastCostUs() / 1000.0,
+               costSec > 0 ? checkpoint.GetLastWriteSize() / 1024.0 / 1024.0 / costSec : 0, checkpoint.GetLastStallUs() / 1000.0);
+    }
+
+    //soft-dirty不可用时用影子拷贝模拟脏页跟踪, 看增量写盘的大小, 停顿里包含逐页比较的耗时, 没有参考意义
+    if (!checkpoint.IsSoftDirty())
+    {
+        NFShmCheckpointTestTracker tracker;
+        ASSERT_EQ(0, tracker.InitTracker(env.m_strPath, env.m_pAddr, env.m_size, 1));
+        for (int i = 0; i < 4; i++)
+        {
+            //两次写盘之间改1%的页
+            env.Mutate(env.m_size / 4096 / 100);
+            env.Checkpoint(tracker, 0);
+            double costSec = tracker.GetLastCostUs() / 1000000.0;
+            printf("  tracked checkpoint %d: write %.1fM cost %.1fms %.1fM/s\n", i + 1, tracker.GetLastWriteSize() / 1024.0 / 1024.0,
+                   tracker.GetLastCostUs() / 1000.0, costSec > 0 ? tracker.GetLastWriteSize() / 1024.0 / 1024.0 / costSec : 0);
+        }
+    }
+
+    std::vector<char> vecLoad(env.m_size);
+    uint64_t generation = 0;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(0, NFShmCheckpoint::Load(env.m_strPath, vecLoad.data(), env.m_size, 1, generation));
+    printf("  restore from image: %.1fms (page cache warm)\n",
+           std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+#endif
@@ -0,0 +1,364 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFShmFlatHashMap.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/4/25
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFShmFlatHashMap
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFShmStl/NFShmFlatHashMap.h"
+#include "NFComm/NFShmStl/NFShmHashMap.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <random>
+#include <chrono>
+
+/****************************************************************************
+ * NFShmFlatHashMap 单元测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 验证基本的插入、查找、删除、遍历
+ * 2. 验证删除时把最后一个元素搬到空洞后, 控制字节和稠密数组保持一致
+ * 3. 验证大量删除标记后的原地重建
+ * 4. 与std::unordered_map做随机对比
+ * 5. 与NFShmHashMap对比插入、查找、删除、遍历的耗时
+ *****************************************************************************/
+
+class FlatHashTestValue
+{
+public:
+    FlatHashTestValue() : id(0), name("default")
+    {
+        ++constructor_count;
+    }
+
+    FlatHashTestValue(int i) : id(i), name("value_" + std::to_string(i))
+    {
+        ++constructor_count;
+    }
+
+    FlatHashTestValue(const FlatHashTestValue& other) : id(other.id), name(other.name)
+    {
+        ++constructor_count;
+    }
+
+    FlatHashTestValue& operator=(const FlatHashTestValue& other)
+    {
+        id = other.id;
+        name = other.name;
+        return *this;
+    }
+
+    ~FlatHashTestValue()
+    {
+        ++destructor_count;
+    }
+
+    int id;
+    std::string name;
+
+    static int constructor_count;
+    static int destructor_count;
+};
+
+int FlatHashTestValue::constructor_count = 0;
+int FlatHashTestValue::destructor_count = 0;
+
+class NFShmFlatHashMapTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        FlatHashTestValue::constructor_count = 0;
+        FlatHashTestValue::destructor_count = 0;
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(FlatHashTestValue::constructor_count, FlatHashTestValue::destructor_count);
+    }
+};
+
+TEST_F(NFShmFlatHashMapTest, BasicOperations)
+{
+    NFShmFlatHashMap<int, std::string, 100> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.max_size(), 100);
+
+    auto ret = map.insert({1, "one"});
+    EXPECT_TRUE(ret.second);
+    EXPECT_EQ(ret.first->first, 1);
+    EXPECT_EQ(ret.first->second, "one");
+
+    ret = map.insert({1, "uno"});
+    EXPECT_FALSE(ret.second);
+    EXPECT_EQ(ret.first->second, "one");
+
+    map[2] = "two";
+    map.emplace(3, "three");
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map.count(2), 1);
+    EXPECT_EQ(map.count(4), 0);
+    EXPECT_EQ(map.at(3), "three");
+
+    EXPECT_EQ(map.erase(2), 1);
+    EXPECT_EQ(map.erase(2), 0);
+    EXPECT_EQ(map.find(2), map.end());
+    EXPECT_NE(map.find(1), map.end());
+    EXPECT_NE(map.find(3), map.end());
+    EXPECT_EQ(map.size(), 2);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(1), map.end());
+}
+
+TEST_F(NFShmFlatHashMapTest, CapacityAndFull)
+{
+    NFShmFlatHashMap<int, int, 50> map;
+    for (int i = 0; i < 60; ++i)
+    {
+        auto ret = map.insert({i, i});
+        EXPECT_EQ(ret.second, i < 50);
+    }
+    EXPECT_TRUE(map.full());
+    EXPECT_EQ(map.left_size(), 0);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        EXPECT_EQ(map.find(i)->second, i);
+    }
+}
+
+TEST_F(NFShmFlatHashMapTest, EraseWhileIterating)
+{
+    NFShmFlatHashMap<int, int, 200> map;
+    for (int i = 0; i < 200; ++i)
+    {
+        map[i] = i;
+    }
+
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (it->first % 3 == 0)
+        {
+            it = map.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    EXPECT_EQ(map.size(), 133);
+    int count = 0;
+    for (auto it = map.begin(); it != map.end(); ++it)
+    {
+        EXPECT_NE(it->first % 3, 0);
+        EXPECT_EQ(map.find(it->first), it);
+        ++count;
+    }
+    EXPECT_EQ(count, 133);
+}
+
+TEST_F(NFShmFlatHashMapTest, TombstoneChurn)
+{
+    // 在满容量附近反复删除插入, 触发删除标记重建
+    NFShmFlatHashMap<int, int, 1000> map;
+    for (int i = 0; i < 1000; ++i)
+    {
+        map[i] = i;
+    }
+
+    int next = 1000;
+    for (int round = 0; round < 20000; ++round)
+    {
+        int victim = next - 1000;
+        EXPECT_EQ(map.erase(victim), 1);
+        EXPECT_TRUE(map.insert({next, next}).second);
+        ++next;
+    }
+
+    EXPECT_EQ(map.size(), 1000);
+    for (int i = next - 1000; i < next; ++i)
+    {
+        auto it = map.find(i);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(it->second, i);
+    }
+    EXPECT_EQ(map.find(next - 1001), map.end());
+}
+
+TEST_F(NFShmFlatHashMapTest, CustomTypeLifetime)
+{
+    {
+        NFShmFlatHashMap<int, FlatHashTestValue, 64> map;
+        for (int i = 0; i < 64; ++i)
+        {
+            map.insert({i, FlatHashTestValue(i)});
+        }
+        for (int i = 0; i < 64; i += 2)
+        {
+            map.erase(i);
+        }
+        EXPECT_EQ(map.size(), 32);
+        EXPECT_EQ(map.find(5)->second.name, "value_5");
+
+        NFShmFlatHashMap<int, FlatHashTestValue, 64> copy(map);
+        EXPECT_EQ(copy.size(), 32);
+        EXPECT_EQ(copy.find(7)->second.id, 7);
+    }
+}
+
+TEST_F(NFShmFlatHashMapTest, SharedMemorySpecificFeatures)
+{
+    NFShmFlatHashMap<int, int, 100> map;
+    EXPECT_EQ(map.CreateInit(), 0);
+    EXPECT_EQ(map.ResumeInit(), 0);
+    map[1] = 10;
+    map[2] = 20;
+
+    // 内部只保存下标, 整块内存拷贝到其他地址后依然可以直接使用
+    typedef NFShmFlatHashMap<int, int, 100> MapType;
+    std::unique_ptr<char[]> buffer(new char[sizeof(MapType)]);
+    memcpy(buffer.get(), static_cast<void*>(&map), sizeof(MapType));
+    MapType* pResumed = reinterpret_cast<MapType*>(buffer.get());
+    EXPECT_EQ(pResumed->size(), 2);
+    EXPECT_EQ(pResumed->find(1)->second, 10);
+    EXPECT_EQ(pResumed->find(2)->second, 20);
+    EXPECT_EQ(pResumed->find(3), pResumed->end());
+
+    map.Init();
+    EXPECT_TRUE(map.empty());
+}
+
+TEST_F(NFShmFlatHashMapTest, RandomCompareWithStl)
+{
+    const int MAX = 5000;
+    std::unique_ptr<NFShmFlatHashMap<uint64_t, int, MAX>> pMap(new NFShmFlatHashMap<uint64_t, int, MAX>());
+    std::unordered_map<uint64_t, int> stdMap;
+    std::mt19937_64 rng(12345);
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        uint64_t key = rng() % 8000;
+        int op = static_cast<int>(rng() % 3);
+        if (op == 0 && stdMap.size() < static_cast<size_t>(MAX))
+        {
+            bool inserted = stdMap.insert(std::make_pair(key, i)).second;
+            EXPECT_EQ(pMap->insert({key, i}).second, inserted);
+        }
+        else if (op == 1)
+        {
+            EXPECT_EQ(pMap->erase(key), stdMap.erase(key));
+        }
+        else
+        {
+            auto it = pMap->find(key);
+            auto stdIt = stdMap.find(key);
+            ASSERT_EQ(it == pMap->end(), stdIt == stdMap.end());
+            if (stdIt != stdMap.end())
+            {
+                EXPECT_EQ(it->second, stdIt->second);
+            }
+        }
+    }
+
+    EXPECT_EQ(pMap->size(), stdMap.size());
+    size_t count = 0;
+    for (auto it = pMap->begin(); it != pMap->end(); ++it)
+    {
+        EXPECT_EQ(stdMap[it->first], it->second);
+        ++count;
+    }
+    EXPECT_EQ(count, stdMap.size());
+}
+
+// ==================== 与NFShmHashMap的性能对比 ====================
+
+template <class Map>
+static void FlatHashBenchmark(const char* name, Map& map, const std::vector<int>& keys)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        map.insert({keys[i], static_cast<int>(i)});
+    }
+    auto insertEnd = std::chrono::high_resolution_clock::now();
+
+    int64_t sum = 0;
+    for (int round = 0; round < 4; ++round)
+    {
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            auto it = map.find(keys[i]);
+            if (it != map.end())
+            {
+                sum += it->second;
+            }
+            // 一半查找不命中
+            if (map.find(-keys[i] - 1) != map.end())
+            {
+                sum -= 1;
+            }
+        }
+    }
+    auto findEnd = std::chrono::high_resolution_clock::now();
+
+    for (int round = 0; round < 10; ++round)
+    {
+        for (auto it = map.begin(); it != map.end(); ++it)
+        {
+            sum += it->second;
+        }
+    }
+    auto iterEnd = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        map.erase(keys[i]);
+    }
+    auto eraseEnd = std::chrono::high_resolution_clock::now();
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_NE(sum, 0);
+
+    printf("%-18s size:%zu insert:%lldus find:%lldus iterate:%lldus erase:%lldus\n", name, keys.size(),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(insertEnd - start).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(findEnd - insertEnd).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(iterEnd - findEnd).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(eraseEnd - iterEnd).count()));
+}
+
+TEST_F(NFShmFlatHashMapTest, BenchmarkAgainstNFShmHashMap)
+{
+    const int BENCH_SIZE = 100000;
+    std::vector<int> keys(BENCH_SIZE);
+    std::mt19937 rng(54321);
+    for (int i = 0; i < BENCH_SIZE; ++i)
+    {
+        keys[i] = static_cast<int>(rng() & 0x3fffffff);
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    std::unique_ptr<NFShmHashMap<int, int, BENCH_SIZE>> pHashMap(new NFShmHashMap<int, int, BENCH_SIZE>());
+    FlatHashBenchmark("NFShmHashMap", *pHashMap, keys);
+
+    std::unique_ptr<NFShmFlatHashMap<int, int, BENCH_SIZE>> pFlatMap(new NFShmFlatHashMap<int, int, BENCH_SIZE>());
+    FlatHashBenchmark("NFShmFlatHashMap", *pFlatMap, keys);
+
+    // 只有10%元素时, 链地址法遍历仍然要扫描全部桶
+    std::vector<int> halfKeys(keys.begin(), keys.begin() + keys.size() / 10);
+    FlatHashBenchmark("NFShmHashMap 10%", *pHashMap, halfKeys);
+    FlatHashBenchmark("NFShmFlatHashMap 10%", *pFlatMap, halfKeys);
+}
@@ -0,0 +1,276 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFShmRBTreeRank.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/4/28
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFShmRBTreeRank
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFShmStl/NFShmMap.h"
+#include "NFComm/NFShmStl/NFShmMultiMap.h"
+#include "NFComm/NFShmStl/NFShmSet.h"
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <vector>
+
+/****************************************************************************
+ * NFShmRBTree 名次查询单元测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 验证NthElement/RankOf与std::distance/std::advance结果一致
+ * 2. 验证插入、删除、旋转后子树节点数保持正确（RbVerify）
+ * 3. 验证同值元素用次要键分先后
+ * 4. 与从begin()线性遍历对比10k和100k元素下的查询耗时
+ *****************************************************************************/
+
+// 排行榜键：分数从高到低，分数相同按时间从早到晚，再按cid
+struct RankTestKey
+{
+    uint64_t m_score;
+    uint64_t m_time;
+    uint64_t m_cid;
+
+    RankTestKey() : m_score(0), m_time(0), m_cid(0)
+    {
+    }
+
+    RankTestKey(uint64_t score, uint64_t time, uint64_t cid) : m_score(score), m_time(time), m_cid(cid)
+    {
+    }
+};
+
+struct RankTestKeyCompare
+{
+    bool operator()(const RankTestKey& a, const RankTestKey& b) const
+    {
+        if (a.m_score != b.m_score)
+            return a.m_score > b.m_score;
+        if (a.m_time != b.m_time)
+            return a.m_time < b.m_time;
+        return a.m_cid < b.m_cid;
+    }
+};
+
+TEST(NFShmRBTreeRankTest, EmptyTree)
+{
+    NFShmMultiMap<uint64_t, int, 16> map;
+    EXPECT_EQ(map.NthElement(0), map.end());
+    EXPECT_EQ(map.RankOf(100), 0);
+    EXPECT_EQ(map.RankOf(map.end()), 0);
+}
+
+TEST(NFShmRBTreeRankTest, NthElementAndRankOf)
+{
+    NFShmMap<int, int, 200> map;
+    for (int i = 0; i < 200; ++i)
+    {
+        map[(i * 37) % 200] = i;
+    }
+    EXPECT_TRUE(map.size() == 200);
+
+    for (int k = 0; k < 200; ++k)
+    {
+        auto it = map.NthElement(k);
+        ASSERT_NE(it, map.end());
+        EXPECT_EQ(it->first, k);
+        EXPECT_EQ(map.RankOf(it), static_cast<size_t>(k));
+        EXPECT_EQ(map.RankOf(k), static_cast<size_t>(k));
+    }
+    EXPECT_EQ(map.NthElement(200), map.end());
+    EXPECT_EQ(map.RankOf(map.end()), 200);
+    EXPECT_EQ(map.RankOf(1000), 200);
+    EXPECT_EQ(map.RankOf(-1), 0);
+}
+
+TEST(NFShmRBTreeRankTest, DescendingMultiMapWithDuplicates)
+{
+    // 与NFCommonRank相同的用法, 同分时先进入的排在前面
+    NFShmMultiMap<uint64_t, int, 100, std::greater<uint64_t>> map;
+    map.insert(std::make_pair(50, 1));
+    map.insert(std::make_pair(80, 2));
+    map.insert(std::make_pair(50, 3));
+    map.insert(std::make_pair(90, 4));
+    map.insert(std::make_pair(50, 5));
+
+    int expect[] = {4, 2, 1, 3, 5};
+    for (int k = 0; k < 5; ++k)
+    {
+        EXPECT_EQ(map.NthElement(k)->second, expect[k]);
+    }
+
+    EXPECT_EQ(map.RankOf(90), 0);
+    EXPECT_EQ(map.RankOf(50), 2);
+    EXPECT_EQ(map.RankOf(10), 5);
+
+    auto range = map.equal_range(50);
+    size_t rank = 2;
+    for (auto it = range.first; it != range.second; ++it, ++rank)
+    {
+        EXPECT_EQ(map.RankOf(it), rank);
+    }
+}
+
+TEST(NFShmRBTreeRankTest, SecondaryKeyTieBreak)
+{
+    NFShmSet<RankTestKey, 100, RankTestKeyCompare> set;
+    set.insert(RankTestKey(100, 3, 1));
+    set.insert(RankTestKey(100, 1, 2));
+    set.insert(RankTestKey(200, 5, 3));
+    set.insert(RankTestKey(100, 1, 4));
+    set.insert(RankTestKey(50, 0, 5));
+
+    uint64_t expect[] = {3, 2, 4, 1, 5};
+    for (int k = 0; k < 5; ++k)
+    {
+        EXPECT_EQ(set.NthElement(k)->m_cid, expect[k]);
+    }
+
+    // 已知分数、时间和cid时直接算名次
+    EXPECT_EQ(set.RankOf(RankTestKey(100, 1, 4)), 2);
+    EXPECT_EQ(set.RankOf(set.find(RankTestKey(100, 3, 1))), 3);
+}
+
+TEST(NFShmRBTreeRankTest, RandomCompareWithStl)
+{
+    // 直接用底层红黑树, 便于每隔一段调用RbVerify校验子树节点数
+    const int MAX = 3000;
+    typedef NFShmPair<int, int> ValueType;
+    typedef NFShmRBTree<int, ValueType, std::_Select1st<ValueType>, MAX> TreeType;
+    std::unique_ptr<TreeType> pTree(new TreeType());
+    std::multimap<int, int> stdMap;
+    std::mt19937 rng(2025);
+
+    for (int round = 0; round < 30000; ++round)
+    {
+        int op = static_cast<int>(rng() % 4);
+        int key = static_cast<int>(rng() % 500);
+        if (op <= 1 && stdMap.size() < static_cast<size_t>(MAX))
+        {
+            pTree->insert_equal(ValueType(key, round));
+            stdMap.insert(std::make_pair(key, round));
+        }
+        else if (op == 2 && !stdMap.empty())
+        {
+            size_t k = rng() % stdMap.size();
+            auto it = pTree->NthElement(k);
+            auto stdIt = stdMap.begin();
+            std::advance(stdIt, k);
+            ASSERT_NE(it, pTree->end());
+            EXPECT_EQ(it->first, stdIt->first);
+            EXPECT_EQ(it->second, stdIt->second);
+            pTree->erase(it);
+            stdMap.erase(stdIt);
+        }
+        else
+        {
+            size_t rank = static_cast<size_t>(std::distance(stdMap.begin(), stdMap.lower_bound(key)));
+            EXPECT_EQ(pTree->RankOf(key), rank);
+        }
+
+        if (round % 1000 == 0)
+        {
+            ASSERT_TRUE(pTree->RbVerify());
+        }
+    }
+
+    ASSERT_TRUE(pTree->RbVerify());
+    size_t rank = 0;
+    for (auto it = pTree->begin(); it != pTree->end(); ++it, ++rank)
+    {
+        EXPECT_EQ(pTree->RankOf(it), rank);
+    }
+
+    // 拷贝和交换后子树节点数依然正确
+    std::unique_ptr<TreeType> pCopy(new TreeType(*pTree));
+    EXPECT_TRUE(pCopy->RbVerify());
+    pTree->clear();
+    pTree->swap(*pCopy);
+    EXPECT_TRUE(pTree->RbVerify());
+    EXPECT_TRUE(pCopy->RbVerify());
+    EXPECT_EQ(pTree->size(), stdMap.size());
+}
+
+// ==================== 与线性遍历的性能对比 ====================
+
+template <size_t SIZE>
+static void RankBenchmark()
+{
+    typedef NFShmMultiMap<uint64_t, uint64_t, SIZE, std::greater<uint64_t>> MapType;
+    std::unique_ptr<MapType> pMap(new MapType());
+    std::vector<typename MapType::iterator> vecIter;
+    std::mt19937_64 rng(SIZE);
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        vecIter.push_back(pMap->insert(std::make_pair(rng() % (SIZE * 4), i)));
+    }
+
+    const int QUERY = 200;
+    std::vector<size_t> vecPos;
+    for (int i = 0; i < QUERY; ++i)
+    {
+        vecPos.push_back(rng() % SIZE);
+    }
+
+    // 我的名次: 原来从begin()数过去, 现在沿父节点往上累加
+    uint64_t linearSum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < QUERY; ++i)
+    {
+        linearSum += std::distance(pMap->begin(), vecIter[vecPos[i]]);
+    }
+    auto linearRankEnd = std::chrono::high_resolution_clock::now();
+
+    uint64_t rankSum = 0;
+    for (int i = 0; i < QUERY; ++i)
+    {
+        rankSum += pMap->RankOf(vecIter[vecPos[i]]);
+    }
+    auto rankEnd = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(linearSum, rankSum);
+
+    // 取第k名开始的20个: 原来从begin()往后走k步
+    uint64_t linearValue = 0;
+    for (int i = 0; i < QUERY; ++i)
+    {
+        auto it = pMap->begin();
+        std::advance(it, vecPos[i]);
+        for (int j = 0; j < 20 && it != pMap->end(); ++j, ++it)
+        {
+            linearValue += it->second;
+        }
+    }
+    auto linearNthEnd = std::chrono::high_resolution_clock::now();
+
+    uint64_t nthValue = 0;
+    for (int i = 0; i < QUERY; ++i)
+    {
+        auto it = pMap->NthElement(vecPos[i]);
+        for (int j = 0; j < 20 && it != pMap->end(); ++j, ++it)
+        {
+            nthValue += it->second;
+        }
+    }
+    auto nthEnd = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(linearValue, nthValue);
+
+    printf("size:%zu queries:%d rank linear:%lldus RankOf:%lldus | range linear:%lldus NthElement:%lldus\n", SIZE, QUERY,
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(linearRankEnd - start).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(rankEnd - linearRankEnd).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(linearNthEnd - rankEnd).count()),
+           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(nthEnd - linearNthEnd).count()));
+}
+
+TEST(NFShmRBTreeRankTest, BenchmarkAgainstLinearWalk)
+{
+    RankBenchmark<10000>();
+    RankBenchmark<100000>();
+}
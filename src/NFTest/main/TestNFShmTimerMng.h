@@ -0,0 +1,355 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFShmTimerMng.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/6/2
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFShmTimerMng
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFCore/NFServerTime.h"
+#include "NFComm/NFObjCommon/NFShmMgr.h"
+#include "NFComm/NFPluginModule/NFGlobalSystem.h"
+#include "NFComm/NFPluginModule/NFIMemMngModule.h"
+#include "NFPluginManager/NFCPluginManager.h"
+#include "NFCommPlugin/NFShmPlugin/NFShmTimerMng.h"
+#include <chrono>
+#include <map>
+#include <vector>
+
+/****************************************************************************
+ * 共享内存定时器测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 直接驱动NFShmTimerMng的多层时间轮和槽链表, 不经过服务器框架
+ * 2. 远期的定时器挂在高层槽, 下放后准时触发
+ * 3. 满载(ALL_TIMER_COUNT)时设置, OnTick推进, 删除的耗时
+ *
+ * 对象的创建, 查找, 销毁由NFShmTimerTestMemMngModule在堆上模拟,
+ * 其余逻辑(槽, 链表, 下放, 超时列表)都是线上的代码
+ ****************************************************************************/
+
+/**
+ * @brief 定时器的挂载对象, 记录触发次数
+ */
+class NFShmTimerTestOwner : public NFObject
+{
+public:
+    NFShmTimerTestOwner() : m_iFireCount(0)
+    {
+    }
+
+    int OnTimer(int timeId, int callCount) override
+    {
+        ++m_iFireCount;
+        return 0;
+    }
+
+    int m_iFireCount;
+};
+
+/**
+ * @brief 测试用的对象管理, 只支持定时器, 定时器管理器和挂载对象三种类型
+ */
+class NFShmTimerTestMemMngModule final : public NFIMemMngModule
+{
+public:
+    explicit NFShmTimerTestMemMngModule(NFIPluginManager* p) : NFIMemMngModule(p), m_iObjSeq(0)
+    {
+    }
+
+    NFObject* CreateObj(int iType) override
+    {
+        NFShmMgr::Instance()->SetCreateMode(EN_OBJ_MODE_INIT);
+        NFShmMgr::Instance()->m_iType = iType;
+        if (iType == EOT_TYPE_TIMER_OBJ)
+        {
+            return new(::operator new(sizeof(NFShmTimer))) NFShmTimer();
+        }
+        if (iType == EOT_TYPE_TIMER_MNG)
+        {
+            return new(::operator new(sizeof(NFShmTimerMng))) NFShmTimerMng();
+        }
+        return new(::operator new(sizeof(NFShmTimerTestOwner))) NFShmTimerTestOwner();
+    }
+
+    void DestroyObj(NFObject* pObj) override
+    {
+        if (pObj == nullptr) return;
+        std::vector<NFObject*>& vecObj = m_mapObj[pObj->GetClassType()];
+        if (pObj->GetObjId() >= 0 && pObj->GetObjId() < static_cast<int>(vecObj.size()))
+        {
+            vecObj[pObj->GetObjId()] = nullptr;
+            m_mapFreeId[pObj->GetClassType()].push_back(pObj->GetObjId());
+        }
+        if (pObj->GetGlobalId() >= 0 && pObj->GetGlobalId() < static_cast<int>(m_vecGlobalObj.size()))
+        {
+            m_vecGlobalObj[pObj->GetGlobalId()] = nullptr;
+        }
+        void* pBuffer = dynamic_cast<void*>(pObj);
+        pObj->~NFObject();
+        ::operator delete(pBuffer);
+    }
+
+    int GetObjId(int iType, NFObject* pObj) override
+    {
+        std::vector<int>& vecFree = m_mapFreeId[iType];
+        std::vector<NFObject*>& vecObj = m_mapObj[iType];
+        if (vecFree.empty())
+        {
+            vecObj.push_back(pObj);
+            return static_cast<int>(vecObj.size()) - 1;
+        }
+        int iObjId = vecFree.back();
+        vecFree.pop_back();
+        vecObj[iObjId] = pObj;
+        return iObjId;
+    }
+
+    int GetGlobalId(int iType, int iIndex, NFObject* pObj) override
+    {
+        m_vecGlobalObj.push_back(pObj);
+        return static_cast<int>(m_vecGlobalObj.size()) - 1;
+    }
+
+    NFObject* GetObjByObjId(int iType, int iIndex) override
+    {
+        std::vector<NFObject*>& vecObj = m_mapObj[iType];
+        if (iIndex < 0 || iIndex >= static_cast<int>(vecObj.size())) return nullptr;
+        return vecObj[iIndex];
+    }
+
+    NFObject* GetObjByGlobalId(int iType, int iGlobalId, bool withChildrenType = false) override { return GetObjByGlobalIdWithNoCheck(iGlobalId); }
+
+    NFObject* GetObjByGlobalIdWithNoCheck(int iGlobalId) override
+    {
+        if (iGlobalId < 0 || iGlobalId >= static_cast<int>(m_vecGlobalObj.size())) return nullptr;
+        return m_vecGlobalObj[iGlobalId];
+    }
+
+    NFObject* GetHeadObj(int iType) override
+    {
+        for (auto pObj : m_mapObj[iType])
+        {
+            if (pObj) return pObj;
+        }
+        return nullptr;
+    }
+
+    int GetUsedCount(int iType) override
+    {
+        return static_cast<int>(m_mapObj[iType].size() - m_mapFreeId[iType].size());
+    }
+
+    int IncreaseObjSeqNum() override { return ++m_iObjSeq; }
+    EN_OBJ_MODE GetCreateMode() override { return NFShmMgr::Instance()->GetCreateMode(); }
+    void SetCreateMode(EN_OBJ_MODE mode) override { NFShmMgr::Instance()->SetCreateMode(mode); }
+    EN_OBJ_MODE GetRunMode() override { return NFShmMgr::Instance()->GetRunMode(); }
+    EN_OBJ_MODE GetInitMode() override { return EN_OBJ_MODE_INIT; }
+    void SetInitMode(EN_OBJ_MODE mode) override {}
+
+    //下面的接口定时器用不到
+    std::string GetClassName(int bType) override { return "NFShmTimerTest"; }
+    int GetClassType(int bType) override { return bType; }
+    void* AllocMemForObject(int iType) override { return nullptr; }
+    void FreeMemForObject(int iType, void* pMem) override {}
+    void RegisterClassToObjSeg(int bType, size_t nObjSize, int iItemCount, NFObject*(*pfResumeObj)(void*), NFObject*(*pCreatefn)(), void (*pDestroy)(NFObject*), int parentType,
+                               const std::string& pszClassName, bool useHash = false, bool singleton = false) override {}
+    void UnRegisterClassToObjSeg(int bType) override {}
+    int AddResumeDependency(int iType, int iDependType) override { return 0; }
+    void SetShmInitSuccessFlag() override {}
+    NFObject* CreateObjByHashKey(int iType, NFObjectHashKey hashKey) override { return nullptr; }
+    NFObject* GetObjByHashKey(int iType, NFObjectHashKey hashKey) override { return nullptr; }
+    const std::unordered_set<int>& GetChildrenType(int iType) override { return m_setEmpty; }
+    int GetItemCount(int iType) override { return ALL_TIMER_COUNT; }
+    int GetFreeCount(int iType) override { return ALL_TIMER_COUNT - GetUsedCount(iType); }
+    NFObject* GetNextObj(int iType, NFObject* pObj) override { return nullptr; }
+    void ClearAllObj(int iType) override {}
+    int DestroyObjAutoErase(int iType, int maxNum = INVALID_ID, const DESTROY_OBJECT_AUTO_ERASE_FUNCTION& func = nullptr) override { return 0; }
+    NFObject* GetObjByMiscId(int iMiscId, int iType = -1) override { return nullptr; }
+    bool IsEnd(int iType, int iIndex) override { return true; }
+    void SetSecOffSet(int iOffset) override {}
+    int GetSecOffSet() const override { return 0; }
+    size_t IterIncr(int iType, size_t iPos) override { return iPos + 1; }
+    size_t IterDecr(int iType, size_t iPos) override { return iPos - 1; }
+    iterator IterBegin(int iType) override { return iterator(this, iType, 0); }
+    iterator IterEnd(int iType) override { return iterator(this, iType, 0); }
+    const_iterator IterBegin(int iType) const override { return const_iterator(this, iType, 0); }
+    const_iterator IterEnd(int iType) const override { return const_iterator(this, iType, 0); }
+    iterator Erase(iterator iter) override { return iter; }
+    bool IsValid(iterator iter) override { return false; }
+    NFObject* GetIterObj(int iType, size_t iPos) override { return nullptr; }
+    const NFObject* GetIterObj(int iType, size_t iPos) const override { return nullptr; }
+    bool IsTypeValid(int iType) const override { return true; }
+    NFTransBase* CreateTrans(int iType) override { return nullptr; }
+    NFTransBase* GetTrans(uint64_t ullTransId) override { return nullptr; }
+    int DeleteTimer(NFObject* pObj, int timeObjId) override { return 0; }
+    int DeleteAllTimer(NFObject* pObj) override { return 0; }
+    int DeleteAllTimer(NFObject* pObj, NFRawObject* pRawShmObj) override { return 0; }
+    int SetTimer(NFObject* pObj, int hour, int minutes, int second, int microSec, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetCalender(NFObject* pObj, int hour, int minutes, int second, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetCalender(NFObject* pObj, uint64_t timestamp, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetTimer(NFObject* pObj, int interval, int callCount, int hour, int minutes, int second, int microSec, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetDayTime(NFObject* pObj, int callCount, int hour, int minutes, int second, int microSec, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetDayCalender(NFObject* pObj, int callCount, int hour, int minutes, int second, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetWeekTime(NFObject* pObj, int callCount, int hour, int minutes, int second, int microSec, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetWeekCalender(NFObject* pObj, int callCount, int weekDay, int hour, int minutes, int second, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetMonthTime(NFObject* pObj, int callCount, int hour, int minutes, int second, int microSec, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int SetMonthCalender(NFObject* pObj, int callCount, int day, int hour, int minutes, int second, NFRawObject* pRawShmObj = nullptr) override { return INVALID_ID; }
+    int FireExecute(NF_SERVER_TYPE serverType, uint32_t eventId, uint32_t srcType, uint64_t srcId, const google::protobuf::Message& message) override { return 0; }
+    int Subscribe(NFObject* pObj, NF_SERVER_TYPE serverType, uint32_t eventId, uint32_t srcType, uint64_t srcId, const std::string& desc) override { return 0; }
+    int UnSubscribe(NFObject* pObj, NF_SERVER_TYPE serverType, uint32_t eventId, uint32_t srcType, uint64_t srcId) override { return 0; }
+    int UnSubscribeAll(NFObject* pObj) override { return 0; }
+
+private:
+    std::map<int, std::vector<NFObject*>> m_mapObj;
+    std::map<int, std::vector<int>> m_mapFreeId;
+    std::vector<NFObject*> m_vecGlobalObj;
+    std::unordered_set<int> m_setEmpty;
+    int m_iObjSeq;
+};
+
+/**
+ * @brief 搭一个只有对象管理模块的插件管理器, 时间由NFServerTime驱动, NF_ADJUST_TIMENOW_MS()跟着变
+ */
+class NFShmTimerTestEnv
+{
+public:
+    static NFShmTimerTestMemMngModule* MemMng()
+    {
+        static NFCPluginManager* pPluginManager = nullptr;
+        static NFShmTimerTestMemMngModule* pMemMng = nullptr;
+        if (pPluginManager == nullptr)
+        {
+            pPluginManager = new NFCPluginManager();
+            pMemMng = new NFShmTimerTestMemMngModule(pPluginManager);
+            pMemMng->m_strName = "NFShmTimerTestMemMngModule";
+            pPluginManager->AddModule("NFIMemMngModule", pMemMng);
+            NFGlobalSystem::Instance()->SetGlobalPluginManager(pPluginManager);
+        }
+        return pMemMng;
+    }
+
+    static uint64_t Now() { return NFServerTime::Instance()->Tick(); }
+
+    /**
+     * @brief 时间回到固定起点, 新建一个定时器管理器
+     */
+    static NFShmTimerMng* Reset()
+    {
+        NFServerTime::Instance()->Update(1700000000000ULL);
+        NFShmTimerMng* pMng = NFShmTimerMng::Instance();
+        if (pMng)
+        {
+            MemMng()->DestroyObj(pMng);
+        }
+        return dynamic_cast<NFShmTimerMng*>(MemMng()->CreateObj(EOT_TYPE_TIMER_MNG));
+    }
+
+    /**
+     * @brief 每次前进step毫秒并OnTick一次, 共前进ms毫秒
+     */
+    static void Run(NFShmTimerMng* pMng, uint64_t ms, uint64_t step = SLOT_TICK_TIME)
+    {
+        for (uint64_t i = 0; i < ms; i += step)
+        {
+            NFServerTime::Instance()->Update(Now() + step);
+            pMng->OnTick(Now());
+        }
+    }
+};
+
+TEST(NFShmTimerMngTest, LoopAndCallCount)
+{
+    NFShmTimerMng* pMng = NFShmTimerTestEnv::Reset();
+    auto pOwner = dynamic_cast<NFShmTimerTestOwner*>(NFShmTimerTestEnv::MemMng()->CreateObj(EOT_OBJECT));
+
+    //第一次1秒后触发, 之后每秒一次, 共3次
+    EXPECT_NE(INVALID_ID, pMng->SetTimer(pOwner, 1000, 3, 0, 0, 1, 0));
+    NFShmTimerTestEnv::Run(pMng, 10000);
+    EXPECT_EQ(3, pOwner->m_iFireCount);
+    EXPECT_EQ(0, NFShmTimerTestEnv::MemMng()->GetUsedCount(EOT_TYPE_TIMER_OBJ));
+
+    NFShmTimerTestEnv::MemMng()->DestroyObj(pOwner);
+}
+
+TEST(NFShmTimerMngTest, CascadeFarTimer)
+{
+    NFShmTimerMng* pMng = NFShmTimerTestEnv::Reset();
+    auto pOwner = dynamic_cast<NFShmTimerTestOwner*>(NFShmTimerTestEnv::MemMng()->CreateObj(EOT_OBJECT));
+
+    //5小时在第2层(约21小时), 要下放两次才到第0层
+    EXPECT_NE(INVALID_ID, pMng->SetTimer(pOwner, 5, 0, 0, 0));
+    NFShmTimerTestEnv::Run(pMng, 5 * 3600 * 1000ULL - 1000);
+    EXPECT_EQ(0, pOwner->m_iFireCount);
+    NFShmTimerTestEnv::Run(pMng, 2000);
+    EXPECT_EQ(1, pOwner->m_iFireCount);
+    EXPECT_EQ(0, NFShmTimerTestEnv::MemMng()->GetUsedCount(EOT_TYPE_TIMER_OBJ));
+
+    NFShmTimerTestEnv::MemMng()->DestroyObj(pOwner);
+}
+
+TEST(NFShmTimerMngTest, Benchmark)
+{
+    //定时器个数受ALL_TIMER_COUNT限制, 达不到百万, 这里按满载测
+    const int timerCount = ALL_TIMER_COUNT - 100;
+    const int ownerCount = 1000;
+
+    NFShmTimerMng* pMng = NFShmTimerTestEnv::Reset();
+    std::vector<NFShmTimerTestOwner*> vecOwner(ownerCount);
+    for (int i = 0; i < ownerCount; i++)
+    {
+        vecOwner[i] = dynamic_cast<NFShmTimerTestOwner*>(NFShmTimerTestEnv::MemMng()->CreateObj(EOT_OBJECT));
+    }
+
+    //一半是几秒内的循环定时器, 一半是几小时到几天后的远期定时器
+    std::vector<int> vecTimerId(timerCount);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < timerCount; i++)
+    {
+        NFShmTimerTestOwner* pOwner = vecOwner[i % ownerCount];
+        if (i % 2 == 0)
+        {
+            vecTimerId[i] = pMng->SetTimer(pOwner, 100 + i % 5000, NFSHM_INFINITY_CALL, 0, 0, 0, 100 + i % 1000);
+        }
+        else
+        {
+            vecTimerId[i] = pMng->SetTimer(pOwner, 1 + i % 72, i % 60, 0, 0);
+        }
+        ASSERT_NE(INVALID_ID, vecTimerId[i]);
+    }
+    auto setEnd = std::chrono::steady_clock::now();
+
+    //按32ms一次OnTick推进60秒, 跨过一整圈第0层(约19秒), 会有高层下放
+    NFShmTimerTestEnv::Run(pMng, 60000);
+    auto runEnd = std::chrono::steady_clock::now();
+
+    int fires = 0;
+    for (int i = 0; i < ownerCount; i++)
+    {
+        fires += vecOwner[i]->m_iFireCount;
+    }
+    EXPECT_GT(fires, timerCount / 2);
+
+    for (int i = 0; i < timerCount; i++)
+    {
+        pMng->Delete(vecTimerId[i]);
+    }
+    auto delEnd = std::chrono::steady_clock::now();
+    EXPECT_EQ(0, NFShmTimerTestEnv::MemMng()->GetUsedCount(EOT_TYPE_TIMER_OBJ));
+
+    printf("shm timer %d timers: set %.1fms, run 60s %.1fms (%d fires, %.1fus per OnTick), delete %.1fms\n", timerCount,
+           std::chrono::duration<double, std::milli>(setEnd - start).count(),
+           std::chrono::duration<double, std::milli>(runEnd - setEnd).count(), fires,
+           std::chrono::duration<double, std::micro>(runEnd - setEnd).count() / (60000 / SLOT_TICK_TIME),
+           std::chrono::duration<double, std::milli>(delEnd - runEnd).count());
+
+    for (int i = 0; i < ownerCount; i++)
+    {
+        NFShmTimerTestEnv::MemMng()->DestroyObj(vecOwner[i]);
+    }
+}
@@ -0,0 +1,196 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFTimerAxis.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/31
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFTimerAxis
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFCore/NFServerTime.h"
+#include "NFCommPlugin/NFKernelPlugin/NFTimerAxis.h"
+#include <chrono>
+#include <map>
+#include <vector>
+
+/****************************************************************************
+ * 时间轴测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. 毫秒定时器按间隔触发, 次数用完后自动删除
+ * 2. 超过第0层范围的定时器逐层下放后准时触发
+ * 3. 回调里删除自己或删除对象的所有定时器是安全的
+ * 4. 10k/100k/1M个活跃定时器下设置, 推进5秒, 删除的耗时
+ ****************************************************************************/
+
+/**
+ * @brief 时间轴测试用的时间, 直接驱动NFServerTime, NF_ADJUST_TIMENOW_MS()跟着变
+ */
+class NFTimerAxisTestClock
+{
+public:
+    static uint64_t Now() { return NFServerTime::Instance()->Tick(); }
+
+    static void Reset() { NFServerTime::Instance()->Update(1700000000000ULL); }
+
+    /**
+     * @brief 每次前进step毫秒并驱动一次Update, 共前进ms毫秒
+     */
+    static void Run(NFTimerAxis& axis, uint64_t ms, uint64_t step = 1)
+    {
+        for (uint64_t i = 0; i < ms; i += step)
+        {
+            NFServerTime::Instance()->Update(Now() + step);
+            axis.Update();
+        }
+    }
+};
+
+/**
+ * @brief 记录每个定时器的触发次数, 可以在回调里删除定时器
+ */
+class NFTimerAxisTestObj : public NFTimerObjBase
+{
+public:
+    enum
+    {
+        MODE_NONE = 0,
+        MODE_KILL_SELF = 1,
+        MODE_KILL_ALL = 2,
+    };
+
+    NFTimerAxisTestObj() : m_pAxis(nullptr), m_mode(MODE_NONE)
+    {
+    }
+
+    int OnTimer(uint32_t nTimerID) override
+    {
+        m_fires[nTimerID]++;
+        if (m_mode == MODE_KILL_SELF)
+        {
+            m_pAxis->KillTimer(nTimerID, this);
+        }
+        else if (m_mode == MODE_KILL_ALL)
+        {
+            m_pAxis->KillAllTimer(this);
+        }
+        return 0;
+    }
+
+    bool SetTimer(uint32_t nTimerID, uint64_t nInterVal, uint32_t nCallCount = 0) override { return m_pAxis->SetTimer(nTimerID, nInterVal, this, nCallCount); }
+    bool KillTimer(uint32_t nTimerID) override { return m_pAxis->KillTimer(nTimerID, this); }
+    bool KillAllTimer() override { return m_pAxis->KillAllTimer(this); }
+    bool SetFixTimer(uint32_t nTimerID, uint64_t nStartTime, uint32_t nInterSec, uint32_t nCallCount = 0) override { return m_pAxis->SetClocker(nTimerID, nStartTime, nInterSec, this, nCallCount); }
+
+    NFTimerAxis* m_pAxis;
+    int m_mode;
+    std::map<uint32_t, uint32_t> m_fires;
+};
+
+TEST(NFTimerAxisTest, IntervalAndCallCount)
+{
+    NFTimerAxisTestClock::Reset();
+    NFTimerAxis axis;
+    NFTimerAxisTestObj obj;
+    obj.m_pAxis = &axis;
+
+    EXPECT_TRUE(obj.SetTimer(1, 100));
+    EXPECT_TRUE(obj.SetTimer(2, 50, 3));
+    //同一个对象同一个id不能重复设置
+    EXPECT_FALSE(obj.SetTimer(1, 10));
+
+    NFTimerAxisTestClock::Run(axis, 10000);
+    EXPECT_GE(obj.m_fires[1], 95u);
+    EXPECT_LE(obj.m_fires[1], 101u);
+    EXPECT_EQ(3u, obj.m_fires[2]);
+
+    obj.KillAllTimer();
+    EXPECT_EQ(nullptr, *obj.GetTimerInfoPtr());
+}
+
+TEST(NFTimerAxisTest, CascadeFarTimer)
+{
+    NFTimerAxisTestClock::Reset();
+    NFTimerAxis axis;
+    NFTimerAxisTestObj obj;
+    obj.m_pAxis = &axis;
+
+    //5小时在第3层, 要下放两次才到第0层
+    const uint64_t interval = 5 * 3600 * 1000ULL;
+    EXPECT_TRUE(obj.SetTimer(1, interval, 1));
+    NFTimerAxisTestClock::Run(axis, interval - 1000, 16);
+    EXPECT_EQ(0u, obj.m_fires[1]);
+    NFTimerAxisTestClock::Run(axis, 2000, 16);
+    EXPECT_EQ(1u, obj.m_fires[1]);
+    EXPECT_EQ(nullptr, *obj.GetTimerInfoPtr());
+}
+
+TEST(NFTimerAxisTest, KillInCallback)
+{
+    NFTimerAxisTestClock::Reset();
+    NFTimerAxis axis;
+
+    NFTimerAxisTestObj killSelf;
+    killSelf.m_pAxis = &axis;
+    killSelf.m_mode = NFTimerAxisTestObj::MODE_KILL_SELF;
+    killSelf.SetTimer(1, 100);
+    killSelf.SetTimer(2, 100);
+
+    NFTimerAxisTestObj killAll;
+    killAll.m_pAxis = &axis;
+    killAll.m_mode = NFTimerAxisTestObj::MODE_KILL_ALL;
+    killAll.SetTimer(1, 100);
+    killAll.SetTimer(2, 100);
+
+    NFTimerAxisTestClock::Run(axis, 1000);
+    EXPECT_EQ(1u, killSelf.m_fires[1]);
+    EXPECT_EQ(1u, killSelf.m_fires[2]);
+    EXPECT_EQ(nullptr, *killSelf.GetTimerInfoPtr());
+    //同一个刻度上的第二个定时器已经被第一个回调删掉, 不能再触发
+    EXPECT_EQ(1u, killAll.m_fires[1] + killAll.m_fires[2]);
+    EXPECT_EQ(nullptr, *killAll.GetTimerInfoPtr());
+}
+
+TEST(NFTimerAxisTest, Benchmark)
+{
+    NFTimerAxisTestClock::Reset();
+    NFTimerAxis axis;
+    const int counts[] = {10000, 100000, 1000000};
+    for (int n : counts)
+    {
+        std::vector<NFTimerAxisTestObj> vecObj(n);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < n; i++)
+        {
+            vecObj[i].m_pAxis = &axis;
+            vecObj[i].SetTimer(1, 32 + i % 5000);
+        }
+        auto setEnd = std::chrono::steady_clock::now();
+
+        //按服务器帧率推进5秒, 每个定时器都会触发若干次
+        NFTimerAxisTestClock::Run(axis, 5000, 16);
+        auto runEnd = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < n; i++)
+        {
+            vecObj[i].KillAllTimer();
+        }
+        auto killEnd = std::chrono::steady_clock::now();
+
+        uint64_t fires = 0;
+        for (int i = 0; i < n; i++)
+        {
+            fires += vecObj[i].m_fires[1];
+        }
+        EXPECT_GT(fires, static_cast<uint64_t>(n));
+
+        printf("timer axis %d timers: set %.1fms, run 5s %.1fms (%llu fires), kill %.1fms\n", n,
+               std::chrono::duration<double, std::milli>(setEnd - start).count(),
+               std::chrono::duration<double, std::milli>(runEnd - setEnd).count(), static_cast<unsigned long long>(fires),
+               std::chrono::duration<double, std::milli>(killEnd - runEnd).count());
+    }
+}
@@ -0,0 +1,291 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    TestNFWireFormat.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/26
+//    @Email            :    445267987@qq.com
+//    @Module           :    TestNFWireFormat
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include "NFComm/NFCore/NFWireFormat.h"
+#include "NFComm/NFKernelMessage/FrameTestComm.nanopb.h"
+#include "NFComm/NFKernelMessage/FrameTest.nanopb.h"
+#include "NFComm/NFKernelMessage/FrameBehavior.nanopb.h"
+#include <cmath>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * 共享内存结构体直接序列化测试
+ ****************************************************************************
+ *
+ * 测试目标：
+ * 1. SerializeTo的结果和ToPb后SerializeToString逐字节一致, 包括proto3默认值不写、负数、packed数组
+ *    proto3的浮点-0.0按位判断, 要写出去, 解析回来还是-0.0
+ * 2. ParseFrom和ParseFromString后FromPb得到的结构体一致, 缓冲区不够/数据截断时返回失败
+ * 3. 带oneof/map的结构体走ToPb/FromPb回退, 结果同样一致
+ * 4. 统计SerializeTo/ParseFrom和原来先转protobuf对象的耗时
+ ****************************************************************************/
+
+static void NFWireTestFill(wxWorkRobotTextTest& data, int seed)
+{
+    data.id = 1000 + seed;
+    data.test_string = "string_" + std::to_string(seed);
+    data.test_string_stl = "string_stl_with_a_longer_value_" + std::to_string(seed);
+    data.test_string_repeated.push_back("repeated_a");
+    data.test_string_repeated.push_back("repeated_b");
+    data.test_string_stl_vector.push_back("vector_" + std::to_string(seed));
+    data.test_string_stl_list.push_back("list_a");
+    data.test_string_stl_list.push_back("list_b");
+    data.test_string_stl_unordered_set.insert("set_" + std::to_string(seed));
+    data.test_int_vector.push_back(-1);
+    data.test_int_vector.push_back(300 + seed);
+    data.test_int_list.push_back(0);
+    data.test_int_unordered_set.insert(123456789);
+    data.test_bytes_stl = "bytes_stl";
+    data.test_bytes_stl_vector.push_back("bytes_vector");
+}
+
+static void NFWireTestFill(BevLogTest& data, int seed)
+{
+    data.tDtEventTime = 1716000000000ull + seed;
+    data.szVGameIP = "192.168.1.100";
+    data.iIZoneAreaID = -7;
+    data.iITimeShift = 8;
+    data.item.item_id = 10000 + seed;
+    data.item.item_num = 99;
+    data.item_list.emplace_back();
+    data.item_list.back().item_id = 20000 + seed;
+    data.id_list.push_back(-2147483647 - 1);
+}
+
+template<typename T>
+static std::string NFWireTestSerialize(const T& data)
+{
+    std::vector<uint8_t> buf(64 * 1024);
+    int length = data.SerializeTo(buf.data(), buf.size());
+    if (length < 0)
+    {
+        return std::string();
+    }
+    return std::string(reinterpret_cast<const char*>(buf.data()), length);
+}
+
+TEST(NFWireFormatTest, EmptyProto3MessageWritesNothing)
+{
+    BevLogTest data;
+    EXPECT_EQ(data.ToPb().SerializeAsString(), NFWireTestSerialize(data));
+
+    BevLogTestItem item;
+    EXPECT_EQ(0, item.SerializeTo(NULL, 0));
+}
+
+TEST(NFWireFormatTest, SameBytesAsProtobuf)
+{
+    BevLogTest bev;
+    NFWireTestFill(bev, 1);
+    EXPECT_EQ(bev.ToPb().SerializeAsString(), NFWireTestSerialize(bev));
+
+    wxWorkRobotTextTest text;
+    NFWireTestFill(text, 2);
+    EXPECT_EQ(text.ToPb().SerializeAsString(), NFWireTestSerialize(text));
+}
+
+TEST(NFWireFormatTest, FallbackSameBytesAsProtobuf)
+{
+    wxWorkRobotTextMore more;
+    for (int i = 0; i < FRAME_ENUM_DEFAULT_REPEATED; i++)
+    {
+        wxWorkRobotTextTest text;
+        NFWireTestFill(text, i);
+        more.test_map.emplace(text.id, text);
+        more.test_set.insert(text);
+    }
+    std::string wire = NFWireTestSerialize(more);
+    EXPECT_FALSE(wire.empty());
+    EXPECT_EQ(more.ToPb().SerializeAsString(), wire);
+
+    wxWorkRobotTextMore parsed;
+    ASSERT_TRUE(parsed.ParseFrom(reinterpret_cast<const uint8_t*>(wire.data()), wire.size()));
+    EXPECT_EQ(more.ShortDebugString(), parsed.ShortDebugString());
+
+    WelfareNodeDBDataUnion data;
+    data.init_which_m_stData(NFrameComm::WelfareNodeDBDataUnion::kMStPddOpenFieldNumber);
+    data.m_stData.m_stPddOpen.m_ullTeamID = 99887766;
+    data.m_stPddBuy1.m_dwBuyCount = 3;
+    wire = NFWireTestSerialize(data);
+    EXPECT_EQ(data.ToPb().SerializeAsString(), wire);
+
+    WelfareNodeDBDataUnion parsedUnion;
+    ASSERT_TRUE(parsedUnion.ParseFrom(reinterpret_cast<const uint8_t*>(wire.data()), wire.size()));
+    EXPECT_EQ(data.ShortDebugString(), parsedUnion.ShortDebugString());
+}
+
+TEST(NFWireFormatTest, ParseSameAsFromPb)
+{
+    wxWorkRobotTextTest text;
+    NFWireTestFill(text, 3);
+    std::string wire = text.ToPb().SerializeAsString();
+
+    NFrameComm::wxWorkRobotTextTest pb;
+    ASSERT_TRUE(pb.ParseFromString(wire));
+    wxWorkRobotTextTest fromPb;
+    ASSERT_TRUE(fromPb.FromPb(pb));
+
+    //先填入旧数据, ParseFrom后不在包里的字段要回到默认值
+    wxWorkRobotTextTest parsed;
+    NFWireTestFill(parsed, 4);
+    ASSERT_TRUE(parsed.ParseFrom(reinterpret_cast<const uint8_t*>(wire.data()), wire.size()));
+    EXPECT_EQ(fromPb.ShortDebugString(), parsed.ShortDebugString());
+    EXPECT_EQ(wire, NFWireTestSerialize(parsed));
+
+    BevLogTest bev;
+    NFWireTestFill(bev, 5);
+    wire = NFWireTestSerialize(bev);
+    BevLogTest parsedBev;
+    ASSERT_TRUE(parsedBev.ParseFrom(reinterpret_cast<const uint8_t*>(wire.data()), wire.size()));
+    EXPECT_EQ(bev.ShortDebugString(), parsedBev.ShortDebugString());
+}
+
+TEST(NFWireFormatTest, ParseAcceptsUnpackedAndUnknownFields)
+{
+    //id_list按非packed格式写, 再加一个不认识的字段
+    std::vector<uint8_t> buf(256);
+    NFWireWriter writer(buf.data(), buf.size());
+    writer.WriteUInt64(1, 42);
+    writer.WriteBytes(1000, "unknown", 7);
+    writer.WriteInt32(7, -3);
+    writer.WriteFixed64(1001, 5);
+    ASSERT_FALSE(writer.IsOverflow());
+
+    BevLogTest bev;
+    ASSERT_TRUE(bev.ParseFrom(buf.data(), writer.GetLength()));
+    EXPECT_EQ(42u, bev.tDtEventTime);
+    ASSERT_EQ(1u, bev.id_list.size());
+    EXPECT_EQ(-3, bev.id_list[0]);
+}
+
+TEST(NFWireFormatTest, NegativeZeroFloat)
+{
+    EXPECT_FALSE(NFWireWriter::IsNonZeroBits(0.0f));
+    EXPECT_TRUE(NFWireWriter::IsNonZeroBits(-0.0f));
+    EXPECT_FALSE(NFWireWriter::IsNonZeroBits(0.0));
+    EXPECT_TRUE(NFWireWriter::IsNonZeroBits(-0.0));
+
+    BevLogDeviceInfo info;
+    EXPECT_TRUE(NFWireTestSerialize(info).empty());
+
+    info.fDensity = -0.0f;
+    std::string wire = NFWireTestSerialize(info);
+    EXPECT_FALSE(wire.empty());
+
+    BevLogDeviceInfo parsed;
+    ASSERT_TRUE(parsed.ParseFrom(reinterpret_cast<const uint8_t*>(wire.data()), wire.size()));
+    EXPECT_EQ(0.0f, parsed.fDensity);
+    EXPECT_TRUE(std::signbit(parsed.fDensity));
+}
+
+TEST(NFWireFormatTest, LongLengthPrefix)
+{
+    //嵌套消息超过127字节时长度要占2个字节, 消息体后移
+    std::string body(300, 'x');
+    std::vector<uint8_t> buf(512);
+    NFWireWriter writer(buf.data(), buf.size());
+    size_t start = writer.BeginLength(5);
+    writer.WriteBytes(2, body.data(), body.size());
+    writer.EndLength(start);
+    writer.WriteInt32(3, 1);
+    ASSERT_FALSE(writer.IsOverflow());
+
+    NFWireReader reader(buf.data(), writer.GetLength());
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    ASSERT_TRUE(reader.ReadTag(field, wireType));
+    EXPECT_EQ(5u, field);
+    NFWireReader sub;
+    ASSERT_TRUE(reader.ReadSubReader(sub));
+    ASSERT_TRUE(sub.ReadTag(field, wireType));
+    const char* pData = NULL;
+    size_t length = 0;
+    ASSERT_TRUE(sub.ReadBytes(pData, length));
+    EXPECT_EQ(body, std::string(pData, length));
+    EXPECT_TRUE(sub.IsEnd());
+    ASSERT_TRUE(reader.ReadTag(field, wireType));
+    EXPECT_EQ(3u, field);
+    EXPECT_EQ(1, reader.ReadInt32());
+    EXPECT_TRUE(reader.IsEnd());
+    EXPECT_FALSE(reader.IsError());
+}
+
+TEST(NFWireFormatTest, OverflowAndTruncated)
+{
+    wxWorkRobotTextTest text;
+    NFWireTestFill(text, 6);
+    std::string wire = NFWireTestSerialize(text);
+    ASSERT_FALSE(wire.empty());
+
+    std::vector<uint8_t> buf(wire.size());
+    EXPECT_EQ(static_cast<int>(wire.size()), text.SerializeTo(buf.data(), buf.size()));
+    EXPECT_EQ(-1, text.SerializeTo(buf.data(), buf.size() - 1));
+
+    wxWorkRobotTextTest parsed;
+    EXPECT_FALSE(parsed.ParseFrom(reinterpret_cast<const uint8_t*>(wire.data()), wire.size() - 1));
+
+    //字符串超过结构体容量
+    std::string longString(FRAME_ENUM_STRING_NUM, 'a');
+    std::vector<uint8_t> longBuf(256);
+    NFWireWriter writer(longBuf.data(), longBuf.size());
+    writer.WriteBytes(2, longString.data(), longString.size());
+    EXPECT_FALSE(parsed.ParseFrom(longBuf.data(), writer.GetLength()));
+}
+
+TEST(NFWireFormatTest, Benchmark)
+{
+    const int count = 100000;
+    wxWorkRobotTextTest text;
+    NFWireTestFill(text, 7);
+    std::vector<uint8_t> buf(64 * 1024);
+    size_t total = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        total += text.ToPb().SerializeAsString().size();
+    }
+    double pbSerialize = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        total += text.SerializeTo(buf.data(), buf.size());
+    }
+    double wireSerialize = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    std::string wire = NFWireTestSerialize(text);
+    wxWorkRobotTextTest parsed;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        NFrameComm::wxWorkRobotTextTest pb;
+        pb.ParseFromString(wire);
+        parsed.FromPb(pb);
+    }
+    double pbParse = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        parsed.ParseFrom(reinterpret_cast<const uint8_t*>(wire.data()), wire.size());
+    }
+    double wireParse = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    printf("wxWorkRobotTextTest %d bytes x %d\n", static_cast<int>(wire.size()), count);
+    printf("  ToPb+SerializeToString: %.3f us/op, SerializeTo: %.3f us/op\n", pbSerialize / count, wireSerialize / count);
+    printf("  ParseFromString+FromPb: %.3f us/op, ParseFrom: %.3f us/op\n", pbParse / count, wireParse / count);
+    EXPECT_GT(total, 0u);
+    EXPECT_EQ(text.ShortDebugString(), parsed.ShortDebugString());
+}
@@ -31,6 +31,20 @@
 #include "TestNFShmHashMultiMap.h"
 #include "TestNFShmHashMultiSet.h"
 #include "TestNFShmHashTableWithList.h"
+#include "TestNFShmFlatHashMap.h"
+#include "TestNFShmRBTreeRank.h"
+#include "TestNFLogMgr.h"
+#include "TestNFPacketCompress.h"
+#include "TestNFEncrypt.h"
+#include "TestNFRedisPipeline.h"
+#include "TestNFWireFormat.h"
+#include "TestNFHugePage.h"
+#include "TestNFShmCheckpoint.h"
+#include "TestNFShmBus.h"
+#include "TestNFTimerAxis.h"
+#include "TestNFShmTimerMng.h"
+#include "TestNFDeltaSave.h"
+#include "TestNFMysqlRowDecoder.h"
 
 int main(int argc, char* argv[])
 {
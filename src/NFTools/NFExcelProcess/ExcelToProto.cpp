@@ -1064,6 +1064,7 @@ void ExcelToProto::WriteSheetDescStoreH(ExcelSheet* pSheet)
     {
         desc_file += "\tvirtual std::string GetFileName() { return \"" + pSheet->m_protoInfo.m_binFileName + "\"; }\n";
     }
+    desc_file += "\tvirtual std::string GetTableMsgName() override { return proto_ff::Sheet_" + pSheet->m_otherName + "::descriptor()->full_name(); }\n";
 
     for (auto iter = pSheet->m_indexMap.begin(); iter != pSheet->m_indexMap.end(); iter++)
     {
@@ -0,0 +1,234 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFHugePage.cpp
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/28
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFCore
+//
+// -------------------------------------------------------------------------
+
+#include "NFHugePage.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdlib.h>
+#include <string.h>
+
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#ifndef MADV_POPULATE_WRITE
+#define MADV_POPULATE_WRITE 23
+#endif
+
+//mbind的策略, 跟<numaif.h>里的MPOL_PREFERRED一样, 不依赖libnuma
+#define NF_MPOL_PREFERRED 1
+#define NF_NUMA_MAX_NODE 1024
+
+static std::string NFHugePageReadFile(const char* szPath)
+{
+	std::ifstream file(szPath);
+	if (!file.is_open())
+	{
+		return std::string();
+	}
+
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return ss.str();
+}
+
+uint64_t NFHugePage::ParseMemInfo(const std::string& strMemInfo, const std::string& strKey)
+{
+	size_t pos = 0;
+	while (pos < strMemInfo.size())
+	{
+		size_t end = strMemInfo.find('\n', pos);
+		if (end == std::string::npos)
+		{
+			end = strMemInfo.size();
+		}
+
+		if (strMemInfo.compare(pos, strKey.size(), strKey) == 0 && pos + strKey.size() < end && strMemInfo[pos + strKey.size()] == ':')
+		{
+			std::string strLine = strMemInfo.substr(pos + strKey.size() + 1, end - pos - strKey.size() - 1);
+			uint64_t value = strtoull(strLine.c_str(), NULL, 10);
+			if (strLine.find("kB") != std::string::npos)
+			{
+				value *= 1024;
+			}
+			return value;
+		}
+
+		pos = end + 1;
+	}
+
+	return 0;
+}
+
+size_t NFHugePage::GetHugePageSize()
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+	return ParseMemInfo(NFHugePageReadFile("/proc/meminfo"), "Hugepagesize");
+#else
+	return 0;
+#endif
+}
+
+size_t NFHugePage::GetFreeHugePageMem()
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+	std::string strMemInfo = NFHugePageReadFile("/proc/meminfo");
+	return ParseMemInfo(strMemInfo, "HugePages_Free") * ParseMemInfo(strMemInfo, "Hugepagesize");
+#else
+	return 0;
+#endif
+}
+
+size_t NFHugePage::AlignSize(size_t size, size_t align)
+{
+	if (align == 0)
+	{
+		return size;
+	}
+	return (size + align - 1) & ~(align - 1);
+}
+
+size_t NFHugePage::ParseSmapsPageSize(const std::string& strSmaps, uintptr_t addr)
+{
+	//每个映射以"start-end perms ..."开头, 后面是"Key: value"的字段
+	bool bInRange = false;
+	size_t pos = 0;
+	while (pos < strSmaps.size())
+	{
+		size_t end = strSmaps.find('\n', pos);
+		if (end == std::string::npos)
+		{
+			end = strSmaps.size();
+		}
+
+		std::string strLine = strSmaps.substr(pos, end - pos);
+		size_t dash = strLine.find('-');
+		size_t space = strLine.find(' ');
+		if (dash != std::string::npos && space != std::string::npos && dash < space && strLine.find(':') > space)
+		{
+			uintptr_t start = static_cast<uintptr_t>(strtoull(strLine.substr(0, dash).c_str(), NULL, 16));
+			uintptr_t stop = static_cast<uintptr_t>(strtoull(strLine.substr(dash + 1, space - dash - 1).c_str(), NULL, 16));
+			bInRange = addr >= start && addr < stop;
+		}
+		else if (bInRange && strLine.compare(0, 15, "KernelPageSize:") == 0)
+		{
+			return ParseMemInfo(strLine, "KernelPageSize");
+		}
+
+		pos = end + 1;
+	}
+
+	return 0;
+}
+
+bool NFHugePage::IsHugeTlbMapping(void* pAddr)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+	size_t pageSize = ParseSmapsPageSize(NFHugePageReadFile("/proc/self/smaps"), reinterpret_cast<uintptr_t>(pAddr));
+	return pageSize > static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+	return false;
+#endif
+}
+
+int NFHugePage::AdviseHugePage(void* pAddr, size_t size)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX && defined(MADV_HUGEPAGE)
+	return madvise(pAddr, size, MADV_HUGEPAGE);
+#else
+	return -1;
+#endif
+}
+
+int NFHugePage::GetNumaNodeCount()
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+	//内容类似"0"或者"0-1"或者"0,2-3", 取最大的节点号
+	std::string strOnline = NFHugePageReadFile("/sys/devices/system/node/online");
+	int iMaxNode = 0;
+	int iValue = -1;
+	for (size_t i = 0; i < strOnline.size(); i++)
+	{
+		char c = strOnline[i];
+		if (c >= '0' && c <= '9')
+		{
+			iValue = (iValue < 0 ? 0 : iValue * 10) + (c - '0');
+		}
+		else
+		{
+			if (iValue > iMaxNode)
+			{
+				iMaxNode = iValue;
+			}
+			iValue = -1;
+		}
+	}
+	if (iValue > iMaxNode)
+	{
+		iMaxNode = iValue;
+	}
+	return iMaxNode + 1;
+#else
+	return 1;
+#endif
+}
+
+int NFHugePage::BindNumaNode(void* pAddr, size_t size, int iNode)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX && defined(SYS_mbind)
+	if (iNode < 0 || iNode >= NF_NUMA_MAX_NODE)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+
+	const size_t bitsPerLong = sizeof(unsigned long) * 8;
+	unsigned long nodeMask[NF_NUMA_MAX_NODE / (sizeof(unsigned long) * 8)];
+	memset(nodeMask, 0, sizeof(nodeMask));
+	nodeMask[iNode / bitsPerLong] |= 1UL << (iNode % bitsPerLong);
+	//内核会先把maxnode减1, 所以要多传一位
+	return static_cast<int>(syscall(SYS_mbind, pAddr, size, NF_MPOL_PREFERRED, nodeMask, NF_NUMA_MAX_NODE + 1, 0));
+#else
+	return -1;
+#endif
+}
+
+void NFHugePage::Prefault(void* pAddr, size_t size, size_t pageSize)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+	if (pAddr == NULL || size == 0)
+	{
+		return;
+	}
+
+	//5.14以后的内核一次系统调用就能分配好所有页, 不读写内存
+	if (madvise(pAddr, size, MADV_POPULATE_WRITE) == 0)
+	{
+		return;
+	}
+
+	if (pageSize == 0)
+	{
+		pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	}
+
+	//共享内存读缺页就会分配物理页, 只读不写, 不会和其它attach的进程抢着改数据
+	volatile const char* p = static_cast<volatile const char*>(pAddr);
+	char sum = 0;
+	for (size_t i = 0; i < size; i += pageSize)
+	{
+		sum ^= p[i];
+	}
+	(void)sum;
+#endif
+}
@@ -0,0 +1,85 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFHugePage.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/28
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFCore
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include "NFPlatform.h"
+#include <string>
+
+/**
+ * @brief 共享内存大页/NUMA相关的辅助函数, 只在linux下生效, 其它平台返回0或者什么都不做
+ *
+ * 大页有两种来源:
+ * 1. hugetlbfs大页池(/proc/meminfo里的HugePages_Total), shmget加SHM_HUGETLB, 需要提前配置vm.nr_hugepages
+ * 2. 透明大页(THP), 对已经映射的内存madvise(MADV_HUGEPAGE), 共享内存需要/sys/kernel/mm/transparent_hugepage/shmem_enabled为advise或always
+ * 大页池不够时先退回透明大页, 再退回普通4K页
+ */
+class _NFExport NFHugePage
+{
+public:
+	/**
+	 * @brief 从/proc/meminfo格式的文本里读一个字段, 单位是kB的返回字节数
+	 * @param strMemInfo /proc/meminfo的内容
+	 * @param strKey 字段名, 比如Hugepagesize, HugePages_Free
+	 * @return 字段值, 没找到返回0
+	 */
+	static uint64_t ParseMemInfo(const std::string& strMemInfo, const std::string& strKey);
+
+	/**
+	 * @brief 系统大页大小(字节), 不支持返回0
+	 */
+	static size_t GetHugePageSize();
+
+	/**
+	 * @brief 大页池里还没用掉的大小(字节)
+	 */
+	static size_t GetFreeHugePageMem();
+
+	/**
+	 * @brief 把size向上对齐到align, align必须是2的幂
+	 */
+	static size_t AlignSize(size_t size, size_t align);
+
+	/**
+	 * @brief 从/proc/self/smaps格式的文本里找到包含addr的映射, 返回它的KernelPageSize(字节)
+	 * @return 页大小, 没找到返回0
+	 */
+	static size_t ParseSmapsPageSize(const std::string& strSmaps, uintptr_t addr);
+
+	/**
+	 * @brief 已经映射的内存是不是hugetlbfs大页(SHM_HUGETLB创建的共享内存), 透明大页不算
+	 * @note attach已有的共享内存时不用带SHM_HUGETLB, 只能attach以后从smaps里看
+	 */
+	static bool IsHugeTlbMapping(void* pAddr);
+
+	/**
+	 * @brief 对已经映射的内存建议使用透明大页
+	 * @return 0成功
+	 */
+	static int AdviseHugePage(void* pAddr, size_t size);
+
+	/**
+	 * @brief 系统NUMA节点数, 不是NUMA或者拿不到返回1
+	 */
+	static int GetNumaNodeCount();
+
+	/**
+	 * @brief 设置内存的NUMA策略, 以后缺页时优先从iNode节点分配物理页, 节点内存不够时退回其它节点
+	 * @note 只影响还没分配物理页的部分, 共享内存的策略挂在共享内存对象上, 所有attach的进程都生效
+	 * @return 0成功
+	 */
+	static int BindNumaNode(void* pAddr, size_t size, int iNode);
+
+	/**
+	 * @brief 预先触发每一页的缺页, 避免启动后头几分钟缺页中断导致的卡顿
+	 * @note 优先用MADV_POPULATE_WRITE, 不支持时按页只读访问, 都不会改写内存里的数据, 恢复模式和正在使用的通道都可以调用
+	 * @param pageSize 页大小, 传0用系统页大小
+	 */
+	static void Prefault(void* pAddr, size_t size, size_t pageSize = 0);
+};
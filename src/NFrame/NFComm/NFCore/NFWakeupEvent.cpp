@@ -0,0 +1,200 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFWakeupEvent.cpp
+//    @Author           :    Gao.Yi
+//    @Date             :   2022-09-18
+//    @Email			:    445267987@qq.com
+//    @Module           :    NFCore
+//
+// -------------------------------------------------------------------------
+
+#include "NFWakeupEvent.h"
+
+#include <sstream>
+#include <chrono>
+
+#if NF_PLATFORM == NF_PLATFORM_WIN
+#else
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+static const uint64_t g_wakeupLatencyBucketUs[NFWakeupEvent::WAKEUP_LATENCY_BUCKET_NUM] = {10, 50, 100, 500, 1000, 5000, 10000, UINT64_MAX};
+static const char* g_wakeupLatencyBucketName[NFWakeupEvent::WAKEUP_LATENCY_BUCKET_NUM] = {"<10us", "<50us", "<100us", "<500us", "<1ms", "<5ms", "<10ms", ">=10ms"};
+
+NFWakeupEvent::NFWakeupEvent()
+{
+#if NF_PLATFORM == NF_PLATFORM_WIN
+	m_bSignaled = false;
+#else
+	m_eventFd = -1;
+#endif
+	m_firstNotifyUs = 0;
+	ClearLatencyHistogram();
+}
+
+NFWakeupEvent::~NFWakeupEvent()
+{
+	UnInit();
+}
+
+bool NFWakeupEvent::Init()
+{
+#if NF_PLATFORM == NF_PLATFORM_WIN
+	return true;
+#else
+	if (m_eventFd >= 0)
+	{
+		return true;
+	}
+
+	m_eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	return m_eventFd >= 0;
+#endif
+}
+
+void NFWakeupEvent::UnInit()
+{
+#if NF_PLATFORM == NF_PLATFORM_WIN
+#else
+	if (m_eventFd >= 0)
+	{
+		close(m_eventFd);
+		m_eventFd = -1;
+	}
+#endif
+}
+
+void NFWakeupEvent::Notify()
+{
+	// 只有第一个Notify需要真正写事件, 后面的Notify在主线程醒来之前都是多余的
+	int64_t expected = 0;
+	if (!m_firstNotifyUs.compare_exchange_strong(expected, NFGetMicroSecondTime()))
+	{
+		return;
+	}
+
+#if NF_PLATFORM == NF_PLATFORM_WIN
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bSignaled = true;
+	}
+	m_cond.notify_one();
+#else
+	if (m_eventFd >= 0)
+	{
+		uint64_t one = 1;
+		ssize_t ret = write(m_eventFd, &one, sizeof(one));
+		(void)ret;
+	}
+#endif
+}
+
+bool NFWakeupEvent::Wait(uint32_t timeoutUs)
+{
+	// 已经有未处理的事件, 不需要等待
+	if (m_firstNotifyUs.load() != 0)
+	{
+#if NF_PLATFORM == NF_PLATFORM_WIN
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bSignaled = false;
+#else
+		if (m_eventFd >= 0)
+		{
+			uint64_t value = 0;
+			ssize_t ret = read(m_eventFd, &value, sizeof(value));
+			(void)ret;
+		}
+#endif
+		return true;
+	}
+
+#if NF_PLATFORM == NF_PLATFORM_WIN
+	std::unique_lock<std::mutex> lock(m_mutex);
+	bool signaled = m_cond.wait_for(lock, std::chrono::microseconds(timeoutUs), [this] { return m_bSignaled; });
+	m_bSignaled = false;
+	return signaled;
+#else
+	if (m_eventFd < 0)
+	{
+		NFSLEEP(timeoutUs);
+		return false;
+	}
+
+	struct pollfd pfd;
+	pfd.fd = m_eventFd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	struct timespec ts;
+	ts.tv_sec = timeoutUs / 1000000;
+	ts.tv_nsec = (timeoutUs % 1000000) * 1000;
+
+	int ret = ppoll(&pfd, 1, &ts, nullptr);
+	if (ret > 0 && (pfd.revents & POLLIN))
+	{
+		uint64_t value = 0;
+		ssize_t readRet = read(m_eventFd, &value, sizeof(value));
+		(void)readRet;
+		return true;
+	}
+
+	return false;
+#endif
+}
+
+void NFWakeupEvent::RecordLatency()
+{
+	int64_t firstNotifyUs = m_firstNotifyUs.exchange(0);
+	if (firstNotifyUs == 0)
+	{
+		return;
+	}
+
+	int64_t now = NFGetMicroSecondTime();
+	uint64_t latencyUs = now > firstNotifyUs ? static_cast<uint64_t>(now - firstNotifyUs) : 0;
+	m_latencyBucket[GetLatencyBucket(latencyUs)]++;
+	m_latencyCount++;
+	m_latencyTotalUs += latencyUs;
+	if (latencyUs > m_latencyMaxUs)
+	{
+		m_latencyMaxUs = latencyUs;
+	}
+}
+
+std::string NFWakeupEvent::GetLatencyHistogram() const
+{
+	std::stringstream ss;
+	ss << "wakeup latency count:" << m_latencyCount;
+	ss << " avg:" << (m_latencyCount > 0 ? m_latencyTotalUs / m_latencyCount : 0) << "us";
+	ss << " max:" << m_latencyMaxUs << "us";
+	for (uint32_t i = 0; i < WAKEUP_LATENCY_BUCKET_NUM; i++)
+	{
+		ss << " " << g_wakeupLatencyBucketName[i] << ":" << m_latencyBucket[i];
+	}
+	return ss.str();
+}
+
+void NFWakeupEvent::ClearLatencyHistogram()
+{
+	for (uint32_t i = 0; i < WAKEUP_LATENCY_BUCKET_NUM; i++)
+	{
+		m_latencyBucket[i] = 0;
+	}
+	m_latencyCount = 0;
+	m_latencyTotalUs = 0;
+	m_latencyMaxUs = 0;
+}
+
+uint32_t NFWakeupEvent::GetLatencyBucket(uint64_t latencyUs)
+{
+	for (uint32_t i = 0; i < WAKEUP_LATENCY_BUCKET_NUM; i++)
+	{
+		if (latencyUs < g_wakeupLatencyBucketUs[i])
+		{
+			return i;
+		}
+	}
+	return WAKEUP_LATENCY_BUCKET_NUM - 1;
+}
@@ -0,0 +1,99 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFWakeupEvent.h
+//    @Author           :    Gao.Yi
+//    @Date             :   2022-09-18
+//    @Email			:    445267987@qq.com
+//    @Module           :    NFCore
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include "NFPlatform.h"
+
+#include <atomic>
+#include <string>
+
+#if NF_PLATFORM == NF_PLATFORM_WIN
+#include <mutex>
+#include <condition_variable>
+#endif
+
+/**
+ * @brief 主循环唤醒事件
+ *
+ * 生产者线程(网络IO线程, 任务线程)调用Notify, 主线程调用Wait阻塞到有事件或者超时。
+ * linux下使用eventfd, 其他平台使用条件变量。
+ * 同时统计从第一次Notify到主线程醒来的延迟, 用于比较唤醒模式和固定休眠模式。
+ */
+class _NFExport NFWakeupEvent
+{
+public:
+	enum
+	{
+		WAKEUP_LATENCY_BUCKET_NUM = 8,
+	};
+
+	NFWakeupEvent();
+
+	~NFWakeupEvent();
+
+	/**
+	 * @brief 创建底层事件句柄
+	 * @return 是否成功
+	 */
+	bool Init();
+
+	/**
+	 * @brief 释放底层事件句柄
+	 */
+	void UnInit();
+
+	/**
+	 * @brief 唤醒主线程, 线程安全
+	 */
+	void Notify();
+
+	/**
+	 * @brief 等待事件
+	 * @param timeoutUs 超时时间, 微秒
+	 * @return 返回true表示被Notify唤醒，false表示超时
+	 */
+	bool Wait(uint32_t timeoutUs);
+
+	/**
+	 * @brief 主线程醒来后调用, 把从第一次Notify到现在的延迟记入直方图
+	 */
+	void RecordLatency();
+
+	/**
+	 * @brief 延迟直方图
+	 * @return 格式化后的直方图
+	 */
+	std::string GetLatencyHistogram() const;
+
+	/**
+	 * @brief 清空直方图
+	 */
+	void ClearLatencyHistogram();
+
+private:
+	static uint32_t GetLatencyBucket(uint64_t latencyUs);
+
+private:
+#if NF_PLATFORM == NF_PLATFORM_WIN
+	std::mutex m_mutex;
+	std::condition_variable m_cond;
+	bool m_bSignaled;
+#else
+	int m_eventFd;
+#endif
+	/**
+	 * @brief 第一次未处理的Notify的时间, 0表示没有未处理的Notify
+	 */
+	std::atomic<int64_t> m_firstNotifyUs;
+	uint64_t m_latencyBucket[WAKEUP_LATENCY_BUCKET_NUM];
+	uint64_t m_latencyCount;
+	uint64_t m_latencyTotalUs;
+	uint64_t m_latencyMaxUs;
+};
@@ -0,0 +1,461 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFWireFormat.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/26
+//    @Email			:    445267987@qq.com
+//    @Module           :    NFCore
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief protobuf编码格式的wire type
+ */
+enum NF_WIRE_TYPE
+{
+	NF_WIRE_TYPE_VARINT = 0,
+	NF_WIRE_TYPE_FIXED64 = 1,
+	NF_WIRE_TYPE_LENGTH = 2,
+	NF_WIRE_TYPE_START_GROUP = 3,
+	NF_WIRE_TYPE_END_GROUP = 4,
+	NF_WIRE_TYPE_FIXED32 = 5,
+};
+
+/**
+ * @brief 按protobuf编码格式直接写内存, 给nanopb生成的共享内存结构体SerializeTo使用
+ *
+ * 不分配内存, 缓冲区不够时置溢出标记, 之后的写入都忽略。
+ * 嵌套消息先占1字节长度, 写完消息体后回填, 长度超过127时把消息体整体后移, 结果和protobuf完全一致
+ */
+class NFWireWriter
+{
+public:
+	NFWireWriter(uint8_t* pBuf, size_t size) : m_pBegin(pBuf), m_pPos(pBuf), m_pEnd(pBuf + size), m_overflow(false)
+	{
+	}
+
+	bool IsOverflow() const { return m_overflow; }
+
+	size_t GetLength() const { return m_pPos - m_pBegin; }
+
+	static size_t VarintSize(uint64_t value)
+	{
+		size_t size = 1;
+		while (value >= 0x80)
+		{
+			value >>= 7;
+			size++;
+		}
+		return size;
+	}
+
+	void WriteRawVarint(uint64_t value)
+	{
+		if (m_pEnd - m_pPos < 10)
+		{
+			size_t size = VarintSize(value);
+			if (static_cast<size_t>(m_pEnd - m_pPos) < size)
+			{
+				SetOverflow();
+				return;
+			}
+		}
+
+		while (value >= 0x80)
+		{
+			*m_pPos++ = static_cast<uint8_t>(value | 0x80);
+			value >>= 7;
+		}
+		*m_pPos++ = static_cast<uint8_t>(value);
+	}
+
+	void WriteRawFixed32(uint32_t value)
+	{
+		uint8_t* p = Reserve(4);
+		if (p)
+		{
+			p[0] = static_cast<uint8_t>(value);
+			p[1] = static_cast<uint8_t>(value >> 8);
+			p[2] = static_cast<uint8_t>(value >> 16);
+			p[3] = static_cast<uint8_t>(value >> 24);
+		}
+	}
+
+	void WriteRawFixed64(uint64_t value)
+	{
+		WriteRawFixed32(static_cast<uint32_t>(value));
+		WriteRawFixed32(static_cast<uint32_t>(value >> 32));
+	}
+
+	void WriteRaw(const void* pData, size_t length)
+	{
+		uint8_t* p = Reserve(length);
+		if (p && length > 0)
+		{
+			memcpy(p, pData, length);
+		}
+	}
+
+	/**
+	 * @brief 预留length字节给调用者直接写, 空间不够返回NULL
+	 */
+	uint8_t* Reserve(size_t length)
+	{
+		if (m_overflow || static_cast<size_t>(m_pEnd - m_pPos) < length)
+		{
+			SetOverflow();
+			return NULL;
+		}
+		uint8_t* p = m_pPos;
+		m_pPos += length;
+		return p;
+	}
+
+	void WriteTag(uint32_t field, uint32_t wireType) { WriteRawVarint((field << 3) | wireType); }
+
+	/**
+	 * @brief 开始写一个长度前缀的字段(嵌套消息或packed数组), 返回长度所在位置, 写完后调用EndLength
+	 */
+	size_t BeginLength(uint32_t field)
+	{
+		WriteTag(field, NF_WIRE_TYPE_LENGTH);
+		size_t start = GetLength();
+		Reserve(1);
+		return start;
+	}
+
+	void EndLength(size_t start)
+	{
+		if (m_overflow)
+		{
+			return;
+		}
+
+		uint8_t* pLen = m_pBegin + start;
+		size_t length = m_pPos - pLen - 1;
+		if (length < 0x80)
+		{
+			*pLen = static_cast<uint8_t>(length);
+			return;
+		}
+
+		size_t extra = VarintSize(length) - 1;
+		if (Reserve(extra) == NULL)
+		{
+			return;
+		}
+		memmove(pLen + 1 + extra, pLen + 1, length);
+		while (length >= 0x80)
+		{
+			*pLen++ = static_cast<uint8_t>(length | 0x80);
+			length >>= 7;
+		}
+		*pLen = static_cast<uint8_t>(length);
+	}
+
+	//不带tag的写法, packed数组使用
+	void WriteInt32NoTag(int32_t value) { WriteRawVarint(static_cast<uint64_t>(static_cast<int64_t>(value))); }
+	void WriteInt64NoTag(int64_t value) { WriteRawVarint(static_cast<uint64_t>(value)); }
+	void WriteUInt32NoTag(uint32_t value) { WriteRawVarint(value); }
+	void WriteUInt64NoTag(uint64_t value) { WriteRawVarint(value); }
+	void WriteSInt32NoTag(int32_t value) { WriteRawVarint((static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31)); }
+	void WriteSInt64NoTag(int64_t value) { WriteRawVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63)); }
+	void WriteBoolNoTag(bool value) { WriteRawVarint(value ? 1 : 0); }
+	void WriteEnumNoTag(int32_t value) { WriteInt32NoTag(value); }
+	void WriteFixed32NoTag(uint32_t value) { WriteRawFixed32(value); }
+	void WriteSFixed32NoTag(int32_t value) { WriteRawFixed32(static_cast<uint32_t>(value)); }
+	void WriteFixed64NoTag(uint64_t value) { WriteRawFixed64(value); }
+	void WriteSFixed64NoTag(int64_t value) { WriteRawFixed64(static_cast<uint64_t>(value)); }
+
+	void WriteFloatNoTag(float value)
+	{
+		uint32_t bits = 0;
+		memcpy(&bits, &value, sizeof(bits));
+		WriteRawFixed32(bits);
+	}
+
+	void WriteDoubleNoTag(double value)
+	{
+		uint64_t bits = 0;
+		memcpy(&bits, &value, sizeof(bits));
+		WriteRawFixed64(bits);
+	}
+
+	/**
+	 * @brief proto3的float/double按位判断是不是默认值, -0.0不是默认值, 要写出去
+	 */
+	static bool IsNonZeroBits(float value)
+	{
+		uint32_t bits = 0;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits != 0;
+	}
+
+	static bool IsNonZeroBits(double value)
+	{
+		uint64_t bits = 0;
+		memcpy(&bits, &value, sizeof(bits));
+		return bits != 0;
+	}
+
+	void WriteInt32(uint32_t field, int32_t value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteInt32NoTag(value); }
+	void WriteInt64(uint32_t field, int64_t value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteInt64NoTag(value); }
+	void WriteUInt32(uint32_t field, uint32_t value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteUInt32NoTag(value); }
+	void WriteUInt64(uint32_t field, uint64_t value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteUInt64NoTag(value); }
+	void WriteSInt32(uint32_t field, int32_t value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteSInt32NoTag(value); }
+	void WriteSInt64(uint32_t field, int64_t value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteSInt64NoTag(value); }
+	void WriteBool(uint32_t field, bool value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteBoolNoTag(value); }
+	void WriteEnum(uint32_t field, int32_t value) { WriteTag(field, NF_WIRE_TYPE_VARINT); WriteEnumNoTag(value); }
+	void WriteFixed32(uint32_t field, uint32_t value) { WriteTag(field, NF_WIRE_TYPE_FIXED32); WriteFixed32NoTag(value); }
+	void WriteSFixed32(uint32_t field, int32_t value) { WriteTag(field, NF_WIRE_TYPE_FIXED32); WriteSFixed32NoTag(value); }
+	void WriteFloat(uint32_t field, float value) { WriteTag(field, NF_WIRE_TYPE_FIXED32); WriteFloatNoTag(value); }
+	void WriteFixed64(uint32_t field, uint64_t value) { WriteTag(field, NF_WIRE_TYPE_FIXED64); WriteFixed64NoTag(value); }
+	void WriteSFixed64(uint32_t field, int64_t value) { WriteTag(field, NF_WIRE_TYPE_FIXED64); WriteSFixed64NoTag(value); }
+	void WriteDouble(uint32_t field, double value) { WriteTag(field, NF_WIRE_TYPE_FIXED64); WriteDoubleNoTag(value); }
+
+	void WriteBytes(uint32_t field, const char* pData, size_t length)
+	{
+		WriteTag(field, NF_WIRE_TYPE_LENGTH);
+		WriteRawVarint(length);
+		WriteRaw(pData, length);
+	}
+
+private:
+	void SetOverflow()
+	{
+		m_overflow = true;
+		m_pPos = m_pEnd;
+	}
+
+	uint8_t* m_pBegin;
+	uint8_t* m_pPos;
+	uint8_t* m_pEnd;
+	bool m_overflow;
+};
+
+/**
+ * @brief 按protobuf编码格式直接读内存, 给nanopb生成的共享内存结构体ParseFrom使用
+ *
+ * 读取失败时置错误标记并停在末尾, 数值读取函数直接返回值, 调用者最后检查IsError即可
+ */
+class NFWireReader
+{
+public:
+	NFWireReader() : m_pPos(NULL), m_pEnd(NULL), m_error(false)
+	{
+	}
+
+	NFWireReader(const uint8_t* pBuf, size_t size) : m_pPos(pBuf), m_pEnd(pBuf + size), m_error(false)
+	{
+	}
+
+	bool IsEnd() const { return m_pPos >= m_pEnd; }
+
+	bool IsError() const { return m_error; }
+
+	const uint8_t* GetPos() const { return m_pPos; }
+
+	size_t GetLeft() const { return m_pEnd - m_pPos; }
+
+	void SetError()
+	{
+		m_error = true;
+		m_pPos = m_pEnd;
+	}
+
+	void SkipAll() { m_pPos = m_pEnd; }
+
+	uint64_t ReadRawVarint()
+	{
+		uint64_t value = 0;
+		for (uint32_t shift = 0; shift < 64; shift += 7)
+		{
+			if (m_pPos >= m_pEnd)
+			{
+				SetError();
+				return 0;
+			}
+			uint8_t byte = *m_pPos++;
+			value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				return value;
+			}
+		}
+		SetError();
+		return 0;
+	}
+
+	uint32_t ReadRawFixed32()
+	{
+		if (m_pEnd - m_pPos < 4)
+		{
+			SetError();
+			return 0;
+		}
+		uint32_t value = static_cast<uint32_t>(m_pPos[0]) | (static_cast<uint32_t>(m_pPos[1]) << 8) | (static_cast<uint32_t>(m_pPos[2]) << 16) | (static_cast<uint32_t>(m_pPos[3]) << 24);
+		m_pPos += 4;
+		return value;
+	}
+
+	uint64_t ReadRawFixed64()
+	{
+		uint64_t low = ReadRawFixed32();
+		uint64_t high = ReadRawFixed32();
+		return low | (high << 32);
+	}
+
+	/**
+	 * @brief 读下一个字段的tag, 到末尾或出错返回false
+	 */
+	bool ReadTag(uint32_t& field, uint32_t& wireType)
+	{
+		if (IsEnd())
+		{
+			return false;
+		}
+		uint64_t tag = ReadRawVarint();
+		field = static_cast<uint32_t>(tag >> 3);
+		wireType = static_cast<uint32_t>(tag & 7);
+		if (m_error || field == 0)
+		{
+			SetError();
+			return false;
+		}
+		return true;
+	}
+
+	int32_t ReadInt32() { return static_cast<int32_t>(ReadRawVarint()); }
+	int64_t ReadInt64() { return static_cast<int64_t>(ReadRawVarint()); }
+	uint32_t ReadUInt32() { return static_cast<uint32_t>(ReadRawVarint()); }
+	uint64_t ReadUInt64() { return ReadRawVarint(); }
+
+	int32_t ReadSInt32()
+	{
+		uint32_t value = static_cast<uint32_t>(ReadRawVarint());
+		return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+	}
+
+	int64_t ReadSInt64()
+	{
+		uint64_t value = ReadRawVarint();
+		return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+	}
+
+	bool ReadBool() { return ReadRawVarint() != 0; }
+	int32_t ReadEnum() { return ReadInt32(); }
+	uint32_t ReadFixed32() { return ReadRawFixed32(); }
+	int32_t ReadSFixed32() { return static_cast<int32_t>(ReadRawFixed32()); }
+	uint64_t ReadFixed64() { return ReadRawFixed64(); }
+	int64_t ReadSFixed64() { return static_cast<int64_t>(ReadRawFixed64()); }
+
+	float ReadFloat()
+	{
+		uint32_t bits = ReadRawFixed32();
+		float value = 0;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	double ReadDouble()
+	{
+		uint64_t bits = ReadRawFixed64();
+		double value = 0;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	/**
+	 * @brief 读长度前缀的字段, 数据仍在原缓冲区里
+	 */
+	bool ReadBytes(const char*& pData, size_t& length)
+	{
+		uint64_t size = ReadRawVarint();
+		if (m_error || size > static_cast<uint64_t>(m_pEnd - m_pPos))
+		{
+			SetError();
+			return false;
+		}
+		pData = reinterpret_cast<const char*>(m_pPos);
+		length = static_cast<size_t>(size);
+		m_pPos += length;
+		return true;
+	}
+
+	/**
+	 * @brief 读嵌套消息或packed数组, sub只能读这个字段的内容
+	 */
+	bool ReadSubReader(NFWireReader& sub)
+	{
+		const char* pData = NULL;
+		size_t length = 0;
+		if (!ReadBytes(pData, length))
+		{
+			return false;
+		}
+		sub = NFWireReader(reinterpret_cast<const uint8_t*>(pData), length);
+		return true;
+	}
+
+	/**
+	 * @brief 跳过不认识的字段
+	 */
+	bool SkipField(uint32_t field, uint32_t wireType)
+	{
+		switch (wireType)
+		{
+			case NF_WIRE_TYPE_VARINT:
+				ReadRawVarint();
+				break;
+			case NF_WIRE_TYPE_FIXED64:
+				ReadRawFixed64();
+				break;
+			case NF_WIRE_TYPE_LENGTH:
+			{
+				const char* pData = NULL;
+				size_t length = 0;
+				ReadBytes(pData, length);
+				break;
+			}
+			case NF_WIRE_TYPE_START_GROUP:
+			{
+				uint32_t subField = 0;
+				uint32_t subWireType = 0;
+				while (ReadTag(subField, subWireType))
+				{
+					if (subWireType == NF_WIRE_TYPE_END_GROUP)
+					{
+						if (subField != field)
+						{
+							SetError();
+						}
+						return !m_error;
+					}
+					if (!SkipField(subField, subWireType))
+					{
+						return false;
+					}
+				}
+				SetError();
+				break;
+			}
+			case NF_WIRE_TYPE_FIXED32:
+				ReadRawFixed32();
+				break;
+			default:
+				SetError();
+				break;
+		}
+		return !m_error;
+	}
+
+private:
+	const uint8_t* m_pPos;
+	const uint8_t* m_pEnd;
+	bool m_error;
+};
@@ -118,6 +118,139 @@ NFrame::BevLogBaseInfo BevLogBaseInfo::ToPb() const
     return cc;
 }
 
+bool BevLogBaseInfo::SerializeTo(NFWireWriter& writer) const
+{
+    if (!szGameSvrId.empty())
+    {
+        writer.WriteBytes(1, szGameSvrId.data(), szGameSvrId.length());
+    }
+    if (tDtEventTime != 0)
+    {
+        writer.WriteUInt64(2, tDtEventTime);
+    }
+    if (!szVGameAppid.empty())
+    {
+        writer.WriteBytes(3, szVGameAppid.data(), szVGameAppid.length());
+    }
+    if (iPlatID != 0)
+    {
+        writer.WriteInt32(4, iPlatID);
+    }
+    if (iIZoneAreaID != 0)
+    {
+        writer.WriteInt32(5, iIZoneAreaID);
+    }
+    if (!szVopenid.empty())
+    {
+        writer.WriteBytes(6, szVopenid.data(), szVopenid.length());
+    }
+    return !writer.IsOverflow();
+}
+
+int BevLogBaseInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool BevLogBaseInfo::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrame::BevLogBaseInfo::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool BevLogBaseInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool BevLogBaseInfo::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 32)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogBaseInfo, field:szGameSvrId, cur length:%d, max length:31", static_cast<int>(length));
+                        return false;
+                    }
+                    szGameSvrId.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    tDtEventTime = static_cast<uint64_t>(reader.ReadUInt64());
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 32)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogBaseInfo, field:szVGameAppid, cur length:%d, max length:31", static_cast<int>(length));
+                        return false;
+                    }
+                    szVGameAppid.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iPlatID = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iIZoneAreaID = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 6:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogBaseInfo, field:szVopenid, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szVopenid.assign(pData, length);
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string BevLogBaseInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -360,6 +493,383 @@ NFrame::BevLogDeviceInfo BevLogDeviceInfo::ToPb() const
     return cc;
 }
 
+bool BevLogDeviceInfo::SerializeTo(NFWireWriter& writer) const
+{
+    if (!szClientVersion.empty())
+    {
+        writer.WriteBytes(1, szClientVersion.data(), szClientVersion.length());
+    }
+    if (!szSystemSoftware.empty())
+    {
+        writer.WriteBytes(2, szSystemSoftware.data(), szSystemSoftware.length());
+    }
+    if (!szSystemHardware.empty())
+    {
+        writer.WriteBytes(3, szSystemHardware.data(), szSystemHardware.length());
+    }
+    if (!szTelecomOper.empty())
+    {
+        writer.WriteBytes(4, szTelecomOper.data(), szTelecomOper.length());
+    }
+    if (!szNetwork.empty())
+    {
+        writer.WriteBytes(5, szNetwork.data(), szNetwork.length());
+    }
+    if (iScreenWidth != 0)
+    {
+        writer.WriteInt32(6, iScreenWidth);
+    }
+    if (iScreenHight != 0)
+    {
+        writer.WriteInt32(7, iScreenHight);
+    }
+    if (NFWireWriter::IsNonZeroBits(fDensity))
+    {
+        writer.WriteFloat(8, fDensity);
+    }
+    if (!szCpuHardware.empty())
+    {
+        writer.WriteBytes(9, szCpuHardware.data(), szCpuHardware.length());
+    }
+    if (iMemory != 0)
+    {
+        writer.WriteInt32(10, iMemory);
+    }
+    if (!szGLRender.empty())
+    {
+        writer.WriteBytes(11, szGLRender.data(), szGLRender.length());
+    }
+    if (!szGLVersion.empty())
+    {
+        writer.WriteBytes(12, szGLVersion.data(), szGLVersion.length());
+    }
+    if (!szDeviceId.empty())
+    {
+        writer.WriteBytes(13, szDeviceId.data(), szDeviceId.length());
+    }
+    if (iIsRoot != 0)
+    {
+        writer.WriteInt32(14, iIsRoot);
+    }
+    if (!szIPStr.empty())
+    {
+        writer.WriteBytes(15, szIPStr.data(), szIPStr.length());
+    }
+    if (iPort != 0)
+    {
+        writer.WriteInt32(16, iPort);
+    }
+    if (!szIPV6Str.empty())
+    {
+        writer.WriteBytes(17, szIPV6Str.data(), szIPV6Str.length());
+    }
+    if (!szMacAddr.empty())
+    {
+        writer.WriteBytes(18, szMacAddr.data(), szMacAddr.length());
+    }
+    if (!szInstallPath.empty())
+    {
+        writer.WriteBytes(19, szInstallPath.data(), szInstallPath.length());
+    }
+    if (iCountryCode != 0)
+    {
+        writer.WriteInt32(20, iCountryCode);
+    }
+    return !writer.IsOverflow();
+}
+
+int BevLogDeviceInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool BevLogDeviceInfo::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrame::BevLogDeviceInfo::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool BevLogDeviceInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool BevLogDeviceInfo::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szClientVersion, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szClientVersion.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szSystemSoftware, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szSystemSoftware.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szSystemHardware, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szSystemHardware.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szTelecomOper, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szTelecomOper.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szNetwork, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szNetwork.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 6:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iScreenWidth = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 7:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iScreenHight = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 8:
+                if (wireType == NF_WIRE_TYPE_FIXED32)
+                {
+                    fDensity = static_cast<float>(reader.ReadFloat());
+                    continue;
+                }
+                break;
+            case 9:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szCpuHardware, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szCpuHardware.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 10:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iMemory = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 11:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szGLRender, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szGLRender.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 12:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 128)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szGLVersion, cur length:%d, max length:127", static_cast<int>(length));
+                        return false;
+                    }
+                    szGLVersion.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 13:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szDeviceId, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szDeviceId.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 14:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iIsRoot = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 15:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 16)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szIPStr, cur length:%d, max length:15", static_cast<int>(length));
+                        return false;
+                    }
+                    szIPStr.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 16:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iPort = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 17:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szIPV6Str, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szIPV6Str.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 18:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 32)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szMacAddr, cur length:%d, max length:31", static_cast<int>(length));
+                        return false;
+                    }
+                    szMacAddr.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 19:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 256)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogDeviceInfo, field:szInstallPath, cur length:%d, max length:255", static_cast<int>(length));
+                        return false;
+                    }
+                    szInstallPath.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 20:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iCountryCode = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string BevLogDeviceInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -516,6 +1026,185 @@ NFrame::BevLogRoleBaseInfo BevLogRoleBaseInfo::ToPb() const
     return cc;
 }
 
+bool BevLogRoleBaseInfo::SerializeTo(NFWireWriter& writer) const
+{
+    if (!szVRoleID.empty())
+    {
+        writer.WriteBytes(1, szVRoleID.data(), szVRoleID.length());
+    }
+    if (!szVRoleName.empty())
+    {
+        writer.WriteBytes(2, szVRoleName.data(), szVRoleName.length());
+    }
+    if (iIHomeLevel != 0)
+    {
+        writer.WriteInt32(3, iIHomeLevel);
+    }
+    if (iSurviveLevel != 0)
+    {
+        writer.WriteInt32(4, iSurviveLevel);
+    }
+    if (iBattleLevel != 0)
+    {
+        writer.WriteInt32(5, iBattleLevel);
+    }
+    if (llFamilyID != 0)
+    {
+        writer.WriteInt64(6, llFamilyID);
+    }
+    if (iIVipLevel != 0)
+    {
+        writer.WriteInt32(7, iIVipLevel);
+    }
+    if (iProfId != 0)
+    {
+        writer.WriteInt32(8, iProfId);
+    }
+    if (iGender != 0)
+    {
+        writer.WriteInt32(9, iGender);
+    }
+    if (iBattleForce != 0)
+    {
+        writer.WriteInt32(10, iBattleForce);
+    }
+    if (iBirthTime != 0)
+    {
+        writer.WriteInt32(11, iBirthTime);
+    }
+    return !writer.IsOverflow();
+}
+
+int BevLogRoleBaseInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool BevLogRoleBaseInfo::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrame::BevLogRoleBaseInfo::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool BevLogRoleBaseInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool BevLogRoleBaseInfo::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 64)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogRoleBaseInfo, field:szVRoleID, cur length:%d, max length:63", static_cast<int>(length));
+                        return false;
+                    }
+                    szVRoleID.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 128)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogRoleBaseInfo, field:szVRoleName, cur length:%d, max length:127", static_cast<int>(length));
+                        return false;
+                    }
+                    szVRoleName.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iIHomeLevel = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iSurviveLevel = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iBattleLevel = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 6:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    llFamilyID = static_cast<int64_t>(reader.ReadInt64());
+                    continue;
+                }
+                break;
+            case 7:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iIVipLevel = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 8:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iProfId = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 9:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iGender = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 10:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iBattleForce = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 11:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iBirthTime = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string BevLogRoleBaseInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -623,6 +1312,101 @@ NFrame::BevLogTransBaseInfo BevLogTransBaseInfo::ToPb() const
     return cc;
 }
 
+bool BevLogTransBaseInfo::SerializeTo(NFWireWriter& writer) const
+{
+    if (iGlobalID != 0)
+    {
+        writer.WriteInt32(1, iGlobalID);
+    }
+    if (iErrCode != 0)
+    {
+        writer.WriteInt32(2, iErrCode);
+    }
+    if (iEotType != 0)
+    {
+        writer.WriteInt32(3, iEotType);
+    }
+    if (ullTransStartTime != 0)
+    {
+        writer.WriteUInt64(4, ullTransStartTime);
+    }
+    if (ullTransStopTime != 0)
+    {
+        writer.WriteUInt64(5, ullTransStopTime);
+    }
+    return !writer.IsOverflow();
+}
+
+int BevLogTransBaseInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool BevLogTransBaseInfo::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrame::BevLogTransBaseInfo::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool BevLogTransBaseInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool BevLogTransBaseInfo::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iGlobalID = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iErrCode = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iEotType = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    ullTransStartTime = static_cast<uint64_t>(reader.ReadUInt64());
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    ullTransStopTime = static_cast<uint64_t>(reader.ReadUInt64());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string BevLogTransBaseInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -724,6 +1508,99 @@ NFrame::ServerStateFlow ServerStateFlow::ToPb() const
     return cc;
 }
 
+bool ServerStateFlow::SerializeTo(NFWireWriter& writer) const
+{
+    if (tDtEventTime != 0)
+    {
+        writer.WriteUInt64(1, tDtEventTime);
+    }
+    if (!szVGameIP.empty())
+    {
+        writer.WriteBytes(2, szVGameIP.data(), szVGameIP.length());
+    }
+    if (iIZoneAreaID != 0)
+    {
+        writer.WriteInt32(3, iIZoneAreaID);
+    }
+    if (iITimeShift != 0)
+    {
+        writer.WriteInt32(4, iITimeShift);
+    }
+    return !writer.IsOverflow();
+}
+
+int ServerStateFlow::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ServerStateFlow::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrame::ServerStateFlow::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool ServerStateFlow::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ServerStateFlow::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    tDtEventTime = static_cast<uint64_t>(reader.ReadUInt64());
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 32)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:ServerStateFlow, field:szVGameIP, cur length:%d, max length:31", static_cast<int>(length));
+                        return false;
+                    }
+                    szVGameIP.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iIZoneAreaID = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iITimeShift = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string ServerStateFlow::ShortDebugString() const
 {
     std::stringstream ss;
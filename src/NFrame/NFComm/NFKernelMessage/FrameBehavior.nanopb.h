@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include "NFComm/NFShmStl/NFShmString.h"
 #include <pb.h>
 
@@ -40,6 +41,11 @@ struct BevLogBaseInfo {
     bool FromPb(const NFrame::BevLogBaseInfo& cc);
     void ToPb(NFrame::BevLogBaseInfo* cc) const;
     NFrame::BevLogBaseInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:BevLogBaseInfo) */
@@ -78,6 +84,11 @@ struct BevLogDeviceInfo {
     bool FromPb(const NFrame::BevLogDeviceInfo& cc);
     void ToPb(NFrame::BevLogDeviceInfo* cc) const;
     NFrame::BevLogDeviceInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:BevLogDeviceInfo) */
@@ -107,6 +118,11 @@ struct BevLogRoleBaseInfo {
     bool FromPb(const NFrame::BevLogRoleBaseInfo& cc);
     void ToPb(NFrame::BevLogRoleBaseInfo* cc) const;
     NFrame::BevLogRoleBaseInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:BevLogRoleBaseInfo) */
@@ -130,6 +146,11 @@ struct BevLogTransBaseInfo {
     bool FromPb(const NFrame::BevLogTransBaseInfo& cc);
     void ToPb(NFrame::BevLogTransBaseInfo* cc) const;
     NFrame::BevLogTransBaseInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:BevLogTransBaseInfo) */
@@ -152,6 +173,11 @@ struct ServerStateFlow {
     bool FromPb(const NFrame::ServerStateFlow& cc);
     void ToPb(NFrame::ServerStateFlow* cc) const;
     NFrame::ServerStateFlow ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ServerStateFlow) */
@@ -113,6 +113,48 @@ NFrame::tbServerMgr tbServerMgr::ToPb() const
     return cc;
 }
 
+bool tbServerMgr::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::tbServerMgr cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int tbServerMgr::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool tbServerMgr::ParseFrom(NFWireReader& reader)
+{
+    NFrame::tbServerMgr cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool tbServerMgr::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool tbServerMgr::MergeFrom(NFWireReader& reader)
+{
+    NFrame::tbServerMgr cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string tbServerMgr::ShortDebugString() const
 {
     std::stringstream ss;
@@ -230,6 +272,48 @@ NFrame::pbMysqlConfig pbMysqlConfig::ToPb() const
     return cc;
 }
 
+bool pbMysqlConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbMysqlConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbMysqlConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbMysqlConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbMysqlConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbMysqlConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbMysqlConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbMysqlConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbMysqlConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -323,6 +407,48 @@ NFrame::pbRedisConfig pbRedisConfig::ToPb() const
     return cc;
 }
 
+bool pbRedisConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbRedisConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbRedisConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbRedisConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbRedisConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbRedisConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbRedisConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbRedisConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbRedisConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -414,6 +540,48 @@ NFrame::pbRouteConfig pbRouteConfig::ToPb() const
     return cc;
 }
 
+bool pbRouteConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbRouteConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbRouteConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbRouteConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbRouteConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbRouteConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbRouteConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbRouteConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbRouteConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -550,6 +718,48 @@ NFrame::pbPluginConfig pbPluginConfig::ToPb() const
     return cc;
 }
 
+bool pbPluginConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbPluginConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbPluginConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbPluginConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbPluginConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbPluginConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbPluginConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbPluginConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbPluginConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -657,6 +867,48 @@ NFrame::pbAllServerConfig pbAllServerConfig::ToPb() const
     return cc;
 }
 
+bool pbAllServerConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbAllServerConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbAllServerConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbAllServerConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbAllServerConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbAllServerConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbAllServerConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbAllServerConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbAllServerConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -744,6 +996,48 @@ NFrame::pbTableConfig pbTableConfig::ToPb() const
     return cc;
 }
 
+bool pbTableConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbTableConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbTableConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbTableConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbTableConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbTableConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbTableConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbTableConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbTableConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -834,6 +1128,48 @@ NFrame::pbEncryptConfig pbEncryptConfig::ToPb() const
     return cc;
 }
 
+bool pbEncryptConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbEncryptConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbEncryptConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbEncryptConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbEncryptConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbEncryptConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbEncryptConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbEncryptConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbEncryptConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1075,6 +1411,48 @@ NFrame::pbNFServerConfig pbNFServerConfig::ToPb() const
     return cc;
 }
 
+bool pbNFServerConfig::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::pbNFServerConfig cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int pbNFServerConfig::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool pbNFServerConfig::ParseFrom(NFWireReader& reader)
+{
+    NFrame::pbNFServerConfig cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool pbNFServerConfig::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool pbNFServerConfig::MergeFrom(NFWireReader& reader)
+{
+    NFrame::pbNFServerConfig cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string pbNFServerConfig::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1213,6 +1591,48 @@ NFrame::wxWorkRobotText wxWorkRobotText::ToPb() const
     return cc;
 }
 
+bool wxWorkRobotText::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::wxWorkRobotText cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int wxWorkRobotText::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool wxWorkRobotText::ParseFrom(NFWireReader& reader)
+{
+    NFrame::wxWorkRobotText cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool wxWorkRobotText::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool wxWorkRobotText::MergeFrom(NFWireReader& reader)
+{
+    NFrame::wxWorkRobotText cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string wxWorkRobotText::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1304,6 +1724,48 @@ NFrame::wxWorkRobotHttpPost wxWorkRobotHttpPost::ToPb() const
     return cc;
 }
 
+bool wxWorkRobotHttpPost::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::wxWorkRobotHttpPost cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int wxWorkRobotHttpPost::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool wxWorkRobotHttpPost::ParseFrom(NFWireReader& reader)
+{
+    NFrame::wxWorkRobotHttpPost cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool wxWorkRobotHttpPost::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool wxWorkRobotHttpPost::MergeFrom(NFWireReader& reader)
+{
+    NFrame::wxWorkRobotHttpPost cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string wxWorkRobotHttpPost::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1415,6 +1877,48 @@ NFrame::ExcelSheetInfo ExcelSheetInfo::ToPb() const
     return cc;
 }
 
+bool ExcelSheetInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::ExcelSheetInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ExcelSheetInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ExcelSheetInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::ExcelSheetInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ExcelSheetInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ExcelSheetInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::ExcelSheetInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ExcelSheetInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1520,6 +2024,48 @@ NFrame::ExcelPbInfo ExcelPbInfo::ToPb() const
     return cc;
 }
 
+bool ExcelPbInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::ExcelPbInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ExcelPbInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ExcelPbInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::ExcelPbInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ExcelPbInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ExcelPbInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::ExcelPbInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ExcelPbInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1617,6 +2163,48 @@ NFrame::ExcelParseInfo ExcelParseInfo::ToPb() const
     return cc;
 }
 
+bool ExcelParseInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::ExcelParseInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ExcelParseInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ExcelParseInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::ExcelParseInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ExcelParseInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ExcelParseInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::ExcelParseInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ExcelParseInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include <pb.h>
 
 #include "FrameComm.pb.h"
@@ -45,6 +46,11 @@ struct ExcelSheetInfo {
     bool FromPb(const NFrame::ExcelSheetInfo& cc);
     void ToPb(NFrame::ExcelSheetInfo* cc) const;
     NFrame::ExcelSheetInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ExcelSheetInfo) */
@@ -66,6 +72,11 @@ struct pbAllServerConfig {
     bool FromPb(const NFrame::pbAllServerConfig& cc);
     void ToPb(NFrame::pbAllServerConfig* cc) const;
     NFrame::pbAllServerConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbAllServerConfig) */
@@ -88,6 +99,11 @@ struct pbEncryptConfig {
     bool FromPb(const NFrame::pbEncryptConfig& cc);
     void ToPb(NFrame::pbEncryptConfig* cc) const;
     NFrame::pbEncryptConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbEncryptConfig) */
@@ -109,6 +125,11 @@ struct pbRedisConfig {
     bool FromPb(const NFrame::pbRedisConfig& cc);
     void ToPb(NFrame::pbRedisConfig* cc) const;
     NFrame::pbRedisConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbRedisConfig) */
@@ -132,6 +153,11 @@ struct pbRouteConfig {
     bool FromPb(const NFrame::pbRouteConfig& cc);
     void ToPb(NFrame::pbRouteConfig* cc) const;
     NFrame::pbRouteConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbRouteConfig) */
@@ -153,6 +179,11 @@ struct pbTableConfig {
     bool FromPb(const NFrame::pbTableConfig& cc);
     void ToPb(NFrame::pbTableConfig* cc) const;
     NFrame::pbTableConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbTableConfig) */
@@ -181,6 +212,11 @@ struct tbServerMgr {
     bool FromPb(const NFrame::tbServerMgr& cc);
     void ToPb(NFrame::tbServerMgr* cc) const;
     NFrame::tbServerMgr ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:tbServerMgr) */
@@ -202,6 +238,11 @@ struct wxWorkRobotText {
     bool FromPb(const NFrame::wxWorkRobotText& cc);
     void ToPb(NFrame::wxWorkRobotText* cc) const;
     NFrame::wxWorkRobotText ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:wxWorkRobotText) */
@@ -222,6 +263,11 @@ struct ExcelPbInfo {
     bool FromPb(const NFrame::ExcelPbInfo& cc);
     void ToPb(NFrame::ExcelPbInfo* cc) const;
     NFrame::ExcelPbInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ExcelPbInfo) */
@@ -246,6 +292,11 @@ struct pbMysqlConfig {
     bool FromPb(const NFrame::pbMysqlConfig& cc);
     void ToPb(NFrame::pbMysqlConfig* cc) const;
     NFrame::pbMysqlConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbMysqlConfig) */
@@ -269,6 +320,11 @@ struct pbPluginConfig {
     bool FromPb(const NFrame::pbPluginConfig& cc);
     void ToPb(NFrame::pbPluginConfig* cc) const;
     NFrame::pbPluginConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbPluginConfig) */
@@ -289,6 +345,11 @@ struct wxWorkRobotHttpPost {
     bool FromPb(const NFrame::wxWorkRobotHttpPost& cc);
     void ToPb(NFrame::wxWorkRobotHttpPost* cc) const;
     NFrame::wxWorkRobotHttpPost ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:wxWorkRobotHttpPost) */
@@ -308,6 +369,11 @@ struct ExcelParseInfo {
     bool FromPb(const NFrame::ExcelParseInfo& cc);
     void ToPb(NFrame::ExcelParseInfo* cc) const;
     NFrame::ExcelParseInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ExcelParseInfo) */
@@ -366,6 +432,11 @@ struct pbNFServerConfig {
     bool FromPb(const NFrame::pbNFServerConfig& cc);
     void ToPb(NFrame::pbNFServerConfig* cc) const;
     NFrame::pbNFServerConfig ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:pbNFServerConfig) */
@@ -98,6 +98,48 @@ NFrame::Proto_DispInfo Proto_DispInfo::ToPb() const
     return cc;
 }
 
+bool Proto_DispInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_DispInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_DispInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_DispInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_DispInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_DispInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_DispInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_DispInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_DispInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -184,6 +226,48 @@ NFrame::Proto_TransInfo Proto_TransInfo::ToPb() const
     return cc;
 }
 
+bool Proto_TransInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_TransInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_TransInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_TransInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_TransInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_TransInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_TransInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_TransInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_TransInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -267,6 +351,48 @@ NFrame::Proto_StoreInfo Proto_StoreInfo::ToPb() const
     return cc;
 }
 
+bool Proto_StoreInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_StoreInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_StoreInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_StoreInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_StoreInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_StoreInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_StoreInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_StoreInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_StoreInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -363,6 +489,48 @@ NFrame::Proto_EventInfo Proto_EventInfo::ToPb() const
     return cc;
 }
 
+bool Proto_EventInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_EventInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_EventInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_EventInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_EventInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_EventInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_EventInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_EventInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_EventInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -448,6 +616,48 @@ NFrame::Proto_ScriptRpcResult Proto_ScriptRpcResult::ToPb() const
     return cc;
 }
 
+bool Proto_ScriptRpcResult::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_ScriptRpcResult cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_ScriptRpcResult::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_ScriptRpcResult::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_ScriptRpcResult cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_ScriptRpcResult::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_ScriptRpcResult::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_ScriptRpcResult cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_ScriptRpcResult::ShortDebugString() const
 {
     std::stringstream ss;
@@ -562,6 +772,48 @@ NFrame::Proto_RpcInfo Proto_RpcInfo::ToPb() const
     return cc;
 }
 
+bool Proto_RpcInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_RpcInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_RpcInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_RpcInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_RpcInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_RpcInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_RpcInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_RpcInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_RpcInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -658,6 +910,48 @@ NFrame::Proto_RedirectInfo Proto_RedirectInfo::ToPb() const
     return cc;
 }
 
+bool Proto_RedirectInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_RedirectInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_RedirectInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_RedirectInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_RedirectInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_RedirectInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_RedirectInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_RedirectInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_RedirectInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -773,6 +1067,48 @@ NFrame::Proto_FramePkg Proto_FramePkg::ToPb() const
     return cc;
 }
 
+bool Proto_FramePkg::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_FramePkg cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_FramePkg::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_FramePkg::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_FramePkg cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_FramePkg::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_FramePkg::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_FramePkg cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_FramePkg::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1018,6 +1354,48 @@ NFrame::ServerInfoReport ServerInfoReport::ToPb() const
     return cc;
 }
 
+bool ServerInfoReport::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::ServerInfoReport cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ServerInfoReport::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ServerInfoReport::ParseFrom(NFWireReader& reader)
+{
+    NFrame::ServerInfoReport cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ServerInfoReport::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ServerInfoReport::MergeFrom(NFWireReader& reader)
+{
+    NFrame::ServerInfoReport cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ServerInfoReport::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1157,6 +1535,48 @@ NFrame::ServerInfoReportList ServerInfoReportList::ToPb() const
     return cc;
 }
 
+bool ServerInfoReportList::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::ServerInfoReportList cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ServerInfoReportList::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ServerInfoReportList::ParseFrom(NFWireReader& reader)
+{
+    NFrame::ServerInfoReportList cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ServerInfoReportList::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ServerInfoReportList::MergeFrom(NFWireReader& reader)
+{
+    NFrame::ServerInfoReportList cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ServerInfoReportList::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1239,6 +1659,48 @@ NFrame::ServerInfoReportListRespne ServerInfoReportListRespne::ToPb() const
     return cc;
 }
 
+bool ServerInfoReportListRespne::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::ServerInfoReportListRespne cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ServerInfoReportListRespne::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ServerInfoReportListRespne::ParseFrom(NFWireReader& reader)
+{
+    NFrame::ServerInfoReportListRespne cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ServerInfoReportListRespne::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ServerInfoReportListRespne::MergeFrom(NFWireReader& reader)
+{
+    NFrame::ServerInfoReportListRespne cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ServerInfoReportListRespne::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1317,6 +1779,48 @@ NFrame::ZkServerInfo ZkServerInfo::ToPb() const
     return cc;
 }
 
+bool ZkServerInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::ZkServerInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int ZkServerInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool ZkServerInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::ZkServerInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool ZkServerInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool ZkServerInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::ZkServerInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string ZkServerInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1398,6 +1902,48 @@ NFrame::DynLibFileInfo DynLibFileInfo::ToPb() const
     return cc;
 }
 
+bool DynLibFileInfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::DynLibFileInfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int DynLibFileInfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool DynLibFileInfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::DynLibFileInfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool DynLibFileInfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool DynLibFileInfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::DynLibFileInfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string DynLibFileInfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1490,6 +2036,48 @@ NFrame::DynLibFileInfoArray DynLibFileInfoArray::ToPb() const
     return cc;
 }
 
+bool DynLibFileInfoArray::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::DynLibFileInfoArray cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int DynLibFileInfoArray::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool DynLibFileInfoArray::ParseFrom(NFWireReader& reader)
+{
+    NFrame::DynLibFileInfoArray cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool DynLibFileInfoArray::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool DynLibFileInfoArray::MergeFrom(NFWireReader& reader)
+{
+    NFrame::DynLibFileInfoArray cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string DynLibFileInfoArray::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1567,6 +2155,48 @@ NFrame::Proto_KillAllServerNtf Proto_KillAllServerNtf::ToPb() const
     return cc;
 }
 
+bool Proto_KillAllServerNtf::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_KillAllServerNtf cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_KillAllServerNtf::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_KillAllServerNtf::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_KillAllServerNtf cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_KillAllServerNtf::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_KillAllServerNtf::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_KillAllServerNtf cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_KillAllServerNtf::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1643,6 +2273,48 @@ NFrame::Proto_KillAllServerRsp Proto_KillAllServerRsp::ToPb() const
     return cc;
 }
 
+bool Proto_KillAllServerRsp::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_KillAllServerRsp cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_KillAllServerRsp::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_KillAllServerRsp::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_KillAllServerRsp cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_KillAllServerRsp::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_KillAllServerRsp::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_KillAllServerRsp cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_KillAllServerRsp::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1735,6 +2407,48 @@ NFrame::Proto_STSBroadPlayerMsgNotify Proto_STSBroadPlayerMsgNotify::ToPb() cons
     return cc;
 }
 
+bool Proto_STSBroadPlayerMsgNotify::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_STSBroadPlayerMsgNotify cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_STSBroadPlayerMsgNotify::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_STSBroadPlayerMsgNotify::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_STSBroadPlayerMsgNotify cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_STSBroadPlayerMsgNotify::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_STSBroadPlayerMsgNotify::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_STSBroadPlayerMsgNotify cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_STSBroadPlayerMsgNotify::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1827,6 +2541,48 @@ NFrame::Proto_STWebMsgRspNotify Proto_STWebMsgRspNotify::ToPb() const
     return cc;
 }
 
+bool Proto_STWebMsgRspNotify::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_STWebMsgRspNotify cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_STWebMsgRspNotify::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_STWebMsgRspNotify::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_STWebMsgRspNotify cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_STWebMsgRspNotify::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_STWebMsgRspNotify::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_STWebMsgRspNotify cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_STWebMsgRspNotify::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1926,6 +2682,48 @@ NFrame::NFEventNoneData NFEventNoneData::ToPb() const
     return cc;
 }
 
+bool NFEventNoneData::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::NFEventNoneData cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int NFEventNoneData::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool NFEventNoneData::ParseFrom(NFWireReader& reader)
+{
+    NFrame::NFEventNoneData cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool NFEventNoneData::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool NFEventNoneData::MergeFrom(NFWireReader& reader)
+{
+    NFrame::NFEventNoneData cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string NFEventNoneData::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2008,6 +2806,48 @@ NFrame::NFEventScriptData NFEventScriptData::ToPb() const
     return cc;
 }
 
+bool NFEventScriptData::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::NFEventScriptData cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int NFEventScriptData::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool NFEventScriptData::ParseFrom(NFWireReader& reader)
+{
+    NFrame::NFEventScriptData cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool NFEventScriptData::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool NFEventScriptData::MergeFrom(NFWireReader& reader)
+{
+    NFrame::NFEventScriptData cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string NFEventScriptData::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2089,6 +2929,48 @@ NFrame::Proto_ServerDumpInfoNtf Proto_ServerDumpInfoNtf::ToPb() const
     return cc;
 }
 
+bool Proto_ServerDumpInfoNtf::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::Proto_ServerDumpInfoNtf cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int Proto_ServerDumpInfoNtf::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool Proto_ServerDumpInfoNtf::ParseFrom(NFWireReader& reader)
+{
+    NFrame::Proto_ServerDumpInfoNtf cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool Proto_ServerDumpInfoNtf::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool Proto_ServerDumpInfoNtf::MergeFrom(NFWireReader& reader)
+{
+    NFrame::Proto_ServerDumpInfoNtf cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string Proto_ServerDumpInfoNtf::ShortDebugString() const
 {
     std::stringstream ss;
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include <pb.h>
 
 #include "FrameMsg.pb.h"
@@ -178,6 +179,11 @@ struct Proto_KillAllServerNtf {
     bool FromPb(const NFrame::Proto_KillAllServerNtf& cc);
     void ToPb(NFrame::Proto_KillAllServerNtf* cc) const;
     NFrame::Proto_KillAllServerNtf ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_KillAllServerNtf) */
@@ -198,6 +204,11 @@ struct DynLibFileInfo {
     bool FromPb(const NFrame::DynLibFileInfo& cc);
     void ToPb(NFrame::DynLibFileInfo* cc) const;
     NFrame::DynLibFileInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:DynLibFileInfo) */
@@ -221,6 +232,11 @@ struct NFEventNoneData {
     bool FromPb(const NFrame::NFEventNoneData& cc);
     void ToPb(NFrame::NFEventNoneData* cc) const;
     NFrame::NFEventNoneData ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:NFEventNoneData) */
@@ -241,6 +257,11 @@ struct NFEventScriptData {
     bool FromPb(const NFrame::NFEventScriptData& cc);
     void ToPb(NFrame::NFEventScriptData* cc) const;
     NFrame::NFEventScriptData ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:NFEventScriptData) */
@@ -264,6 +285,11 @@ struct Proto_DispInfo {
     bool FromPb(const NFrame::Proto_DispInfo& cc);
     void ToPb(NFrame::Proto_DispInfo* cc) const;
     NFrame::Proto_DispInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_DispInfo) */
@@ -287,6 +313,11 @@ struct Proto_EventInfo {
     bool FromPb(const NFrame::Proto_EventInfo& cc);
     void ToPb(NFrame::Proto_EventInfo* cc) const;
     NFrame::Proto_EventInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_EventInfo) */
@@ -306,6 +337,11 @@ struct Proto_KillAllServerRsp {
     bool FromPb(const NFrame::Proto_KillAllServerRsp& cc);
     void ToPb(NFrame::Proto_KillAllServerRsp* cc) const;
     NFrame::Proto_KillAllServerRsp ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_KillAllServerRsp) */
@@ -326,6 +362,11 @@ struct Proto_RedirectInfo {
     bool FromPb(const NFrame::Proto_RedirectInfo& cc);
     void ToPb(NFrame::Proto_RedirectInfo* cc) const;
     NFrame::Proto_RedirectInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_RedirectInfo) */
@@ -352,6 +393,11 @@ struct Proto_RpcInfo {
     bool FromPb(const NFrame::Proto_RpcInfo& cc);
     void ToPb(NFrame::Proto_RpcInfo* cc) const;
     NFrame::Proto_RpcInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_RpcInfo) */
@@ -373,6 +419,11 @@ struct Proto_STSBroadPlayerMsgNotify {
     bool FromPb(const NFrame::Proto_STSBroadPlayerMsgNotify& cc);
     void ToPb(NFrame::Proto_STSBroadPlayerMsgNotify* cc) const;
     NFrame::Proto_STSBroadPlayerMsgNotify ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_STSBroadPlayerMsgNotify) */
@@ -394,6 +445,11 @@ struct Proto_STWebMsgRspNotify {
     bool FromPb(const NFrame::Proto_STWebMsgRspNotify& cc);
     void ToPb(NFrame::Proto_STWebMsgRspNotify* cc) const;
     NFrame::Proto_STWebMsgRspNotify ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_STWebMsgRspNotify) */
@@ -415,6 +471,11 @@ struct Proto_ScriptRpcResult {
     bool FromPb(const NFrame::Proto_ScriptRpcResult& cc);
     void ToPb(NFrame::Proto_ScriptRpcResult* cc) const;
     NFrame::Proto_ScriptRpcResult ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_ScriptRpcResult) */
@@ -435,6 +496,11 @@ struct Proto_ServerDumpInfoNtf {
     bool FromPb(const NFrame::Proto_ServerDumpInfoNtf& cc);
     void ToPb(NFrame::Proto_ServerDumpInfoNtf* cc) const;
     NFrame::Proto_ServerDumpInfoNtf ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_ServerDumpInfoNtf) */
@@ -455,6 +521,11 @@ struct Proto_StoreInfo {
     bool FromPb(const NFrame::Proto_StoreInfo& cc);
     void ToPb(NFrame::Proto_StoreInfo* cc) const;
     NFrame::Proto_StoreInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_StoreInfo) */
@@ -475,6 +546,11 @@ struct Proto_TransInfo {
     bool FromPb(const NFrame::Proto_TransInfo& cc);
     void ToPb(NFrame::Proto_TransInfo* cc) const;
     NFrame::Proto_TransInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_TransInfo) */
@@ -527,6 +603,11 @@ struct ServerInfoReport {
     bool FromPb(const NFrame::ServerInfoReport& cc);
     void ToPb(NFrame::ServerInfoReport* cc) const;
     NFrame::ServerInfoReport ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ServerInfoReport) */
@@ -546,6 +627,11 @@ struct ServerInfoReportListRespne {
     bool FromPb(const NFrame::ServerInfoReportListRespne& cc);
     void ToPb(NFrame::ServerInfoReportListRespne* cc) const;
     NFrame::ServerInfoReportListRespne ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ServerInfoReportListRespne) */
@@ -566,6 +652,11 @@ struct ZkServerInfo {
     bool FromPb(const NFrame::ZkServerInfo& cc);
     void ToPb(NFrame::ZkServerInfo* cc) const;
     NFrame::ZkServerInfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ZkServerInfo) */
@@ -585,6 +676,11 @@ struct DynLibFileInfoArray {
     bool FromPb(const NFrame::DynLibFileInfoArray& cc);
     void ToPb(NFrame::DynLibFileInfoArray* cc) const;
     NFrame::DynLibFileInfoArray ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:DynLibFileInfoArray) */
@@ -612,6 +708,11 @@ struct Proto_FramePkg {
     bool FromPb(const NFrame::Proto_FramePkg& cc);
     void ToPb(NFrame::Proto_FramePkg* cc) const;
     NFrame::Proto_FramePkg ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:Proto_FramePkg) */
@@ -631,6 +732,11 @@ struct ServerInfoReportList {
     bool FromPb(const NFrame::ServerInfoReportList& cc);
     void ToPb(NFrame::ServerInfoReportList* cc) const;
     NFrame::ServerInfoReportList ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:ServerInfoReportList) */
@@ -94,6 +94,48 @@ NFrame::storesvr_vk storesvr_vk::ToPb() const
     return cc;
 }
 
+bool storesvr_vk::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_vk cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_vk::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_vk::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_vk cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_vk::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_vk::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_vk cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_vk::ShortDebugString() const
 {
     std::stringstream ss;
@@ -209,6 +251,48 @@ NFrame::storesvr_wherecond storesvr_wherecond::ToPb() const
     return cc;
 }
 
+bool storesvr_wherecond::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_wherecond cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_wherecond::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_wherecond::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_wherecond cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_wherecond::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_wherecond::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_wherecond cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_wherecond::ShortDebugString() const
 {
     std::stringstream ss;
@@ -323,6 +407,48 @@ NFrame::storesvr_baseinfo storesvr_baseinfo::ToPb() const
     return cc;
 }
 
+bool storesvr_baseinfo::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_baseinfo cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_baseinfo::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_baseinfo::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_baseinfo cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_baseinfo::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_baseinfo::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_baseinfo cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_baseinfo::ShortDebugString() const
 {
     std::stringstream ss;
@@ -418,6 +544,48 @@ NFrame::storesvr_opres storesvr_opres::ToPb() const
     return cc;
 }
 
+bool storesvr_opres::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_opres cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_opres::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_opres::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_opres cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_opres::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_opres::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_opres cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_opres::ShortDebugString() const
 {
     std::stringstream ss;
@@ -500,6 +668,48 @@ NFrame::storesvr_sel storesvr_sel::ToPb() const
     return cc;
 }
 
+bool storesvr_sel::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_sel cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_sel::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_sel::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_sel cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_sel::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_sel::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_sel cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_sel::ShortDebugString() const
 {
     std::stringstream ss;
@@ -603,6 +813,48 @@ NFrame::storesvr_sel_res storesvr_sel_res::ToPb() const
     return cc;
 }
 
+bool storesvr_sel_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_sel_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_sel_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_sel_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_sel_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_sel_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_sel_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_sel_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_sel_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -697,6 +949,48 @@ NFrame::storesvr_selobj storesvr_selobj::ToPb() const
     return cc;
 }
 
+bool storesvr_selobj::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_selobj cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_selobj::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_selobj::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_selobj cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_selobj::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_selobj::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_selobj cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_selobj::ShortDebugString() const
 {
     std::stringstream ss;
@@ -782,6 +1076,48 @@ NFrame::storesvr_selobj_res storesvr_selobj_res::ToPb() const
     return cc;
 }
 
+bool storesvr_selobj_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_selobj_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_selobj_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_selobj_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_selobj_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_selobj_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_selobj_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_selobj_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_selobj_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -868,6 +1204,48 @@ NFrame::storesvr_insertobj storesvr_insertobj::ToPb() const
     return cc;
 }
 
+bool storesvr_insertobj::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_insertobj cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_insertobj::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_insertobj::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insertobj cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_insertobj::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_insertobj::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insertobj cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_insertobj::ShortDebugString() const
 {
     std::stringstream ss;
@@ -950,6 +1328,48 @@ NFrame::storesvr_insertobj_res storesvr_insertobj_res::ToPb() const
     return cc;
 }
 
+bool storesvr_insertobj_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_insertobj_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_insertobj_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_insertobj_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insertobj_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_insertobj_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_insertobj_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insertobj_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_insertobj_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1044,6 +1464,48 @@ NFrame::storesvr_insert storesvr_insert::ToPb() const
     return cc;
 }
 
+bool storesvr_insert::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_insert cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_insert::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_insert::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insert cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_insert::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_insert::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insert cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_insert::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1132,6 +1594,48 @@ NFrame::storesvr_insert_res storesvr_insert_res::ToPb() const
     return cc;
 }
 
+bool storesvr_insert_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_insert_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_insert_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_insert_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insert_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_insert_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_insert_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_insert_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_insert_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1213,11 +1717,53 @@ NFrame::storesvr_del storesvr_del::ToPb() const
     return cc;
 }
 
-std::string storesvr_del::ShortDebugString() const
+bool storesvr_del::SerializeTo(NFWireWriter& writer) const
 {
-    std::stringstream ss;
-    ss << "{";
-    ss << "baseinfo:" << baseinfo.ShortDebugString() << ", ";
+    NFrame::storesvr_del cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_del::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_del::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_del cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_del::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_del::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_del cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+std::string storesvr_del::ShortDebugString() const
+{
+    std::stringstream ss;
+    ss << "{";
+    ss << "baseinfo:" << baseinfo.ShortDebugString() << ", ";
     ss << "cond:" << cond.ShortDebugString();
     ss << "}";
     return ss.str();
@@ -1294,6 +1840,48 @@ NFrame::storesvr_del_res storesvr_del_res::ToPb() const
     return cc;
 }
 
+bool storesvr_del_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_del_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_del_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_del_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_del_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_del_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_del_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_del_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_del_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1379,6 +1967,48 @@ NFrame::storesvr_delobj storesvr_delobj::ToPb() const
     return cc;
 }
 
+bool storesvr_delobj::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_delobj cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_delobj::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_delobj::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_delobj cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_delobj::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_delobj::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_delobj cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_delobj::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1461,6 +2091,48 @@ NFrame::storesvr_delobj_res storesvr_delobj_res::ToPb() const
     return cc;
 }
 
+bool storesvr_delobj_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_delobj_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_delobj_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_delobj_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_delobj_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_delobj_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_delobj_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_delobj_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_delobj_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1545,6 +2217,48 @@ NFrame::storesvr_mod storesvr_mod::ToPb() const
     return cc;
 }
 
+bool storesvr_mod::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_mod cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_mod::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_mod::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_mod cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_mod::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_mod::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_mod cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_mod::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1627,6 +2341,48 @@ NFrame::storesvr_mod_res storesvr_mod_res::ToPb() const
     return cc;
 }
 
+bool storesvr_mod_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_mod_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_mod_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_mod_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_mod_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_mod_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_mod_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_mod_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_mod_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1712,6 +2468,48 @@ NFrame::storesvr_modobj storesvr_modobj::ToPb() const
     return cc;
 }
 
+bool storesvr_modobj::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_modobj cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_modobj::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_modobj::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_modobj cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_modobj::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_modobj::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_modobj cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_modobj::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1794,6 +2592,48 @@ NFrame::storesvr_modobj_res storesvr_modobj_res::ToPb() const
     return cc;
 }
 
+bool storesvr_modobj_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_modobj_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_modobj_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_modobj_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_modobj_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_modobj_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_modobj_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_modobj_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_modobj_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1878,6 +2718,48 @@ NFrame::storesvr_update storesvr_update::ToPb() const
     return cc;
 }
 
+bool storesvr_update::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_update cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_update::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_update::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_update cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_update::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_update::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_update cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_update::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1960,6 +2842,48 @@ NFrame::storesvr_update_res storesvr_update_res::ToPb() const
     return cc;
 }
 
+bool storesvr_update_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_update_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_update_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_update_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_update_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_update_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_update_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_update_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_update_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2045,6 +2969,48 @@ NFrame::storesvr_updateobj storesvr_updateobj::ToPb() const
     return cc;
 }
 
+bool storesvr_updateobj::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_updateobj cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_updateobj::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_updateobj::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_updateobj cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_updateobj::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_updateobj::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_updateobj cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_updateobj::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2127,6 +3093,48 @@ NFrame::storesvr_updateobj_res storesvr_updateobj_res::ToPb() const
     return cc;
 }
 
+bool storesvr_updateobj_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_updateobj_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_updateobj_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_updateobj_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_updateobj_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_updateobj_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_updateobj_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_updateobj_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_updateobj_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2212,6 +3220,48 @@ NFrame::storesvr_execute storesvr_execute::ToPb() const
     return cc;
 }
 
+bool storesvr_execute::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_execute cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_execute::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_execute::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_execute::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_execute::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_execute::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2297,6 +3347,48 @@ NFrame::storesvr_execute_res storesvr_execute_res::ToPb() const
     return cc;
 }
 
+bool storesvr_execute_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_execute_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_execute_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_execute_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_execute_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_execute_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_execute_res::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2383,6 +3475,48 @@ NFrame::storesvr_execute_more storesvr_execute_more::ToPb() const
     return cc;
 }
 
+bool storesvr_execute_more::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_execute_more cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_execute_more::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_execute_more::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute_more cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_execute_more::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_execute_more::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute_more cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_execute_more::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2487,6 +3621,48 @@ NFrame::storesvr_execute_more_res storesvr_execute_more_res::ToPb() const
     return cc;
 }
 
+bool storesvr_execute_more_res::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::storesvr_execute_more_res cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int storesvr_execute_more_res::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool storesvr_execute_more_res::ParseFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute_more_res cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool storesvr_execute_more_res::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool storesvr_execute_more_res::MergeFrom(NFWireReader& reader)
+{
+    NFrame::storesvr_execute_more_res cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string storesvr_execute_more_res::ShortDebugString() const
 {
     std::stringstream ss;
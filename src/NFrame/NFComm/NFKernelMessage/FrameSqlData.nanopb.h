@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include <pb.h>
 
 #include "FrameSqlData.pb.h"
@@ -79,6 +80,11 @@ struct storesvr_baseinfo {
     bool FromPb(const NFrame::storesvr_baseinfo& cc);
     void ToPb(NFrame::storesvr_baseinfo* cc) const;
     NFrame::storesvr_baseinfo ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_baseinfo) */
@@ -100,6 +106,11 @@ struct storesvr_opres {
     bool FromPb(const NFrame::storesvr_opres& cc);
     void ToPb(NFrame::storesvr_opres* cc) const;
     NFrame::storesvr_opres ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_opres) */
@@ -123,6 +134,11 @@ struct storesvr_vk {
     bool FromPb(const NFrame::storesvr_vk& cc);
     void ToPb(NFrame::storesvr_vk* cc) const;
     NFrame::storesvr_vk ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_vk) */
@@ -143,6 +159,11 @@ struct storesvr_del_res {
     bool FromPb(const NFrame::storesvr_del_res& cc);
     void ToPb(NFrame::storesvr_del_res* cc) const;
     NFrame::storesvr_del_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_del_res) */
@@ -164,6 +185,11 @@ struct storesvr_delobj {
     bool FromPb(const NFrame::storesvr_delobj& cc);
     void ToPb(NFrame::storesvr_delobj* cc) const;
     NFrame::storesvr_delobj ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_delobj) */
@@ -184,6 +210,11 @@ struct storesvr_delobj_res {
     bool FromPb(const NFrame::storesvr_delobj_res& cc);
     void ToPb(NFrame::storesvr_delobj_res* cc) const;
     NFrame::storesvr_delobj_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_delobj_res) */
@@ -205,6 +236,11 @@ struct storesvr_execute {
     bool FromPb(const NFrame::storesvr_execute& cc);
     void ToPb(NFrame::storesvr_execute* cc) const;
     NFrame::storesvr_execute ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_execute) */
@@ -226,6 +262,11 @@ struct storesvr_execute_more {
     bool FromPb(const NFrame::storesvr_execute_more& cc);
     void ToPb(NFrame::storesvr_execute_more* cc) const;
     NFrame::storesvr_execute_more ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_execute_more) */
@@ -249,6 +290,11 @@ struct storesvr_execute_more_res {
     bool FromPb(const NFrame::storesvr_execute_more_res& cc);
     void ToPb(NFrame::storesvr_execute_more_res* cc) const;
     NFrame::storesvr_execute_more_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_execute_more_res) */
@@ -270,6 +316,11 @@ struct storesvr_execute_res {
     bool FromPb(const NFrame::storesvr_execute_res& cc);
     void ToPb(NFrame::storesvr_execute_res* cc) const;
     NFrame::storesvr_execute_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_execute_res) */
@@ -291,6 +342,11 @@ struct storesvr_insert {
     bool FromPb(const NFrame::storesvr_insert& cc);
     void ToPb(NFrame::storesvr_insert* cc) const;
     NFrame::storesvr_insert ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_insert) */
@@ -311,6 +367,11 @@ struct storesvr_insert_res {
     bool FromPb(const NFrame::storesvr_insert_res& cc);
     void ToPb(NFrame::storesvr_insert_res* cc) const;
     NFrame::storesvr_insert_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_insert_res) */
@@ -332,6 +393,11 @@ struct storesvr_insertobj {
     bool FromPb(const NFrame::storesvr_insertobj& cc);
     void ToPb(NFrame::storesvr_insertobj* cc) const;
     NFrame::storesvr_insertobj ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_insertobj) */
@@ -352,6 +418,11 @@ struct storesvr_insertobj_res {
     bool FromPb(const NFrame::storesvr_insertobj_res& cc);
     void ToPb(NFrame::storesvr_insertobj_res* cc) const;
     NFrame::storesvr_insertobj_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_insertobj_res) */
@@ -372,6 +443,11 @@ struct storesvr_mod_res {
     bool FromPb(const NFrame::storesvr_mod_res& cc);
     void ToPb(NFrame::storesvr_mod_res* cc) const;
     NFrame::storesvr_mod_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_mod_res) */
@@ -393,6 +469,11 @@ struct storesvr_modobj {
     bool FromPb(const NFrame::storesvr_modobj& cc);
     void ToPb(NFrame::storesvr_modobj* cc) const;
     NFrame::storesvr_modobj ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_modobj) */
@@ -413,6 +494,11 @@ struct storesvr_modobj_res {
     bool FromPb(const NFrame::storesvr_modobj_res& cc);
     void ToPb(NFrame::storesvr_modobj_res* cc) const;
     NFrame::storesvr_modobj_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_modobj_res) */
@@ -436,6 +522,11 @@ struct storesvr_sel_res {
     bool FromPb(const NFrame::storesvr_sel_res& cc);
     void ToPb(NFrame::storesvr_sel_res* cc) const;
     NFrame::storesvr_sel_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_sel_res) */
@@ -457,6 +548,11 @@ struct storesvr_selobj {
     bool FromPb(const NFrame::storesvr_selobj& cc);
     void ToPb(NFrame::storesvr_selobj* cc) const;
     NFrame::storesvr_selobj ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_selobj) */
@@ -478,6 +574,11 @@ struct storesvr_selobj_res {
     bool FromPb(const NFrame::storesvr_selobj_res& cc);
     void ToPb(NFrame::storesvr_selobj_res* cc) const;
     NFrame::storesvr_selobj_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_selobj_res) */
@@ -498,6 +599,11 @@ struct storesvr_update_res {
     bool FromPb(const NFrame::storesvr_update_res& cc);
     void ToPb(NFrame::storesvr_update_res* cc) const;
     NFrame::storesvr_update_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_update_res) */
@@ -519,6 +625,11 @@ struct storesvr_updateobj {
     bool FromPb(const NFrame::storesvr_updateobj& cc);
     void ToPb(NFrame::storesvr_updateobj* cc) const;
     NFrame::storesvr_updateobj ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_updateobj) */
@@ -539,6 +650,11 @@ struct storesvr_updateobj_res {
     bool FromPb(const NFrame::storesvr_updateobj_res& cc);
     void ToPb(NFrame::storesvr_updateobj_res* cc) const;
     NFrame::storesvr_updateobj_res ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_updateobj_res) */
@@ -561,6 +677,11 @@ struct storesvr_wherecond {
     bool FromPb(const NFrame::storesvr_wherecond& cc);
     void ToPb(NFrame::storesvr_wherecond* cc) const;
     NFrame::storesvr_wherecond ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_wherecond) */
@@ -581,6 +702,11 @@ struct storesvr_del {
     bool FromPb(const NFrame::storesvr_del& cc);
     void ToPb(NFrame::storesvr_del* cc) const;
     NFrame::storesvr_del ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_del) */
@@ -602,6 +728,11 @@ struct storesvr_mod {
     bool FromPb(const NFrame::storesvr_mod& cc);
     void ToPb(NFrame::storesvr_mod* cc) const;
     NFrame::storesvr_mod ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_mod) */
@@ -622,6 +753,11 @@ struct storesvr_sel {
     bool FromPb(const NFrame::storesvr_sel& cc);
     void ToPb(NFrame::storesvr_sel* cc) const;
     NFrame::storesvr_sel ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_sel) */
@@ -643,6 +779,11 @@ struct storesvr_update {
     bool FromPb(const NFrame::storesvr_update& cc);
     void ToPb(NFrame::storesvr_update* cc) const;
     NFrame::storesvr_update ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:storesvr_update) */
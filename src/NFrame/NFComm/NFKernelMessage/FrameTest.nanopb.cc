@@ -135,6 +135,48 @@ NFrame::wxWorkRobotTextMore wxWorkRobotTextMore::ToPb() const
     return cc;
 }
 
+bool wxWorkRobotTextMore::SerializeTo(NFWireWriter& writer) const
+{
+    NFrame::wxWorkRobotTextMore cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int wxWorkRobotTextMore::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool wxWorkRobotTextMore::ParseFrom(NFWireReader& reader)
+{
+    NFrame::wxWorkRobotTextMore cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool wxWorkRobotTextMore::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool wxWorkRobotTextMore::MergeFrom(NFWireReader& reader)
+{
+    NFrame::wxWorkRobotTextMore cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string wxWorkRobotTextMore::ShortDebugString() const
 {
     std::stringstream ss;
@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include "NFComm/NFShmStl/NFShmHashMap.h"
 #include "NFComm/NFShmStl/NFShmHashMultiMap.h"
 #include "NFComm/NFShmStl/NFShmHashMapWithList.h"
@@ -43,6 +44,11 @@ struct wxWorkRobotTextMore {
     bool FromPb(const NFrame::wxWorkRobotTextMore& cc);
     void ToPb(NFrame::wxWorkRobotTextMore* cc) const;
     NFrame::wxWorkRobotTextMore ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:wxWorkRobotTextMore) */
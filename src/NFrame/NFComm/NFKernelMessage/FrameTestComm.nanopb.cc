@@ -490,6 +490,528 @@ NFrameComm::wxWorkRobotTextTest wxWorkRobotTextTest::ToPb() const
     return cc;
 }
 
+bool wxWorkRobotTextTest::SerializeTo(NFWireWriter& writer) const
+{
+    if (!test_string.empty())
+    {
+        writer.WriteBytes(1, test_string.data(), test_string.length());
+    }
+    if (!test_string_stl.empty())
+    {
+        writer.WriteBytes(2, test_string_stl.data(), test_string_stl.length());
+    }
+    for (auto iter = test_string_repeated.begin(); iter != test_string_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(3, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_repeated.begin(); iter != test_string_stl_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(4, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_vector.begin(); iter != test_string_stl_vector.end(); ++iter)
+    {
+        writer.WriteBytes(5, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_list.begin(); iter != test_string_stl_list.end(); ++iter)
+    {
+        writer.WriteBytes(6, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_unordered_set.begin(); iter != test_string_stl_unordered_set.end(); ++iter)
+    {
+        writer.WriteBytes(7, iter->data(), iter->length());
+    }
+    if (!test_int_vector.empty())
+    {
+        size_t start = writer.BeginLength(8);
+        for (auto iter = test_int_vector.begin(); iter != test_int_vector.end(); ++iter)
+        {
+            writer.WriteInt32NoTag(*iter);
+        }
+        writer.EndLength(start);
+    }
+    if (!test_int_list.empty())
+    {
+        size_t start = writer.BeginLength(9);
+        for (auto iter = test_int_list.begin(); iter != test_int_list.end(); ++iter)
+        {
+            writer.WriteInt32NoTag(*iter);
+        }
+        writer.EndLength(start);
+    }
+    if (!test_int_unordered_set.empty())
+    {
+        size_t start = writer.BeginLength(10);
+        for (auto iter = test_int_unordered_set.begin(); iter != test_int_unordered_set.end(); ++iter)
+        {
+            writer.WriteInt32NoTag(*iter);
+        }
+        writer.EndLength(start);
+    }
+    if (!test_bytes.empty())
+    {
+        writer.WriteBytes(11, test_bytes.data(), test_bytes.length());
+    }
+    if (!test_bytes_stl.empty())
+    {
+        writer.WriteBytes(12, test_bytes_stl.data(), test_bytes_stl.length());
+    }
+    for (auto iter = test_bytes_repeated.begin(); iter != test_bytes_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(13, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_repeated.begin(); iter != test_bytes_stl_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(14, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_vector.begin(); iter != test_bytes_stl_vector.end(); ++iter)
+    {
+        writer.WriteBytes(15, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_list.begin(); iter != test_bytes_stl_list.end(); ++iter)
+    {
+        writer.WriteBytes(16, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_unordered_set.begin(); iter != test_bytes_stl_unordered_set.end(); ++iter)
+    {
+        writer.WriteBytes(17, iter->data(), iter->length());
+    }
+    if (id != 0)
+    {
+        writer.WriteUInt32(100, id);
+    }
+    return !writer.IsOverflow();
+}
+
+int wxWorkRobotTextTest::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool wxWorkRobotTextTest::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrameComm::wxWorkRobotTextTest::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool wxWorkRobotTextTest::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool wxWorkRobotTextTest::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string, cur length:%d, max length:67", static_cast<int>(length));
+                        return false;
+                    }
+                    test_string.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl, cur length:%d, max length:67", static_cast<int>(length));
+                        return false;
+                    }
+                    test_string_stl.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_repeated.size() >= test_string_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_repeated, cur count:%d, max count:%d", static_cast<int>(test_string_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_string_repeated.emplace_back();
+                    test_string_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_repeated.size() >= test_string_stl_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_repeated, cur count:%d, max count:%d", static_cast<int>(test_string_stl_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_string_stl_repeated.emplace_back();
+                    test_string_stl_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_vector.size() >= test_string_stl_vector.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_vector, cur count:%d, max count:%d", static_cast<int>(test_string_stl_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_vector, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_string_stl_vector.emplace_back();
+                    test_string_stl_vector.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 6:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_list.size() >= test_string_stl_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_list, cur count:%d, max count:%d", static_cast<int>(test_string_stl_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_list, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_string_stl_list.push_back(temp);
+                    continue;
+                }
+                break;
+            case 7:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_unordered_set.size() >= test_string_stl_unordered_set.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_string_stl_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_string_stl_unordered_set, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_string_stl_unordered_set.insert(temp);
+                    continue;
+                }
+                break;
+            case 8:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    while (!sub.IsEnd())
+                    {
+                        if (test_int_vector.size() >= test_int_vector.max_size())
+                        {
+                            if (NULL != g_nanopb_frompb_log_handle)
+                                g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_int_vector, cur count:%d, max count:%d", static_cast<int>(test_int_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                            return false;
+                        }
+                        test_int_vector.push_back(static_cast<int32_t>(sub.ReadInt32()));
+                    }
+                    if (sub.IsError()) return false;
+                    continue;
+                }
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    if (test_int_vector.size() >= test_int_vector.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_int_vector, cur count:%d, max count:%d", static_cast<int>(test_int_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    test_int_vector.push_back(static_cast<int32_t>(reader.ReadInt32()));
+                    continue;
+                }
+                break;
+            case 9:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    while (!sub.IsEnd())
+                    {
+                        if (test_int_list.size() >= test_int_list.max_size())
+                        {
+                            if (NULL != g_nanopb_frompb_log_handle)
+                                g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_int_list, cur count:%d, max count:%d", static_cast<int>(test_int_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                            return false;
+                        }
+                        test_int_list.push_back(static_cast<int32_t>(sub.ReadInt32()));
+                    }
+                    if (sub.IsError()) return false;
+                    continue;
+                }
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    if (test_int_list.size() >= test_int_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_int_list, cur count:%d, max count:%d", static_cast<int>(test_int_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    test_int_list.push_back(static_cast<int32_t>(reader.ReadInt32()));
+                    continue;
+                }
+                break;
+            case 10:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    while (!sub.IsEnd())
+                    {
+                        if (test_int_unordered_set.size() >= test_int_unordered_set.max_size())
+                        {
+                            if (NULL != g_nanopb_frompb_log_handle)
+                                g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_int_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_int_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                            return false;
+                        }
+                        test_int_unordered_set.insert(static_cast<int32_t>(sub.ReadInt32()));
+                    }
+                    if (sub.IsError()) return false;
+                    continue;
+                }
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    if (test_int_unordered_set.size() >= test_int_unordered_set.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_int_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_int_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    test_int_unordered_set.insert(static_cast<int32_t>(reader.ReadInt32()));
+                    continue;
+                }
+                break;
+            case 11:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes, cur length:%d, max length:67", static_cast<int>(length));
+                        return false;
+                    }
+                    test_bytes.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 12:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl, cur length:%d, max length:67", static_cast<int>(length));
+                        return false;
+                    }
+                    test_bytes_stl.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 13:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_repeated.size() >= test_bytes_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_repeated, cur count:%d, max count:%d", static_cast<int>(test_bytes_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_bytes_repeated.emplace_back();
+                    test_bytes_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 14:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_repeated.size() >= test_bytes_stl_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_repeated, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_bytes_stl_repeated.emplace_back();
+                    test_bytes_stl_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 15:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_vector.size() >= test_bytes_stl_vector.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_vector, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_vector, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_bytes_stl_vector.emplace_back();
+                    test_bytes_stl_vector.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 16:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_list.size() >= test_bytes_stl_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_list, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_list, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_bytes_stl_list.push_back(temp);
+                    continue;
+                }
+                break;
+            case 17:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_unordered_set.size() >= test_bytes_stl_unordered_set.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:wxWorkRobotTextTest, field:test_bytes_stl_unordered_set, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_bytes_stl_unordered_set.insert(temp);
+                    continue;
+                }
+                break;
+            case 100:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    id = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string wxWorkRobotTextTest::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1079,6 +1601,539 @@ NFrameComm::WelfareNodeDBDataPddBuy WelfareNodeDBDataPddBuy::ToPb() const
     return cc;
 }
 
+bool WelfareNodeDBDataPddBuy::SerializeTo(NFWireWriter& writer) const
+{
+    if (!test_string.empty())
+    {
+        writer.WriteBytes(1, test_string.data(), test_string.length());
+    }
+    if (!test_string_stl.empty())
+    {
+        writer.WriteBytes(2, test_string_stl.data(), test_string_stl.length());
+    }
+    for (auto iter = test_string_repeated.begin(); iter != test_string_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(3, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_repeated.begin(); iter != test_string_stl_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(4, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_vector.begin(); iter != test_string_stl_vector.end(); ++iter)
+    {
+        writer.WriteBytes(5, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_list.begin(); iter != test_string_stl_list.end(); ++iter)
+    {
+        writer.WriteBytes(6, iter->data(), iter->length());
+    }
+    for (auto iter = test_string_stl_unordered_set.begin(); iter != test_string_stl_unordered_set.end(); ++iter)
+    {
+        writer.WriteBytes(7, iter->data(), iter->length());
+    }
+    if (!test_int_vector.empty())
+    {
+        size_t start = writer.BeginLength(8);
+        for (auto iter = test_int_vector.begin(); iter != test_int_vector.end(); ++iter)
+        {
+            writer.WriteInt32NoTag(*iter);
+        }
+        writer.EndLength(start);
+    }
+    if (!test_int_list.empty())
+    {
+        size_t start = writer.BeginLength(9);
+        for (auto iter = test_int_list.begin(); iter != test_int_list.end(); ++iter)
+        {
+            writer.WriteInt32NoTag(*iter);
+        }
+        writer.EndLength(start);
+    }
+    if (!test_int_unordered_set.empty())
+    {
+        size_t start = writer.BeginLength(10);
+        for (auto iter = test_int_unordered_set.begin(); iter != test_int_unordered_set.end(); ++iter)
+        {
+            writer.WriteInt32NoTag(*iter);
+        }
+        writer.EndLength(start);
+    }
+    if (!test_bytes.empty())
+    {
+        writer.WriteBytes(11, test_bytes.data(), test_bytes.length());
+    }
+    if (!test_bytes_stl.empty())
+    {
+        writer.WriteBytes(12, test_bytes_stl.data(), test_bytes_stl.length());
+    }
+    for (auto iter = test_bytes_repeated.begin(); iter != test_bytes_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(13, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_repeated.begin(); iter != test_bytes_stl_repeated.end(); ++iter)
+    {
+        writer.WriteBytes(14, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_vector.begin(); iter != test_bytes_stl_vector.end(); ++iter)
+    {
+        writer.WriteBytes(15, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_list.begin(); iter != test_bytes_stl_list.end(); ++iter)
+    {
+        writer.WriteBytes(16, iter->data(), iter->length());
+    }
+    for (auto iter = test_bytes_stl_unordered_set.begin(); iter != test_bytes_stl_unordered_set.end(); ++iter)
+    {
+        writer.WriteBytes(17, iter->data(), iter->length());
+    }
+    if (m_dwBuyCount != 0)
+    {
+        writer.WriteUInt32(100, m_dwBuyCount);
+    }
+    if (m_dwLastBuyTime != 0)
+    {
+        writer.WriteUInt32(102, m_dwLastBuyTime);
+    }
+    return !writer.IsOverflow();
+}
+
+int WelfareNodeDBDataPddBuy::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool WelfareNodeDBDataPddBuy::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrameComm::WelfareNodeDBDataPddBuy::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool WelfareNodeDBDataPddBuy::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool WelfareNodeDBDataPddBuy::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string, cur length:%d, max length:67", static_cast<int>(length));
+                        return false;
+                    }
+                    test_string.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl, cur length:%d, max length:67", static_cast<int>(length));
+                        return false;
+                    }
+                    test_string_stl.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_repeated.size() >= test_string_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_repeated, cur count:%d, max count:%d", static_cast<int>(test_string_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_string_repeated.emplace_back();
+                    test_string_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_repeated.size() >= test_string_stl_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_repeated, cur count:%d, max count:%d", static_cast<int>(test_string_stl_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_string_stl_repeated.emplace_back();
+                    test_string_stl_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_vector.size() >= test_string_stl_vector.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_vector, cur count:%d, max count:%d", static_cast<int>(test_string_stl_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_vector, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_string_stl_vector.emplace_back();
+                    test_string_stl_vector.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 6:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_list.size() >= test_string_stl_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_list, cur count:%d, max count:%d", static_cast<int>(test_string_stl_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_list, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_string_stl_list.push_back(temp);
+                    continue;
+                }
+                break;
+            case 7:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_string_stl_unordered_set.size() >= test_string_stl_unordered_set.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_string_stl_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_string_stl_unordered_set, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_string_stl_unordered_set.insert(temp);
+                    continue;
+                }
+                break;
+            case 8:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    while (!sub.IsEnd())
+                    {
+                        if (test_int_vector.size() >= test_int_vector.max_size())
+                        {
+                            if (NULL != g_nanopb_frompb_log_handle)
+                                g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_int_vector, cur count:%d, max count:%d", static_cast<int>(test_int_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                            return false;
+                        }
+                        test_int_vector.push_back(static_cast<int32_t>(sub.ReadInt32()));
+                    }
+                    if (sub.IsError()) return false;
+                    continue;
+                }
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    if (test_int_vector.size() >= test_int_vector.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_int_vector, cur count:%d, max count:%d", static_cast<int>(test_int_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    test_int_vector.push_back(static_cast<int32_t>(reader.ReadInt32()));
+                    continue;
+                }
+                break;
+            case 9:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    while (!sub.IsEnd())
+                    {
+                        if (test_int_list.size() >= test_int_list.max_size())
+                        {
+                            if (NULL != g_nanopb_frompb_log_handle)
+                                g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_int_list, cur count:%d, max count:%d", static_cast<int>(test_int_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                            return false;
+                        }
+                        test_int_list.push_back(static_cast<int32_t>(sub.ReadInt32()));
+                    }
+                    if (sub.IsError()) return false;
+                    continue;
+                }
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    if (test_int_list.size() >= test_int_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_int_list, cur count:%d, max count:%d", static_cast<int>(test_int_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    test_int_list.push_back(static_cast<int32_t>(reader.ReadInt32()));
+                    continue;
+                }
+                break;
+            case 10:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    while (!sub.IsEnd())
+                    {
+                        if (test_int_unordered_set.size() >= test_int_unordered_set.max_size())
+                        {
+                            if (NULL != g_nanopb_frompb_log_handle)
+                                g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_int_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_int_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                            return false;
+                        }
+                        test_int_unordered_set.insert(static_cast<int32_t>(sub.ReadInt32()));
+                    }
+                    if (sub.IsError()) return false;
+                    continue;
+                }
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    if (test_int_unordered_set.size() >= test_int_unordered_set.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_int_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_int_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    test_int_unordered_set.insert(static_cast<int32_t>(reader.ReadInt32()));
+                    continue;
+                }
+                break;
+            case 11:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length > 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes, cur size:%d, max size:68", static_cast<int>(length));
+                        return false;
+                    }
+                    test_bytes.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 12:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length > 68)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl, cur size:%d, max size:68", static_cast<int>(length));
+                        return false;
+                    }
+                    test_bytes_stl.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 13:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_repeated.size() >= test_bytes_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_repeated, cur count:%d, max count:%d", static_cast<int>(test_bytes_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_bytes_repeated.emplace_back();
+                    test_bytes_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 14:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_repeated.size() >= test_bytes_stl_repeated.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_repeated, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_repeated.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_repeated, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_bytes_stl_repeated.emplace_back();
+                    test_bytes_stl_repeated.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 15:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_vector.size() >= test_bytes_stl_vector.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_vector, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_vector.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_vector, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    test_bytes_stl_vector.emplace_back();
+                    test_bytes_stl_vector.back().assign(pData, length);
+                    continue;
+                }
+                break;
+            case 16:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_list.size() >= test_bytes_stl_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_list, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_list.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_list, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_bytes_stl_list.push_back(temp);
+                    continue;
+                }
+                break;
+            case 17:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (test_bytes_stl_unordered_set.size() >= test_bytes_stl_unordered_set.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_unordered_set, cur count:%d, max count:%d", static_cast<int>(test_bytes_stl_unordered_set.size()), FRAME_ENUM_DEFAULT_REPEATED);
+                        return false;
+                    }
+                    if (length >= FRAME_ENUM_STRING_NUM)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:WelfareNodeDBDataPddBuy, field:test_bytes_stl_unordered_set, cur length:%d, max length:%d", static_cast<int>(length), FRAME_ENUM_STRING_NUM-1);
+                        return false;
+                    }
+                    NFShmString<FRAME_ENUM_STRING_NUM> temp;
+                    temp.assign(pData, length);
+                    test_bytes_stl_unordered_set.insert(temp);
+                    continue;
+                }
+                break;
+            case 100:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_dwBuyCount = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            case 102:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_dwLastBuyTime = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string WelfareNodeDBDataPddBuy::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1272,6 +2327,101 @@ NFrameComm::WelfareNodeDBDataPddOpen WelfareNodeDBDataPddOpen::ToPb() const
     return cc;
 }
 
+bool WelfareNodeDBDataPddOpen::SerializeTo(NFWireWriter& writer) const
+{
+    if (m_dwOpenCount != 0)
+    {
+        writer.WriteUInt32(1, m_dwOpenCount);
+    }
+    if (m_dwLastJoinTime != 0)
+    {
+        writer.WriteUInt32(2, m_dwLastJoinTime);
+    }
+    if (m_ullTeamID != 0)
+    {
+        writer.WriteUInt64(3, m_ullTeamID);
+    }
+    if (m_dwRwdCount != 0)
+    {
+        writer.WriteUInt32(4, m_dwRwdCount);
+    }
+    if (m_dwLastRwdTime != 0)
+    {
+        writer.WriteUInt32(5, m_dwLastRwdTime);
+    }
+    return !writer.IsOverflow();
+}
+
+int WelfareNodeDBDataPddOpen::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool WelfareNodeDBDataPddOpen::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrameComm::WelfareNodeDBDataPddOpen::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool WelfareNodeDBDataPddOpen::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool WelfareNodeDBDataPddOpen::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_dwOpenCount = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_dwLastJoinTime = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_ullTeamID = static_cast<uint64_t>(reader.ReadUInt64());
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_dwRwdCount = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_dwLastRwdTime = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string WelfareNodeDBDataPddOpen::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1353,6 +2503,57 @@ NFrameComm::WelfareNodeDBDataGetTaskManual WelfareNodeDBDataGetTaskManual::ToPb(
     return cc;
 }
 
+bool WelfareNodeDBDataGetTaskManual::SerializeTo(NFWireWriter& writer) const
+{
+    if (m_iState != 0)
+    {
+        writer.WriteInt32(1, m_iState);
+    }
+    return !writer.IsOverflow();
+}
+
+int WelfareNodeDBDataGetTaskManual::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool WelfareNodeDBDataGetTaskManual::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrameComm::WelfareNodeDBDataGetTaskManual::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool WelfareNodeDBDataGetTaskManual::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool WelfareNodeDBDataGetTaskManual::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    m_iState = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string WelfareNodeDBDataGetTaskManual::ShortDebugString() const
 {
     std::stringstream ss;
@@ -1643,6 +2844,48 @@ NFrameComm::WelfareNodeDBDataUnion WelfareNodeDBDataUnion::ToPb() const
     return cc;
 }
 
+bool WelfareNodeDBDataUnion::SerializeTo(NFWireWriter& writer) const
+{
+    NFrameComm::WelfareNodeDBDataUnion cc;
+    ToPb(&cc);
+    size_t length = cc.ByteSizeLong();
+    uint8_t* pBuf = writer.Reserve(length);
+    if (NULL == pBuf) return false;
+    cc.SerializeWithCachedSizesToArray(pBuf);
+    return true;
+}
+
+int WelfareNodeDBDataUnion::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool WelfareNodeDBDataUnion::ParseFrom(NFWireReader& reader)
+{
+    NFrameComm::WelfareNodeDBDataUnion cc;
+    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
+bool WelfareNodeDBDataUnion::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool WelfareNodeDBDataUnion::MergeFrom(NFWireReader& reader)
+{
+    NFrameComm::WelfareNodeDBDataUnion cc;
+    ToPb(&cc);
+    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));
+    if (!cc.MergePartialFromCodedStream(&input)) return false;
+    reader.SkipAll();
+    return FromPb(cc);
+}
+
 std::string WelfareNodeDBDataUnion::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2126,6 +3369,68 @@ NFrameComm::BevLogTestItem BevLogTestItem::ToPb() const
     return cc;
 }
 
+bool BevLogTestItem::SerializeTo(NFWireWriter& writer) const
+{
+    if (item_id != 0)
+    {
+        writer.WriteUInt32(1, item_id);
+    }
+    if (item_num != 0)
+    {
+        writer.WriteUInt32(2, item_num);
+    }
+    return !writer.IsOverflow();
+}
+
+int BevLogTestItem::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool BevLogTestItem::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrameComm::BevLogTestItem::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool BevLogTestItem::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool BevLogTestItem::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    item_id = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    item_num = static_cast<uint32_t>(reader.ReadUInt32());
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string BevLogTestItem::ShortDebugString() const
 {
     std::stringstream ss;
@@ -2282,6 +3587,174 @@ NFrameComm::BevLogTest BevLogTest::ToPb() const
     return cc;
 }
 
+bool BevLogTest::SerializeTo(NFWireWriter& writer) const
+{
+    if (tDtEventTime != 0)
+    {
+        writer.WriteUInt64(1, tDtEventTime);
+    }
+    if (!szVGameIP.empty())
+    {
+        writer.WriteBytes(2, szVGameIP.data(), szVGameIP.length());
+    }
+    if (iIZoneAreaID != 0)
+    {
+        writer.WriteInt32(3, iIZoneAreaID);
+    }
+    if (iITimeShift != 0)
+    {
+        writer.WriteInt32(4, iITimeShift);
+    }
+    {
+        size_t start = writer.BeginLength(5);
+        item.SerializeTo(writer);
+        writer.EndLength(start);
+    }
+    for (auto iter = item_list.begin(); iter != item_list.end(); ++iter)
+    {
+        size_t start = writer.BeginLength(6);
+        iter->SerializeTo(writer);
+        writer.EndLength(start);
+    }
+    if (!id_list.empty())
+    {
+        size_t start = writer.BeginLength(7);
+        for (auto iter = id_list.begin(); iter != id_list.end(); ++iter)
+        {
+            writer.WriteInt32NoTag(*iter);
+        }
+        writer.EndLength(start);
+    }
+    return !writer.IsOverflow();
+}
+
+int BevLogTest::SerializeTo(uint8_t* pBuf, size_t size) const
+{
+    NFWireWriter writer(pBuf, size);
+    if (!SerializeTo(writer)) return -1;
+    return static_cast<int>(writer.GetLength());
+}
+
+bool BevLogTest::ParseFrom(NFWireReader& reader)
+{
+    if (!FromPb(NFrameComm::BevLogTest::default_instance())) return false;
+    return MergeFrom(reader);
+}
+
+bool BevLogTest::ParseFrom(const uint8_t* pBuf, size_t size)
+{
+    NFWireReader reader(pBuf, size);
+    return ParseFrom(reader);
+}
+
+bool BevLogTest::MergeFrom(NFWireReader& reader)
+{
+    uint32_t field = 0;
+    uint32_t wireType = 0;
+    while (reader.ReadTag(field, wireType))
+    {
+        switch (field)
+        {
+            case 1:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    tDtEventTime = static_cast<uint64_t>(reader.ReadUInt64());
+                    continue;
+                }
+                break;
+            case 2:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    const char* pData = NULL;
+                    size_t length = 0;
+                    if (!reader.ReadBytes(pData, length)) return false;
+                    if (length >= 32)
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogTest, field:szVGameIP, cur length:%d, max length:31", static_cast<int>(length));
+                        return false;
+                    }
+                    szVGameIP.assign(pData, length);
+                    continue;
+                }
+                break;
+            case 3:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iIZoneAreaID = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 4:
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    iITimeShift = static_cast<int32_t>(reader.ReadInt32());
+                    continue;
+                }
+                break;
+            case 5:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    if (!item.MergeFrom(sub)) return false;
+                    continue;
+                }
+                break;
+            case 6:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    if (item_list.size() >= item_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogTest, field:item_list, cur count:%d, max count:%d", static_cast<int>(item_list.size()), MAX_REPEATED_DEFAULT_COUNT);
+                        return false;
+                    }
+                    item_list.emplace_back();
+                    if (!item_list.back().ParseFrom(sub)) return false;
+                    continue;
+                }
+                break;
+            case 7:
+                if (wireType == NF_WIRE_TYPE_LENGTH)
+                {
+                    NFWireReader sub;
+                    if (!reader.ReadSubReader(sub)) return false;
+                    while (!sub.IsEnd())
+                    {
+                        if (id_list.size() >= id_list.max_size())
+                        {
+                            if (NULL != g_nanopb_frompb_log_handle)
+                                g_nanopb_frompb_log_handle("struct:BevLogTest, field:id_list, cur count:%d, max count:%d", static_cast<int>(id_list.size()), MAX_REPEATED_DEFAULT_COUNT);
+                            return false;
+                        }
+                        id_list.push_back(static_cast<int32_t>(sub.ReadInt32()));
+                    }
+                    if (sub.IsError()) return false;
+                    continue;
+                }
+                if (wireType == NF_WIRE_TYPE_VARINT)
+                {
+                    if (id_list.size() >= id_list.max_size())
+                    {
+                        if (NULL != g_nanopb_frompb_log_handle)
+                            g_nanopb_frompb_log_handle("struct:BevLogTest, field:id_list, cur count:%d, max count:%d", static_cast<int>(id_list.size()), MAX_REPEATED_DEFAULT_COUNT);
+                        return false;
+                    }
+                    id_list.push_back(static_cast<int32_t>(reader.ReadInt32()));
+                    continue;
+                }
+                break;
+            default:
+                break;
+        }
+        if (!reader.SkipField(field, wireType)) return false;
+    }
+    return !reader.IsError();
+}
+
 std::string BevLogTest::ShortDebugString() const
 {
     std::stringstream ss;
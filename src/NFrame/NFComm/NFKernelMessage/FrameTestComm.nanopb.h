@@ -8,6 +8,7 @@
 #include <unordered_map>
 #include <map>
 #include <NFComm/NFCore/NFHash.hpp>
+#include "NFComm/NFCore/NFWireFormat.h"
 #include "NFComm/NFShmStl/NFShmString.h"
 #include "NFComm/NFShmStl/NFShmVector.h"
 #include "NFComm/NFShmStl/NFShmList.h"
@@ -41,6 +42,11 @@ struct BevLogTestItem {
     bool FromPb(const NFrameComm::BevLogTestItem& cc);
     void ToPb(NFrameComm::BevLogTestItem* cc) const;
     NFrameComm::BevLogTestItem ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:BevLogTestItem) */
@@ -60,6 +66,11 @@ struct WelfareNodeDBDataGetTaskManual {
     bool FromPb(const NFrameComm::WelfareNodeDBDataGetTaskManual& cc);
     void ToPb(NFrameComm::WelfareNodeDBDataGetTaskManual* cc) const;
     NFrameComm::WelfareNodeDBDataGetTaskManual ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:WelfareNodeDBDataGetTaskManual) */
@@ -97,6 +108,11 @@ struct WelfareNodeDBDataPddBuy {
     bool FromPb(const NFrameComm::WelfareNodeDBDataPddBuy& cc);
     void ToPb(NFrameComm::WelfareNodeDBDataPddBuy* cc) const;
     NFrameComm::WelfareNodeDBDataPddBuy ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:WelfareNodeDBDataPddBuy) */
@@ -120,6 +136,11 @@ struct WelfareNodeDBDataPddOpen {
     bool FromPb(const NFrameComm::WelfareNodeDBDataPddOpen& cc);
     void ToPb(NFrameComm::WelfareNodeDBDataPddOpen* cc) const;
     NFrameComm::WelfareNodeDBDataPddOpen ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:WelfareNodeDBDataPddOpen) */
@@ -156,6 +177,11 @@ struct wxWorkRobotTextTest {
     bool FromPb(const NFrameComm::wxWorkRobotTextTest& cc);
     void ToPb(NFrameComm::wxWorkRobotTextTest* cc) const;
     NFrameComm::wxWorkRobotTextTest ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 	bool operator==(const wxWorkRobotTextTest &value) const
@@ -204,6 +230,11 @@ struct BevLogTest {
     bool FromPb(const NFrameComm::BevLogTest& cc);
     void ToPb(NFrameComm::BevLogTest* cc) const;
     NFrameComm::BevLogTest ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 
 /* @@protoc_insertion_point(struct:BevLogTest) */
@@ -249,6 +280,11 @@ struct WelfareNodeDBDataUnion {
     bool FromPb(const NFrameComm::WelfareNodeDBDataUnion& cc);
     void ToPb(NFrameComm::WelfareNodeDBDataUnion* cc) const;
     NFrameComm::WelfareNodeDBDataUnion ToPb() const;
+    bool SerializeTo(NFWireWriter& writer) const;
+    int SerializeTo(uint8_t* pBuf, size_t size) const;
+    bool ParseFrom(NFWireReader& reader);
+    bool ParseFrom(const uint8_t* pBuf, size_t size);
+    bool MergeFrom(NFWireReader& reader);
     std::string ShortDebugString() const;
 public:
     void init_which_m_stData(pb_size_t which_data);
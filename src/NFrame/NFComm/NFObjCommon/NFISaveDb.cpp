@@ -30,12 +30,18 @@ int NFISaveDb::CreateInit()
     m_lastSaveDbTime = 0;
     m_curSavingDbTime = 0;
     m_lastAllSeq = 0;
+    m_bNeedReloadDb = false;
     return 0;
 }
 
 
 int NFISaveDb::ResumeInit()
 {
+    //热重启不清这个标记, 镜像恢复后还没重新加载就又热重启的对象也不能存盘
+    if (NFShmMgr::Instance()->IsCheckpointRecover())
+    {
+        m_bNeedReloadDb = true;
+    }
     return 0;
 }
 
@@ -61,6 +67,12 @@ int NFISaveDb::SendTransToDb(int iReason)
 
 bool NFISaveDb::CanSaveDb(uint32_t maxTimes, bool bForce)
 {
+    //镜像里的旧数据会覆盖DB里更新的数据
+    if (m_bNeedReloadDb)
+    {
+        return false;
+    }
+
     if (IsNeedSave() && !IsSavingDb())
     {
         if (bForce || NF_ADJUST_TIMENOW() - m_lastSaveDbTime >= maxTimes)
@@ -33,6 +33,14 @@ public:
 
     uint64_t GetCurSaveingDbTime() const { return m_curSavingDbTime; }
 
+    /**
+     * @brief 共享内存从写盘镜像恢复后, 对象里的数据可能比DB里的旧, 要重新从DB加载, 加载完之前不能存盘
+     * 这里不会自己重新加载, 派生类重新加载后调用SetNeedReloadDb(false); 存DB对象用NFBaseDBObj的由NFDBObjMgr处理
+     */
+    bool IsNeedReloadDb() const { return m_bNeedReloadDb; }
+
+    void SetNeedReloadDb(bool bNeedReload) { m_bNeedReloadDb = bNeedReload; }
+
     virtual bool IsNeedSave() const;
 
     virtual bool IsSavingDb() const;
@@ -52,4 +60,5 @@ protected:
     uint64_t m_lastSaveDbTime;
     uint64_t m_curSavingDbTime;
     uint64_t m_lastAllSeq;
+    bool m_bNeedReloadDb;
 };
\ No newline at end of file
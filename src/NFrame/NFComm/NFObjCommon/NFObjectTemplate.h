@@ -195,6 +195,16 @@ public:
 		return 0;
 	}
 
+	/**
+	 * @brief 声明本类型的ResumeInit依赖iDependType的对象, 热重启时等iDependType恢复完再恢复本类型
+	 * @param iDependType 被依赖的对象类型ID
+	 * @return 0成功
+	 */
+	static int AddResumeDependency(int iDependType)
+	{
+		return NFGlobalSystem::Instance()->GetGlobalPluginManager()->FindModule<NFIMemMngModule>()->AddResumeDependency(ClassType, iDependType);
+	}
+
 	void* operator new(size_t, void* pBuffer) throw()
 	{
 		return pBuffer;
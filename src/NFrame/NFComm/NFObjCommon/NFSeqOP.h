@@ -12,6 +12,11 @@
 #include "NFComm/NFCore/NFPlatform.h"
 #include "NFShmMgr.h"
 
+//字段修改掩码, 按protobuf顶层字段编号置位, 编号大于等于63的字段共用最高位
+#define SEQOP_FIELD_MASK(fieldNumber) ((fieldNumber) < 63 ? (1ULL << (fieldNumber)) : (1ULL << 63))
+//全部字段, 不知道改了哪些字段时整个对象存储
+#define SEQOP_FIELD_MASK_ALL 0xFFFFFFFFFFFFFFFFULL
+
 class NFSeqOP {
 public:
     NFSeqOP() {
@@ -27,12 +32,14 @@ public:
     int CreateInit() {
         m_dwCurSeq = 0;
         m_bIsUrgentNeedSave = false;
+        m_ullDirtyFieldMask = 0;
         return 0;
     }
 
     void ResetCurSeq() {
         m_dwCurSeq = 0;
         m_bIsUrgentNeedSave = false;
+        m_ullDirtyFieldMask = 0;
     }
 
     int ResumeInit() {
@@ -47,23 +54,48 @@ public:
         return m_dwCurSeq;
     }
 
-    void MarkDirty() {
+    //fieldMask: 修改的字段, 用SEQOP_FIELD_MASK(proto_ff::Xxx::kYyyFieldNumber)组合, 默认全部字段
+    void MarkDirty(uint64_t fieldMask = SEQOP_FIELD_MASK_ALL) {
         m_dwCurSeq++;
         m_bIsUrgentNeedSave = true;
+        m_ullDirtyFieldMask |= fieldMask;
+        OnMarkDirty();
     }
 
-    void MarkUrgent() {
+    void MarkUrgent(uint64_t fieldMask = SEQOP_FIELD_MASK_ALL) {
         m_dwCurSeq++;
         m_bIsUrgentNeedSave = true;
+        m_ullDirtyFieldMask |= fieldMask;
+        OnMarkDirty();
     }
 
     void ClearUrgent() {
         m_bIsUrgentNeedSave = false;
     }
 
+    uint64_t GetDirtyFieldMask() const {
+        return m_ullDirtyFieldMask;
+    }
+
+    //取出修改的字段并清空, 存储失败时用RestoreDirtyFieldMask放回
+    uint64_t TakeDirtyFieldMask() {
+        uint64_t fieldMask = m_ullDirtyFieldMask;
+        m_ullDirtyFieldMask = 0;
+        return fieldMask;
+    }
+
+    void RestoreDirtyFieldMask(uint64_t fieldMask) {
+        m_ullDirtyFieldMask |= fieldMask;
+    }
+
+    //数据被修改, 需要存储的对象可以在这里加入存储队列
+    virtual void OnMarkDirty() {}
+
 protected:
     uint32_t m_dwCurSeq;
     bool m_bIsUrgentNeedSave;
+    //新增字段, 所有继承NFSeqOP的共享内存对象多了8字节, 从旧版本升级不能resume, 要用--Init重新创建共享内存
+    uint64_t m_ullDirtyFieldMask;
 };
 
 class NFDescStoreSeqOP {
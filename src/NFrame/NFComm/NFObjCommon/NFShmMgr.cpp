@@ -14,6 +14,7 @@ NFShmMgr::NFShmMgr()
     m_objCreateMode = EN_OBJ_MODE_INIT;
     m_objRunMode = EN_OBJ_MODE_RECOVER;
     m_siAddrOffset = 0;
+    m_bCheckpointRecover = false;
 }
 
 NFShmMgr::~NFShmMgr()
@@ -55,3 +56,13 @@ void NFShmMgr::SetAddrOffset(size_t offset)
 {
     m_siAddrOffset = offset;
 }
+
+bool NFShmMgr::IsCheckpointRecover() const
+{
+    return m_bCheckpointRecover;
+}
+
+void NFShmMgr::SetCheckpointRecover(bool bRecover)
+{
+    m_bCheckpointRecover = bRecover;
+}
@@ -40,6 +40,13 @@ public:
     size_t   GetAddrOffset() const;
 
     void SetAddrOffset(size_t offset);
+
+    /**
+    * @brief  共享内存是不是机器重启后从写盘镜像恢复的, 镜像之后DB里的数据可能更新过, 存DB的对象要重新从DB加载
+    */
+    bool IsCheckpointRecover() const;
+
+    void SetCheckpointRecover(bool bRecover);
 public:
     EN_OBJ_MODE m_objCreateMode;
     EN_OBJ_MODE m_objRunMode;
@@ -47,6 +54,7 @@ public:
     * 相对于上次共享内存地址recover之后的偏移量,用来恢复指针对象
     */
     size_t  m_siAddrOffset;
+    bool m_bCheckpointRecover;
 public:
     int m_iType;
 };
@@ -65,4 +65,14 @@ typedef enum
         ClassName::UnRegisterClassToObjSeg(ClassName::GetStaticClassType());\
     }while(0)
 
+/**
+ * @brief 声明共享内存对象的恢复顺序
+ * @param ClassName 类名, 它的ResumeInit会访问DependClassName的对象
+ * @param DependClassName 被依赖的类名
+ * @note 热重启时各类型的对象是多线程并行恢复的, ClassName会等DependClassName的对象全部恢复完才开始恢复
+ */
+#define REGISTER_SHM_OBJ_RESUME_AFTER(ClassName, DependClassName) do{\
+        ClassName::AddResumeDependency(DependClassName::GetStaticClassType());\
+    }while(0)
+
 
@@ -0,0 +1,407 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFBinLog.h
+//    @Author           :    gaoyi
+//    @Date             :   2025-05-12
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFBinLog
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "common/spdlog/fmt/fmt.h"
+
+//每个线程默认的缓冲区大小
+#define NF_BIN_LOG_DEFAULT_RING_SIZE (4 * 1024 * 1024)
+//缓冲区最小值
+#define NF_BIN_LOG_MIN_RING_SIZE (64 * 1024)
+//block策略下缓冲区满了最多等多久, 超时就丢弃, 防止log线程卡住拖死业务线程
+#define NF_BIN_LOG_BLOCK_TIMEOUT_MS 100
+//log线程每个缓冲区一次最多取多少条, 避免一个线程刷屏饿死其他线程
+#define NF_BIN_LOG_CONSUME_BATCH 1024
+//卸载插件前等log线程处理完已写入记录的最长时间
+#define NF_BIN_LOG_DRAIN_TIMEOUT_MS 5000
+
+/**
+ * @brief 缓冲区满了的处理方式
+ */
+enum NF_BIN_LOG_POLICY
+{
+    NF_BIN_LOG_POLICY_DROP = 0, //直接丢弃并计数, 业务线程不会被log拖慢
+    NF_BIN_LOG_POLICY_BLOCK = 1, //等log线程腾出空间, 最多等NF_BIN_LOG_BLOCK_TIMEOUT_MS
+};
+
+/**
+ * @brief 记录类型
+ */
+enum NF_BIN_LOG_RECORD_TYPE
+{
+    NF_BIN_LOG_RECORD_FORMAT = 0, //格式串加原始参数, log线程格式化
+    NF_BIN_LOG_RECORD_STRING = 1, //已经格式化好的字符串, 对应NFILogModule::LogDefault/LogBehaviour
+};
+
+/**
+ * @brief NF_BIN_LOG_RECORD_STRING对应的输出接口
+ */
+enum NF_BIN_LOG_STRING_KIND
+{
+    NF_BIN_LOG_KIND_LOC = 0, //LogDefault(level, loc, logId, guid, log)
+    NF_BIN_LOG_KIND_MODULE = 1, //LogDefault(level, loc, logId, guid, module, log)
+    NF_BIN_LOG_KIND_BEHAVIOUR = 2, //LogBehaviour(level, logId, log)
+    NF_BIN_LOG_KIND_GUID = 3, //LogDefault(level, logId, guid, log)
+};
+
+/**
+ * @brief 在log线程里用格式串和参数区还原出log内容
+ */
+typedef std::string (*NFBinLogFormatFunc)(const char* fmt, uint32_t fmtLen, const char* args);
+
+/**
+ * @brief 缓冲区里的一条log
+ *
+ * NF_BIN_LOG_RECORD_FORMAT后面跟着格式串和参数, 文件名函数名来自log宏里的__FILE__和__FUNCTION__, 只存指针;
+ * NF_BIN_LOG_RECORD_STRING后面跟着文件名, 函数名, log内容, 调用者的loc不一定是常量, 所以拷贝
+ */
+struct NFBinLogRecord
+{
+    uint8_t m_type;
+    uint8_t m_level;
+    uint16_t m_kind;
+    uint32_t m_logId;
+    int32_t m_moduleId;
+    int32_t m_retCode;
+    uint64_t m_guid;
+    int64_t m_time; //业务线程写入的时间, std::chrono::system_clock
+    uint32_t m_line;
+    uint32_t m_fileLen;
+    uint32_t m_funcLen;
+    uint32_t m_dataLen; //格式串或log内容的长度
+    const char* m_file;
+    const char* m_func;
+    NFBinLogFormatFunc m_formatFunc;
+
+    const char* GetData() const { return reinterpret_cast<const char*>(this + 1); }
+};
+
+/**
+ * @brief 单生产者单消费者的字节环形缓冲区
+ *
+ * 业务线程独占一个, 只有log线程读, 不加锁。每条记录前面8字节放长度和标记, 按8字节对齐,
+ * 尾部放不下的记录写一个填充记录后从头开始, 保证每条记录在内存里是连续的
+ */
+class NFBinLogRing
+{
+public:
+    enum
+    {
+        HEAD_SIZE = 8,
+        FLAG_DATA = 0,
+        FLAG_PAD = 1,
+    };
+
+    explicit NFBinLogRing(uint32_t size) : m_head(0), m_tail(0), m_cachedTail(0), m_reserveHead(0), m_reserveSize(0), m_peekSize(0), m_writeCount(0), m_dropCount(0), m_bClosed(false)
+    {
+        uint32_t capacity = NF_BIN_LOG_MIN_RING_SIZE;
+        while (capacity < size && capacity < 0x40000000)
+        {
+            capacity <<= 1;
+        }
+        m_buffer.resize(capacity);
+        m_mask = capacity - 1;
+    }
+
+    uint32_t GetCapacity() const { return static_cast<uint32_t>(m_buffer.size()); }
+
+    /**
+     * @brief 一条记录最大的长度, 超过的调用者自己处理
+     */
+    uint32_t GetMaxRecordSize() const { return GetCapacity() / 4 - HEAD_SIZE; }
+
+    /**
+     * @brief 业务线程申请一条记录的空间
+     * @return 空间不够返回nullptr, 成功后必须调用Commit
+     */
+    char* Reserve(uint32_t size)
+    {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        uint64_t total = Align(size + HEAD_SIZE);
+        uint64_t pos = head & m_mask;
+        uint64_t tailRoom = m_buffer.size() - pos;
+        uint64_t need = total <= tailRoom ? total : total + tailRoom;
+        if (head + need - m_cachedTail > m_buffer.size())
+        {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head + need - m_cachedTail > m_buffer.size())
+            {
+                return nullptr;
+            }
+        }
+
+        if (total > tailRoom)
+        {
+            WriteHead(pos, static_cast<uint32_t>(tailRoom - HEAD_SIZE), FLAG_PAD);
+            head += tailRoom;
+            pos = 0;
+        }
+
+        WriteHead(pos, size, FLAG_DATA);
+        m_reserveHead = head;
+        m_reserveSize = total;
+        return &m_buffer[pos + HEAD_SIZE];
+    }
+
+    void Commit()
+    {
+        m_head.store(m_reserveHead + m_reserveSize, std::memory_order_release);
+        m_writeCount.store(m_writeCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void AddDrop()
+    {
+        m_dropCount.store(m_dropCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief log线程取下一条记录
+     * @return 没有数据返回nullptr, 用完后调用Release
+     */
+    const char* Peek(uint32_t& size)
+    {
+        uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        while (tail != m_head.load(std::memory_order_acquire))
+        {
+            uint64_t pos = tail & m_mask;
+            uint32_t len = 0;
+            uint32_t flag = 0;
+            memcpy(&len, &m_buffer[pos], sizeof(len));
+            memcpy(&flag, &m_buffer[pos + sizeof(len)], sizeof(flag));
+            if (flag == FLAG_PAD)
+            {
+                tail += Align(len + HEAD_SIZE);
+                m_tail.store(tail, std::memory_order_release);
+                continue;
+            }
+
+            size = len;
+            m_peekSize = Align(len + HEAD_SIZE);
+            return &m_buffer[pos + HEAD_SIZE];
+        }
+        return nullptr;
+    }
+
+    void Release()
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + m_peekSize, std::memory_order_release);
+    }
+
+    bool IsEmpty() const { return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire); }
+
+    uint64_t GetHead() const { return m_head.load(std::memory_order_acquire); }
+
+    /**
+     * @brief head之前的记录是否都已经被log线程处理完, Release在处理完之后才推进m_tail
+     */
+    bool IsConsumed(uint64_t head) const { return m_tail.load(std::memory_order_acquire) >= head; }
+
+    uint64_t GetUsedSize() const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); }
+
+    uint64_t GetWriteCount() const { return m_writeCount.load(std::memory_order_relaxed); }
+
+    uint64_t GetDropCount() const { return m_dropCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 所属线程退出, 取完剩下的记录就可以回收
+     */
+    void Close() { m_bClosed.store(true, std::memory_order_release); }
+
+    bool IsClosed() const { return m_bClosed.load(std::memory_order_acquire); }
+
+private:
+    static uint64_t Align(uint64_t size) { return (size + 7) & ~static_cast<uint64_t>(7); }
+
+    void WriteHead(uint64_t pos, uint32_t len, uint32_t flag)
+    {
+        memcpy(&m_buffer[pos], &len, sizeof(len));
+        memcpy(&m_buffer[pos + sizeof(len)], &flag, sizeof(flag));
+    }
+
+private:
+    std::vector<char> m_buffer;
+    uint64_t m_mask;
+    //生产者和消费者各写各的, 分开缓存行
+    alignas(64) std::atomic<uint64_t> m_head;
+    alignas(64) std::atomic<uint64_t> m_tail;
+    alignas(64) uint64_t m_cachedTail; //生产者看到的m_tail, 不够时才重新读
+    uint64_t m_reserveHead;
+    uint64_t m_reserveSize;
+    uint64_t m_peekSize;
+    std::atomic<uint64_t> m_writeCount;
+    std::atomic<uint64_t> m_dropCount;
+    std::atomic<bool> m_bClosed;
+};
+
+/**
+ * @brief 二进制log的统计
+ */
+struct NFBinLogStat
+{
+    NFBinLogStat() : m_writeCount(0), m_dropCount(0), m_ringCount(0), m_usedSize(0)
+    {
+    }
+
+    uint64_t m_writeCount; //写进缓冲区的记录数
+    uint64_t m_dropCount; //缓冲区满了丢弃的记录数
+    uint32_t m_ringCount; //当前的缓冲区个数, 即写过log的线程数
+    uint64_t m_usedSize; //缓冲区里还没写文件的字节数
+};
+
+/**
+ * @brief 参数怎么存进缓冲区
+ *
+ * 算术类型和枚举按原始字节拷贝, 字符串存长度加内容, log线程取出来还是原来的类型或fmt::string_view,
+ * 所以格式化结果和在业务线程里直接fmt::format一致。其他类型不支持, 整条log走原来的路径
+ */
+template <typename T, typename Enable = void>
+struct NFBinLogArg
+{
+    static const bool value = false;
+};
+
+template <typename T>
+struct NFBinLogArg<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type>
+{
+    static const bool value = true;
+    typedef T ValueType;
+
+    static size_t Size(const T& arg) { return sizeof(T); }
+
+    static char* Write(char* p, const T& arg)
+    {
+        memcpy(p, &arg, sizeof(T));
+        return p + sizeof(T);
+    }
+
+    static T Read(const char*& p)
+    {
+        T arg;
+        memcpy(&arg, p, sizeof(T));
+        p += sizeof(T);
+        return arg;
+    }
+};
+
+struct NFBinLogStringArg
+{
+    static const bool value = true;
+    typedef fmt::string_view ValueType;
+
+    static size_t Size(const char* str, size_t len) { return sizeof(uint32_t) + len; }
+
+    static char* Write(char* p, const char* str, size_t len)
+    {
+        uint32_t len32 = static_cast<uint32_t>(len);
+        memcpy(p, &len32, sizeof(len32));
+        if (len32 > 0)
+        {
+            memcpy(p + sizeof(len32), str, len32);
+        }
+        return p + sizeof(len32) + len32;
+    }
+
+    static fmt::string_view Read(const char*& p)
+    {
+        uint32_t len = 0;
+        memcpy(&len, p, sizeof(len));
+        fmt::string_view str(p + sizeof(len), len);
+        p += sizeof(len) + len;
+        return str;
+    }
+};
+
+template <>
+struct NFBinLogArg<std::string> : public NFBinLogStringArg
+{
+    static size_t Size(const std::string& arg) { return NFBinLogStringArg::Size(arg.data(), arg.length()); }
+
+    static char* Write(char* p, const std::string& arg) { return NFBinLogStringArg::Write(p, arg.data(), arg.length()); }
+};
+
+template <>
+struct NFBinLogArg<const char*> : public NFBinLogStringArg
+{
+    static size_t Size(const char* arg) { return NFBinLogStringArg::Size(arg, arg ? strlen(arg) : 0); }
+
+    static char* Write(char* p, const char* arg) { return NFBinLogStringArg::Write(p, arg, arg ? strlen(arg) : 0); }
+};
+
+template <>
+struct NFBinLogArg<char*> : public NFBinLogArg<const char*>
+{
+};
+
+/**
+ * @brief 一组参数的编码
+ */
+template <typename... Args>
+struct NFBinLogArgs;
+
+template <>
+struct NFBinLogArgs<>
+{
+    static const bool value = true;
+
+    static size_t Size() { return 0; }
+
+    static char* Write(char* p) { return p; }
+};
+
+template <typename T, typename... Rest>
+struct NFBinLogArgs<T, Rest...>
+{
+    typedef NFBinLogArg<typename std::decay<T>::type> Arg;
+    static const bool value = Arg::value && NFBinLogArgs<Rest...>::value;
+
+    static size_t Size(const T& arg, const Rest&... rest) { return Arg::Size(arg) + NFBinLogArgs<Rest...>::Size(rest...); }
+
+    static char* Write(char* p, const T& arg, const Rest&... rest) { return NFBinLogArgs<Rest...>::Write(Arg::Write(p, arg), rest...); }
+};
+
+/**
+ * @brief 按编码时的类型依次取出参数, 取完后格式化
+ */
+template <typename... Rest>
+struct NFBinLogUnpack;
+
+template <>
+struct NFBinLogUnpack<>
+{
+    template <typename... Done>
+    static std::string Format(const char*& p, fmt::string_view fmt, const Done&... done)
+    {
+        return fmt::format(fmt, done...);
+    }
+};
+
+template <typename T, typename... Rest>
+struct NFBinLogUnpack<T, Rest...>
+{
+    template <typename... Done>
+    static std::string Format(const char*& p, fmt::string_view fmt, const Done&... done)
+    {
+        typedef NFBinLogArg<typename std::decay<T>::type> Arg;
+        typename Arg::ValueType arg = Arg::Read(p);
+        return NFBinLogUnpack<Rest...>::Format(p, fmt, done..., arg);
+    }
+};
+
+template <typename... Args>
+std::string NFBinLogFormat(const char* fmt, uint32_t fmtLen, const char* args)
+{
+    return NFBinLogUnpack<Args...>::Format(args, fmt::string_view(fmt, fmtLen));
+}
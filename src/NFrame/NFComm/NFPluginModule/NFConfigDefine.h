@@ -16,6 +16,7 @@
 #include "NFComm/NFPluginModule/NFServerDefine.h"
 #include "NFComm/NFKernelMessage/FrameComm.nanopb.h"
 #include "NFComm/NFPluginModule/NFProtobufCommon.h"
+#include "NFComm/NFPluginModule/NFBinLog.h"
 #include <unordered_map>
 
 #define DEFINE_LUA_STRING_LOAD_PLUGIN            "LoadPlugin"
@@ -27,6 +28,7 @@
 #define DEFINE_LUA_STRING_LOG_FLUSH_LEVEL        "LogFlushLevel"                //log刷新等级配置
 
 #define DEFINE_LUA_STRING_LOG_INFO                "LogInfo"            //log配置
+#define DEFINE_LUA_STRING_LOG_BINARY              "LogBinary"          //二进制异步log配置
 
 #define DEFINE_LUA_STRING_EXTERNAL_DATA         "ExternalData"
 
@@ -51,9 +53,15 @@ struct NFLogConfig
     void Clear()
     {
         mLineConfigList.clear();
+        mBinLogOpen = false;
+        mBinLogRingSize = NF_BIN_LOG_DEFAULT_RING_SIZE / (1024 * 1024);
+        mBinLogPolicy = NF_BIN_LOG_POLICY_DROP;
     }
     
     std::vector<LogInfoConfig> mLineConfigList;
+    bool mBinLogOpen; //是否开启二进制异步log
+    uint32_t mBinLogRingSize; //每个线程的缓冲区大小, 单位M
+    uint32_t mBinLogPolicy; //缓冲区满了的处理, NF_BIN_LOG_POLICY
 };
 
 struct NFServerConfig : public pbNFServerConfig
@@ -74,6 +74,15 @@ public:
      */
     virtual void UnRegisterClassToObjSeg(int bType) = 0;
 
+    /**
+     * @brief 声明恢复顺序, iType的ResumeInit会访问iDependType的对象, 所以iType要等iDependType的对象全部恢复完才开始
+     * @param iType 对象类型ID
+     * @param iDependType 被依赖的对象类型ID
+     * @return 0成功
+     * @note 共享内存热重启时各类型的对象是多线程并行恢复的, 没有声明依赖的类型之间没有先后顺序
+     */
+    virtual int AddResumeDependency(int iType, int iDependType) = 0;
+
     /**
     * @brief  设置功能内存初始化成功
     */
@@ -58,6 +58,14 @@ public:
         return true;
     }
 
+    /**
+     * @brief 所有插件的Execute都执行完之后调用, 用来发送本帧攒下的数据
+     */
+    virtual bool AfterExecute()
+    {
+        return true;
+    }
+
     virtual bool BeforeShut()
     {
         return true;
@@ -123,6 +123,13 @@ public:
 
 	virtual void CloseLinkId(uint64_t usLinkId) = 0;
 
+    /**
+     * @brief 设置链接发送时的压缩算法, 对端不论是否设置都能解压, 只有tcp链接支持
+     * @param compressType NF_PACKET_COMPRESS_TYPE
+     * @param minSize 小于这个长度的包不压缩
+     */
+    virtual int SetLinkCompress(uint64_t usLinkId, uint32_t compressType, uint32_t minSize = NF_PACKET_COMPRESS_MIN_SIZE) = 0;
+
     virtual void Send(uint64_t usLinkId, uint32_t nModuleId, uint32_t nMsgID, const std::string& strData, uint64_t param1 = 0, uint64_t param2 = 0, uint64_t srcId = 0, uint64_t dstId = 0) = 0;
 
     virtual void Send(uint64_t usLinkId, uint32_t nModuleId, uint32_t nMsgID, const char* msg,uint32_t nLen, uint64_t param1 = 0, uint64_t param2 = 0, uint64_t srcId = 0, uint64_t dstId = 0) = 0;
@@ -24,7 +24,7 @@ public:
 	virtual int DeCodeImpl(const char* strData, uint32_t unLen, char*& outData, uint32_t& outLen, uint32_t& allLen, NFDataPackage& recvPackage) = 0;
 	virtual int EnCodeImpl(const NFDataPackage& recvPackage, const char* strData, uint32_t unLen, NFBuffer& buffer, uint64_t nSendBusLinkId = 0) = 0;
 
-    // 使用 lzf 算法 压缩、解压
-    virtual int CompressImpl(const char* inBuffer, int inLen, void *outBuffer, unsigned int outSize) { return -1; }
+    // 压缩、解压, compressType见NF_PACKET_COMPRESS_TYPE, 解压时算法从压缩数据里取
+    virtual int CompressImpl(uint32_t compressType, const char* inBuffer, int inLen, void *outBuffer, unsigned int outSize) { return -1; }
     virtual int DecompressImpl(const char* inBuffer, int inLen, void *outBuffer, int outSize) { return -1; }
 };
@@ -149,6 +149,24 @@ bool NFIPlugin::Execute()
 	return true;
 }
 
+bool NFIPlugin::AfterExecute()
+{
+	for (size_t i = 0; i < m_vecModule.size(); i++)
+	{
+		NFIModule* pModule = m_vecModule[i];
+		if (pModule)
+		{
+			bool bRet = pModule->AfterExecute();
+			if (!bRet)
+			{
+				NFLogError(NF_LOG_DEFAULT, 0, "{} AfterExecute failed!", pModule->m_strName);
+			}
+		}
+	}
+
+	return true;
+}
+
 bool NFIPlugin::BeforeShut()
 {
 	for (size_t i = 0; i < m_vecModule.size(); i++)
@@ -66,6 +66,8 @@ public:
 
 	bool Execute() override;
 
+	bool AfterExecute() override;
+
 	bool BeforeShut() override;
 
 	bool Shut() override;
@@ -730,6 +730,90 @@ public:
 	 */
 	virtual void SetInitShm() = 0;
 
+	/**
+	 * @brief 获取共享内存热重启时恢复对象的线程数。
+	 *
+	 * @return int 0表示按CPU核数自动选择，1表示只在主线程串行恢复。
+	 */
+	virtual int GetShmResumeThreadNum() const = 0;
+
+	/**
+	 * @brief 设置共享内存热重启时恢复对象的线程数。
+	 *
+	 * @param num 线程数，0表示按CPU核数自动选择。
+	 */
+	virtual void SetShmResumeThreadNum(int num) = 0;
+
+	/**
+	 * @brief 共享内存和bus通道是否使用大页。
+	 *
+	 * @return bool 大页不够时会退回透明大页或者普通页。
+	 */
+	virtual bool IsShmHugePage() const = 0;
+
+	/**
+	 * @brief 设置共享内存和bus通道使用大页。
+	 */
+	virtual void SetShmHugePage(bool bHugePage) = 0;
+
+	/**
+	 * @brief 共享内存创建后是否预先触发缺页。
+	 */
+	virtual bool IsShmPrefault() const = 0;
+
+	/**
+	 * @brief 设置共享内存创建后预先触发缺页。
+	 */
+	virtual void SetShmPrefault(bool bPrefault) = 0;
+
+	/**
+	 * @brief 获取共享内存绑定的NUMA节点。
+	 *
+	 * @return int 小于0表示不绑定。
+	 */
+	virtual int GetShmNumaNode() const = 0;
+
+	/**
+	 * @brief 设置共享内存绑定的NUMA节点。
+	 *
+	 * @param node NUMA节点号，小于0表示不绑定。
+	 */
+	virtual void SetShmNumaNode(int node) = 0;
+
+	/**
+	 * @brief 获取共享内存写盘镜像的路径。
+	 *
+	 * @return std::string 为空表示不写盘。
+	 */
+	virtual const std::string& GetShmCheckpointPath() const = 0;
+
+	/**
+	 * @brief 设置共享内存写盘镜像的路径，每个服务器生成path.BusName.0和path.BusName.1两个文件轮流写。
+	 */
+	virtual void SetShmCheckpointPath(const std::string& path) = 0;
+
+	/**
+	 * @brief 获取共享内存写盘间隔(秒)。
+	 */
+	virtual int GetShmCheckpointInterval() const = 0;
+
+	/**
+	 * @brief 设置共享内存写盘间隔(秒)。
+	 */
+	virtual void SetShmCheckpointInterval(int interval) = 0;
+
+	/**
+	 * @brief 新建共享内存时是否从写盘镜像恢复。
+	 *
+	 * @return bool 默认false, 只写镜像不恢复; 开启后存DB的对象恢复出来要重新从DB加载才能存盘。
+	 */
+	virtual bool IsShmCheckpointRestore() const = 0;
+
+	/**
+	 * @brief 设置新建共享内存时是否从写盘镜像恢复。
+	 */
+	virtual void SetShmCheckpointRestore(bool restore) = 0;
+
 	/**
 	 * @brief 设置总线名称。
 	 *
@@ -851,6 +935,29 @@ public:
 	 */
 	virtual void SetIdleSleepUs(uint32_t time) = 0;
 
+	/**
+	 * @brief 判断是否开启事件唤醒模式。
+	 * @return 返回true表示主循环阻塞在唤醒事件上，而不是固定休眠。
+	 */
+	virtual bool IsWakeupMode() const = 0;
+
+	/**
+	 * @brief 设置是否开启事件唤醒模式。
+	 * @param wakeup 设置为true表示开启事件唤醒模式。
+	 */
+	virtual void SetWakeupMode(bool wakeup) = 0;
+
+	/**
+	 * @brief 唤醒主循环，线程安全，网络线程和任务线程有新数据时调用。
+	 */
+	virtual void Wakeup() = 0;
+
+	/**
+	 * @brief 登记下一次需要主循环处理的时间点（比如最近的定时器到期时间），唤醒模式下空闲等待不会超过这个时间点。
+	 * @param timeMs 时间点（毫秒，NF_ADJUST_TIMENOW_MS的时间），一帧内多次登记取最早的。
+	 */
+	virtual void SetNextWakeupTime(uint64_t timeMs) = 0;
+
 	/**
 	 * @brief 判断是否已经初始化。
 	 * @return 返回true表示已经初始化，否则返回false。
@@ -12,11 +12,37 @@
 #include "common/spdlog/sinks/basic_file_sink.h"
 #include "common/spdlog/sinks/ansicolor_sink.h"
 #include "pb.h"
+#include <thread>
 
-NFLogMgr::NFLogMgr()
+namespace
 {
-	m_pLogModule = nullptr;
+	/**
+	 * @brief 线程退出时关掉自己的缓冲区, log线程取完后回收
+	 */
+	struct NFBinLogThreadRing
+	{
+		~NFBinLogThreadRing()
+		{
+			if (m_pRing)
+			{
+				m_pRing->Close();
+			}
+		}
+
+		std::shared_ptr<NFBinLogRing> m_pRing;
+	};
+
+	thread_local NFBinLogThreadRing g_binLogThreadRing;
+}
 
+NFLogMgr::NFLogMgr() : m_bBinLog(false), m_binLogRingSize(NF_BIN_LOG_DEFAULT_RING_SIZE), m_binLogPolicy(NF_BIN_LOG_POLICY_DROP), m_binLogClosedWrite(0), m_binLogClosedDrop(0)
+{
+	m_pLogModule = nullptr;
+	//log模块初始化之前全部放行, 由LogFormat自己判断
+	for (int i = 0; i < NF_LOG_ENABLE_LEVEL_NUM; i++)
+	{
+		m_logEnableBitmap[i] = ~0ULL;
+	}
 }
 
 NFLogMgr::~NFLogMgr()
@@ -38,8 +64,223 @@ bool NFLogMgr::Init(NFILogModule* pSpdlogModule)
 void NFLogMgr::UnInit()
 {
 	m_pLogModule = nullptr;
+	UpdateLogEnable();
+}
+
+void NFLogMgr::UpdateLogEnable()
+{
+	for (int level = 0; level < NF_LOG_ENABLE_LEVEL_NUM; level++)
+	{
+		uint64_t bitmap = 0;
+		for (uint32_t logId = 0; logId < NF_LOG_ENABLE_BITMAP_BITS; logId++)
+		{
+			if (m_pLogModule == nullptr || m_pLogModule->IsLogIdEnable(static_cast<NF_LOG_LEVEL>(level), logId))
+			{
+				bitmap |= 1ULL << logId;
+			}
+		}
+		m_logEnableBitmap[level] = bitmap;
+	}
+}
+
+
+void NFLogMgr::EnableBinLog(uint32_t ringSize, int policy)
+{
+	m_binLogRingSize.store(ringSize, std::memory_order_relaxed);
+	m_binLogPolicy.store(policy, std::memory_order_relaxed);
+	m_bBinLog.store(true, std::memory_order_release);
 }
 
+void NFLogMgr::DisableBinLog()
+{
+	m_bBinLog.store(false, std::memory_order_release);
+}
+
+NFBinLogRing* NFLogMgr::GetBinLogRing()
+{
+	if (!g_binLogThreadRing.m_pRing)
+	{
+		g_binLogThreadRing.m_pRing = std::make_shared<NFBinLogRing>(m_binLogRingSize.load(std::memory_order_relaxed));
+		std::lock_guard<std::mutex> lock(m_binLogMutex);
+		m_binLogRings.push_back(g_binLogThreadRing.m_pRing);
+	}
+	return g_binLogThreadRing.m_pRing.get();
+}
+
+char* NFLogMgr::ReserveBinLog(NFBinLogRing* pRing, uint32_t size)
+{
+	char* p = pRing->Reserve(size);
+	if (p)
+	{
+		return p;
+	}
+
+	if (m_binLogPolicy.load(std::memory_order_relaxed) == NF_BIN_LOG_POLICY_BLOCK)
+	{
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(NF_BIN_LOG_BLOCK_TIMEOUT_MS);
+		while (m_bBinLog.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < deadline)
+		{
+			std::this_thread::yield();
+			p = pRing->Reserve(size);
+			if (p)
+			{
+				return p;
+			}
+		}
+	}
+
+	pRing->AddDrop();
+	return nullptr;
+}
+
+bool NFLogMgr::LogBinaryString(NF_BIN_LOG_STRING_KIND kind, NF_LOG_LEVEL logLevel, const NFSourceLoc& loc, uint32_t logId, uint64_t guid, uint32_t module, const std::string& log)
+{
+	if (!m_bBinLog.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	NFBinLogRing* pRing = GetBinLogRing();
+	size_t fileLen = loc.filename ? strlen(loc.filename) : 0;
+	size_t funcLen = loc.funcname ? strlen(loc.funcname) : 0;
+	size_t headLen = sizeof(NFBinLogRecord) + fileLen + funcLen;
+	if (headLen >= pRing->GetMaxRecordSize())
+	{
+		return false;
+	}
+
+	//超长的log截断, 不能因为一条log把缓冲区占满
+	size_t logLen = log.length();
+	if (headLen + logLen > pRing->GetMaxRecordSize())
+	{
+		logLen = pRing->GetMaxRecordSize() - headLen;
+	}
+
+	char* p = ReserveBinLog(pRing, static_cast<uint32_t>(headLen + logLen));
+	if (p == nullptr)
+	{
+		return true;
+	}
+
+	NFBinLogRecord* pRecord = reinterpret_cast<NFBinLogRecord*>(p);
+	pRecord->m_type = NF_BIN_LOG_RECORD_STRING;
+	pRecord->m_level = static_cast<uint8_t>(logLevel);
+	pRecord->m_kind = static_cast<uint16_t>(kind);
+	pRecord->m_logId = logId;
+	pRecord->m_moduleId = static_cast<int32_t>(module);
+	pRecord->m_retCode = 0;
+	pRecord->m_guid = guid;
+	pRecord->m_time = std::chrono::system_clock::now().time_since_epoch().count();
+	pRecord->m_line = loc.line;
+	pRecord->m_fileLen = static_cast<uint32_t>(fileLen);
+	pRecord->m_funcLen = static_cast<uint32_t>(funcLen);
+	pRecord->m_dataLen = static_cast<uint32_t>(logLen);
+	pRecord->m_file = nullptr;
+	pRecord->m_func = nullptr;
+	pRecord->m_formatFunc = nullptr;
+	p += sizeof(NFBinLogRecord);
+	memcpy(p, loc.filename, fileLen);
+	memcpy(p + fileLen, loc.funcname, funcLen);
+	memcpy(p + fileLen + funcLen, log.data(), logLen);
+	pRing->Commit();
+	return true;
+}
+
+int NFLogMgr::ConsumeBinLog(const std::function<void(const NFBinLogRecord*)>& func)
+{
+	std::vector<std::shared_ptr<NFBinLogRing>> vecRing;
+	{
+		std::lock_guard<std::mutex> lock(m_binLogMutex);
+		vecRing = m_binLogRings;
+	}
+
+	int count = 0;
+	bool bHasClosed = false;
+	for (size_t i = 0; i < vecRing.size(); i++)
+	{
+		NFBinLogRing* pRing = vecRing[i].get();
+		//先看是否关闭再取, 关闭之后不会再有新记录, 取空了就可以回收
+		bHasClosed = bHasClosed || pRing->IsClosed();
+		uint32_t size = 0;
+		for (int j = 0; j < NF_BIN_LOG_CONSUME_BATCH; j++)
+		{
+			const char* p = pRing->Peek(size);
+			if (p == nullptr)
+			{
+				break;
+			}
+
+			func(reinterpret_cast<const NFBinLogRecord*>(p));
+			pRing->Release();
+			count++;
+		}
+	}
+
+	if (bHasClosed)
+	{
+		std::lock_guard<std::mutex> lock(m_binLogMutex);
+		for (auto iter = m_binLogRings.begin(); iter != m_binLogRings.end();)
+		{
+			if ((*iter)->IsClosed() && (*iter)->IsEmpty())
+			{
+				m_binLogClosedWrite += (*iter)->GetWriteCount();
+				m_binLogClosedDrop += (*iter)->GetDropCount();
+				iter = m_binLogRings.erase(iter);
+			}
+			else
+			{
+				++iter;
+			}
+		}
+	}
+
+	return count;
+}
+
+void NFLogMgr::GetBinLogStat(NFBinLogStat& stat)
+{
+	std::lock_guard<std::mutex> lock(m_binLogMutex);
+	stat.m_writeCount = m_binLogClosedWrite;
+	stat.m_dropCount = m_binLogClosedDrop;
+	stat.m_ringCount = static_cast<uint32_t>(m_binLogRings.size());
+	stat.m_usedSize = 0;
+	for (size_t i = 0; i < m_binLogRings.size(); i++)
+	{
+		stat.m_writeCount += m_binLogRings[i]->GetWriteCount();
+		stat.m_dropCount += m_binLogRings[i]->GetDropCount();
+		stat.m_usedSize += m_binLogRings[i]->GetUsedSize();
+	}
+}
+
+bool NFLogMgr::WaitBinLogConsumed(uint32_t timeoutMs)
+{
+	//记下每个缓冲区现在写到哪里, 只等这之前的记录
+	std::vector<std::pair<std::shared_ptr<NFBinLogRing>, uint64_t>> vecWait;
+	{
+		std::lock_guard<std::mutex> lock(m_binLogMutex);
+		for (size_t i = 0; i < m_binLogRings.size(); i++)
+		{
+			if (!m_binLogRings[i]->IsEmpty())
+			{
+				vecWait.push_back(std::make_pair(m_binLogRings[i], m_binLogRings[i]->GetHead()));
+			}
+		}
+	}
+
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+	for (size_t i = 0; i < vecWait.size(); i++)
+	{
+		while (!vecWait[i].first->IsConsumed(vecWait[i].second))
+		{
+			if (std::chrono::steady_clock::now() >= deadline)
+			{
+				return false;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+	return true;
+}
 
 void NFLogMgr::CreateNoLog()
 {
@@ -16,6 +16,10 @@
 #include "NFComm/NFCore/NFSnprintf.h"
 #include "NFComm/NFCore/NFTime.h"
 #include "NFComm/NFPluginModule/NFProtobufCommon.h"
+#include "NFComm/NFPluginModule/NFBinLog.h"
+#include <chrono>
+#include <functional>
+#include <mutex>
 
 namespace spdlog
 {
@@ -344,6 +348,9 @@ namespace nf_safe_format_detail
 }
 
 
+#define NF_LOG_ENABLE_BITMAP_BITS 64 //位图能覆盖的logId个数, 超出的不走位图
+#define NF_LOG_ENABLE_LEVEL_NUM NLL_OFF_NORMAL //位图覆盖的log等级个数
+
 class NFLogMgr : public NFSingleton<NFLogMgr>
 {
 public:
@@ -377,6 +384,10 @@ public:
             if (!IsLogIdEnable(logLevel, logId))
                 return;
 
+            //二进制模式下只拷贝格式串和参数, 格式化放到log线程
+            if (m_bBinLog.load(std::memory_order_relaxed) && LogBinary(std::integral_constant<bool, NFBinLogArgs<Args...>::value>(), logLevel, loc, logId, guid, moduleId, retCode, myFmt, args...))
+                return;
+
             try
             {
                 std::string str = fmt::format("[{}] ERR Ret:{}. ", moduleId, retCode);
@@ -476,13 +487,141 @@ public:
         return false;
     }
 
+    /**
+     * @brief 按(等级, logId)查位图, log宏在求值参数和格式化之前先调这个
+     *
+     * 只是一次数组访问和移位, 不走虚函数。logId超出位图的不拦, 交给LogFormat里的IsLogIdEnable
+     */
+    bool IsLogEnable(NF_LOG_LEVEL logLevel, uint32_t logId) const
+    {
+        if (logId >= NF_LOG_ENABLE_BITMAP_BITS || static_cast<uint32_t>(logLevel) >= NF_LOG_ENABLE_LEVEL_NUM)
+        {
+            return true;
+        }
+        return (m_logEnableBitmap[logLevel] >> logId) & 1;
+    }
+
+    /**
+     * @brief log配置变了以后按IsLogIdEnable重新生成位图
+     */
+    void UpdateLogEnable();
+
     void CreateNoLog();
 
     void NoLog(NF_LOG_LEVEL logLevel, const NFSourceLoc& loc, uint32_t logId, uint64_t guid, const std::string& log);
 
+public:
+    /**
+     * @brief 打开二进制log, 由log模块在启动log线程后调用
+     * @param ringSize 每个线程的缓冲区大小, 只对之后新建的缓冲区生效
+     * @param policy NF_BIN_LOG_POLICY
+     */
+    void EnableBinLog(uint32_t ringSize, int policy);
+
+    /**
+     * @brief 关闭二进制log, 之后的log走原来的路径, 缓冲区里剩下的由log线程取完
+     */
+    void DisableBinLog();
+
+    bool IsBinLogEnable() const { return m_bBinLog.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 把格式化好的log写进缓冲区, 给NFILogModule::LogDefault/LogBehaviour用
+     * @return 没开二进制log返回false, 调用者自己输出
+     */
+    bool LogBinaryString(NF_BIN_LOG_STRING_KIND kind, NF_LOG_LEVEL logLevel, const NFSourceLoc& loc, uint32_t logId, uint64_t guid, uint32_t module, const std::string& log);
+
+    /**
+     * @brief log线程从所有缓冲区取记录
+     * @param func 处理一条记录, 记录只在回调期间有效
+     * @return 取到的记录数
+     */
+    int ConsumeBinLog(const std::function<void(const NFBinLogRecord*)>& func);
+
+    void GetBinLogStat(NFBinLogStat& stat);
+
+    /**
+     * @brief 等log线程处理完调用时已经写进缓冲区的记录
+     *
+     * 格式化记录里的文件名, 函数名和格式化函数是指向写log的库里的指针, 卸载插件库之前必须等这些记录处理完。
+     * 之后别的线程新写的记录不等
+     * @param timeoutMs 最长等待时间
+     * @return 超时返回false
+     */
+    bool WaitBinLogConsumed(uint32_t timeoutMs);
+
+protected:
+    template <typename... Args>
+    bool LogBinary(std::false_type, NF_LOG_LEVEL logLevel, const NFSourceLoc& loc, uint32_t logId, uint64_t guid, int moduleId, int retCode, const char* myFmt, const Args&... args)
+    {
+        return false;
+    }
+
+    /**
+     * @brief 参数全部能按原始字节存的log写进缓冲区
+     * @return false表示这条log写不进缓冲区(太长), 调用者按原来的方式输出
+     */
+    template <typename... Args>
+    bool LogBinary(std::true_type, NF_LOG_LEVEL logLevel, const NFSourceLoc& loc, uint32_t logId, uint64_t guid, int moduleId, int retCode, const char* myFmt, const Args&... args)
+    {
+        NFBinLogRing* pRing = GetBinLogRing();
+        size_t fmtLen = strlen(myFmt);
+        size_t size = sizeof(NFBinLogRecord) + fmtLen + NFBinLogArgs<Args...>::Size(args...);
+        if (size > pRing->GetMaxRecordSize())
+        {
+            return false;
+        }
+
+        char* p = ReserveBinLog(pRing, static_cast<uint32_t>(size));
+        if (p == nullptr)
+        {
+            return true;
+        }
+
+        NFBinLogRecord* pRecord = reinterpret_cast<NFBinLogRecord*>(p);
+        pRecord->m_type = NF_BIN_LOG_RECORD_FORMAT;
+        pRecord->m_level = static_cast<uint8_t>(logLevel);
+        pRecord->m_kind = NF_BIN_LOG_KIND_LOC;
+        pRecord->m_logId = logId;
+        pRecord->m_moduleId = moduleId;
+        pRecord->m_retCode = retCode;
+        pRecord->m_guid = guid;
+        pRecord->m_time = std::chrono::system_clock::now().time_since_epoch().count();
+        pRecord->m_line = loc.line;
+        pRecord->m_fileLen = 0;
+        pRecord->m_funcLen = 0;
+        pRecord->m_dataLen = static_cast<uint32_t>(fmtLen);
+        pRecord->m_file = loc.filename;
+        pRecord->m_func = loc.funcname;
+        pRecord->m_formatFunc = &NFBinLogFormat<Args...>;
+        p += sizeof(NFBinLogRecord);
+        memcpy(p, myFmt, fmtLen);
+        NFBinLogArgs<Args...>::Write(p + fmtLen, args...);
+        pRing->Commit();
+        return true;
+    }
+
+    /**
+     * @brief 当前线程的缓冲区, 第一次调用时创建并登记给log线程
+     */
+    NFBinLogRing* GetBinLogRing();
+
+    /**
+     * @brief 按策略申请空间, 申请不到时计入丢弃数
+     */
+    char* ReserveBinLog(NFBinLogRing* pRing, uint32_t size);
+
 protected:
     NFILogModule* m_pLogModule;
     std::shared_ptr<spdlog::logger> m_noLogger;
+    uint64_t m_logEnableBitmap[NF_LOG_ENABLE_LEVEL_NUM]; //m_logEnableBitmap[等级]的第logId位表示是否输出
+    std::atomic<bool> m_bBinLog;
+    std::atomic<uint32_t> m_binLogRingSize;
+    std::atomic<int> m_binLogPolicy;
+    std::mutex m_binLogMutex; //只保护缓冲区列表, 线程第一次写log和log线程遍历时加锁
+    std::vector<std::shared_ptr<NFBinLogRing>> m_binLogRings;
+    uint64_t m_binLogClosedWrite; //已回收缓冲区的统计
+    uint64_t m_binLogClosedDrop;
 };
 
 void NanoFromPbLogHandle(const char* format, ...);
@@ -905,6 +1044,24 @@ struct NFSafeFormatCheckFmtStyle<true, true>
 
 #endif
 
+/**
+ * @brief 编译期保留的最低log等级, 低于它的log宏整条编译掉, 参数也不会求值
+ *
+ * debug版本全部保留, release版本去掉trace和debug, release需要trace时编译选项加-DNF_LOG_ACTIVE_LEVEL=0
+ */
+#ifndef NF_LOG_ACTIVE_LEVEL
+#ifdef NF_DEBUG_MODE
+#define NF_LOG_ACTIVE_LEVEL 0
+#else
+#define NF_LOG_ACTIVE_LEVEL 2
+#endif
+#endif
+
+/**
+ * @brief log宏先判断这条log会不会输出, 不输出的不求值参数也不格式化
+ */
+#define NF_LOG_IS_ENABLE(logLevel, logID) (static_cast<int>(logLevel) >= NF_LOG_ACTIVE_LEVEL && NFLogMgr::Instance()->IsLogEnable(logLevel, logID))
+
 #define COUNT_ARGS(...) FL_INTERNAL_ARG_COUNT_PRIVATE(0, ##__VA_ARGS__,\
 64, 63, 62, 61, 60, \
 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, \
@@ -927,32 +1084,32 @@ struct NFSafeFormatCheckFmtStyle<true, true>
 #define NFLogTrace(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogDebug(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_DEBUG_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogInfo(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_INFO_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogWarning(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_WARING_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogError(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_ERROR_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogFatal(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_CRITICAL_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogTraceIf(CONDITION, logID, guid, format, ...) 		if(CONDITION) NFLogTrace(logID, guid, format, ##__VA_ARGS__)
 #define NFLogDebugIf(CONDITION, logID, guid, format, ...) 		if(CONDITION) NFLogDebug(logID, guid, format, ##__VA_ARGS__)
@@ -964,48 +1121,48 @@ struct NFSafeFormatCheckFmtStyle<true, true>
 #define LOG_TRACE(guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_DEBUG(guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_DEBUG_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_INFO(guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_INFO_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_WARN(guid, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_WARING_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_ERR(guid, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_ERROR_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_FATAL(guid, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_CRITICAL_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_TRACE_M(guid, module, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_DEBUG_M(guid, module, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_DEBUG_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_INFO_M(guid, module, format, ...) \
     do {\
         constexpr bool LogIsHasCFormat = NFHasCFormat::execute(format);\
         constexpr bool LogIsHasFmtStyle = NFHasFmtStyle::execute(format);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_INFO_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
         constexpr bool IsStringLiteral = noexcept(NFCheckStringLiteral(format));\
         static_assert(NFSafeFormatCheckCFormat<IsStringLiteral, LogIsHasCFormat>::execute(format), "not good c format:"#format);\
         NFSafeFormatCheckCFormat<IsStringLiteral, LogIsHasCFormat>::check(format, ##__VA_ARGS__);\
@@ -1015,53 +1172,53 @@ struct NFSafeFormatCheckFmtStyle<true, true>
 #define LOG_WARN_M(guid, module, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_WARING_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_ERR_M(guid, module, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_ERROR_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_FATAL_M(guid, module, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_CRITICAL_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_ANY_M(guid, module, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
     } while (false);
 #else
 #define NFLogTrace(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogDebug(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_DEBUG_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogInfo(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_INFO_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogWarning(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_WARING_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogError(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_ERROR_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogFatal(logID, guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_CRITICAL_NORMAL, logID)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, logID, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define NFLogTraceIf(CONDITION, logID, guid, format, ...) 		if(CONDITION) NFLogTrace(logID, guid, format, ##__VA_ARGS__)
 #define NFLogDebugIf(CONDITION, logID, guid, format, ...) 		if(CONDITION) NFLogDebug(logID, guid, format, ##__VA_ARGS__)
@@ -1073,48 +1230,48 @@ struct NFSafeFormatCheckFmtStyle<true, true>
 #define LOG_TRACE(guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_DEBUG(guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_DEBUG_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_INFO(guid, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_INFO_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_WARN(guid, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_WARING_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_ERR(guid, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_ERROR_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_FATAL(guid, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_CRITICAL_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, 0, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_TRACE_M(guid, module, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_DEBUG_M(guid, module, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_DEBUG_NORMAL, NF_LOG_DEFAULT)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_DEBUG_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NF_LOG_DEFAULT, guid, module, 0, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_INFO_M(guid, module, format, ...) \
     do {\
         constexpr bool LogIsHasCFormat = NFHasCFormat::execute(format);\
         constexpr bool LogIsHasFmtStyle = NFHasFmtStyle::execute(format);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_INFO_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_INFO_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
         constexpr bool IsStringLiteral = noexcept(NFCheckStringLiteral(format));\
         NFSafeFormatCheckCFormat<IsStringLiteral, LogIsHasCFormat>::check(format, ##__VA_ARGS__);\
         constexpr size_t argsNum = COUNT_ARGS(__VA_ARGS__);\
@@ -1124,22 +1281,22 @@ struct NFSafeFormatCheckFmtStyle<true, true>
 #define LOG_WARN_M(guid, module, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_WARING_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_WARING_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_ERR_M(guid, module, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_ERROR_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_ERROR_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_FATAL_M(guid, module, retCode,  format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_CRITICAL_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_CRITICAL_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, retCode, format, ##__VA_ARGS__);\
     } while (false);
 #define LOG_ANY_M(guid, module, format, ...) \
     do {\
         CHECK_LOG(format, ##__VA_ARGS__);\
-        NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
+        if (NF_LOG_IS_ENABLE(NLL_TRACE_NORMAL, NLL_TRACE_NORMAL)) NFSafeFormat<IsStringLiteral, LogIsHasCFormat, LogIsHasFmtStyle>(NLL_TRACE_NORMAL, NFSourceLoc{NFLOG_FILE_BASENAME(__FILE__), __LINE__, NF_MACRO_FUNCTION}, NLL_TRACE_NORMAL, guid, module, 0, format, ##__VA_ARGS__);\
     } while (false);
 #endif
 
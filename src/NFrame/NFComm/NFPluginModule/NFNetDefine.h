@@ -66,6 +66,9 @@ struct NFMessageFlag
 	bool bUdp;
 	bool bActivityConnect;
     bool mSecurity;
+    std::string mSecurityKey; //安全连接的主密钥, 为空时用内置密钥
+    uint32_t mCompressType; //压缩算法, NF_PACKET_COMPRESS_TYPE
+    uint32_t mCompressMinSize; //小于这个长度的包不压缩
 	NFMessageFlag()
 	{
         mLinkId = 0;
@@ -80,6 +83,8 @@ struct NFMessageFlag
 		bUdp = false;
         bActivityConnect = true;
         mSecurity = false;
+        mCompressType = NF_PACKET_COMPRESS_NONE;
+        mCompressMinSize = NF_PACKET_COMPRESS_MIN_SIZE;
 	}
 };
 
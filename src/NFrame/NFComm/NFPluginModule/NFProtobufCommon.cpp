@@ -21,6 +21,7 @@
 #include "NFComm/NFPluginModule/NFProto/NFXmlMessageCodec.h"
 #include "NFComm/NFCore/NFCommon.h"
 #include "NFComm/NFCore/NFLock.h"
+#include "NFComm/NFObjCommon/NFSeqOP.h"
 
 #ifdef GetMessage
 #undef GetMessage
@@ -953,6 +954,74 @@ void NFProtobufCommon::GetMapDBFieldsFromMessage(const google::protobuf::Message
     }
 }
 
+void NFProtobufCommon::FilterDBFieldsByTopFields(const google::protobuf::RepeatedPtrField<std::string>& topFields, const std::map<std::string, std::string>& keyMap,
+                                                 std::map<std::string, std::string>& kevValueMap)
+{
+    if (topFields.size() <= 0) return;
+
+    for (auto iter = kevValueMap.begin(); iter != kevValueMap.end();)
+    {
+        bool bKeep = keyMap.find(iter->first) != keyMap.end();
+        for (int i = 0; i < topFields.size() && !bKeep; i++)
+        {
+            const std::string& field = topFields.Get(i);
+            if (iter->first.size() >= field.size() && iter->first.compare(0, field.size(), field) == 0 &&
+                (iter->first.size() == field.size() || iter->first[field.size()] == '_'))
+            {
+                bKeep = true;
+            }
+        }
+
+        if (bKeep)
+        {
+            ++iter;
+        }
+        else
+        {
+            iter = kevValueMap.erase(iter);
+        }
+    }
+}
+
+bool NFProtobufCommon::MakeDeltaSaveData(google::protobuf::Message* pMessage, uint64_t fieldMask, std::vector<std::string>& vecFields)
+{
+    CHECK_EXPR(pMessage, false, "pMessage == NULL");
+    const google::protobuf::Descriptor* pDesc = pMessage->GetDescriptor();
+    const google::protobuf::Reflection* pReflect = pMessage->GetReflection();
+    CHECK_EXPR(pDesc && pReflect, false, "message:{} no descriptor", pMessage->GetTypeName());
+
+    // 没有主键就没有更新条件, 只能整个对象存储
+    std::string strKey;
+    if (GetPrivateKeyFromMessage(pDesc, strKey) != 0 || strKey.empty())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < pDesc->field_count(); i++)
+    {
+        const google::protobuf::FieldDescriptor* pFieldDesc = pDesc->field(i);
+        if (pFieldDesc == NULL) continue;
+
+        // 主键和唯一索引是更新条件, 一直保留
+        if (pFieldDesc->options().GetExtension(nanopb).db_type() == E_FIELD_TYPE_PRIMARYKEY ||
+            pFieldDesc->options().GetExtension(nanopb).db_type() == E_FIELD_TYPE_UNIQUE_INDEX)
+        {
+            continue;
+        }
+
+        if (fieldMask & SEQOP_FIELD_MASK(pFieldDesc->number()))
+        {
+            vecFields.push_back(pFieldDesc->name());
+        }
+        else
+        {
+            pReflect->ClearField(pMessage, pFieldDesc);
+        }
+    }
+
+    return true;
+}
+
 void NFProtobufCommon::GetDBFieldsFromMessage(const google::protobuf::Message& message, std::vector<std::pair<std::string, std::string>>& kevValueList, const std::string& lastFieldName)
 {
     const google::protobuf::Descriptor* pDesc = message.GetDescriptor();
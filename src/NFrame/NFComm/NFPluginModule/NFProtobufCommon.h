@@ -89,6 +89,13 @@ public:
 
     static void GetDBFieldsFromMessage(const google::protobuf::Message &message, std::vector<std::pair<std::string, std::string>> &kevValueList, const std::string& lastFieldName = "");
 
+    //只保留属于这些顶层字段的列(含展开的子字段和数组列), 主键列保留, 用于按字段增量更新
+    static void FilterDBFieldsByTopFields(const google::protobuf::RepeatedPtrField<std::string>& topFields, const std::map<std::string, std::string> &keyMap, std::map<std::string, std::string> &kevValueMap);
+
+    //按NFSeqOP的字段修改掩码只保留修改过的顶层字段和主键/唯一索引, 其余顶层字段清空, vecFields返回保留的修改字段名
+    //消息没有主键时不做修改, 返回false, 调用者整个对象存储
+    static bool MakeDeltaSaveData(google::protobuf::Message* pMessage, uint64_t fieldMask, std::vector<std::string>& vecFields);
+
     static void GetDBMessageFromMapFields(const std::map<std::string, std::string> &result, google::protobuf::Message *pMessageObject, const std::string& lastFieldName = "", bool* pbAllEmpty = NULL);
 
     static int GetMessageFromMapFields(const std::unordered_map<std::string, std::string>& result, google::protobuf::Message* pMessageObject, const std::string& lastFieldName = "", bool* pbAllEmpty = NULL);
@@ -103,6 +103,20 @@ enum PacketParseType
 	PACKET_PARSE_TYPE_EXTERNAL = 1, //外部协议
 };
 
+/**
+ * @brief 网络包压缩算法
+ */
+enum NF_PACKET_COMPRESS_TYPE
+{
+	NF_PACKET_COMPRESS_NONE = 0,
+	NF_PACKET_COMPRESS_LZF  = 1, //速度优先, 适合大的快照包
+	NF_PACKET_COMPRESS_ZLIB = 2, //压缩率优先, 可以带预置字典, 适合小而重复的protobuf
+	NF_PACKET_COMPRESS_MAX,
+};
+
+//默认小于这个长度的包不压缩
+#define NF_PACKET_COMPRESS_MIN_SIZE 1024
+
 enum
 {
 	APP_INIT_TASK_GROUP_NONE                    = 0,
@@ -201,6 +215,7 @@ struct NFDataPackage
 		nDstId           = data.nDstId;
 		nSendBusLinkId   = data.nSendBusLinkId;
 		bCompress        = data.bCompress;
+		nCompressType    = data.nCompressType;
 		nServerLinkId    = data.nServerLinkId;
 		nObjectLinkId    = data.nObjectLinkId;
 		nPacketParseType = data.nPacketParseType;
@@ -226,6 +241,7 @@ struct NFDataPackage
 		nDstId           = 0;
 		nSendBusLinkId   = 0;
 		bCompress        = false;
+		nCompressType    = 0;
 		nServerLinkId    = 0;
 		nObjectLinkId    = 0;
 		nPacketParseType = 0;
@@ -294,6 +310,7 @@ struct NFDataPackage
 	uint64_t nDstId;
 	uint64_t nSendBusLinkId;
 	bool     bCompress;
+	uint32_t nCompressType; //发送时使用的压缩算法, NF_PACKET_COMPRESS_TYPE
 	uint64_t nServerLinkId;
 	uint64_t nObjectLinkId;
 	uint32_t nPacketParseType;
@@ -0,0 +1,627 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFShmFlatHashMap.h
+//    @Author           :    gaoyi
+//    @Date             :    23-2-11
+//    @Email			:    445267987@qq.com
+//    @Module           :    NFShmFlatHashMap
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include "NFShmStl.h"
+#include "NFShmPair.h"
+#include <functional>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NF_SHM_FLAT_HASH_USE_SSE2 1
+#endif
+
+#if NF_PLATFORM == NF_PLATFORM_WIN
+#include <intrin.h>
+#endif
+
+/**
+ * @file NFShmFlatHashMap.h
+ * @brief 基于共享内存的开放寻址哈希映射, Swiss Table风格
+ *
+ * @section overview 概述
+ *
+ * NFShmFlatHashMap 和 NFShmHashMap 一样是固定容量、支持CreateInit/ResumeInit的共享内存容器,
+ * 但是不再使用链地址法:
+ * - 控制字节数组m_ctrl: 每个槽一个字节, 空(-128), 已删除(-2), 或者哈希值的低7位(H2)
+ * - 查找时一次取16个控制字节(一组), SSE2下用一条比较指令得到所有H2相同的候选槽, 绝大多数查找只比较一次key
+ * - 元素连续存放在稠密数组m_values[0, size)中, 遍历只扫描size个元素, 与MAX_SIZE无关
+ * - 删除时把最后一个元素搬到空洞上, 稠密数组始终没有空洞
+ *
+ * 容器内部只保存下标, 没有任何指针, 整块内存可以直接映射到其他进程或者重启后恢复。
+ *
+ * @section stl_comparison 与NFShmHashMap对比
+ *
+ * | 特性 | NFShmHashMap | NFShmFlatHashMap |
+ * |------|--------------|------------------|
+ * | **冲突处理** | 链地址法 | 开放寻址, 16槽一组探测 |
+ * | **查找** | 至少一次下标跳转 | 控制字节组比较, 命中后一次跳转 |
+ * | **遍历** | 扫描MAX_SIZE个桶 | 扫描size个元素 |
+ * | **迭代器稳定性** | 删除其他元素不影响 | **删除会把最后一个元素搬到被删位置** |
+ * | **额外内存** | 每个元素一个int桶头 | 每个槽1字节控制位 + 2个int下标 |
+ *
+ * @section usage_examples 使用示例
+ *
+ * ```cpp
+ * NFShmFlatHashMap<int, int, 1000> map;
+ * map[1] = 100;
+ * map.insert(NFShmPair<int, int>(2, 200));
+ * auto it = map.find(1);
+ *
+ * // 边遍历边删除, erase返回的迭代器指向搬过来的元素
+ * for (auto iter = map.begin(); iter != map.end();)
+ * {
+ *     if (iter->second > 100)
+ *         iter = map.erase(iter);
+ *     else
+ *         ++iter;
+ * }
+ * ```
+ *
+ * @warning 删除元素会使指向最后一个元素的迭代器失效, 这一点与std::unordered_map不同
+ */
+
+namespace NFShmFlatHash
+{
+    /// @brief 空槽
+    static const int8_t CTRL_EMPTY = -128;
+    /// @brief 已删除的槽
+    static const int8_t CTRL_DELETED = -2;
+    /// @brief 一组控制字节的个数
+    static const int GROUP_WIDTH = 16;
+
+    constexpr size_t NextPow2(size_t n, size_t p = 1)
+    {
+        return p >= n ? p : NextPow2(n, p << 1);
+    }
+
+    /// @brief 槽数是2的幂, 并且保证MAX_SIZE个元素时负载不超过7/8
+    constexpr size_t CalcCapacity(size_t maxSize)
+    {
+        return NextPow2((maxSize * 8 + 6) / 7 > static_cast<size_t>(GROUP_WIDTH) ? (maxSize * 8 + 6) / 7 : static_cast<size_t>(GROUP_WIDTH));
+    }
+
+    /// @brief 打散哈希值, std::hash<int>是恒等函数, 不打散的话H2全部集中在低位
+    inline uint64_t Mix(size_t hash)
+    {
+        uint64_t h = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+        return h ^ (h >> 32);
+    }
+
+    inline uint32_t TrailingZeros(uint32_t mask)
+    {
+#if NF_PLATFORM == NF_PLATFORM_WIN
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+    }
+
+    /**
+     * @brief 一组16个控制字节, 每个匹配函数返回16位的掩码, 第i位表示第i个槽匹配
+     */
+    class Group
+    {
+    public:
+        explicit Group(const int8_t* pCtrl)
+        {
+#ifdef NF_SHM_FLAT_HASH_USE_SSE2
+            m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl));
+#else
+            m_pCtrl = pCtrl;
+#endif
+        }
+
+        uint32_t Match(int8_t h2) const
+        {
+#ifdef NF_SHM_FLAT_HASH_USE_SSE2
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+#else
+            uint32_t mask = 0;
+            for (int i = 0; i < GROUP_WIDTH; ++i)
+            {
+                if (m_pCtrl[i] == h2)
+                {
+                    mask |= 1u << i;
+                }
+            }
+            return mask;
+#endif
+        }
+
+        uint32_t MatchEmpty() const
+        {
+            return Match(CTRL_EMPTY);
+        }
+
+        /// @brief 空和已删除的控制字节最高位都是1
+        uint32_t MatchEmptyOrDeleted() const
+        {
+#ifdef NF_SHM_FLAT_HASH_USE_SSE2
+            return static_cast<uint32_t>(_mm_movemask_epi8(m_ctrl));
+#else
+            uint32_t mask = 0;
+            for (int i = 0; i < GROUP_WIDTH; ++i)
+            {
+                if (m_pCtrl[i] < 0)
+                {
+                    mask |= 1u << i;
+                }
+            }
+            return mask;
+#endif
+        }
+
+    private:
+#ifdef NF_SHM_FLAT_HASH_USE_SSE2
+        __m128i m_ctrl;
+#else
+        const int8_t* m_pCtrl;
+#endif
+    };
+}
+
+template <class Key, class Tp, int MAX_SIZE, class HashFcn = std::hash<Key>, class EqualKey = std::equal_to<Key>>
+class NFShmFlatHashMap;
+
+/**
+ * @brief NFShmFlatHashMap迭代器, 保存稠密数组下标, 不依赖内存地址
+ */
+template <class Map, class Value>
+struct NFShmFlatHashMapIterator
+{
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Value value_type;
+    typedef ptrdiff_t difference_type;
+    typedef Value* pointer;
+    typedef Value& reference;
+
+    Map* m_pMap;
+    int m_index;
+
+    NFShmFlatHashMapIterator() : m_pMap(nullptr), m_index(0)
+    {
+    }
+
+    NFShmFlatHashMapIterator(Map* pMap, int index) : m_pMap(pMap), m_index(index)
+    {
+    }
+
+    /// @brief 允许iterator转换为const_iterator
+    template <class OtherMap, class OtherValue>
+    NFShmFlatHashMapIterator(const NFShmFlatHashMapIterator<OtherMap, OtherValue>& other) : m_pMap(other.m_pMap), m_index(other.m_index)
+    {
+    }
+
+    reference operator*() const { return m_pMap->GetValue(m_index); }
+
+    pointer operator->() const { return &m_pMap->GetValue(m_index); }
+
+    NFShmFlatHashMapIterator& operator++()
+    {
+        ++m_index;
+        return *this;
+    }
+
+    NFShmFlatHashMapIterator operator++(int)
+    {
+        NFShmFlatHashMapIterator tmp = *this;
+        ++m_index;
+        return tmp;
+    }
+
+    template <class OtherMap, class OtherValue>
+    bool operator==(const NFShmFlatHashMapIterator<OtherMap, OtherValue>& other) const { return m_index == other.m_index && m_pMap == other.m_pMap; }
+
+    template <class OtherMap, class OtherValue>
+    bool operator!=(const NFShmFlatHashMapIterator<OtherMap, OtherValue>& other) const { return !(*this == other); }
+};
+
+template <class Key, class Tp, int MAX_SIZE, class HashFcn, class EqualKey>
+class NFShmFlatHashMap
+{
+public:
+    typedef Key key_type;
+    typedef Tp mapped_type;
+    typedef Tp data_type;
+    typedef NFShmPair<Key, Tp> value_type;
+    typedef HashFcn hasher;
+    typedef EqualKey key_equal;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+
+    typedef NFShmFlatHashMapIterator<NFShmFlatHashMap, value_type> iterator;
+    typedef NFShmFlatHashMapIterator<const NFShmFlatHashMap, const value_type> const_iterator;
+
+    friend struct NFShmFlatHashMapIterator<NFShmFlatHashMap, value_type>;
+    friend struct NFShmFlatHashMapIterator<const NFShmFlatHashMap, const value_type>;
+
+    enum
+    {
+        CAPACITY = NFShmFlatHash::CalcCapacity(MAX_SIZE), ///< 控制字节槽数
+        GROUP_COUNT = CAPACITY / NFShmFlatHash::GROUP_WIDTH, ///< 组数
+        MAX_LOAD = CAPACITY - CAPACITY / 8, ///< 元素和删除标记加起来的上限
+    };
+
+private:
+    typedef typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type AlignedStorage;
+
+    AlignedStorage m_values[MAX_SIZE]; ///< 稠密元素数组, [0, m_size)有效
+    int m_valueCtrlIdx[MAX_SIZE]; ///< 元素所在的控制槽
+    int m_ctrlValueIdx[CAPACITY]; ///< 控制槽对应的元素下标
+    int8_t m_ctrl[CAPACITY]; ///< 控制字节
+    size_type m_size; ///< 元素个数
+    size_type m_deleted; ///< 删除标记个数
+    int8_t m_init; ///< 初始化状态
+    static value_type m_staticError; ///< 错误返回值
+
+public:
+    NFShmFlatHashMap()
+    {
+        if (SHM_CREATE_MODE)
+        {
+            CreateInit();
+        }
+        else
+        {
+            ResumeInit();
+        }
+    }
+
+    NFShmFlatHashMap(const NFShmFlatHashMap& other)
+    {
+        CreateInit();
+        insert(other.begin(), other.end());
+    }
+
+    NFShmFlatHashMap& operator=(const NFShmFlatHashMap& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            insert(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    ~NFShmFlatHashMap()
+    {
+        clear();
+    }
+
+    /**
+     * @brief 创建模式初始化
+     * @return 0表示成功
+     */
+    int CreateInit()
+    {
+        memset(m_ctrl, NFShmFlatHash::CTRL_EMPTY, sizeof(m_ctrl));
+        m_size = 0;
+        m_deleted = 0;
+        m_init = EN_NF_SHM_STL_INIT_OK;
+        return 0;
+    }
+
+    /**
+     * @brief 恢复模式初始化, 对非平凡类型的元素在原地调用构造函数
+     * @return 0表示成功
+     */
+    int ResumeInit()
+    {
+        if (m_init == EN_NF_SHM_STL_INIT_OK)
+        {
+            if (!std::stl_is_trivially_default_constructible<value_type>::value)
+            {
+                for (size_type i = 0; i < m_size; i++)
+                {
+                    std::_Construct(&GetValue(i));
+                }
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief 使用placement new重新初始化
+     */
+    void Init()
+    {
+        new(this) NFShmFlatHashMap();
+    }
+
+public:
+    size_type size() const { return m_size; }
+
+    size_type max_size() const { return MAX_SIZE; }
+
+    bool empty() const { return m_size == 0; }
+
+    bool full() const { return m_size >= static_cast<size_type>(MAX_SIZE); }
+
+    size_type left_size() const { return MAX_SIZE - m_size; }
+
+    iterator begin() { return iterator(this, 0); }
+
+    iterator end() { return iterator(this, static_cast<int>(m_size)); }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    const_iterator end() const { return const_iterator(this, static_cast<int>(m_size)); }
+
+    const_iterator cbegin() const { return begin(); }
+
+    const_iterator cend() const { return end(); }
+
+public:
+    std::pair<iterator, bool> insert(const value_type& obj)
+    {
+        return InsertUnique(obj.first, obj.second);
+    }
+
+    template <class InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(*first);
+        }
+    }
+
+    std::pair<iterator, bool> emplace(const key_type& key, const mapped_type& value)
+    {
+        return InsertUnique(key, value);
+    }
+
+    iterator find(const key_type& key)
+    {
+        int index = FindIndex(key);
+        return index >= 0 ? iterator(this, index) : end();
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        int index = FindIndex(key);
+        return index >= 0 ? const_iterator(this, index) : end();
+    }
+
+    size_type count(const key_type& key) const
+    {
+        return FindIndex(key) >= 0 ? 1 : 0;
+    }
+
+    Tp& operator[](const key_type& key)
+    {
+        int index = FindIndex(key);
+        if (index >= 0)
+        {
+            return GetValue(index).second;
+        }
+
+        std::pair<iterator, bool> ret = InsertUnique(key, Tp());
+        CHECK_EXPR(ret.second, m_staticError.second, "NFShmFlatHashMap is full, max size:%d, TRACE_STACK:%s", MAX_SIZE, TRACE_STACK());
+        return ret.first->second;
+    }
+
+    Tp& at(const key_type& key)
+    {
+        int index = FindIndex(key);
+        CHECK_EXPR(index >= 0, m_staticError.second, "key not exist, TRACE_STACK:%s", TRACE_STACK());
+        return GetValue(index).second;
+    }
+
+    const Tp& at(const key_type& key) const
+    {
+        int index = FindIndex(key);
+        CHECK_EXPR(index >= 0, m_staticError.second, "key not exist, TRACE_STACK:%s", TRACE_STACK());
+        return GetValue(index).second;
+    }
+
+    size_type erase(const key_type& key)
+    {
+        int index = FindIndex(key);
+        if (index < 0)
+        {
+            return 0;
+        }
+
+        EraseIndex(index);
+        return 1;
+    }
+
+    /**
+     * @brief 删除迭代器指向的元素
+     * @return 指向原位置的迭代器, 最后一个元素已经搬到这里
+     */
+    iterator erase(const_iterator it)
+    {
+        CHECK_EXPR(it.m_pMap == this && it.m_index >= 0 && it.m_index < static_cast<int>(m_size), end(), "erase invalid iterator, TRACE_STACK:%s", TRACE_STACK());
+        EraseIndex(it.m_index);
+        return iterator(this, it.m_index);
+    }
+
+    void clear()
+    {
+        for (size_type i = 0; i < m_size; i++)
+        {
+            std::_Destroy(&GetValue(i));
+        }
+        memset(m_ctrl, NFShmFlatHash::CTRL_EMPTY, sizeof(m_ctrl));
+        m_size = 0;
+        m_deleted = 0;
+    }
+
+private:
+    value_type& GetValue(size_type index) { return reinterpret_cast<value_type*>(m_values)[index]; }
+
+    const value_type& GetValue(size_type index) const { return reinterpret_cast<const value_type*>(m_values)[index]; }
+
+    static uint64_t Hash(const key_type& key)
+    {
+        return NFShmFlatHash::Mix(hasher()(key));
+    }
+
+    static int8_t H2(uint64_t hash)
+    {
+        return static_cast<int8_t>(hash & 0x7F);
+    }
+
+    static size_type H1(uint64_t hash)
+    {
+        return static_cast<size_type>(hash >> 7);
+    }
+
+    /**
+     * @brief 查找key所在的元素下标
+     * @return 元素下标, 不存在返回-1
+     */
+    int FindIndex(const key_type& key) const
+    {
+        uint64_t hash = Hash(key);
+        int8_t h2 = H2(hash);
+        size_type group = H1(hash) & (GROUP_COUNT - 1);
+        key_equal equals;
+
+        // 按组做三角数探测, 组数是2的幂, 可以保证遍历到所有组
+        for (size_type i = 0; i < static_cast<size_type>(GROUP_COUNT); ++i)
+        {
+            size_type offset = group * NFShmFlatHash::GROUP_WIDTH;
+            NFShmFlatHash::Group g(m_ctrl + offset);
+            for (uint32_t mask = g.Match(h2); mask != 0; mask &= mask - 1)
+            {
+                int index = m_ctrlValueIdx[offset + NFShmFlatHash::TrailingZeros(mask)];
+                if (equals(GetValue(index).first, key))
+                {
+                    return index;
+                }
+            }
+
+            if (g.MatchEmpty() != 0)
+            {
+                return -1;
+            }
+
+            group = (group + i + 1) & (GROUP_COUNT - 1);
+        }
+
+        return -1;
+    }
+
+    /**
+     * @brief 沿探测序列找第一个空或者已删除的控制槽
+     */
+    size_type FindInsertSlot(uint64_t hash) const
+    {
+        size_type group = H1(hash) & (GROUP_COUNT - 1);
+        for (size_type i = 0; i < static_cast<size_type>(GROUP_COUNT); ++i)
+        {
+            size_type offset = group * NFShmFlatHash::GROUP_WIDTH;
+            uint32_t mask = NFShmFlatHash::Group(m_ctrl + offset).MatchEmptyOrDeleted();
+            if (mask != 0)
+            {
+                return offset + NFShmFlatHash::TrailingZeros(mask);
+            }
+
+            group = (group + i + 1) & (GROUP_COUNT - 1);
+        }
+
+        // 负载不超过7/8, 不会走到这里
+        return CAPACITY;
+    }
+
+    std::pair<iterator, bool> InsertUnique(const key_type& key, const mapped_type& value)
+    {
+        CHECK_EXPR(m_init == EN_NF_SHM_STL_INIT_OK, std::make_pair(end(), false), "not init, TRACE_STACK:%s", TRACE_STACK());
+
+        int index = FindIndex(key);
+        if (index >= 0)
+        {
+            return std::make_pair(iterator(this, index), false);
+        }
+
+        CHECK_EXPR(m_size < static_cast<size_type>(MAX_SIZE), std::make_pair(end(), false), "NFShmFlatHashMap is full, max size:%d, TRACE_STACK:%s", MAX_SIZE, TRACE_STACK());
+
+        if (m_size + m_deleted >= static_cast<size_type>(MAX_LOAD))
+        {
+            // 删除标记太多, 探测链变长, 原地重建控制字节, 元素本身不需要移动
+            RebuildCtrl();
+        }
+
+        uint64_t hash = Hash(key);
+        size_type slot = FindInsertSlot(hash);
+        CHECK_EXPR(slot < static_cast<size_type>(CAPACITY), std::make_pair(end(), false), "NFShmFlatHashMap no free slot, TRACE_STACK:%s", TRACE_STACK());
+
+        if (m_ctrl[slot] == NFShmFlatHash::CTRL_DELETED)
+        {
+            --m_deleted;
+        }
+
+        index = static_cast<int>(m_size);
+        new(&GetValue(index)) value_type(key, value);
+        m_ctrl[slot] = H2(hash);
+        m_ctrlValueIdx[slot] = index;
+        m_valueCtrlIdx[index] = static_cast<int>(slot);
+        ++m_size;
+
+        return std::make_pair(iterator(this, index), true);
+    }
+
+    void EraseIndex(int index)
+    {
+        int slot = m_valueCtrlIdx[index];
+        size_type offset = slot & ~(NFShmFlatHash::GROUP_WIDTH - 1);
+        // 所在的组里还有空槽, 说明任何探测都不会越过这个组, 可以直接置空, 否则只能打删除标记
+        if (NFShmFlatHash::Group(m_ctrl + offset).MatchEmpty() != 0)
+        {
+            m_ctrl[slot] = NFShmFlatHash::CTRL_EMPTY;
+        }
+        else
+        {
+            m_ctrl[slot] = NFShmFlatHash::CTRL_DELETED;
+            ++m_deleted;
+        }
+
+        std::_Destroy(&GetValue(index));
+
+        // 最后一个元素搬到空洞上, 保持稠密
+        int last = static_cast<int>(m_size) - 1;
+        if (index != last)
+        {
+            new(&GetValue(index)) value_type(GetValue(last));
+            std::_Destroy(&GetValue(last));
+            int lastSlot = m_valueCtrlIdx[last];
+            m_ctrlValueIdx[lastSlot] = index;
+            m_valueCtrlIdx[index] = lastSlot;
+        }
+
+        --m_size;
+    }
+
+    void RebuildCtrl()
+    {
+        memset(m_ctrl, NFShmFlatHash::CTRL_EMPTY, sizeof(m_ctrl));
+        m_deleted = 0;
+        for (size_type i = 0; i < m_size; i++)
+        {
+            uint64_t hash = Hash(GetValue(i).first);
+            size_type slot = FindInsertSlot(hash);
+            m_ctrl[slot] = H2(hash);
+            m_ctrlValueIdx[slot] = static_cast<int>(i);
+            m_valueCtrlIdx[i] = static_cast<int>(slot);
+        }
+    }
+};
+
+template <class Key, class Tp, int MAX_SIZE, class HashFcn, class EqualKey>
+typename NFShmFlatHashMap<Key, Tp, MAX_SIZE, HashFcn, EqualKey>::value_type NFShmFlatHashMap<Key, Tp, MAX_SIZE, HashFcn, EqualKey>::m_staticError = value_type();
@@ -325,6 +325,9 @@ struct NFShmRBTreeNodeBase
     ptrdiff_t m_right; // 右子节点索引
     NFRBTreeColor m_color; // 节点颜色
     ptrdiff_t m_self; // 自身索引，便于定位
+    // 以该节点为根的子树节点数，用于按名次查找
+    // 每个节点多8字节, 共享内存布局变了, 旧的共享内存不能恢复, 升级时要用--Init启动
+    size_t m_count;
 };
 
 inline NFShmRBTreeNodeBase::NFShmRBTreeNodeBase()
@@ -346,6 +349,7 @@ inline NFShmRBTreeNodeBase::~NFShmRBTreeNodeBase()
     m_right = INVALID_ID;
     m_color = RB_RED; // 默认新节点为红色
     m_self = INVALID_ID;
+    m_count = 0;
 }
 
 inline int NFShmRBTreeNodeBase::CreateInit()
@@ -355,6 +359,7 @@ inline int NFShmRBTreeNodeBase::CreateInit()
     m_right = INVALID_ID;
     m_color = RB_RED; // 默认新节点为红色
     m_self = INVALID_ID;
+    m_count = 0;
     return 0;
 }
 
@@ -968,6 +973,35 @@ public:
     std::pair<iterator, iterator> equal_range(const key_type& k); // 返回与k相等的范围
     std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
 
+    // ==================== 名次查询接口 ====================
+
+    /**
+     * @brief 查找排序后第k个元素（从0开始）
+     * @param k 名次
+     * @return 指向第k个元素的迭代器，k >= size()时返回end()
+     * @note STL没有对应接口，类似__gnu_pbds::tree::find_by_order()
+     *       - 每个节点维护子树节点数，复杂度：O(log n)
+     */
+    iterator NthElement(size_type k);
+    const_iterator NthElement(size_type k) const;
+
+    /**
+     * @brief 计算迭代器之前的元素个数，即该元素的名次（从0开始）
+     * @param position 元素位置，end()返回size()
+     * @return 名次
+     * @note 等价于std::distance(begin(), position)，复杂度：O(log n)
+     */
+    size_type RankOf(const_iterator position) const;
+
+    /**
+     * @brief 计算严格排在k之前的元素个数，即lower_bound(k)的名次
+     * @param k 查找的键
+     * @return 名次
+     * @note 类似__gnu_pbds::tree::order_of_key()，复杂度：O(log n)
+     *       - 需要对同值元素分先后时，把次要键放进Key并在Compare里比较
+     */
+    size_type RankOf(const key_type& k) const;
+
     // ==================== 红黑树特有验证接口 ====================
 
     /**
@@ -1026,6 +1060,8 @@ protected:
 protected:
     iterator InsertNode(NodeBase* x, NodeBase* y, const value_type& v); // 插入节点的内部实现
     int BlackCount(const NFShmRBTreeNodeBase* node, const NFShmRBTreeNodeBase* root) const; // 计算黑色节点数
+    size_t SubtreeCount(ptrdiff_t index) const; // 子树节点数，空子树为0
+    void UpdateCount(NodeBase* x); // 根据左右子树重新计算节点数
     // 删除函数
     void EraseAux(const key_type* first, const key_type* last);
     void EraseAux(const_iterator position); // 删除指定位置的元素
@@ -1511,6 +1547,10 @@ void NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::RotateLeft(NodeB
     // 步骤4: 设置x为y的左子节点
     y->m_left = x->m_self;
     x->m_parent = y->m_self;
+
+    // 步骤5: y接管x原来的整棵子树，x只剩α和β
+    y->m_count = x->m_count;
+    UpdateCount(x);
 }
 
 template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
@@ -1560,6 +1600,10 @@ void NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::RotateRight(Node
     // 步骤4: 设置x为y的右子节点
     y->m_right = x->m_self;
     x->m_parent = y->m_self;
+
+    // 步骤5: y接管x原来的整棵子树，x只剩β和γ
+    y->m_count = x->m_count;
+    UpdateCount(x);
 }
 
 template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
@@ -2074,6 +2118,12 @@ void NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::EraseAux(const_i
         x = GetNode(y->m_right);
     }
 
+    // y是实际从原位置摘下的节点，它到根路径上的子树都少一个节点（y != z时包含z）
+    for (NodeBase* p = GetNode(y->m_parent); p != nullptr && p != GetHeader(); p = GetNode(p->m_parent))
+    {
+        --p->m_count;
+    }
+
     if (y != z)
     {
         y->m_left = z->m_left;
@@ -2116,6 +2166,7 @@ void NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::EraseAux(const_i
 
 
         y->m_parent = z->m_parent;
+        y->m_count = z->m_count;
         std::swap(y->m_color, z->m_color);
         y = z;
     }
@@ -2226,6 +2277,11 @@ typename NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::iterator NFS
     z->m_parent = y->m_self;
     z->m_left = INVALID_ID;
     z->m_right = INVALID_ID;
+    z->m_count = 1;
+    for (NodeBase* p = y; p != GetHeader(); p = GetNode(p->m_parent))
+    {
+        ++p->m_count;
+    }
     RebalanceForInsert(z);
     ++m_size;
     return iterator(this, z);
@@ -2698,6 +2754,105 @@ int NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::BlackCount(const
     }
 }
 
+template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
+size_t NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::SubtreeCount(ptrdiff_t index) const
+{
+    const NodeBase* x = GetNode(index);
+    return x ? x->m_count : 0;
+}
+
+template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
+void NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::UpdateCount(NodeBase* x)
+{
+    x->m_count = SubtreeCount(x->m_left) + SubtreeCount(x->m_right) + 1;
+}
+
+template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
+typename NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::iterator NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::NthElement(size_type k)
+{
+    CHECK_EXPR(m_init == EN_NF_SHM_STL_INIT_OK, iterator(this, MAX_SIZE), "not init, TRACE_STACK:%s", TRACE_STACK());
+    if (k >= m_size)
+    {
+        return end();
+    }
+
+    // 左子树节点数等于k时就是当前节点，否则往左或减去左子树和自身后往右
+    NodeBase* x = GetRoot();
+    while (x != nullptr)
+    {
+        size_t leftCount = SubtreeCount(x->m_left);
+        if (k < leftCount)
+        {
+            x = GetNode(x->m_left);
+        }
+        else if (k == leftCount)
+        {
+            return iterator(this, x);
+        }
+        else
+        {
+            k -= leftCount + 1;
+            x = GetNode(x->m_right);
+        }
+    }
+
+    CHECK_EXPR(false, end(), "subtree count mismatch, TRACE_STACK:%s", TRACE_STACK());
+    return end();
+}
+
+template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
+typename NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::const_iterator NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::NthElement(size_type k) const
+{
+    return const_cast<NFShmRBTree*>(this)->NthElement(k);
+}
+
+template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
+typename NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::size_type NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::RankOf(const_iterator position) const
+{
+    CHECK_EXPR(m_init == EN_NF_SHM_STL_INIT_OK, 0, "not init, TRACE_STACK:%s", TRACE_STACK());
+    const NodeBase* x = position.m_node;
+    if (x == nullptr || x == GetHeader())
+    {
+        return m_size;
+    }
+
+    // 自己的左子树，加上每个从右边上来的祖先及其左子树
+    size_type rank = SubtreeCount(x->m_left);
+    const NodeBase* p = GetNode(x->m_parent);
+    while (p != nullptr && p != GetHeader())
+    {
+        if (p->m_right == x->m_self)
+        {
+            rank += SubtreeCount(p->m_left) + 1;
+        }
+        x = p;
+        p = GetNode(p->m_parent);
+    }
+    return rank;
+}
+
+template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
+typename NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::size_type NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::RankOf(const key_type& k) const
+{
+    CHECK_EXPR(m_init == EN_NF_SHM_STL_INIT_OK, 0, "not init, TRACE_STACK:%s", TRACE_STACK());
+    // 与lower_bound相同的下降路径，往右走时累加左子树和当前节点
+    size_type rank = 0;
+    const NodeBase* x = GetRoot();
+    while (x != nullptr)
+    {
+        if (m_keyCompare(GetKey(x), k))
+        {
+            rank += SubtreeCount(x->m_left) + 1;
+            x = GetNode(x->m_right);
+        }
+        else
+        {
+            x = GetNode(x->m_left);
+        }
+    }
+    return rank;
+}
+
 template <class Key, class KeyValue, class KeyOfValue, size_t MAX_SIZE, class Compare>
 bool NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::RbVerify() const
 {
@@ -2737,8 +2892,15 @@ bool NFShmRBTree<Key, KeyValue, KeyOfValue, MAX_SIZE, Compare>::RbVerify() const
         // 验证性质5：从任一节点到其每个叶子节点的所有路径包含相同数量的黑色节点
         if (!l && !r && BlackCount(x, GetRoot()) != len)
             return false;
+
+        // 验证子树节点数
+        if (x->m_count != SubtreeCount(x->m_left) + SubtreeCount(x->m_right) + 1)
+            return false;
     }
 
+    if (GetRoot()->m_count != m_size)
+        return false;
+
     // 验证最小节点和最大节点指针的正确性
     if (GetNode(GetHeader()->m_left) != Minimum(GetRoot()))
         return false;
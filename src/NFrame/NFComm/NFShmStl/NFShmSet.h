@@ -604,6 +604,26 @@ public:
      */
     std::pair<const_iterator, const_iterator> equal_range(const key_type& k) const { return m_tree.equal_range(k); }
 
+    // ==================== 名次查询（扩展功能） ====================
+
+    /**
+     * @brief 查找排序后第k个元素（从0开始），k >= size()时返回end()
+     * @note STL没有对应接口，复杂度：O(log n)
+     */
+    const_iterator NthElement(size_type k) const { return m_tree.NthElement(k); }
+
+    /**
+     * @brief 元素的名次（从0开始），等价于std::distance(begin(), position)
+     * @note 复杂度：O(log n)
+     */
+    size_type RankOf(const_iterator position) const { return m_tree.RankOf(position); }
+
+    /**
+     * @brief 严格排在k之前的元素个数，即lower_bound(k)的名次
+     * @note 复杂度：O(log n)
+     */
+    size_type RankOf(const key_type& k) const { return m_tree.RankOf(k); }
+
     // ==================== 交换操作（STL兼容） ====================
 
     /**
@@ -1548,6 +1548,136 @@ public:
     int m_iRet;
 };
 
+/**
+ * @class NFDbBatchWriteTask
+ * @brief 合并写任务, 把同一张表短时间内的InsertObj/ModifyObj攒成一批, 在一个事务里提交。
+ *
+ * 原来的插入/修改任务不再单独投递, 由这个任务持有, 执行完以后把各自的结果填回去,
+ * 在主线程里按原来的顺序调用它们的MainThreadProcess, 回调和不合并时完全一样。
+ */
+class NFDbBatchWriteTask final : public NFDbTask
+{
+public:
+    /**
+     * @brief 构造函数
+     * @param strServerId 服务器ID
+     * @param strTbName 表名
+     * @param ullBalanceId 第一条请求的mod_key, 保证和不合并时落在同一个actor上
+     */
+    NFDbBatchWriteTask(const std::string& strServerId, const std::string& strTbName, uint64_t ullBalanceId) : NFDbTask(strServerId)
+    {
+        m_balanceId = ullBalanceId;
+        m_ullStartTime = NFGetTime();
+        m_ullByteSize = 0;
+        m_taskName = GET_CLASS_NAME(NFDbBatchWriteTask) + std::string("_") + strTbName;
+    }
+
+    /**
+     * @brief 析构函数, 释放持有的插入/修改任务
+     */
+    ~NFDbBatchWriteTask() override
+    {
+        for (size_t i = 0; i < m_vecTask.size(); i++)
+        {
+            NF_SAFE_DELETE(m_vecTask[i]);
+        }
+        m_vecTask.clear();
+    }
+
+    /**
+     * @brief 加入一条插入请求
+     */
+    void AddInsertObj(NFDbInsertObjTask* pTask)
+    {
+        NFMysqlBatchWriteItem item;
+        item.m_pInsert = &pTask->m_stSelect;
+        item.m_pInsertRes = &pTask->m_stSelectRes;
+        m_vecItem.push_back(item);
+        m_vecTask.push_back(pTask);
+        m_ullByteSize += pTask->m_stSelect.record().size();
+    }
+
+    /**
+     * @brief 加入一条修改请求
+     */
+    void AddModifyObj(NFDbModifyObjTask* pTask)
+    {
+        NFMysqlBatchWriteItem item;
+        item.m_pModify = &pTask->m_stSelect;
+        item.m_pModifyRes = &pTask->m_stSelectRes;
+        m_vecItem.push_back(item);
+        m_vecTask.push_back(pTask);
+        m_ullByteSize += pTask->m_stSelect.record().size();
+    }
+
+    /**
+     * @brief 行数或字节数到上限了, 需要马上提交
+     */
+    bool IsFull() const
+    {
+        return m_vecItem.size() >= NF_ASY_DB_BATCH_WRITE_MAX_ROW || m_ullByteSize >= NF_ASY_DB_BATCH_WRITE_MAX_BYTE;
+    }
+
+    /**
+     * @brief 攒够时间了
+     */
+    bool IsTimeOut(uint64_t ullNow) const
+    {
+        return ullNow >= m_ullStartTime + NF_ASY_DB_BATCH_WRITE_WINDOW;
+    }
+
+    /**
+     * @brief 异步线程处理函数，整批写入数据库，结果写回每条请求。
+     * @return 始终返回true
+     */
+    bool ThreadProcess() override
+    {
+        if (m_pMysqlDriver)
+        {
+            m_pMysqlDriver->BatchWriteObj(m_vecItem);
+        }
+        else
+        {
+            for (size_t i = 0; i < m_vecItem.size(); i++)
+            {
+                m_vecItem[i].m_iRet = -1;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief 主线程处理函数，按请求顺序把结果交给原来的任务，由它们调用各自的回调。
+     * @return 返回TPTASK_STATE_COMPLETED
+     */
+    TPTaskState MainThreadProcess() override
+    {
+        for (size_t i = 0; i < m_vecItem.size(); i++)
+        {
+            NFDbTask* pTask = m_vecTask[i];
+            pTask->m_runActorGroup = m_runActorGroup;
+            pTask->m_nextActorGroup = m_runActorGroup;
+            if (m_vecItem[i].m_pInsert)
+            {
+                static_cast<NFDbInsertObjTask*>(pTask)->m_iRet = m_vecItem[i].m_iRet;
+            }
+            else
+            {
+                static_cast<NFDbModifyObjTask*>(pTask)->m_iRet = m_vecItem[i].m_iRet;
+            }
+            pTask->MainThreadProcess();
+        }
+        return TPTASK_STATE_COMPLETED;
+    }
+
+public:
+    std::vector<NFMysqlBatchWriteItem> m_vecItem; ///< 每条请求的数据和结果, 指向m_vecTask里的任务
+    std::vector<NFDbTask*> m_vecTask; ///< 原来的插入/修改任务
+    uint64_t m_ullStartTime; ///< 第一条请求加入的时间
+    uint64_t m_ullByteSize; ///< 已经攒了多少字节的record
+};
+
 /**
  * @class NFDbTaskComponent
  * @brief 该类继承自NFITaskComponent，用于管理与数据库相关的任务。
@@ -1676,9 +1806,17 @@ NFCAsyDbModule::NFCAsyDbModule(NFIPluginManager* pPluginManager) : NFIAsyDbModul
 {
     m_ullLastCheckTime = NFGetTime();
     m_bInitComponent = false;
+    m_bStopBatchWrite = false;
 }
 
-NFCAsyDbModule::~NFCAsyDbModule() = default;
+NFCAsyDbModule::~NFCAsyDbModule()
+{
+    for (auto iter = m_mapBatchWrite.begin(); iter != m_mapBatchWrite.end(); ++iter)
+    {
+        NF_SAFE_DELETE(iter->second);
+    }
+    m_mapBatchWrite.clear();
+}
 
 /**
  * @brief 初始化Actor池
@@ -1779,6 +1917,7 @@ int NFCAsyDbModule::DeleteByCond(const std::string& strServerId, const NFrame::s
                                  const DeleteByCondCb& bCallback)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
     if (bUseCache)
     {
         auto* pTask = NF_NEW NFDbDeleteByCondTask(strServerId, stSelect, bCallback, bUseCache);
@@ -1801,6 +1940,7 @@ int NFCAsyDbModule::DeleteObj(const std::string& strServerId, const NFrame::stor
                               const DeleteObjCb& bCallback)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
     if (bUseCache)
     {
         auto* pTask = NF_NEW NFDbDeleteObjTask(strServerId, stSelect, bCallback, bUseCache);
@@ -1824,8 +1964,22 @@ int NFCAsyDbModule::InsertObj(const std::string& strServerId, const NFrame::stor
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
     auto* pTask = NF_NEW NFDbInsertObjTask(strServerId, stSelect, fCallback, bUseCache);
-    int iRet = AddTask(NF_ASY_TASK_WRITE_GROUP, pTask);
-    CHECK_EXPR(iRet == 0, -1, "AddTask Failed");
+    if (bUseCache || m_bStopBatchWrite)
+    {
+        FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
+        int iRet = AddTask(NF_ASY_TASK_WRITE_GROUP, pTask);
+        CHECK_EXPR(iRet == 0, -1, "AddTask Failed");
+    }
+    else
+    {
+        NFDbBatchWriteTask* pBatchTask = GetBatchWriteTask(strServerId, stSelect.baseinfo().tbname(), stSelect.mod_key());
+        CHECK_EXPR(pBatchTask, -1, "GetBatchWriteTask Failed");
+        pBatchTask->AddInsertObj(pTask);
+        if (pBatchTask->IsFull())
+        {
+            FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
+        }
+    }
 
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
     return 0;
@@ -1835,6 +1989,7 @@ int NFCAsyDbModule::ModifyByCond(const std::string& strServerId, const NFrame::s
                                  const ModifyByCondCb& fCallback)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
     if (bUseCache)
     {
         auto* pTask = NF_NEW NFDbModifyByCondTask(strServerId, stSelect, fCallback, bUseCache);
@@ -1858,16 +2013,29 @@ int NFCAsyDbModule::ModifyObj(const std::string& strServerId, const NFrame::stor
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
     if (bUseCache)
     {
+        FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
         auto* pTask = NF_NEW NFDbModifyObjTask(strServerId, stSelect, bCallback, bUseCache);
         int iRet = AddTask(NF_ASY_TASK_READ_GROUP, pTask);
         CHECK_EXPR(iRet == 0, -1, "AddTask Failed");
     }
-    else
+    else if (m_bStopBatchWrite)
     {
+        FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
         auto* pTask = NF_NEW NFDbModifyObjTask(strServerId, stSelect, bCallback, bUseCache);
         int iRet = AddTask(NF_ASY_TASK_WRITE_GROUP, pTask);
         CHECK_EXPR(iRet == 0, -1, "AddTask Failed");
     }
+    else
+    {
+        NFDbBatchWriteTask* pBatchTask = GetBatchWriteTask(strServerId, stSelect.baseinfo().tbname(), stSelect.mod_key());
+        CHECK_EXPR(pBatchTask, -1, "GetBatchWriteTask Failed");
+        auto* pTask = NF_NEW NFDbModifyObjTask(strServerId, stSelect, bCallback, bUseCache);
+        pBatchTask->AddModifyObj(pTask);
+        if (pBatchTask->IsFull())
+        {
+            FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
+        }
+    }
 
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
     return 0;
@@ -1877,6 +2045,7 @@ int NFCAsyDbModule::UpdateByCond(const std::string& strServerId, const NFrame::s
                                  const UpdateByCondCb& fCallback)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
     if (bUseCache)
     {
         auto* pTask = NF_NEW NFDbUpdateByCondTask(strServerId, stSelect, fCallback, bUseCache);
@@ -1898,6 +2067,7 @@ int NFCAsyDbModule::UpdateObj(const std::string& strServerId, const NFrame::stor
                               const UpdateObjCb& fCallback)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    FlushBatchWrite(strServerId, stSelect.baseinfo().tbname());
     if (bUseCache)
     {
         auto* pTask = NF_NEW NFDbUpdateObjTask(strServerId, stSelect, fCallback, bUseCache);
@@ -1919,6 +2089,8 @@ int NFCAsyDbModule::Execute(const std::string& strServerId, const NFrame::stores
                             const ExecuteCb& fCallback)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    //不知道sql改哪张表, 全部先提交
+    FlushBatchWrite(true);
     auto* pTask = NF_NEW NFDbExecuteTask(strServerId, stSelect, fCallback);
     int iRet = AddTask(NF_ASY_TASK_WRITE_GROUP, pTask);
     CHECK_EXPR(iRet == 0, -1, "AddTask Failed");
@@ -1930,6 +2102,8 @@ int NFCAsyDbModule::ExecuteMore(const std::string& strServerId, const NFrame::st
                                 const ExecuteMoreCb& fCallback)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    //不知道sql改哪张表, 全部先提交
+    FlushBatchWrite(true);
     auto* pTask = NF_NEW NFDbExecuteMoreTask(strServerId, stSelect, fCallback);
     int iRet = AddTask(NF_ASY_TASK_WRITE_GROUP, pTask);
     CHECK_EXPR(iRet == 0, -1, "AddTask Failed");
@@ -1940,6 +2114,7 @@ int NFCAsyDbModule::ExecuteMore(const std::string& strServerId, const NFrame::st
 bool NFCAsyDbModule::Execute()
 {
     if (!m_bInitComponent) return true;
+    FlushBatchWrite(false);
     if (NFGetTime() - m_ullLastCheckTime < 10000) return true;
 
     m_ullLastCheckTime = NFGetTime();
@@ -1955,3 +2130,80 @@ bool NFCAsyDbModule::Execute()
 
     return true;
 }
+
+bool NFCAsyDbModule::BeforeShut()
+{
+    m_bStopBatchWrite = true;
+    FlushBatchWrite(true);
+    return true;
+}
+
+NFDbBatchWriteTask* NFCAsyDbModule::GetBatchWriteTask(const std::string& strServerId, const std::string& strTbName, uint64_t ullModKey)
+{
+    //mod_key为0的请求本来就随机分配actor, 统一攒到一起
+    int iActorId = 0;
+    if (ullModKey != 0)
+    {
+        iActorId = GetBalanceActor(NF_ASY_TASK_WRITE_GROUP, ullModKey);
+        CHECK_EXPR(iActorId > 0, nullptr, "GetBalanceActor Failed, modKey:{}", ullModKey);
+    }
+
+    std::string strKey = strServerId + "|" + strTbName + "|" + NFCommon::tostr(iActorId);
+    auto iter = m_mapBatchWrite.find(strKey);
+    if (iter != m_mapBatchWrite.end())
+    {
+        return iter->second;
+    }
+
+    auto* pTask = NF_NEW NFDbBatchWriteTask(strServerId, strTbName, ullModKey);
+    m_mapBatchWrite.emplace(strKey, pTask);
+    return pTask;
+}
+
+void NFCAsyDbModule::FlushBatchWrite(const std::string& strServerId, const std::string& strTbName)
+{
+    std::string strPrefix = strServerId + "|" + strTbName + "|";
+    auto iter = m_mapBatchWrite.lower_bound(strPrefix);
+    while (iter != m_mapBatchWrite.end() && iter->first.compare(0, strPrefix.size(), strPrefix) == 0)
+    {
+        AddBatchWriteTask(iter->second);
+        iter = m_mapBatchWrite.erase(iter);
+    }
+}
+
+void NFCAsyDbModule::FlushBatchWrite(bool bAll)
+{
+    uint64_t ullNow = NFGetTime();
+    for (auto iter = m_mapBatchWrite.begin(); iter != m_mapBatchWrite.end();)
+    {
+        if (bAll || iter->second->IsTimeOut(ullNow))
+        {
+            AddBatchWriteTask(iter->second);
+            iter = m_mapBatchWrite.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+int NFCAsyDbModule::AddBatchWriteTask(NFDbBatchWriteTask* pTask)
+{
+    CHECK_NULL(0, pTask);
+    int iRet = AddTask(NF_ASY_TASK_WRITE_GROUP, pTask);
+    if (iRet != 0)
+    {
+        //投递失败也要给每条请求回调
+        NFLogError(NF_LOG_DEFAULT, 0, "AddTask Failed, task:{}", pTask->m_taskName);
+        for (size_t i = 0; i < pTask->m_vecItem.size(); i++)
+        {
+            pTask->m_vecItem[i].m_iRet = -1;
+        }
+        pTask->m_runActorGroup = NF_ASY_TASK_WRITE_GROUP;
+        pTask->MainThreadProcess();
+        NF_SAFE_DELETE(pTask);
+        return -1;
+    }
+    return 0;
+}
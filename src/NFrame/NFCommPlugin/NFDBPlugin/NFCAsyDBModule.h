@@ -12,6 +12,11 @@
 #include "NFCMysqlDriverManager.h"
 #include "NFCMysqlDriver.h"
 
+#define NF_ASY_DB_BATCH_WRITE_WINDOW 10 //合并写最多攒多少毫秒
+#define NF_ASY_DB_BATCH_WRITE_MAX_ROW 64 //合并写一批最多多少行
+#define NF_ASY_DB_BATCH_WRITE_MAX_BYTE (512 * 1024) //合并写一批record最多多少字节, 要小于mysql的max_allowed_packet
+
+class NFDbBatchWriteTask;
 
 /**
  * @brief 异步mysql
@@ -38,6 +43,11 @@ public:
 	 */
 	bool Execute() override;
 
+	/**
+	 * @brief 关服前把攒着的合并写全部提交
+	 */
+	bool BeforeShut() override;
+
 	/**
 	 * @brief 初始化Actor池
 	 * @param iMaxTaskGroup 最大任务组数量，用于控制并发任务的数量
@@ -176,6 +186,37 @@ public:
 	int ExecuteMore(const std::string& strServerId, const NFrame::storesvr_execute_more& stSelect, const ExecuteMoreCb& fCallback) override;
 
 private:
+	/**
+	 * @brief 取一个还没提交的合并写任务, 没有就新建
+	 *
+	 * 按(服务器, 表, 写组actor)分开攒, 同一个mod_key的请求和不合并的请求落在同一个actor上, 顺序不变
+	 * @param strServerId 服务器ID
+	 * @param strTbName 表名
+	 * @param ullModKey 请求的mod_key
+	 * @return 合并写任务, 失败返回nullptr
+	 */
+	NFDbBatchWriteTask* GetBatchWriteTask(const std::string& strServerId, const std::string& strTbName, uint64_t ullModKey);
+
+	/**
+	 * @brief 提交一张表所有攒着的合并写, 同一张表的其它写操作之前调用, 保证先后顺序
+	 * @param strServerId 服务器ID
+	 * @param strTbName 表名
+	 */
+	void FlushBatchWrite(const std::string& strServerId, const std::string& strTbName);
+
+	/**
+	 * @brief 提交攒够时间的合并写
+	 * @param bAll true表示不管时间全部提交
+	 */
+	void FlushBatchWrite(bool bAll);
+
+	/**
+	 * @brief 把一个合并写任务交给写组执行
+	 * @param pTask 合并写任务
+	 * @return 0成功
+	 */
+	int AddBatchWriteTask(NFDbBatchWriteTask* pTask);
+
 	/**
 	 * @brief 最后一次检查时间的变量，用于记录某个操作或事件的上次检查时间。
 	 *
@@ -189,4 +230,16 @@ private:
 	 * 该变量通常用于控制组件的初始化流程，确保组件在首次使用时被正确初始化。
 	 */
 	bool m_bInitComponent;
+
+	/**
+	 * @brief 还没提交的合并写任务, key为"服务器ID|表名|actor"
+	 *
+	 * 用有序map, 按"服务器ID|表名|"前缀就能找到一张表的所有合并写
+	 */
+	std::map<std::string, NFDbBatchWriteTask*> m_mapBatchWrite;
+
+	/**
+	 * @brief 关服以后不再合并, 直接提交
+	 */
+	bool m_bStopBatchWrite;
 };
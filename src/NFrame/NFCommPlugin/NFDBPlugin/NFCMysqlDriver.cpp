@@ -2,6 +2,7 @@
 #include "NFComm/NFCore/NFCommon.h"
 #include "NFComm/NFPluginModule/NFProtobufCommon.h"
 #include "NFComm/NFPluginModule/NFCheck.h"
+#include "mysqlpp/dbdriver.h"
 
 //m_pMysqlConnect在调用Connect会引发多线程的崩溃，必须枷锁
 NFMutex NFCMysqlDriver::m_stConnectLock;
@@ -105,58 +106,45 @@ int NFCMysqlDriver::Execute(const NFrame::storesvr_execute& select, NFrame::stor
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "query:{}", select.record());
 
-    std::vector<std::map<std::string, std::string>> resultVec;
     std::string errorMsg;
-    int iRet = ExecuteMore(select.record(), resultVec, errorMsg);
-    if (iRet != 0)
+    google::protobuf::Message* pMessage = CreateTableMessage(select.baseinfo().package_name(), select.baseinfo().clname());
+    if (pMessage == nullptr)
     {
-        selectRes.mutable_opres()->set_errmsg(errorMsg);
+        selectRes.mutable_opres()->set_errmsg("CreateTableMessage Failed");
         return -1;
     }
 
-    selectRes.mutable_baseinfo()->CopyFrom(select.baseinfo());
-    selectRes.mutable_opres()->set_mod_key(select.mod_key());
-
-    for (size_t i = 0; i < resultVec.size(); i++)
+    bool bFirst = true;
+    int iRet = ExecuteMore(select.record(), pMessage, [&](google::protobuf::Message* pRow)
     {
-        const std::map<std::string, std::string>& result = resultVec[i];
+        if (!bFirst) return;
+        bFirst = false;
+        selectRes.set_record(pRow->SerializePartialAsString());
+        NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pRow->Utf8DebugString());
+    }, errorMsg);
+    NF_SAFE_DELETE(pMessage);
 
-        google::protobuf::Message* pMessage = nullptr;
-        iRet = TransTableRowToMessage(result, select.baseinfo().package_name(), select.baseinfo().clname(), &pMessage);
-        if (iRet == 0 && pMessage != nullptr)
-        {
-            selectRes.set_record(pMessage->SerializePartialAsString());
-            NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pMessage->Utf8DebugString());
-        }
-        else
-        {
-            NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} sql:{}",
-                       NFCommon::tostr(result), select.record());
-            iRet = -1;
-        }
-
-        if (pMessage != nullptr)
-        {
-            NF_SAFE_DELETE(pMessage);
-        }
-
-        break;
+    if (iRet != 0)
+    {
+        selectRes.mutable_opres()->set_errmsg(errorMsg);
+        return -1;
     }
 
-    return iRet;
+    selectRes.mutable_baseinfo()->CopyFrom(select.baseinfo());
+    selectRes.mutable_opres()->set_mod_key(select.mod_key());
+    return 0;
 }
 
 int NFCMysqlDriver::ExecuteMore(const NFrame::storesvr_execute_more& select,
                                 ::google::protobuf::RepeatedPtrField<NFrame::storesvr_execute_more_res>& vecSelectRes)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
-    std::vector<std::map<std::string, std::string>> resultVec;
     std::string errorMsg;
-    int iRet = ExecuteMore(select.record(), resultVec, errorMsg);
-    if (iRet != 0)
+    google::protobuf::Message* pMessage = CreateTableMessage(select.baseinfo().package_name(), select.baseinfo().clname());
+    if (pMessage == nullptr)
     {
         NFrame::storesvr_execute_more_res* select_res = vecSelectRes.Add();
-        select_res->mutable_opres()->set_errmsg(errorMsg);
+        select_res->mutable_opres()->set_errmsg("CreateTableMessage Failed");
         return -1;
     }
 
@@ -167,89 +155,65 @@ int NFCMysqlDriver::ExecuteMore(const NFrame::storesvr_execute_more& select,
     select_res->set_is_lastbatch(false);
 
     int count = 0;
-    for (size_t i = 0; i < resultVec.size(); i++)
+    int iRet = ExecuteMore(select.record(), pMessage, [&](google::protobuf::Message* pRow)
     {
-        const std::map<std::string, std::string>& result = resultVec[i];
+        select_res->add_record(pRow->SerializePartialAsString());
 
-        google::protobuf::Message* pMessage = nullptr;
-        iRet = TransTableRowToMessage(result, select.baseinfo().package_name(), select.baseinfo().clname(), &pMessage);
-        if (iRet == 0 && pMessage != nullptr)
+        count++;
+        select_res->set_row_count(count);
+        if (select_res->record_size() >= static_cast<int>(select.baseinfo().max_records()))
         {
-            select_res->add_record(pMessage->SerializePartialAsString());
+            count = 0;
+            select_res = vecSelectRes.Add();
 
-            count++;
-            select_res->set_row_count(count);
-            if (select_res->record_size() >= static_cast<int>(select.baseinfo().max_records()))
-            {
-                count = 0;
-                select_res = vecSelectRes.Add();
-
-                select_res->mutable_baseinfo()->CopyFrom(select.baseinfo());
-                select_res->mutable_opres()->set_mod_key(select.mod_key());
-                select_res->set_is_lastbatch(false);
-            }
-            NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pMessage->Utf8DebugString());
-        }
-        else
-        {
-            NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} tableName:{}",
-                       NFCommon::tostr(result), select.baseinfo().clname());
-            iRet = -1;
+            select_res->mutable_baseinfo()->CopyFrom(select.baseinfo());
+            select_res->mutable_opres()->set_mod_key(select.mod_key());
+            select_res->set_is_lastbatch(false);
         }
+        NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pRow->Utf8DebugString());
+    }, errorMsg);
+    NF_SAFE_DELETE(pMessage);
 
-        if (pMessage != nullptr)
-        {
-            NF_SAFE_DELETE(pMessage);
-        }
+    if (iRet != 0)
+    {
+        select_res->mutable_opres()->set_errmsg(errorMsg);
+        return -1;
     }
 
     select_res->set_is_lastbatch(true);
 
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
-    return iRet;
+    return 0;
 }
 
 int NFCMysqlDriver::ExecuteMore(const NFrame::storesvr_execute_more& select, NFrame::storesvr_execute_more_res& selectRes)
 {
     NFLogTrace(NF_LOG_DEFAULT, 0, "query:{}", select.record());
 
-    std::vector<std::map<std::string, std::string>> resultVec;
     std::string errorMsg;
-    int iRet = ExecuteMore(select.record(), resultVec, errorMsg);
-    if (iRet != 0)
+    google::protobuf::Message* pMessage = CreateTableMessage(select.baseinfo().package_name(), select.baseinfo().clname());
+    if (pMessage == nullptr)
     {
-        selectRes.mutable_opres()->set_errmsg(errorMsg);
+        selectRes.mutable_opres()->set_errmsg("CreateTableMessage Failed");
         return -1;
     }
 
-    selectRes.mutable_baseinfo()->CopyFrom(select.baseinfo());
-    selectRes.mutable_opres()->set_mod_key(select.mod_key());
-
-    for (size_t i = 0; i < resultVec.size(); i++)
+    int iRet = ExecuteMore(select.record(), pMessage, [&](google::protobuf::Message* pRow)
     {
-        const std::map<std::string, std::string>& result = resultVec[i];
+        selectRes.add_record(pRow->SerializePartialAsString());
+        NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pRow->Utf8DebugString());
+    }, errorMsg);
+    NF_SAFE_DELETE(pMessage);
 
-        google::protobuf::Message* pMessage = nullptr;
-        iRet = TransTableRowToMessage(result, select.baseinfo().package_name(), select.baseinfo().clname(), &pMessage);
-        if (iRet == 0 && pMessage != nullptr)
-        {
-            selectRes.add_record(pMessage->SerializePartialAsString());
-            NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pMessage->Utf8DebugString());
-        }
-        else
-        {
-            NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} sql:{}",
-                       NFCommon::tostr(result), select.record());
-            iRet = -1;
-        }
-
-        if (pMessage != nullptr)
-        {
-            NF_SAFE_DELETE(pMessage);
-        }
+    if (iRet != 0)
+    {
+        selectRes.mutable_opres()->set_errmsg(errorMsg);
+        return -1;
     }
 
-    return iRet;
+    selectRes.mutable_baseinfo()->CopyFrom(select.baseinfo());
+    selectRes.mutable_opres()->set_mod_key(select.mod_key());
+    return 0;
 }
 
 int NFCMysqlDriver::ExecuteMore(const std::string& qstr, std::vector<std::map<std::string, std::string>>& valueVec,
@@ -279,6 +243,44 @@ int NFCMysqlDriver::ExecuteMore(const std::string& qstr, std::vector<std::map<st
     return -1;
 }
 
+int NFCMysqlDriver::ExecuteMore(const std::string& qstr, google::protobuf::Message* pMessage, const std::function<void(google::protobuf::Message*)>& rowFunc, std::string& errorMsg)
+{
+    CHECK_EXPR(pMessage, -1, "pMessage == NULL");
+    NFLogInfo(NF_LOG_DEFAULT, 0, "query:{}", qstr);
+
+    mysqlpp::StoreQueryResult queryResult;
+    if (NFCMysqlDriver::Query(qstr, queryResult, errorMsg) != 0)
+    {
+        return -1;
+    }
+
+    if (queryResult.num_rows() == 0)
+    {
+        return 0;
+    }
+
+    const NFCMysqlRowDecoder* pDecoder = GetRowDecoder(pMessage->GetDescriptor(), *queryResult.field_names());
+    CHECK_EXPR(pDecoder, -1, "GetRowDecoder Failed, message:{}", pMessage->GetDescriptor()->full_name());
+
+    std::vector<NFMysqlColumnValue> vecColumn(queryResult.num_fields());
+    for (size_t i = 0; i < queryResult.num_rows(); ++i)
+    {
+        const mysqlpp::Row& row = queryResult[i];
+        for (size_t j = 0; j < vecColumn.size(); j++)
+        {
+            const mysqlpp::String& value = row[j];
+            vecColumn[j].m_bNull = value.is_null();
+            vecColumn[j].m_pData = value.data();
+            vecColumn[j].m_iLength = value.length();
+        }
+
+        pMessage->Clear();
+        pDecoder->Decode(vecColumn.data(), pMessage);
+        rowFunc(pMessage);
+    }
+    return 0;
+}
+
 /**
  * @brief 执行sql语句, 把数据库配置表里的数据取出来
  *
@@ -427,6 +429,23 @@ int NFCMysqlDriver::TransTableRowToMessage(const std::map<std::string, std::stri
     return 0;
 }
 
+google::protobuf::Message* NFCMysqlDriver::CreateTableMessage(const std::string& packageName, const std::string& className) const
+{
+    std::string proto_fullname;
+    if (packageName.empty())
+    {
+        proto_fullname = DEFINE_DEFAULT_PROTO_PACKAGE_ADD + className;
+    }
+    else
+    {
+        proto_fullname = packageName + "." + className;
+    }
+
+    ::google::protobuf::Message* pMessageObject = NFProtobufCommon::Instance()->CreateDynamicMessageByName(proto_fullname);
+    CHECK_EXPR(pMessageObject, nullptr, "{} New Failed", proto_fullname);
+    return pMessageObject;
+}
+
 int
 NFCMysqlDriver::SelectByCond(const NFrame::storesvr_sel& select, std::string& privateKey, std::unordered_set<std::string>& fields, std::unordered_set<std::string>& privateKeySet)
 {
@@ -476,42 +495,31 @@ int NFCMysqlDriver::SelectByCond(const std::string& packageName, const std::stri
     iRet = CreateSql(tableName, privateKey, leftPrivateKeySet, selectSql);
     CHECK_EXPR(iRet == 0, -1, "CreateSql Failed:{}", selectSql);
 
-    std::vector<std::map<std::string, std::string>> resultVec;
-    std::string errmsg;
-    iRet = ExecuteMore(selectSql, resultVec, errmsg);
-    if (iRet != 0)
+    google::protobuf::Message* pMessage = CreateTableMessage(packageName, className);
+    CHECK_EXPR(pMessage, -1, "CreateTableMessage Failed, tableName:{}", tableName);
+
+    const google::protobuf::FieldDescriptor* pKeyFieldDesc = pMessage->GetDescriptor()->FindFieldByName(privateKey);
+    if (pKeyFieldDesc == nullptr)
     {
+        NFLogError(NF_LOG_DEFAULT, 0, "privateKey:{} not found in {}, tableName:{}", privateKey, className, tableName);
+        NF_SAFE_DELETE(pMessage);
         return -1;
     }
 
-    for (size_t i = 0; i < resultVec.size(); i++)
+    std::string errmsg;
+    iRet = ExecuteMore(selectSql, pMessage, [&](google::protobuf::Message* pRow)
     {
-        const std::map<std::string, std::string>& result = resultVec[i];
-
-        google::protobuf::Message* pMessage = nullptr;
-        iRet = TransTableRowToMessage(result, packageName, className, &pMessage);
-        auto iter = result.find(privateKey);
-        if (iRet == 0 && pMessage != nullptr && iter != result.end())
-        {
-            std::string record = pMessage->SerializePartialAsString();
-            recordsMap.emplace(iter->second, record);
-            NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pMessage->Utf8DebugString());
-        }
-        else
-        {
-            NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} tableName:{}",
-                       NFCommon::tostr(result), tableName);
-            iRet = -1;
-        }
-
-        if (pMessage != nullptr)
-        {
-            NF_SAFE_DELETE(pMessage);
-        }
+        recordsMap.emplace(NFProtobufCommon::GetFieldsString(*pRow, pKeyFieldDesc), pRow->SerializePartialAsString());
+        NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pRow->Utf8DebugString());
+    }, errmsg);
+    NF_SAFE_DELETE(pMessage);
+    if (iRet != 0)
+    {
+        return -1;
     }
 
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
-    return iRet;
+    return 0;
 }
 
 int NFCMysqlDriver::SelectByCond(const NFrame::storesvr_sel& select,
@@ -523,13 +531,11 @@ int NFCMysqlDriver::SelectByCond(const NFrame::storesvr_sel& select,
     iRet = CreateSql(select, selectSql);
     CHECK_EXPR(iRet == 0, -1, "CreateSql Failed:{}", selectSql);
 
-    std::vector<std::map<std::string, std::string>> resultVec;
-    std::string errmsg;
-    iRet = ExecuteMore(selectSql, resultVec, errmsg);
-    if (iRet != 0)
+    google::protobuf::Message* pMessage = CreateTableMessage(select.baseinfo().package_name(), select.baseinfo().clname());
+    if (pMessage == nullptr)
     {
         NFrame::storesvr_sel_res* select_res = vecSelectRes.Add();
-        select_res->mutable_opres()->set_errmsg(errmsg);
+        select_res->mutable_opres()->set_errmsg("CreateTableMessage Failed");
         return -1;
     }
 
@@ -540,46 +546,36 @@ int NFCMysqlDriver::SelectByCond(const NFrame::storesvr_sel& select,
     select_res->set_is_lastbatch(false);
 
     int count = 0;
-    for (size_t i = 0; i < resultVec.size(); i++)
+    std::string errmsg;
+    iRet = ExecuteMore(selectSql, pMessage, [&](google::protobuf::Message* pRow)
     {
-        const std::map<std::string, std::string>& result = resultVec[i];
+        select_res->add_record(pRow->SerializePartialAsString());
 
-        google::protobuf::Message* pMessage = nullptr;
-        iRet = TransTableRowToMessage(result, select.baseinfo().package_name(), select.baseinfo().clname(), &pMessage);
-        if (iRet == 0 && pMessage != nullptr)
+        count++;
+        select_res->set_row_count(count);
+        if (select_res->record_size() >= static_cast<int>(select.baseinfo().max_records()))
         {
-            select_res->add_record(pMessage->SerializePartialAsString());
-
-            count++;
-            select_res->set_row_count(count);
-            if (select_res->record_size() >= static_cast<int>(select.baseinfo().max_records()))
-            {
-                count = 0;
-                select_res = vecSelectRes.Add();
+            count = 0;
+            select_res = vecSelectRes.Add();
 
-                select_res->mutable_baseinfo()->CopyFrom(select.baseinfo());
-                select_res->mutable_opres()->set_mod_key(select.cond().mod_key());
-                select_res->set_is_lastbatch(false);
-            }
-            NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pMessage->Utf8DebugString());
-        }
-        else
-        {
-            NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} tableName:{}",
-                       NFCommon::tostr(result), select.baseinfo().tbname());
-            iRet = -1;
+            select_res->mutable_baseinfo()->CopyFrom(select.baseinfo());
+            select_res->mutable_opres()->set_mod_key(select.cond().mod_key());
+            select_res->set_is_lastbatch(false);
         }
+        NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pRow->Utf8DebugString());
+    }, errmsg);
+    NF_SAFE_DELETE(pMessage);
 
-        if (pMessage != nullptr)
-        {
-            NF_SAFE_DELETE(pMessage);
-        }
+    if (iRet != 0)
+    {
+        select_res->mutable_opres()->set_errmsg(errmsg);
+        return -1;
     }
 
     select_res->set_is_lastbatch(true);
 
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
-    return iRet;
+    return 0;
 }
 
 int NFCMysqlDriver::GetPrivateKeySql(const NFrame::storesvr_sel& select, std::string& privateKey, std::string& selectSql)
@@ -768,45 +764,34 @@ int NFCMysqlDriver::SelectByCond(const NFrame::storesvr_sel& select,
 
     *selectRes.mutable_baseinfo() = select.baseinfo();
     selectRes.mutable_opres()->set_mod_key(select.cond().mod_key());
-    std::vector<std::map<std::string, std::string>> resultVec;
-    std::string errmsg;
-    iRet = ExecuteMore(selectSql, resultVec, errmsg);
-    if (iRet != 0)
+
+    google::protobuf::Message* pMessage = CreateTableMessage(select.baseinfo().package_name(), select.baseinfo().clname());
+    if (pMessage == nullptr)
     {
-        selectRes.mutable_opres()->set_errmsg(errmsg);
+        selectRes.mutable_opres()->set_errmsg("CreateTableMessage Failed");
         return -1;
     }
 
-    selectRes.set_is_lastbatch(true);
-
     int count = 0;
-    for (size_t i = 0; i < resultVec.size(); i++)
+    std::string errmsg;
+    iRet = ExecuteMore(selectSql, pMessage, [&](google::protobuf::Message* pRow)
     {
-        const std::map<std::string, std::string>& result = resultVec[i];
+        count++;
+        selectRes.add_record(pRow->SerializePartialAsString());
+        NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pRow->Utf8DebugString());
+    }, errmsg);
+    NF_SAFE_DELETE(pMessage);
 
-        google::protobuf::Message* pMessage = nullptr;
-        iRet = TransTableRowToMessage(result, select.baseinfo().package_name(), select.baseinfo().clname(), &pMessage);
-        if (iRet == 0 && pMessage != nullptr)
-        {
-            count++;
-            selectRes.add_record(pMessage->SerializePartialAsString());
-            NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pMessage->Utf8DebugString());
-        }
-        else
-        {
-            NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} tableName:{}",
-                       NFCommon::tostr(result), select.baseinfo().tbname());
-            iRet = -1;
-        }
-        if (pMessage != nullptr)
-        {
-            NF_SAFE_DELETE(pMessage);
-        }
+    if (iRet != 0)
+    {
+        selectRes.mutable_opres()->set_errmsg(errmsg);
+        return -1;
     }
 
+    selectRes.set_is_lastbatch(true);
     selectRes.set_row_count(count);
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
-    return iRet;
+    return 0;
 }
 
 int NFCMysqlDriver::SelectObj(const std::string& tbName, google::protobuf::Message* pMessage, std::string& errMsg)
@@ -852,32 +837,25 @@ int NFCMysqlDriver::SelectObj(const NFrame::storesvr_selobj& select,
         vecFields.push_back(select.baseinfo().sel_fields(i));
     }
 
-    std::map<std::string, std::string> result;
-    std::string errmsg;
-    iRet = QueryOne(select.baseinfo().tbname(), keyMap, vecFields, result, errmsg);
-    if (iRet != 0)
+    google::protobuf::Message* pMessage = CreateTableMessage(select.baseinfo().package_name(), select.baseinfo().clname());
+    if (pMessage == nullptr)
     {
-        selectRes.mutable_opres()->set_errmsg(errmsg);
-        return iRet;
+        selectRes.mutable_opres()->set_errmsg("CreateTableMessage Failed");
+        return -1;
     }
 
-    google::protobuf::Message* pMessage = nullptr;
-    iRet = TransTableRowToMessage(result, select.baseinfo().package_name(), select.baseinfo().clname(), &pMessage);
-    if (iRet == 0 && pMessage != nullptr)
+    std::string errmsg;
+    iRet = QueryOne(select.baseinfo().tbname(), keyMap, vecFields, pMessage, errmsg);
+    if (iRet == 0)
     {
         selectRes.set_record(pMessage->SerializePartialAsString());
         NFLogTrace(NF_LOG_DEFAULT, 0, "{}", pMessage->Utf8DebugString());
     }
     else
     {
-        NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} tableName:{}",
-                   NFCommon::tostr(result), select.baseinfo().tbname());
-        iRet = -1;
-    }
-    if (pMessage != nullptr)
-    {
-        NF_SAFE_DELETE(pMessage);
+        selectRes.mutable_opres()->set_errmsg(errmsg);
     }
+    NF_SAFE_DELETE(pMessage);
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
     return iRet;
 }
@@ -891,30 +869,16 @@ int NFCMysqlDriver::SelectObj(const std::string& packageName, const std::string&
 
     std::vector<std::string> vecFields;
 
-    std::map<std::string, std::string> result;
-    std::string errmsg;
-    iRet = QueryOne(tbName, keyMap, vecFields, result, errmsg);
-    if (iRet != 0)
-    {
-        return iRet;
-    }
+    google::protobuf::Message* pMessage = CreateTableMessage(packageName, className);
+    CHECK_EXPR(pMessage, -1, "CreateTableMessage Failed, tableName:{}", tbName);
 
-    google::protobuf::Message* pMessage = nullptr;
-    iRet = TransTableRowToMessage(result, packageName, className, &pMessage);
-    if (iRet == 0 && pMessage != nullptr)
+    std::string errmsg;
+    iRet = QueryOne(tbName, keyMap, vecFields, pMessage, errmsg);
+    if (iRet == 0)
     {
         record = pMessage->SerializePartialAsString();
     }
-    else
-    {
-        NFLogError(NF_LOG_DEFAULT, 0, "TransTableRowToMessage Failed, result:{} tableName:{}",
-                   NFCommon::tostr(result), tbName);
-        iRet = -1;
-    }
-    if (pMessage != nullptr)
-    {
-        NF_SAFE_DELETE(pMessage);
-    }
+    NF_SAFE_DELETE(pMessage);
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
     return iRet;
 }
@@ -1759,6 +1723,7 @@ void NFCMysqlDriver::CloseConnection()
     if (m_pMysqlConnect)
     {
         NFLogInfo(NF_LOG_DEFAULT, 0, "CloseConnection dbName:{} dbHost:{} dbPort:{}", m_strDbName, m_strDbHost, m_iDbPort);
+        ClearStmt();
         delete m_pMysqlConnect;
         m_pMysqlConnect = nullptr;
     }
@@ -1889,6 +1854,81 @@ int NFCMysqlDriver::Disconnect()
     return 0;
 }
 
+NFCMysqlStmt* NFCMysqlDriver::GetStmt(const std::string& key, const std::string& sql, const google::protobuf::Descriptor* pDesc, std::string& errorMsg)
+{
+    auto iter = m_mapStmt.find(key);
+    if (iter != m_mapStmt.end())
+    {
+        return iter->second;
+    }
+
+    mysqlpp::Connection* pConnection = GetConnection();
+    if (pConnection == nullptr || pConnection->driver() == nullptr)
+    {
+        return nullptr;
+    }
+
+    NFCMysqlStmt* pStmt = new NFCMysqlStmt();
+    if (pStmt->Prepare(pConnection->driver()->mysql_handle(), sql, errorMsg) != 0)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "stmt prepare failed, sql:{} error:{}", sql, errorMsg);
+        NF_SAFE_DELETE(pStmt);
+        return nullptr;
+    }
+
+    if (pStmt->GetDecoder().Compile(pDesc, pStmt->GetColumnNames()) != 0)
+    {
+        NF_SAFE_DELETE(pStmt);
+        return nullptr;
+    }
+
+    m_mapStmt.emplace(key, pStmt);
+    return pStmt;
+}
+
+void NFCMysqlDriver::ReleaseStmt(const std::string& key)
+{
+    auto iter = m_mapStmt.find(key);
+    if (iter != m_mapStmt.end())
+    {
+        NF_SAFE_DELETE(iter->second);
+        m_mapStmt.erase(iter);
+    }
+}
+
+void NFCMysqlDriver::ClearStmt()
+{
+    for (auto iter = m_mapStmt.begin(); iter != m_mapStmt.end(); ++iter)
+    {
+        NF_SAFE_DELETE(iter->second);
+    }
+    m_mapStmt.clear();
+}
+
+const NFCMysqlRowDecoder* NFCMysqlDriver::GetRowDecoder(const google::protobuf::Descriptor* pDesc, const mysqlpp::FieldNames& fieldNames)
+{
+    CHECK_EXPR(pDesc, nullptr, "pDesc == NULL");
+    std::string key = pDesc->full_name();
+    for (size_t i = 0; i < fieldNames.size(); i++)
+    {
+        key += "|" + fieldNames[i];
+    }
+
+    auto iter = m_mapRowDecoder.find(key);
+    if (iter != m_mapRowDecoder.end())
+    {
+        return &iter->second;
+    }
+
+    NFCMysqlRowDecoder& decoder = m_mapRowDecoder[key];
+    if (decoder.Compile(pDesc, fieldNames) != 0)
+    {
+        m_mapRowDecoder.erase(key);
+        return nullptr;
+    }
+    return &decoder;
+}
+
 int NFCMysqlDriver::Update(const std::string& strTableName, const std::map<std::string, std::string>& keyMap,
                            const std::map<std::string, std::string>& keyValueMap,
                            std::string& errorMsg)
@@ -2206,6 +2246,89 @@ int NFCMysqlDriver::QueryOne(const std::string& strTableName, const std::map<std
     return 0;
 }
 
+int NFCMysqlDriver::QueryOne(const std::string& strTableName, const std::map<std::string, std::string>& keyMap,
+                             const std::vector<std::string>& fieldVec,
+                             google::protobuf::Message* pMessage, std::string& errorMsg)
+{
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    CHECK_EXPR(pMessage, -1, "pMessage == NULL");
+    CHECK_EXPR(!keyMap.empty(), -1, "keyMap empty, tableName:{}", strTableName);
+    pMessage->Clear();
+
+    //(表, 操作, 查询列, 条件列, message类型)确定一条预处理语句, 条件值走参数
+    std::string key = "one|" + strTableName + "|";
+    std::string sql = "SELECT ";
+    if (fieldVec.empty())
+    {
+        sql += "*";
+    }
+    for (size_t i = 0; i < fieldVec.size(); i++)
+    {
+        key += fieldVec[i] + ",";
+        sql += (i == 0 ? "" : ",") + fieldVec[i];
+    }
+    key += "|";
+    sql += " FROM " + strTableName + " WHERE ";
+
+    std::vector<const std::string*> vecParam;
+    for (auto iter = keyMap.begin(); iter != keyMap.end(); ++iter)
+    {
+        key += iter->first + ",";
+        sql += (iter == keyMap.begin() ? "" : " and ") + iter->first + " = ?";
+        vecParam.push_back(&iter->second);
+    }
+    key += "|" + pMessage->GetDescriptor()->full_name();
+    sql += " limit 1;";
+
+    NFCMysqlStmt* pStmt = GetStmt(key, sql, pMessage->GetDescriptor(), errorMsg);
+    if (pStmt)
+    {
+        int iRet = pStmt->Execute(vecParam, errorMsg);
+        if (iRet == 0)
+        {
+            iRet = pStmt->Fetch(errorMsg);
+            if (iRet == 0)
+            {
+                pStmt->GetDecoder().Decode(pStmt->GetColumns(), pMessage);
+            }
+            pStmt->FreeResult();
+
+            if (iRet == 0)
+            {
+                NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
+                return 0;
+            }
+
+            if (iRet == 1)
+            {
+                return NFrame::ERR_CODE_STORESVR_ERRCODE_SELECT_EMPTY;
+            }
+        }
+
+        NFLogError(NF_LOG_DEFAULT, 0, "stmt query failed, sql:{} error:{}", sql, errorMsg);
+        //sql本身的错误拼sql也一样会错, 不再重试
+        if (!pStmt->IsNeedReprepare())
+        {
+            return -1;
+        }
+
+        //断线重连或表结构变化后语句失效, 丢掉重新预处理, 这一次走拼sql
+        ReleaseStmt(key);
+    }
+
+    std::map<std::string, std::string> result;
+    int iRet = QueryOne(strTableName, keyMap, fieldVec, result, errorMsg);
+    if (iRet != 0)
+    {
+        return iRet;
+    }
+
+    pMessage->Clear();
+    NFProtobufCommon::GetDBMessageFromMapFields(result, pMessage);
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
+    return 0;
+}
+
 int NFCMysqlDriver::QueryMore(const std::string& strTableName, const std::map<std::string, std::string>& keyMap,
                               const std::vector<std::string>& fieldVec,
                               std::vector<std::map<std::string, std::string>>& valueVec, std::string& errorMsg)
@@ -2801,6 +2924,213 @@ int NFCMysqlDriver::ModifyObj(const NFrame::storesvr_modobj& select,
     return 0;
 }
 
+/**
+ * @brief 两行能不能放进同一条多行INSERT: 类型相同并且列名完全一样
+ */
+static bool IsSameBatchWriteRow(const NFMysqlBatchWriteRow& first, const NFMysqlBatchWriteRow& row)
+{
+    if (first.m_iType != row.m_iType || first.m_iType == NFMysqlBatchWriteRow::ROW_UPDATE)
+    {
+        return false;
+    }
+
+    if (first.m_mapColumn.size() != row.m_mapColumn.size() || first.m_mapKey.size() != row.m_mapKey.size())
+    {
+        return false;
+    }
+
+    for (auto iter = first.m_mapColumn.begin(), iterRow = row.m_mapColumn.begin(); iter != first.m_mapColumn.end(); ++iter, ++iterRow)
+    {
+        if (iter->first != iterRow->first)
+        {
+            return false;
+        }
+    }
+
+    for (auto iter = first.m_mapKey.begin(), iterRow = row.m_mapKey.begin(); iter != first.m_mapKey.end(); ++iter, ++iterRow)
+    {
+        if (iter->first != iterRow->first)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int NFCMysqlDriver::BatchWriteObj(std::vector<NFMysqlBatchWriteItem>& vecItem)
+{
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    std::string strTableName;
+    std::vector<NFMysqlBatchWriteRow> vecRow;
+    std::vector<size_t> vecRowItem; //vecRow[i]对应的vecItem下标
+    vecRow.reserve(vecItem.size());
+    vecRowItem.reserve(vecItem.size());
+    for (size_t i = 0; i < vecItem.size(); i++)
+    {
+        NFMysqlBatchWriteItem& item = vecItem[i];
+        NFMysqlBatchWriteRow row;
+        int iRet = 0;
+        if (item.m_pInsert)
+        {
+            *item.m_pInsertRes->mutable_baseinfo() = item.m_pInsert->baseinfo();
+            item.m_pInsertRes->mutable_opres()->set_mod_key(item.m_pInsert->mod_key());
+            strTableName = item.m_pInsert->baseinfo().tbname();
+
+            row.m_iType = NFMysqlBatchWriteRow::ROW_INSERT;
+            iRet = CreateSql(*item.m_pInsert, row.m_mapColumn);
+            if (iRet != 0)
+            {
+                item.m_pInsertRes->mutable_opres()->set_errmsg("CreateSql Failed");
+            }
+        }
+        else if (item.m_pModify)
+        {
+            *item.m_pModifyRes->mutable_baseinfo() = item.m_pModify->baseinfo();
+            item.m_pModifyRes->mutable_opres()->set_mod_key(item.m_pModify->mod_key());
+            strTableName = item.m_pModify->baseinfo().tbname();
+
+            //不能合成upsert, 行被删掉后晚到的保存会把它写回来, 不管批里有几行都和ModifyObj一样UPDATE
+            row.m_iType = NFMysqlBatchWriteRow::ROW_UPDATE;
+            iRet = CreateSql(*item.m_pModify, row.m_mapKey, row.m_mapColumn);
+            if (iRet != 0)
+            {
+                item.m_pModifyRes->mutable_opres()->set_errmsg("CreateSql Failed");
+            }
+        }
+        else
+        {
+            iRet = -1;
+        }
+
+        item.m_iRet = iRet;
+        if (iRet == 0)
+        {
+            vecRow.push_back(row);
+            vecRowItem.push_back(i);
+        }
+    }
+
+    if (vecRow.empty())
+    {
+        return -1;
+    }
+
+    std::string errorMsg;
+    int iRet = -1;
+    if (vecRow.size() > 1)
+    {
+        iRet = BatchWrite(strTableName, vecRow, errorMsg);
+        if (iRet == 0)
+        {
+            NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
+            return 0;
+        }
+
+        NFLogError(NF_LOG_DEFAULT, 0, "BatchWrite table:{} row:{} failed:{}, retry one by one", strTableName, vecRow.size(), errorMsg);
+    }
+
+    //事务已经回滚, 逐条执行给每条请求各自的结果
+    for (size_t i = 0; i < vecRowItem.size(); i++)
+    {
+        NFMysqlBatchWriteItem& item = vecItem[vecRowItem[i]];
+        if (item.m_pInsert)
+        {
+            item.m_iRet = InsertObj(*item.m_pInsert, *item.m_pInsertRes);
+        }
+        else
+        {
+            item.m_iRet = ModifyObj(*item.m_pModify, *item.m_pModifyRes);
+        }
+    }
+
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
+    return iRet;
+}
+
+int NFCMysqlDriver::BatchWrite(const std::string& strTableName, const std::vector<NFMysqlBatchWriteRow>& vecRow, std::string& errorMsg)
+{
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
+    mysqlpp::Connection* pConnection = GetConnection();
+    if (nullptr == pConnection)
+    {
+        errorMsg = "no connection";
+        return -1;
+    }
+
+    NFMYSQLTRYBEGIN
+        //出错时析构会回滚
+        mysqlpp::Transaction trans(*pConnection);
+        size_t begin = 0;
+        while (begin < vecRow.size())
+        {
+            const NFMysqlBatchWriteRow& first = vecRow[begin];
+            if (first.m_iType == NFMysqlBatchWriteRow::ROW_UPDATE)
+            {
+                if (Modify(strTableName, first.m_mapKey, first.m_mapColumn, errorMsg) != 0)
+                {
+                    return -1;
+                }
+                begin++;
+                continue;
+            }
+
+            size_t end = begin + 1;
+            while (end < vecRow.size() && IsSameBatchWriteRow(first, vecRow[end]))
+            {
+                end++;
+            }
+
+            mysqlpp::Query query = pConnection->query();
+            query << "INSERT INTO " << strTableName << "(";
+            int i = 0;
+            for (auto iter = first.m_mapColumn.begin(); iter != first.m_mapColumn.end(); ++iter)
+            {
+                if (i == 0)
+                {
+                    query << iter->first;
+                }
+                else
+                {
+                    query << ", " << iter->first;
+                }
+                i++;
+            }
+
+            query << ") VALUES ";
+            for (size_t j = begin; j < end; j++)
+            {
+                query << (j == begin ? "(" : ", (");
+                i = 0;
+                for (auto iter = vecRow[j].m_mapColumn.begin(); iter != vecRow[j].m_mapColumn.end(); ++iter)
+                {
+                    if (i == 0)
+                    {
+                        query << mysqlpp::quote << iter->second;
+                    }
+                    else
+                    {
+                        query << ", " << mysqlpp::quote << iter->second;
+                    }
+                    i++;
+                }
+                query << ")";
+            }
+
+            query << ";";
+
+            NFLogTrace(NF_LOG_DEFAULT, 0, "query:{}", query.str());
+            query.execute();
+            query.reset();
+            begin = end;
+        }
+        trans.commit();
+    NFMYSQLTRYEND("batch write error")
+
+    NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
+    return 0;
+}
+
 int NFCMysqlDriver::CreateSql(const NFrame::storesvr_mod& select, std::map<std::string, std::string>& keyMap,
                               std::map<std::string, std::string>& kevValueMap)
 {
@@ -2883,6 +3213,9 @@ int NFCMysqlDriver::CreateSql(const NFrame::storesvr_modobj& select, std::map<st
     NFProtobufCommon::GetMapDBFieldsFromMessage(*pMessageObject, keyMap, kevValueMap);
     delete pMessageObject;
 
+    // 按字段增量存储, 只更新修改过的列
+    NFProtobufCommon::FilterDBFieldsByTopFields(select.baseinfo().sel_fields(), keyMap, kevValueMap);
+
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
     return 0;
 }
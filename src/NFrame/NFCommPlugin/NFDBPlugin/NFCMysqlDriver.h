@@ -40,6 +40,8 @@
 
 #include <string>
 #include <vector>
+#include <functional>
+#include <unordered_map>
 #include "mysqlpp/mysql++.h"
 #include "NFComm/NFKernelMessage/FrameSqlData.pb.h"
 #include "NFComm/NFCore/NFQueue.hpp"
@@ -47,6 +49,7 @@
 #include "mysqlpp/connection.h"
 #include "NFComm/NFPluginModule/NFLogMgr.h"
 #include "NFComm/NFPluginModule/NFProtobufCommon.h"
+#include "NFCMysqlStmt.h"
 
 #define  NFMYSQLTRYBEGIN try {
 
@@ -79,6 +82,42 @@
 //////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief 合并写里的一条请求, m_pInsert和m_pModify只会有一个不为空
+ */
+struct NFMysqlBatchWriteItem
+{
+    NFMysqlBatchWriteItem() : m_pInsert(nullptr), m_pInsertRes(nullptr), m_pModify(nullptr), m_pModifyRes(nullptr), m_iRet(0)
+    {
+    }
+
+    const NFrame::storesvr_insertobj* m_pInsert;
+    NFrame::storesvr_insertobj_res* m_pInsertRes;
+    const NFrame::storesvr_modobj* m_pModify;
+    NFrame::storesvr_modobj_res* m_pModifyRes;
+    int m_iRet; //这条请求自己的结果
+};
+
+/**
+ * @brief 合并写时一条请求生成的一行
+ */
+struct NFMysqlBatchWriteRow
+{
+    enum
+    {
+        ROW_INSERT = 0, //INSERT
+        ROW_UPDATE = 1, //modify, 和ModifyObj一样单独UPDATE, 行不存在时不会插入
+    };
+
+    NFMysqlBatchWriteRow() : m_iType(ROW_INSERT)
+    {
+    }
+
+    int m_iType;
+    std::map<std::string, std::string> m_mapColumn; //ROW_INSERT是所有列, ROW_UPDATE是要改的列
+    std::map<std::string, std::string> m_mapKey; //ROW_UPDATE的主键列
+};
+
 /**
 * @brief mysql驱动， 里面有一个myql连接
 ** 实现了通过protobuf的反射来存取数据，使用方法如下：
@@ -175,6 +214,20 @@ public:
      */
     int ExecuteMore(const std::string& qstr, std::vector<std::map<std::string, std::string>>& valueVec, std::string& errorMsg);
 
+    /**
+     * @brief 执行SQL语句, 每一行直接解码到pMessage后回调
+     *
+     * 不再为每一行构造std::map<列名,值>, 按message类型和列名编译好的NFCMysqlRowDecoder直接写字段,
+     * pMessage在每一行解码前Clear, 回调里需要保留的数据要自己拷走
+     *
+     * @param qstr SQL语句
+     * @param pMessage 解码用的消息, 所有行复用
+     * @param rowFunc 每一行的回调
+     * @param errorMsg 错误信息
+     * @return int 0表示成功, 非0表示失败
+     */
+    int ExecuteMore(const std::string& qstr, google::protobuf::Message* pMessage, const std::function<void(google::protobuf::Message*)>& rowFunc, std::string& errorMsg);
+
     /**
      * @brief 执行存储过程或查询
      *
@@ -477,6 +530,25 @@ public:
      */
     int ModifyObj(const NFrame::storesvr_modobj& select, NFrame::storesvr_modobj_res& selectRes);
 
+    /**
+     * @brief 合并写同一张表的一批InsertObj/ModifyObj
+     *
+     * 相邻的列相同的insert合成一条多行INSERT, modify和ModifyObj一样逐条UPDATE(删掉的行不会被晚到的保存写回来),
+     * 所有语句放在一个事务里提交。事务失败就回滚, 再一条一条重新执行, 给每条请求各自的结果
+     * @param vecItem 按请求顺序, 结果写回每个item的m_iRet和res
+     * @return 0整批在一个事务里成功, 否则是逐条执行的
+     */
+    int BatchWriteObj(std::vector<NFMysqlBatchWriteItem>& vecItem);
+
+    /**
+     * @brief 在一个事务里执行合并写的所有行
+     * @param strTableName 表名
+     * @param vecRow 按请求顺序
+     * @param errorMsg 错误信息
+     * @return 0成功, 失败时事务已回滚
+     */
+    int BatchWrite(const std::string& strTableName, const std::vector<NFMysqlBatchWriteRow>& vecRow, std::string& errorMsg);
+
     /**
      * @brief 根据修改条件创建SQL语句
      * @param select 修改条件
@@ -582,6 +654,11 @@ public:
      */
     int TransTableRowToMessage(const std::map<std::string, std::string>& result, const std::string& packageName, const std::string& className, google::protobuf::Message** pMessage) const;
 
+    /**
+     * @brief 按包名和类名创建一个空的protobuf消息, 由调用者释放
+     */
+    google::protobuf::Message* CreateTableMessage(const std::string& packageName, const std::string& className) const;
+
     /**
      * @brief 获取MySQL连接对象
      * @return 返回MySQL连接对象指针
@@ -671,6 +748,22 @@ public:
      */
     int QueryOne(const std::string& strTableName, const std::map<std::string, std::string>& keyMap, std::map<std::string, std::string>& valueVec, std::string& errorMsg);
 
+    /**
+     * @brief 查询单条数据并直接解码到pMessage
+     *
+     * 按(表, 操作, 查询列, 条件列)缓存预处理语句, 走二进制协议, 条件值按参数绑定不再拼进sql,
+     * 结果不经过std::map直接写进pMessage。预处理失败, 或者执行时语句失效(断线, 表结构变化, 不支持的类型)时丢掉这条语句,
+     * 退回到拼sql的QueryOne; sql本身的错误直接返回-1
+     *
+     * @param strTableName 表名
+     * @param keyMap 查询条件映射
+     * @param fieldVec 要查询的字段列表, 为空表示所有字段
+     * @param pMessage 返回的数据
+     * @param errorMsg 错误信息
+     * @return 执行结果，0表示成功，非0表示失败
+     */
+    int QueryOne(const std::string& strTableName, const std::map<std::string, std::string>& keyMap, const std::vector<std::string>& fieldVec, google::protobuf::Message* pMessage, std::string& errorMsg);
+
     /**
      * @brief 查询多条数据
      * @param strTableName 表名
@@ -815,6 +908,28 @@ public:
      */
     int Disconnect();
 
+private:
+    /**
+     * @brief 取缓存的预处理语句, 没有就预处理一条
+     * @return 失败返回nullptr
+     */
+    NFCMysqlStmt* GetStmt(const std::string& key, const std::string& sql, const google::protobuf::Descriptor* pDesc, std::string& errorMsg);
+
+    /**
+     * @brief 关闭并丢掉一条预处理语句
+     */
+    void ReleaseStmt(const std::string& key);
+
+    /**
+     * @brief 关闭所有预处理语句, 断开连接前调用
+     */
+    void ClearStmt();
+
+    /**
+     * @brief 取按message类型和列名编译好的文本协议解码器
+     */
+    const NFCMysqlRowDecoder* GetRowDecoder(const google::protobuf::Descriptor* pDesc, const mysqlpp::FieldNames& fieldNames);
+
 private:
     std::string m_strDbName; // 数据库名称
     std::string m_strDbHost; // 数据库主机地址
@@ -829,4 +944,7 @@ private:
     int m_iReconnectCount; // 重连次数计数器
 
     static NFMutex m_stConnectLock; // 连接锁，用于防止多线程调用Connect时崩溃
+
+    std::unordered_map<std::string, NFCMysqlStmt*> m_mapStmt; // 预处理语句缓存, key为(表, 操作, 查询列, 条件列, message类型)
+    std::unordered_map<std::string, NFCMysqlRowDecoder> m_mapRowDecoder; // 文本协议解码器缓存, key为(message类型, 列名)
 };
@@ -0,0 +1,381 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFCMysqlRowDecoder.cpp
+//    @Author           :    gaoyi
+//    @Date             :   2025-05-06
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFCMysqlRowDecoder
+//
+// -------------------------------------------------------------------------
+
+#include "NFCMysqlRowDecoder.h"
+#include <stdlib.h>
+#include <string.h>
+#include "NFComm/NFCore/NFCommon.h"
+#include "NFComm/NFPluginModule/NFProtobufCommon.h"
+#include "NFComm/NFPluginModule/NFCheck.h"
+
+namespace
+{
+    //文本列转数值, 与NFCommon::strto一样空串当作0
+    class NFMysqlTextNumber
+    {
+    public:
+        explicit NFMysqlTextNumber(const NFMysqlColumnValue& value)
+        {
+            size_t len = value.m_bNull ? 0 : value.m_iLength;
+            if (len >= sizeof(m_szBuf))
+            {
+                len = sizeof(m_szBuf) - 1;
+            }
+            if (len > 0)
+            {
+                memcpy(m_szBuf, value.m_pData, len);
+            }
+            m_szBuf[len] = '\0';
+        }
+
+        int64_t ToInt64() const { return strtoll(m_szBuf, nullptr, 10); }
+        uint64_t ToUInt64() const { return strtoull(m_szBuf, nullptr, 10); }
+        double ToDouble() const { return strtod(m_szBuf, nullptr); }
+
+    private:
+        char m_szBuf[64];
+    };
+
+    int64_t ColumnToInt64(const NFMysqlColumnValue& value)
+    {
+        switch (value.m_iType)
+        {
+            case NFMysqlColumnValue::VALUE_INT:
+                return value.m_iValue;
+            case NFMysqlColumnValue::VALUE_UINT:
+                return static_cast<int64_t>(value.m_uValue);
+            case NFMysqlColumnValue::VALUE_DOUBLE:
+                return static_cast<int64_t>(value.m_dValue);
+            default:
+                return NFMysqlTextNumber(value).ToInt64();
+        }
+    }
+
+    uint64_t ColumnToUInt64(const NFMysqlColumnValue& value)
+    {
+        switch (value.m_iType)
+        {
+            case NFMysqlColumnValue::VALUE_INT:
+                return static_cast<uint64_t>(value.m_iValue);
+            case NFMysqlColumnValue::VALUE_UINT:
+                return value.m_uValue;
+            case NFMysqlColumnValue::VALUE_DOUBLE:
+                return static_cast<uint64_t>(value.m_dValue);
+            default:
+                return NFMysqlTextNumber(value).ToUInt64();
+        }
+    }
+
+    double ColumnToDouble(const NFMysqlColumnValue& value)
+    {
+        switch (value.m_iType)
+        {
+            case NFMysqlColumnValue::VALUE_INT:
+                return static_cast<double>(value.m_iValue);
+            case NFMysqlColumnValue::VALUE_UINT:
+                return static_cast<double>(value.m_uValue);
+            case NFMysqlColumnValue::VALUE_DOUBLE:
+                return value.m_dValue;
+            default:
+                return NFMysqlTextNumber(value).ToDouble();
+        }
+    }
+
+    //还原成文本协议下的字符串, 只在少见的类型组合下使用
+    std::string ColumnToString(const NFMysqlColumnValue& value)
+    {
+        if (value.m_bNull)
+        {
+            return std::string();
+        }
+        switch (value.m_iType)
+        {
+            case NFMysqlColumnValue::VALUE_INT:
+                return NFCommon::tostr(value.m_iValue);
+            case NFMysqlColumnValue::VALUE_UINT:
+                return NFCommon::tostr(value.m_uValue);
+            case NFMysqlColumnValue::VALUE_DOUBLE:
+                return NFCommon::tostr(value.m_dValue);
+            default:
+                return std::string(value.m_pData, value.m_iLength);
+        }
+    }
+}
+
+NFCMysqlRowDecoder::NFCMysqlRowDecoder() : m_pDesc(nullptr), m_iColumnCount(0)
+{
+}
+
+int NFCMysqlRowDecoder::Compile(const google::protobuf::Descriptor* pDesc, const std::vector<std::string>& vecColumn)
+{
+    CHECK_EXPR(pDesc, -1, "pDesc == NULL");
+    m_pDesc = pDesc;
+    m_iColumnCount = vecColumn.size();
+    m_vecPlan.clear();
+
+    std::unordered_map<std::string, int> mapColumn;
+    for (int i = 0; i < (int)vecColumn.size(); i++)
+    {
+        mapColumn.emplace(vecColumn[i], i);
+    }
+
+    CompilePlan(pDesc, "", mapColumn);
+    return 0;
+}
+
+int NFCMysqlRowDecoder::FindColumn(const std::unordered_map<std::string, int>& mapColumn, const std::string& name)
+{
+    auto iter = mapColumn.find(name);
+    if (iter == mapColumn.end())
+    {
+        return -1;
+    }
+    return iter->second;
+}
+
+int NFCMysqlRowDecoder::CompilePlan(const google::protobuf::Descriptor* pDesc, const std::string& lastFieldName, const std::unordered_map<std::string, int>& mapColumn)
+{
+    //先占位, 子计划编译时会继续往m_vecPlan里追加
+    int iPlan = (int)m_vecPlan.size();
+    m_vecPlan.push_back(Plan());
+
+    Plan plan;
+    for (int i = 0; i < pDesc->field_count(); i++)
+    {
+        const google::protobuf::FieldDescriptor* pFieldDesc = pDesc->field(i);
+        if (pFieldDesc == nullptr) continue;
+
+        Step step;
+        step.m_pField = pFieldDesc;
+        if (pFieldDesc->is_repeated() == false)
+        {
+            if (pFieldDesc->cpp_type() == google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE && pFieldDesc->options().GetExtension(nanopb).db_message_expand())
+            {
+                step.m_iType = STEP_EXPAND;
+                step.m_vecPlan.push_back(CompilePlan(pFieldDesc->message_type(), lastFieldName + pFieldDesc->name() + "_", mapColumn));
+            }
+            else
+            {
+                step.m_iType = STEP_SCALAR;
+                step.m_iColumn = FindColumn(mapColumn, lastFieldName + pFieldDesc->name());
+                if (step.m_iColumn < 0) continue;
+            }
+        }
+        else
+        {
+            int arysize = NFProtobufCommon::Instance()->GetFieldsDBMaxCount(pFieldDesc);
+            if (arysize <= 0) continue;
+
+            if (pFieldDesc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+            {
+                step.m_iType = STEP_REPEATED;
+                for (int a_i = 0; a_i < arysize; a_i++)
+                {
+                    int iColumn = FindColumn(mapColumn, lastFieldName + pFieldDesc->name() + "_" + NFCommon::tostr(a_i));
+                    if (iColumn >= 0)
+                    {
+                        step.m_vecColumn.push_back(iColumn);
+                    }
+                }
+            }
+            else
+            {
+                if (pFieldDesc->message_type() == nullptr) continue;
+
+                step.m_iType = STEP_REPEATED_MESSAGE;
+                for (int a_i = 0; a_i < arysize; a_i++)
+                {
+                    step.m_vecPlan.push_back(CompilePlan(pFieldDesc->message_type(), lastFieldName + pFieldDesc->name() + "_" + NFCommon::tostr(a_i) + "_", mapColumn));
+                }
+            }
+        }
+        plan.push_back(step);
+    }
+
+    m_vecPlan[iPlan].swap(plan);
+    return iPlan;
+}
+
+void NFCMysqlRowDecoder::Decode(const NFMysqlColumnValue* pColumn, google::protobuf::Message* pMessage) const
+{
+    if (m_vecPlan.empty() || pMessage == nullptr) return;
+    DecodePlan(0, pColumn, pMessage, nullptr);
+}
+
+void NFCMysqlRowDecoder::DecodePlan(int iPlan, const NFMysqlColumnValue* pColumn, google::protobuf::Message* pMessage, bool* pbAllEmpty) const
+{
+    const google::protobuf::Reflection* pReflect = pMessage->GetReflection();
+    const Plan& plan = m_vecPlan[iPlan];
+    for (size_t i = 0; i < plan.size(); i++)
+    {
+        const Step& step = plan[i];
+        switch (step.m_iType)
+        {
+            case STEP_SCALAR:
+            {
+                const NFMysqlColumnValue& value = pColumn[step.m_iColumn];
+                if (pbAllEmpty && !value.IsEmpty())
+                {
+                    *pbAllEmpty = false;
+                }
+                SetColumnValue(pMessage, step.m_pField, value);
+            }
+            break;
+            case STEP_EXPAND:
+            {
+                google::protobuf::Message* pSubMessage = pReflect->MutableMessage(pMessage, step.m_pField);
+                if (pSubMessage == nullptr) break;
+
+                bool allSubMessageEmpty = true;
+                DecodePlan(step.m_vecPlan[0], pColumn, pSubMessage, &allSubMessageEmpty);
+                //与GetDBMessageFromMapFields保持一致
+                if (pbAllEmpty && allSubMessageEmpty)
+                {
+                    *pbAllEmpty = false;
+                }
+            }
+            break;
+            case STEP_REPEATED:
+            {
+                size_t lastIndex = step.m_vecColumn.size();
+                while (lastIndex > 0 && pColumn[step.m_vecColumn[lastIndex - 1]].IsEmpty())
+                {
+                    --lastIndex;
+                }
+                if (pbAllEmpty && lastIndex > 0)
+                {
+                    *pbAllEmpty = false;
+                }
+                for (size_t a_i = 0; a_i < lastIndex; a_i++)
+                {
+                    SetColumnValue(pMessage, step.m_pField, pColumn[step.m_vecColumn[a_i]]);
+                }
+            }
+            break;
+            case STEP_REPEATED_MESSAGE:
+            {
+                int keepSize = 0;
+                for (size_t a_i = 0; a_i < step.m_vecPlan.size(); a_i++)
+                {
+                    google::protobuf::Message* pSubMessage = pReflect->AddMessage(pMessage, step.m_pField);
+                    if (pSubMessage == nullptr) continue;
+
+                    bool allSubMessageEmpty = true;
+                    DecodePlan(step.m_vecPlan[a_i], pColumn, pSubMessage, &allSubMessageEmpty);
+                    if (!allSubMessageEmpty)
+                    {
+                        if (pbAllEmpty)
+                        {
+                            *pbAllEmpty = false;
+                        }
+                        keepSize = pReflect->FieldSize(*pMessage, step.m_pField);
+                    }
+                }
+
+                //去掉末尾全空的元素
+                while (pReflect->FieldSize(*pMessage, step.m_pField) > keepSize)
+                {
+                    pReflect->RemoveLast(pMessage, step.m_pField);
+                }
+            }
+            break;
+            default:
+                break;
+        }
+    }
+}
+
+bool NFCMysqlRowDecoder::SetColumnValue(google::protobuf::Message* pMessage, const google::protobuf::FieldDescriptor* pFieldDesc, const NFMysqlColumnValue& value)
+{
+    const google::protobuf::Reflection* pReflect = pMessage->GetReflection();
+    bool bRepeated = pFieldDesc->is_repeated();
+    switch (pFieldDesc->cpp_type())
+    {
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+        {
+            int32_t iValue = static_cast<int32_t>(ColumnToInt64(value));
+            bRepeated ? pReflect->AddInt32(pMessage, pFieldDesc, iValue) : pReflect->SetInt32(pMessage, pFieldDesc, iValue);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+        {
+            int64_t iValue = ColumnToInt64(value);
+            bRepeated ? pReflect->AddInt64(pMessage, pFieldDesc, iValue) : pReflect->SetInt64(pMessage, pFieldDesc, iValue);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+        {
+            uint32_t iValue = static_cast<uint32_t>(ColumnToUInt64(value));
+            bRepeated ? pReflect->AddUInt32(pMessage, pFieldDesc, iValue) : pReflect->SetUInt32(pMessage, pFieldDesc, iValue);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+        {
+            uint64_t iValue = ColumnToUInt64(value);
+            bRepeated ? pReflect->AddUInt64(pMessage, pFieldDesc, iValue) : pReflect->SetUInt64(pMessage, pFieldDesc, iValue);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+        {
+            double dValue = ColumnToDouble(value);
+            bRepeated ? pReflect->AddDouble(pMessage, pFieldDesc, dValue) : pReflect->SetDouble(pMessage, pFieldDesc, dValue);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+        {
+            float fValue = static_cast<float>(ColumnToDouble(value));
+            bRepeated ? pReflect->AddFloat(pMessage, pFieldDesc, fValue) : pReflect->SetFloat(pMessage, pFieldDesc, fValue);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+        {
+            bool bValue = ColumnToInt64(value) != 0;
+            bRepeated ? pReflect->AddBool(pMessage, pFieldDesc, bValue) : pReflect->SetBool(pMessage, pFieldDesc, bValue);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+        {
+            //文本里可能是枚举宏名, 交给原来的逻辑处理
+            if (value.m_iType == NFMysqlColumnValue::VALUE_TEXT)
+            {
+                std::string strValue = ColumnToString(value);
+                return bRepeated ? NFProtobufCommon::AddFieldsString(*pMessage, pFieldDesc, strValue) : NFProtobufCommon::SetFieldsString(*pMessage, pFieldDesc, strValue);
+            }
+
+            const google::protobuf::EnumValueDescriptor* pEnumValueDesc = pFieldDesc->enum_type()->FindValueByNumber(static_cast<int>(ColumnToInt64(value)));
+            if (pEnumValueDesc == nullptr) return false;
+            bRepeated ? pReflect->AddEnum(pMessage, pFieldDesc, pEnumValueDesc) : pReflect->SetEnum(pMessage, pFieldDesc, pEnumValueDesc);
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+        {
+            if (value.m_iType != NFMysqlColumnValue::VALUE_TEXT)
+            {
+                std::string strValue = ColumnToString(value);
+                bRepeated ? pReflect->AddString(pMessage, pFieldDesc, strValue) : pReflect->SetString(pMessage, pFieldDesc, strValue);
+            }
+            else
+            {
+                std::string strValue = value.m_bNull ? std::string() : std::string(value.m_pData, value.m_iLength);
+                bRepeated ? pReflect->AddString(pMessage, pFieldDesc, strValue) : pReflect->SetString(pMessage, pFieldDesc, strValue);
+            }
+        }
+        break;
+        case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE:
+        {
+            google::protobuf::Message* pSubMessage = bRepeated ? pReflect->AddMessage(pMessage, pFieldDesc) : pReflect->MutableMessage(pMessage, pFieldDesc);
+            if (pSubMessage == nullptr) return false;
+            if (value.m_bNull || value.m_iLength == 0) return true;
+            return pSubMessage->ParsePartialFromArray(value.m_pData, static_cast<int>(value.m_iLength));
+        }
+        default:
+            break;
+    }
+    return true;
+}
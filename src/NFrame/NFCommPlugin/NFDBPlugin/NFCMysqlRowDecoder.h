@@ -0,0 +1,124 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFCMysqlRowDecoder.h
+//    @Author           :    gaoyi
+//    @Date             :   2025-05-06
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFCMysqlRowDecoder
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <stdint.h>
+#include "google/protobuf/message.h"
+#include "google/protobuf/descriptor.h"
+
+/**
+ * @brief 结果集里的一列
+ *
+ * 文本协议只有m_pData/m_iLength, 二进制协议的整数和浮点数直接给数值, 字符串和blob同样给m_pData/m_iLength
+ */
+struct NFMysqlColumnValue
+{
+    enum
+    {
+        VALUE_TEXT = 0,
+        VALUE_INT = 1,
+        VALUE_UINT = 2,
+        VALUE_DOUBLE = 3,
+    };
+
+    NFMysqlColumnValue() : m_iType(VALUE_TEXT), m_bNull(true), m_pData(nullptr), m_iLength(0), m_iValue(0), m_uValue(0), m_dValue(0)
+    {
+    }
+
+    //对应文本协议里非空字符串
+    bool IsEmpty() const
+    {
+        return m_bNull || (m_iType == VALUE_TEXT && m_iLength == 0);
+    }
+
+    int m_iType;
+    bool m_bNull;
+    const char* m_pData;
+    size_t m_iLength;
+    int64_t m_iValue;
+    uint64_t m_uValue;
+    double m_dValue;
+};
+
+/**
+ * @brief 把一行结果直接解码到protobuf
+ *
+ * 按message类型和结果集的列名编译一次, 得到列下标到字段的对应关系, 之后每一行不再构造std::map<列名,值>,
+ * 也不再按列名查找, 数值列直接写进字段。展开规则和空值裁剪与NFProtobufCommon::GetDBMessageFromMapFields一致:
+ * 字段名拼接成列名, db_message_expand的子message展开成"字段_子字段", repeated展开成"字段_下标"和"字段_下标_子字段",
+ * repeated末尾全空的元素会被去掉
+ */
+class NFCMysqlRowDecoder
+{
+public:
+    NFCMysqlRowDecoder();
+
+    /**
+     * @brief 按结果集的列名编译解码计划
+     * @param pDesc message描述
+     * @param vecColumn 结果集的列名, 按列顺序
+     * @return 0成功
+     */
+    int Compile(const google::protobuf::Descriptor* pDesc, const std::vector<std::string>& vecColumn);
+
+    /**
+     * @brief 解码一行
+     * @param pColumn 这一行的所有列, 按列顺序, 个数与Compile时一致
+     * @param pMessage 类型与Compile时一致, 调用者负责Clear
+     */
+    void Decode(const NFMysqlColumnValue* pColumn, google::protobuf::Message* pMessage) const;
+
+    const google::protobuf::Descriptor* GetDescriptor() const { return m_pDesc; }
+
+    size_t GetColumnCount() const { return m_iColumnCount; }
+
+    /**
+     * @brief 把一列的值写进非repeated字段或追加到repeated字段
+     */
+    static bool SetColumnValue(google::protobuf::Message* pMessage, const google::protobuf::FieldDescriptor* pFieldDesc, const NFMysqlColumnValue& value);
+
+private:
+    enum
+    {
+        STEP_SCALAR = 0, //普通字段或序列化成blob的message
+        STEP_EXPAND = 1, //db_message_expand的子message
+        STEP_REPEATED = 2, //repeated普通字段
+        STEP_REPEATED_MESSAGE = 3, //repeated message
+    };
+
+    struct Step
+    {
+        Step() : m_iType(STEP_SCALAR), m_pField(nullptr), m_iColumn(-1)
+        {
+        }
+
+        int m_iType;
+        const google::protobuf::FieldDescriptor* m_pField;
+        int m_iColumn; //STEP_SCALAR的列下标, -1表示结果集里没有这一列
+        std::vector<int> m_vecColumn; //STEP_REPEATED结果集里存在的列下标
+        std::vector<int> m_vecPlan; //STEP_EXPAND和STEP_REPEATED_MESSAGE的子计划
+    };
+
+    typedef std::vector<Step> Plan;
+
+    int CompilePlan(const google::protobuf::Descriptor* pDesc, const std::string& lastFieldName, const std::unordered_map<std::string, int>& mapColumn);
+
+    void DecodePlan(int iPlan, const NFMysqlColumnValue* pColumn, google::protobuf::Message* pMessage, bool* pbAllEmpty) const;
+
+    static int FindColumn(const std::unordered_map<std::string, int>& mapColumn, const std::string& name);
+
+private:
+    const google::protobuf::Descriptor* m_pDesc;
+    size_t m_iColumnCount;
+    std::vector<Plan> m_vecPlan; //m_vecPlan[0]是根
+};
@@ -0,0 +1,307 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFCMysqlStmt.cpp
+//    @Author           :    gaoyi
+//    @Date             :   2025-05-06
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFCMysqlStmt
+//
+// -------------------------------------------------------------------------
+
+#include "NFCMysqlStmt.h"
+#include <string.h>
+#include "errmsg.h"
+#include "NFComm/NFPluginModule/NFLogMgr.h"
+
+//服务器端错误码, mysqld_error.h是编译mysql时生成的, 这里只用到几个
+#define NF_MYSQL_ER_UNKNOWN_STMT_HANDLER 1243
+#define NF_MYSQL_ER_UNSUPPORTED_PS 1295
+#define NF_MYSQL_ER_MAX_PREPARED_STMT_COUNT_REACHED 1461
+#define NF_MYSQL_ER_NEED_REPREPARE 1615
+
+NFCMysqlStmt::NFCMysqlStmt() : m_pStmt(nullptr), m_bNeedReprepare(false), m_bRebind(false)
+{
+}
+
+NFCMysqlStmt::~NFCMysqlStmt()
+{
+    Close();
+}
+
+int NFCMysqlStmt::Prepare(MYSQL* pMysql, const std::string& sql, std::string& errorMsg)
+{
+    Close();
+
+    m_pStmt = mysql_stmt_init(pMysql);
+    if (m_pStmt == nullptr)
+    {
+        SetError(mysql_error(pMysql), errorMsg);
+        return -1;
+    }
+
+    if (mysql_stmt_prepare(m_pStmt, sql.data(), sql.length()) != 0)
+    {
+        SetStmtError(errorMsg);
+        Close();
+        return -1;
+    }
+
+    unsigned long paramCount = mysql_stmt_param_count(m_pStmt);
+    m_vecParamBind.resize(paramCount);
+    m_vecParamLength.resize(paramCount);
+
+    MYSQL_RES* pMeta = mysql_stmt_result_metadata(m_pStmt);
+    if (pMeta == nullptr)
+    {
+        //没有结果集的语句
+        return 0;
+    }
+
+    unsigned int fieldCount = mysql_num_fields(pMeta);
+    MYSQL_FIELD* pFields = mysql_fetch_fields(pMeta);
+
+    MYSQL_BIND emptyBind;
+    memset(&emptyBind, 0, sizeof(emptyBind));
+    m_vecResultBind.assign(fieldCount, emptyBind);
+    m_vecBuffer.assign(fieldCount, std::vector<char>());
+    m_vecLength.assign(fieldCount, 0);
+    m_vecIsNull.assign(fieldCount, 0);
+    m_vecError.assign(fieldCount, 0);
+    m_vecColumn.assign(fieldCount, NFMysqlColumnValue());
+    m_vecColumnName.resize(fieldCount);
+
+    for (unsigned int i = 0; i < fieldCount; i++)
+    {
+        const MYSQL_FIELD& field = pFields[i];
+        MYSQL_BIND& bind = m_vecResultBind[i];
+        NFMysqlColumnValue& column = m_vecColumn[i];
+        m_vecColumnName[i].assign(field.name, field.name_length);
+
+        bind.length = &m_vecLength[i];
+        bind.is_null = &m_vecIsNull[i];
+        bind.error = &m_vecError[i];
+        switch (field.type)
+        {
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_YEAR:
+            {
+                bind.buffer_type = MYSQL_TYPE_LONGLONG;
+                if (field.flags & UNSIGNED_FLAG)
+                {
+                    bind.is_unsigned = 1;
+                    bind.buffer = &column.m_uValue;
+                    column.m_iType = NFMysqlColumnValue::VALUE_UINT;
+                }
+                else
+                {
+                    bind.buffer = &column.m_iValue;
+                    column.m_iType = NFMysqlColumnValue::VALUE_INT;
+                }
+            }
+            break;
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE:
+            {
+                bind.buffer_type = MYSQL_TYPE_DOUBLE;
+                bind.buffer = &column.m_dValue;
+                column.m_iType = NFMysqlColumnValue::VALUE_DOUBLE;
+            }
+            break;
+            default:
+            {
+                //字符串, blob, 时间, decimal都按文本取
+                unsigned long bufSize = field.length;
+                if (bufSize > NF_MYSQL_STMT_INIT_BUFFER_SIZE || bufSize == 0)
+                {
+                    bufSize = NF_MYSQL_STMT_INIT_BUFFER_SIZE;
+                }
+                m_vecBuffer[i].resize(bufSize);
+                bind.buffer_type = MYSQL_TYPE_STRING;
+                bind.buffer = m_vecBuffer[i].data();
+                bind.buffer_length = bufSize;
+                column.m_iType = NFMysqlColumnValue::VALUE_TEXT;
+            }
+            break;
+        }
+    }
+    mysql_free_result(pMeta);
+
+    if (fieldCount > 0 && mysql_stmt_bind_result(m_pStmt, m_vecResultBind.data()) != 0)
+    {
+        SetStmtError(errorMsg);
+        Close();
+        return -1;
+    }
+
+    return 0;
+}
+
+int NFCMysqlStmt::Execute(const std::vector<const std::string*>& vecParam, std::string& errorMsg)
+{
+    m_bNeedReprepare = false;
+    if (m_pStmt == nullptr)
+    {
+        SetError("stmt not prepared", errorMsg);
+        return -1;
+    }
+
+    if (vecParam.size() != m_vecParamBind.size())
+    {
+        SetError("stmt param count mismatch", errorMsg);
+        return -1;
+    }
+
+    for (size_t i = 0; i < vecParam.size(); i++)
+    {
+        MYSQL_BIND& bind = m_vecParamBind[i];
+        memset(&bind, 0, sizeof(bind));
+        m_vecParamLength[i] = vecParam[i]->length();
+        bind.buffer_type = MYSQL_TYPE_STRING;
+        bind.buffer = const_cast<char*>(vecParam[i]->data());
+        bind.buffer_length = m_vecParamLength[i];
+        bind.length = &m_vecParamLength[i];
+    }
+
+    if (!m_vecParamBind.empty() && mysql_stmt_bind_param(m_pStmt, m_vecParamBind.data()) != 0)
+    {
+        SetStmtError(errorMsg);
+        return -1;
+    }
+
+    if (mysql_stmt_execute(m_pStmt) != 0)
+    {
+        SetStmtError(errorMsg);
+        return -1;
+    }
+
+    //表结构变了以后mysql会重新预处理, 列数对不上就不能再用原来的绑定
+    if (mysql_stmt_field_count(m_pStmt) != m_vecResultBind.size())
+    {
+        SetError("stmt result column count changed", errorMsg);
+        FreeResult();
+        return -1;
+    }
+
+    return 0;
+}
+
+int NFCMysqlStmt::Fetch(std::string& errorMsg)
+{
+    m_bNeedReprepare = false;
+    if (m_bRebind)
+    {
+        if (mysql_stmt_bind_result(m_pStmt, m_vecResultBind.data()) != 0)
+        {
+            SetStmtError(errorMsg);
+            return -1;
+        }
+        m_bRebind = false;
+    }
+
+    int iRet = mysql_stmt_fetch(m_pStmt);
+    if (iRet == MYSQL_NO_DATA)
+    {
+        return 1;
+    }
+
+    if (iRet != 0 && iRet != MYSQL_DATA_TRUNCATED)
+    {
+        SetStmtError(errorMsg);
+        return -1;
+    }
+
+    for (size_t i = 0; i < m_vecColumn.size(); i++)
+    {
+        NFMysqlColumnValue& column = m_vecColumn[i];
+        column.m_bNull = m_vecIsNull[i] != 0;
+        if (column.m_iType != NFMysqlColumnValue::VALUE_TEXT)
+        {
+            continue;
+        }
+
+        std::vector<char>& buffer = m_vecBuffer[i];
+        if (!column.m_bNull && m_vecLength[i] > buffer.size())
+        {
+            buffer.resize(m_vecLength[i]);
+
+            MYSQL_BIND& bind = m_vecResultBind[i];
+            bind.buffer = buffer.data();
+            bind.buffer_length = buffer.size();
+            m_bRebind = true;
+
+            if (mysql_stmt_fetch_column(m_pStmt, &bind, static_cast<unsigned int>(i), 0) != 0)
+            {
+                SetStmtError(errorMsg);
+                return -1;
+            }
+        }
+
+        column.m_pData = buffer.data();
+        column.m_iLength = column.m_bNull ? 0 : m_vecLength[i];
+    }
+
+    return 0;
+}
+
+void NFCMysqlStmt::SetStmtError(std::string& errorMsg)
+{
+    unsigned int iErrno = mysql_stmt_errno(m_pStmt);
+    errorMsg = mysql_stmt_error(m_pStmt);
+    switch (iErrno)
+    {
+        case CR_SERVER_GONE_ERROR:
+        case CR_SERVER_LOST:
+        case CR_NO_PREPARE_STMT:
+        case CR_UNSUPPORTED_PARAM_TYPE:
+        case CR_NOT_IMPLEMENTED:
+        case CR_STMT_CLOSED:
+        case CR_NEW_STMT_METADATA:
+        case NF_MYSQL_ER_UNKNOWN_STMT_HANDLER:
+        case NF_MYSQL_ER_UNSUPPORTED_PS:
+        case NF_MYSQL_ER_MAX_PREPARED_STMT_COUNT_REACHED:
+        case NF_MYSQL_ER_NEED_REPREPARE:
+            m_bNeedReprepare = true;
+            break;
+        default:
+            //主键重复, 表不存在, 权限等sql本身的错误
+            m_bNeedReprepare = false;
+            break;
+    }
+}
+
+void NFCMysqlStmt::SetError(const char* szError, std::string& errorMsg)
+{
+    errorMsg = szError;
+    m_bNeedReprepare = true;
+}
+
+void NFCMysqlStmt::FreeResult()
+{
+    if (m_pStmt)
+    {
+        mysql_stmt_free_result(m_pStmt);
+    }
+}
+
+void NFCMysqlStmt::Close()
+{
+    if (m_pStmt)
+    {
+        mysql_stmt_close(m_pStmt);
+        m_pStmt = nullptr;
+    }
+    m_bRebind = false;
+    m_bNeedReprepare = false;
+    m_vecParamBind.clear();
+    m_vecParamLength.clear();
+    m_vecResultBind.clear();
+    m_vecBuffer.clear();
+    m_vecLength.clear();
+    m_vecIsNull.clear();
+    m_vecError.clear();
+    m_vecColumn.clear();
+    m_vecColumnName.clear();
+}
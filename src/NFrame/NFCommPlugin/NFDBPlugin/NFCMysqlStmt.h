@@ -0,0 +1,95 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFCMysqlStmt.h
+//    @Author           :    gaoyi
+//    @Date             :   2025-05-06
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFCMysqlStmt
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "mysqlpp/mysql++.h"
+#include "NFCMysqlRowDecoder.h"
+
+//字符串列第一次绑定的缓冲区上限, 超过的在取数据时按实际长度扩容
+#define NF_MYSQL_STMT_INIT_BUFFER_SIZE 256
+
+/**
+ * @brief 预处理语句, 走二进制协议
+ *
+ * 参数统一按字符串绑定, 由mysql转换成列类型。结果集整数列绑定成int64/uint64, 浮点列绑定成double,
+ * 其余列绑定成字符串缓冲区, 缓冲区不够时按实际长度扩容后重新取这一列, 扩容后的缓冲区留着给后面的查询复用。
+ * 取出的一行放在NFMysqlColumnValue数组里, 交给NFCMysqlRowDecoder直接解码到protobuf。
+ * 语句挂在一个连接上, 连接断开前必须Close
+ */
+class NFCMysqlStmt
+{
+public:
+    NFCMysqlStmt();
+
+    ~NFCMysqlStmt();
+
+    /**
+     * @brief 预处理sql, 绑定结果集
+     * @return 0成功
+     */
+    int Prepare(MYSQL* pMysql, const std::string& sql, std::string& errorMsg);
+
+    /**
+     * @brief 绑定参数并执行
+     * @param vecParam 参数, 个数与sql里的?一致
+     * @return 0成功
+     */
+    int Execute(const std::vector<const std::string*>& vecParam, std::string& errorMsg);
+
+    /**
+     * @brief 取下一行
+     * @return 0取到一行, 1没有数据了, -1出错
+     */
+    int Fetch(std::string& errorMsg);
+
+    /**
+     * @brief 释放这次执行的结果集, 下次Execute之前调用
+     */
+    void FreeResult();
+
+    void Close();
+
+    const NFMysqlColumnValue* GetColumns() const { return m_vecColumn.data(); }
+
+    const std::vector<std::string>& GetColumnNames() const { return m_vecColumnName; }
+
+    NFCMysqlRowDecoder& GetDecoder() { return m_decoder; }
+
+    /**
+     * @brief 上一次出错是不是语句本身失效(断线, 表结构变化, 服务器不支持预处理等), 这种情况丢掉语句改走拼sql;
+     *        其余的是sql本身的错误, 拼sql也一样会错, 直接返回给调用者
+     */
+    bool IsNeedReprepare() const { return m_bNeedReprepare; }
+
+private:
+    /**
+     * @brief 记录mysql_stmt_errno/mysql_stmt_error, 判断是否需要重新预处理
+     */
+    void SetStmtError(std::string& errorMsg);
+
+    void SetError(const char* szError, std::string& errorMsg);
+
+private:
+    MYSQL_STMT* m_pStmt;
+    bool m_bNeedReprepare;
+    bool m_bRebind; //字符串缓冲区扩容后需要重新绑定结果集
+    std::vector<MYSQL_BIND> m_vecParamBind;
+    std::vector<unsigned long> m_vecParamLength;
+    std::vector<MYSQL_BIND> m_vecResultBind;
+    std::vector<std::vector<char>> m_vecBuffer;
+    std::vector<unsigned long> m_vecLength;
+    std::vector<my_bool> m_vecIsNull;
+    std::vector<my_bool> m_vecError;
+    std::vector<NFMysqlColumnValue> m_vecColumn;
+    std::vector<std::string> m_vecColumnName;
+    NFCMysqlRowDecoder m_decoder;
+};
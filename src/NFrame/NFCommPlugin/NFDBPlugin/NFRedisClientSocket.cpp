@@ -7,6 +7,7 @@
 
 #elif NF_PLATFORM == NF_PLATFORM_LINUX
 #include <arpa/inet.h>
+#include <poll.h>
 #endif
 
 //1048576 = 1024 * 1024
@@ -98,6 +99,7 @@ bool NFRedisClientSocket::ReConnect(const std::string& ip, const int port)
 		bev = nullptr;
 	}
 
+	ResetRedisReader();
 	return Connect(ip, port);
 }
 
@@ -111,6 +113,35 @@ int NFRedisClientSocket::Execute()
 	return 0;
 }
 
+int NFRedisClientSocket::Wait(int timeoutMs)
+{
+	if (bev == nullptr || fd_ < 0)
+	{
+		return -1;
+	}
+
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+	struct pollfd pfd;
+	pfd.fd = static_cast<int>(fd_);
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	//连接建立中或者还有没写完的数据, 也要等可写
+	if (mNetStatus != NF_NET_EVENT::NF_NET_EVENT_CONNECTED || evbuffer_get_length(bufferevent_get_output(bev)) > 0)
+	{
+		pfd.events |= POLLOUT;
+	}
+
+	int ret = poll(&pfd, 1, timeoutMs);
+	if (ret < 0)
+	{
+		return errno == EINTR ? 0 : -1;
+	}
+	return ret > 0 ? 1 : 0;
+#else
+	return 1;
+#endif
+}
+
 bool NFRedisClientSocket::IsConnect()
 {
 	return mNetStatus == NF_NET_EVENT::NF_NET_EVENT_CONNECTED;
@@ -126,6 +157,15 @@ redisReader * NFRedisClientSocket::GetRedisReader()
 	return m_pRedisReader;
 }
 
+void NFRedisClientSocket::ResetRedisReader()
+{
+	if (m_pRedisReader)
+	{
+		redisReaderFree(m_pRedisReader);
+	}
+	m_pRedisReader = redisReaderCreate();
+}
+
 int NFRedisClientSocket::Close()
 {
     return 0;
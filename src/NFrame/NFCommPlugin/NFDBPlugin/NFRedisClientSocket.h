@@ -95,9 +95,20 @@ public:
 
     int Execute();
 
+	/**
+	* @brief 阻塞等待socket可读, 有待发送数据时也等待可写, 最多等timeoutMs毫秒, 之后再调用Execute处理
+	* @return 有事件返回1, 超时返回0, 出错返回-1
+	*/
+	int Wait(int timeoutMs);
+
 	bool IsConnect();
 	bool IsNone();
 	redisReader* GetRedisReader();
+
+	/**
+	* @brief 丢弃reader里没解析完的数据, 重连后使用
+	*/
+	void ResetRedisReader();
 protected:
 	static void listener_cb(struct evconnlistener* listener, evutil_socket_t fd, struct sockaddr* sa, int socklen, void* user_data);
 	static void conn_readcb(struct bufferevent* bev, void* user_data);
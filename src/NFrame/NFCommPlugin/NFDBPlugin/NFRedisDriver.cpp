@@ -6,6 +6,19 @@
 
 #define PRIVATE_KEY_EXIST_TIME 86400*2
 
+/**
+ * @brief 流水线里一条HMGET的结果
+ */
+struct NFRedisHMGetResult
+{
+    NFRedisHMGetResult() : m_success(false)
+    {
+    }
+
+    std::vector<std::string> m_values;
+    bool m_success;
+};
+
 NFRedisDriver::NFRedisDriver()
 {
     mnPort = 0;
@@ -172,8 +185,25 @@ int NFRedisDriver::SelectByCond(const NFrame::storesvr_sel &select, const std::s
     CHECK_EXPR(className.size() > 0, -1, "className empty!");
     std::string packageName = select.baseinfo().package_name();
 
-    bool bRet = SelectDB(NFREDIS_DB1);
-    if (!bRet)
+    std::vector<std::string> vecFields;
+    CHECK_EXPR(GetObjFieldNames(packageName, className, fields, vecFields), -1, "GetObjFieldNames Failed, className:{}", className);
+
+    //所有key的HMGET和EXPIRE排进一个流水线, 一次往返
+    std::vector<std::string> vecKeys(privateKeySet.begin(), privateKeySet.end());
+    std::vector<NFRedisHMGetResult> vecResult(vecKeys.size());
+    bool bRet = false;
+    PipelineSelectDB(NFREDIS_DB1, bRet);
+    for (size_t i = 0; i < vecKeys.size(); i++)
+    {
+        std::string db_key = GetPrivateKeys(tableName, privateKey, vecKeys[i]);
+        PipelineHMGET(db_key, vecFields, vecResult[i].m_values, vecResult[i].m_success);
+
+        NFRedisCommand cmd(GET_NAME(EXPIRE));
+        cmd << db_key << PRIVATE_KEY_EXIST_TIME;
+        PipelineCmd(cmd);
+    }
+
+    if (WaitPipeline() != 0 || !bRet)
     {
         NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} ", NFREDIS_DB1, tableName);
         return 1;
@@ -202,19 +232,16 @@ int NFRedisDriver::SelectByCond(const NFrame::storesvr_sel &select, const std::s
 
     std::string errmsg;
     int count = 0;
-    for (auto iter = privateKeySet.begin(); iter != privateKeySet.end(); iter++)
+    for (size_t i = 0; i < vecKeys.size(); i++)
     {
-        std::string db_key = GetPrivateKeys(tableName, privateKey, *iter);
+        const std::vector<std::string>& vecValues = vecResult[i].m_values;
         std::string value;
-        bRet = GetObj(packageName, className, db_key, fields, value);
-        if (!bRet)
+        if (!vecResult[i].m_success || (!vecFields.empty() && vecValues.empty()) || vecValues.size() != vecFields.size() || !MakeObjValue(packageName, className, vecFields, vecValues, value))
         {
-            leftPrivateKeySet.insert(*iter);
+            leftPrivateKeySet.insert(vecKeys[i]);
             continue;
         }
 
-        EXPIRE(db_key, PRIVATE_KEY_EXIST_TIME);
-
         select_res->add_record(value);
 
         count++;
@@ -249,17 +276,19 @@ int NFRedisDriver::DeleteByCond(const NFrame::storesvr_del &select, const std::s
     std::string tableName = select.baseinfo().tbname();
     CHECK_EXPR(tableName.size() > 0, -1, "talbeName empty!");
 
-    bool bRet = SelectDB(NFREDIS_DB1);
-    if (!bRet)
+    bool bRet = false;
+    PipelineSelectDB(NFREDIS_DB1, bRet);
+    for (auto iter = privateKeySet.begin(); iter != privateKeySet.end(); iter++)
     {
-        NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} ", NFREDIS_DB1, tableName);
-        return 1;
+        NFRedisCommand cmd(GET_NAME(DEL));
+        cmd << GetPrivateKeys(tableName, privateKey, *iter);
+        PipelineCmd(cmd);
     }
 
-    for (auto iter = privateKeySet.begin(); iter != privateKeySet.end(); iter++)
+    if (WaitPipeline() != 0 || !bRet)
     {
-        std::string db_key = GetPrivateKeys(tableName, privateKey, *iter);
-        DEL(db_key);
+        NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} ", NFREDIS_DB1, tableName);
+        return 1;
     }
 
     NFLogInfo(NF_LOG_DEFAULT, 0, "DeleteByCond Success");
@@ -450,27 +479,10 @@ bool NFRedisDriver::GetObj(const std::string& packageName, const std::string& cl
 bool NFRedisDriver::GetObj(const std::string &packageName, const std::string &className, const std::string &key,
                            const std::unordered_set<std::string> &fields, std::string &value)
 {
-    std::string full_name;
-    if (packageName.empty())
-    {
-        full_name = DEFINE_DEFAULT_PROTO_PACKAGE_ADD + className;
-    }
-    else
-    {
-        full_name = packageName + "." + className;
-    }
-
-    const google::protobuf::Descriptor *pDesc = NFProtobufCommon::Instance()->FindDynamicMessageTypeByName(full_name);
-    CHECK_EXPR(pDesc, false, "NFProtobufCommon::FindDynamicMessageTypeByName:{} Failed", full_name);
-
     std::vector<std::string> vecFields;
-    if (fields.empty())
+    if (!GetObjFieldNames(packageName, className, fields, vecFields))
     {
-        NFProtobufCommon::GetDBFieldsFromDesc(pDesc, vecFields);
-    }
-    else
-    {
-        vecFields.insert(vecFields.end(), fields.begin(), fields.end());
+        return false;
     }
 
     std::vector<std::string> vecValues;
@@ -487,6 +499,43 @@ bool NFRedisDriver::GetObj(const std::string &packageName, const std::string &cl
     }
 
     CHECK_EXPR(vecFields.size() == vecValues.size(), false, "HMGET key:{} error", key);
+    if (!MakeObjValue(packageName, className, vecFields, vecValues, value))
+    {
+        return false;
+    }
+
+    NFLogInfo(NF_LOG_DEFAULT, 0, "GetObj:{} Success", key);
+
+    return true;
+}
+
+bool NFRedisDriver::GetObjFieldNames(const std::string& packageName, const std::string& className, const std::unordered_set<std::string>& fields, std::vector<std::string>& vecFields)
+{
+    if (!fields.empty())
+    {
+        vecFields.insert(vecFields.end(), fields.begin(), fields.end());
+        return true;
+    }
+
+    std::string full_name;
+    if (packageName.empty())
+    {
+        full_name = DEFINE_DEFAULT_PROTO_PACKAGE_ADD + className;
+    }
+    else
+    {
+        full_name = packageName + "." + className;
+    }
+
+    const google::protobuf::Descriptor *pDesc = NFProtobufCommon::Instance()->FindDynamicMessageTypeByName(full_name);
+    CHECK_EXPR(pDesc, false, "NFProtobufCommon::FindDynamicMessageTypeByName:{} Failed", full_name);
+
+    NFProtobufCommon::GetDBFieldsFromDesc(pDesc, vecFields);
+    return true;
+}
+
+bool NFRedisDriver::MakeObjValue(const std::string& packageName, const std::string& className, const std::vector<std::string>& vecFields, const std::vector<std::string>& vecValues, std::string& value)
+{
     google::protobuf::Message *pMessage = NULL;
     int iRet = TransTableRowToMessage(vecFields, vecValues, packageName, className, &pMessage);
     if (iRet == 0 && pMessage != NULL)
@@ -505,12 +554,30 @@ bool NFRedisDriver::GetObj(const std::string &packageName, const std::string &cl
         NF_SAFE_DELETE(pMessage);
     }
 
-    NFLogInfo(NF_LOG_DEFAULT, 0, "GetObj:{} Success", key);
-
     return true;
 }
 
 bool NFRedisDriver::SetObj(const std::string &packageName, const std::string &className, const std::string &key, const std::string &value)
+{
+    std::vector<string_pair> values;
+    if (!GetObjFieldValues(packageName, className, value, values))
+    {
+        return false;
+    }
+
+    bool bRet = HMSET(key, values);
+    if (!bRet)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} ", NFREDIS_DB1, className);
+        return false;
+    }
+
+    NFLogInfo(NF_LOG_DEFAULT, 0, "SetObj:{} Success", key);
+
+    return true;
+}
+
+bool NFRedisDriver::GetObjFieldValues(const std::string& packageName, const std::string& className, const std::string& value, std::vector<string_pair>& vecFieldValues)
 {
     std::string full_name;
     if (packageName.empty())
@@ -530,16 +597,7 @@ bool NFRedisDriver::SetObj(const std::string &packageName, const std::string &cl
     NFProtobufCommon::GetDBMapFieldsFromMessage(*pMessageObject, resultMap);
     delete pMessageObject;
 
-    std::vector<string_pair> values(resultMap.begin(), resultMap.end());
-    bool bRet = HMSET(key, values);
-    if (!bRet)
-    {
-        NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} ", NFREDIS_DB1, className);
-        return false;
-    }
-
-    NFLogInfo(NF_LOG_DEFAULT, 0, "SetObj:{} Success", key);
-
+    vecFieldValues.insert(vecFieldValues.end(), resultMap.begin(), resultMap.end());
     return true;
 }
 
@@ -564,28 +622,47 @@ int NFRedisDriver::SelectObj(const NFrame::storesvr_selobj &select,
     select_res.mutable_opres()->set_mod_key(select.mod_key());
     std::string errmsg;
 
-    bool bRet = SelectDB(NFREDIS_DB1);
-    if (!bRet)
+    std::vector<std::string> vecFields;
+    CHECK_EXPR(GetObjFieldNames(packageName, className, std::unordered_set<std::string>(), vecFields), -1, "GetObjFieldNames Failed, className:{}", className);
+
+    //SELECT/EXISTS/HMGET/EXPIRE一次写出
+    bool bRet = false;
+    bool bExist = false;
+    NFRedisHMGetResult result;
+    PipelineSelectDB(NFREDIS_DB1, bRet);
+
+    NFRedisCommand existCmd(GET_NAME(EXISTS));
+    existCmd << db_key;
+    PipelineCmd(existCmd, [&bExist](const NF_SHARE_PTR<redisReply>& pReply)
+    {
+        bExist = pReply && REDIS_REPLY_INTEGER == pReply->type && 1 == pReply->integer;
+    });
+
+    PipelineHMGET(db_key, vecFields, result.m_values, result.m_success);
+
+    NFRedisCommand expireCmd(GET_NAME(EXPIRE));
+    expireCmd << db_key << PRIVATE_KEY_EXIST_TIME;
+    PipelineCmd(expireCmd);
+
+    if (WaitPipeline() != 0 || !bRet)
     {
         NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} modkey:{}", NFREDIS_DB1, select.baseinfo().tbname(), select.mod_key());
         return -1;
     }
 
-    if (!EXISTS(db_key))
+    if (!bExist)
     {
         return 1;
     }
 
     std::string value;
-    bRet = GetObj(packageName, className, db_key, value);
-    if (!bRet)
+    if (!result.m_success || (!vecFields.empty() && result.m_values.empty()) || result.m_values.size() != vecFields.size() ||
+        !MakeObjValue(packageName, className, vecFields, result.m_values, value))
     {
         NFLogInfo(NF_LOG_DEFAULT, 0, "SelectObj:{} storesvr_selobj Failed", db_key);
         return 1;
     }
 
-    EXPIRE(db_key, PRIVATE_KEY_EXIST_TIME);
-
     select_res.set_record(value);
 
     NFLogInfo(NF_LOG_DEFAULT, 0, "SelectObj:{} storesvr_selobj Success", db_key);
@@ -600,25 +677,59 @@ int NFRedisDriver::SaveObj(const std::string &packageName, const std::string &ta
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- begin -- ");
     CHECK_EXPR(tableName.size() > 0, -1, "talbeName empty!");
 
-    bool bRet = SelectDB(NFREDIS_DB1);
-    if (!bRet)
+    std::vector<std::pair<std::string, std::vector<string_pair>>> vecObj;
+    for (auto iter = recordsMap.begin(); iter != recordsMap.end(); iter++)
     {
-        NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{}", NFREDIS_DB1, tableName);
-        return -1;
+        vecObj.push_back(std::make_pair(GetPrivateKeys(tableName, privateKey, iter->first), std::vector<string_pair>()));
+        if (!GetObjFieldValues(packageName, clasname, iter->second, vecObj.back().second))
+        {
+            return -1;
+        }
     }
 
-    for (auto iter = recordsMap.begin(); iter != recordsMap.end(); iter++)
+    //多条记录放在一个MULTI/EXEC里, 一次往返, 中间不会插入别的客户端的命令。
+    //redis的事务不回滚: 排队时出错(命令写错)整个EXEC被放弃, 执行时出错(比如key类型不对)只有那一条失败, 其他的照样写入。
+    //任何一条失败都返回-1, 由调用者整体重试, HMSET/EXPIRE重复执行结果一样
+    //WaitPipeline会阻塞当前的db任务线程直到EXEC返回, 和原来的同步命令一样, 不阻塞主线程
+    bool bRet = false;
+    bool bExec = false;
+    PipelineSelectDB(NFREDIS_DB1, bRet);
+    PipelineCmd(NFRedisCommand(GET_NAME(MULTI)));
+    for (size_t i = 0; i < vecObj.size(); i++)
     {
-        std::string errmsg;
-        std::string db_key = GetPrivateKeys(tableName, privateKey, iter->first);
+        NFRedisCommand setCmd(GET_NAME(HMSET));
+        setCmd << vecObj[i].first;
+        for (size_t j = 0; j < vecObj[i].second.size(); j++)
+        {
+            setCmd << vecObj[i].second[j].first << vecObj[i].second[j].second;
+        }
+        PipelineCmd(setCmd);
 
-        bRet = SetObj(packageName, clasname, db_key, iter->second);
-        if (!bRet)
+        NFRedisCommand expireCmd(GET_NAME(EXPIRE));
+        expireCmd << vecObj[i].first << PRIVATE_KEY_EXIST_TIME;
+        PipelineCmd(expireCmd);
+    }
+    PipelineCmd(NFRedisCommand(GET_NAME(EXEC)), [&bExec](const NF_SHARE_PTR<redisReply>& pReply)
+    {
+        if (pReply == nullptr || pReply->type != REDIS_REPLY_ARRAY)
         {
-            return -1;
+            return;
         }
 
-        EXPIRE(db_key, PRIVATE_KEY_EXIST_TIME);
+        for (size_t i = 0; i < pReply->elements; i++)
+        {
+            if (pReply->element[i]->type == REDIS_REPLY_ERROR)
+            {
+                return;
+            }
+        }
+        bExec = true;
+    });
+
+    if (WaitPipeline() != 0 || !bRet || !bExec)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "SaveObj Failed! db:{} dbName:{} records:{}", NFREDIS_DB1, tableName, recordsMap.size());
+        return -1;
     }
 
     NFLogInfo(NF_LOG_DEFAULT, 0, "SaveObj Success");
@@ -645,20 +756,43 @@ int NFRedisDriver::SaveObj(const std::string& packageName, const std::string& ta
         CHECK_EXPR(iRet == 0, 1, "GetPrivateFields Failed:{}", tableName);
     }
 
-    bool bRet = SelectDB(NFREDIS_DB1);
-    if (!bRet)
+    std::vector<string_pair> vecFieldValues;
+    if (!GetObjFieldValues(packageName, className, record, vecFieldValues))
     {
-        NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} fieldKey:{}", NFREDIS_DB1, tableName, fieldKey);
         return -1;
     }
 
-    bRet = SetObj(packageName, className, db_key, record);
-    if (!bRet)
+    //SELECT/HMSET/EXPIRE一次写出
+    bool bRet = false;
+    bool bSet = false;
+    PipelineSelectDB(NFREDIS_DB1, bRet);
+
+    NFRedisCommand setCmd(GET_NAME(HMSET));
+    setCmd << db_key;
+    for (size_t i = 0; i < vecFieldValues.size(); i++)
+    {
+        setCmd << vecFieldValues[i].first << vecFieldValues[i].second;
+    }
+    PipelineCmd(setCmd, [&bSet](const NF_SHARE_PTR<redisReply>& pReply)
     {
+        bSet = pReply != nullptr;
+    });
+
+    NFRedisCommand expireCmd(GET_NAME(EXPIRE));
+    expireCmd << db_key << PRIVATE_KEY_EXIST_TIME;
+    PipelineCmd(expireCmd);
+
+    if (WaitPipeline() != 0 || !bRet)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "SelectDB:{} Failed! dbName:{} fieldKey:{}", NFREDIS_DB1, tableName, fieldKey);
         return -1;
     }
 
-    EXPIRE(db_key, PRIVATE_KEY_EXIST_TIME);
+    if (!bSet)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "HMSET:{} Failed! dbName:{}", db_key, tableName);
+        return -1;
+    }
     NFLogInfo(NF_LOG_DEFAULT, 0, "SaveObj tbName:{} field:{} fieldKey:{} Success", tableName, field, fieldKey);
 
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
@@ -864,6 +998,12 @@ int NFRedisDriver::GetObjKey(const std::string& packageName, const std::string&
 
 NF_SHARE_PTR<redisReply> NFRedisDriver::BuildSendCmd(const NFRedisCommand &cmd)
 {
+    //同步命令的回复排在流水线命令后面, 先把流水线收完
+    if (!m_pipelineCb.empty())
+    {
+        WaitPipeline();
+    }
+
     mbBusy = true;
 
     if (!IsConnect())
@@ -907,17 +1047,24 @@ NF_SHARE_PTR<redisReply> NFRedisDriver::ParseForReply()
             break;
         }
 
-        Execute();
-
         if (!IsConnect())
         {
             ReConnect();
             break;
         }
+
+        //阻塞在socket上等回复, 不空转
+        m_pRedisClientSocket->Wait(NFREDIS_WAIT_REPLY_MS);
+        Execute();
     }
 
     mbBusy = false;
 
+    return MakeReply(reply);
+}
+
+NF_SHARE_PTR<redisReply> NFRedisDriver::MakeReply(redisReply* reply)
+{
     if (reply == nullptr)
     {
         return nullptr;
@@ -925,7 +1072,7 @@ NF_SHARE_PTR<redisReply> NFRedisDriver::ParseForReply()
 
     if (REDIS_REPLY_ERROR == reply->type)
     {
-        // write log
+        NFLogError(NF_LOG_DEFAULT, 0, "redis reply error:{}", std::string(reply->str, reply->len));
         freeReplyObject(reply);
         return nullptr;
     }
@@ -933,6 +1080,172 @@ NF_SHARE_PTR<redisReply> NFRedisDriver::ParseForReply()
     return NF_SHARE_PTR<redisReply>(reply, [](redisReply *r) { if (r) freeReplyObject(r); });
 }
 
+int NFRedisDriver::PipelineCmd(const NFRedisCommand& cmd, const NFRedisReplyCb& cb)
+{
+    if (!IsConnect())
+    {
+        return -1;
+    }
+
+    m_pipelineBuffer.append(cmd.Serialize());
+    m_pipelineCb.push_back(cb);
+    return 0;
+}
+
+int NFRedisDriver::FlushPipeline()
+{
+    if (m_pipelineBuffer.empty())
+    {
+        return 0;
+    }
+
+    int iRet = m_pRedisClientSocket->Write(m_pipelineBuffer.data(), m_pipelineBuffer.length());
+    m_pipelineBuffer.clear();
+    if (iRet != 0)
+    {
+        FailPipeline();
+        return -1;
+    }
+
+    Execute();
+    return 0;
+}
+
+int NFRedisDriver::PollPipeline()
+{
+    Execute();
+
+    int count = 0;
+    while (!m_pipelineCb.empty())
+    {
+        redisReply* reply = nullptr;
+        int ret = redisReaderGetReply(m_pRedisClientSocket->GetRedisReader(), (void**)&reply);
+        if (ret != REDIS_OK)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "redisReaderGetReply protocol error, ip:{} port:{}", mstrIP, mnPort);
+            FailPipeline();
+            ReConnect();
+            return -1;
+        }
+
+        if (reply == nullptr)
+        {
+            break;
+        }
+
+        NFRedisReplyCb cb = m_pipelineCb.front();
+        m_pipelineCb.pop_front();
+        NF_SHARE_PTR<redisReply> pReply = MakeReply(reply);
+        if (cb)
+        {
+            cb(pReply);
+        }
+        count++;
+    }
+
+    if (!m_pipelineCb.empty() && !IsConnect())
+    {
+        FailPipeline();
+        ReConnect();
+        return -1;
+    }
+
+    return count;
+}
+
+int NFRedisDriver::WaitPipeline()
+{
+    if (!IsConnect())
+    {
+        FailPipeline();
+        ReConnect();
+        return -1;
+    }
+
+    if (FlushPipeline() != 0)
+    {
+        return -1;
+    }
+
+    mbBusy = true;
+    while (!m_pipelineCb.empty())
+    {
+        if (PollPipeline() < 0)
+        {
+            mbBusy = false;
+            return -1;
+        }
+
+        if (!m_pipelineCb.empty())
+        {
+            m_pRedisClientSocket->Wait(NFREDIS_WAIT_REPLY_MS);
+        }
+    }
+    mbBusy = false;
+
+    return 0;
+}
+
+void NFRedisDriver::FailPipeline()
+{
+    m_pipelineBuffer.clear();
+    while (!m_pipelineCb.empty())
+    {
+        NFRedisReplyCb cb = m_pipelineCb.front();
+        m_pipelineCb.pop_front();
+        if (cb)
+        {
+            cb(nullptr);
+        }
+    }
+}
+
+void NFRedisDriver::PipelineSelectDB(int dbnum, bool& bSuccess)
+{
+    bSuccess = false;
+    NFRedisCommand cmd(GET_NAME(Select));
+    cmd << dbnum;
+    PipelineCmd(cmd, [&bSuccess](const NF_SHARE_PTR<redisReply>& pReply)
+    {
+        if (pReply && pReply->type == REDIS_REPLY_STATUS)
+        {
+            std::string status(pReply->str, pReply->len);
+            bSuccess = (status == "OK" || status == "ok");
+        }
+    });
+}
+
+void NFRedisDriver::PipelineHMGET(const std::string& key, const std::vector<std::string>& vecFields, std::vector<std::string>& vecValues, bool& bSuccess)
+{
+    bSuccess = false;
+    NFRedisCommand cmd(GET_NAME(HMGET));
+    cmd << key;
+    for (int i = 0; i < (int)vecFields.size(); ++i)
+    {
+        cmd << vecFields[i];
+    }
+
+    PipelineCmd(cmd, [&vecValues, &bSuccess](const NF_SHARE_PTR<redisReply>& pReply)
+    {
+        if (pReply == nullptr)
+        {
+            return;
+        }
+
+        bSuccess = true;
+        if (pReply->type == REDIS_REPLY_ARRAY)
+        {
+            for (int k = 0; k < (int)pReply->elements; k++)
+            {
+                if (pReply->element[k]->type == REDIS_REPLY_STRING)
+                {
+                    vecValues.emplace_back(pReply->element[k]->str, pReply->element[k]->len);
+                }
+            }
+        }
+    });
+}
+
 bool NFRedisDriver::AUTH(const std::string &auth)
 {
     NFRedisCommand cmd(GET_NAME(AUTH));
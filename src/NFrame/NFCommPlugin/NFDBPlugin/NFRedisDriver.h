@@ -39,6 +39,8 @@
 #include <iostream>
 #include <random>
 #include <thread>
+#include <deque>
+#include <functional>
 
 #include "NFRedisCommand.h"
 #include "NFRedisClientSocket.h"
@@ -46,6 +48,15 @@
 #include "NFComm/NFPluginModule/NFINosqlModule.h"
 #include "NFComm/NFKernelMessage/FrameSqlData.pb.h"
 
+//等待回复时每次阻塞在socket上的最长时间(毫秒)
+#define NFREDIS_WAIT_REPLY_MS 10
+
+/**
+* @brief 流水线命令的回复回调, 在调用WaitPipeline/PollPipeline的线程上执行
+* @param pReply 回复, 错误回复或者连接断开时为空
+*/
+typedef std::function<void(const NF_SHARE_PTR<redisReply>& pReply)> NFRedisReplyCb;
+
 
 class NFRedisDriver : public NFINosqlDriver
 {
@@ -65,6 +76,42 @@ public:
 	bool ReConnect();
 
 	bool IsConnect();
+public:
+	/**
+	* @brief 流水线模式, 命令先排队, FlushPipeline一次写出, 回复按发送顺序匹配回调
+	*
+	* 同一个driver只在一个任务线程上使用, 流水线里还有未完成的命令时, 普通的同步命令会先等它们完成
+	* @param cb 回复回调, 可以为空
+	* @return 0成功, 未连接返回-1
+	*/
+	int PipelineCmd(const NFRedisCommand& cmd, const NFRedisReplyCb& cb = NFRedisReplyCb());
+
+	/**
+	* @brief 把排队的命令一次写出, 不等回复
+	*/
+	int FlushPipeline();
+
+	/**
+	* @brief 不阻塞, 处理已经收到的回复
+	* @return 本次完成的命令数, 连接断开返回-1
+	*/
+	int PollPipeline();
+
+	/**
+	* @brief 写出排队的命令并等待全部回复
+	* @return 0成功, 连接断开返回-1, 未完成的回调都以空回复调用
+	*/
+	int WaitPipeline();
+
+	/**
+	* @brief 已排队还没收到回复的命令数
+	*/
+	size_t GetPipelineDepth() const { return m_pipelineCb.size(); }
+
+	/**
+	* @brief 排队SELECT, 结果写到bSuccess
+	*/
+	void PipelineSelectDB(int dbnum, bool& bSuccess);
 public:
 	virtual int SelectByCond(const NFrame::storesvr_sel& select, std::string& privateKey, std::unordered_set<std::string>& fields, std::unordered_set<std::string>& privateKeySet);
 
@@ -850,12 +897,44 @@ protected:
 	NF_SHARE_PTR<redisReply> BuildSendCmd(const NFRedisCommand& cmd);
 	NF_SHARE_PTR<redisReply> ParseForReply();
 
+	/**
+	* @brief 错误回复转成空, 其余交给智能指针释放
+	*/
+	static NF_SHARE_PTR<redisReply> MakeReply(redisReply* reply);
+
+	/**
+	* @brief 连接断开, 所有未完成的流水线命令以空回复结束
+	*/
+	void FailPipeline();
+
+	/**
+	* @brief 对象的所有数据库字段名, fields不为空时直接用fields
+	*/
+	bool GetObjFieldNames(const std::string& packageName, const std::string& className, const std::unordered_set<std::string>& fields, std::vector<std::string>& vecFields);
+
+	/**
+	* @brief 对象序列化数据转成HMSET的字段和值
+	*/
+	bool GetObjFieldValues(const std::string& packageName, const std::string& className, const std::string& value, std::vector<string_pair>& vecFieldValues);
+
+	/**
+	* @brief HMGET的字段值转成对象序列化数据
+	*/
+	bool MakeObjValue(const std::string& packageName, const std::string& className, const std::vector<std::string>& vecFields, const std::vector<std::string>& vecValues, std::string& value);
+
+	/**
+	* @brief 排队HMGET, 字段值写到vecValues, 命令失败时bSuccess为false
+	*/
+	void PipelineHMGET(const std::string& key, const std::vector<std::string>& vecFields, std::vector<std::string>& vecValues, bool& bSuccess);
 
 private:
 
 	bool mbAuthed;
 	bool mbBusy;
 	NFRedisClientSocket* m_pRedisClientSocket;
+
+	std::string m_pipelineBuffer; //还没写出的命令
+	std::deque<NFRedisReplyCb> m_pipelineCb; //已排队命令的回调, 和回复一一对应
 };
 
 
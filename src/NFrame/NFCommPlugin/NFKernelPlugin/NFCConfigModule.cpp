@@ -95,6 +95,15 @@ bool NFCConfigModule::LoadLogConfig()
         mLogConfig.mLineConfigList.push_back(lineConfig);
     }
 
+    //没有配置就不开二进制log
+    NFLuaRef binLogRef = GetGlobal(DEFINE_LUA_STRING_LOG_BINARY);
+    if (binLogRef.isValid() && binLogRef.isTable())
+    {
+        GetLuaTableValue(binLogRef, "open", mLogConfig.mBinLogOpen);
+        GetLuaTableValue(binLogRef, "ringsize", mLogConfig.mBinLogRingSize);
+        GetLuaTableValue(binLogRef, "policy", mLogConfig.mBinLogPolicy);
+    }
+
     FindModule<NFILogModule>()->SetDefaultLogConfig();
 
     return true;
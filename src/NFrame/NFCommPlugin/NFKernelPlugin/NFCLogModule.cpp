@@ -23,7 +23,7 @@
 #include "NFComm/NFCore/NFTime.h"
 
 
-NFCLogModule::NFCLogModule(NFIPluginManager* p):NFILogModule(p)
+NFCLogModule::NFCLogModule(NFIPluginManager* p):NFILogModule(p), m_bBinLogStop(false), m_binLogReportDrop(0), m_binLogReportTime(0)
 {
 	NFLogMgr::Instance()->Init(this);
 #if NF_PLATFORM == NF_PLATFORM_WIN
@@ -57,16 +57,20 @@ void NFCLogModule::InitLogSystem()
 		std::cout << "Create logger failed, error = " << error.what() << std::endl;
 		assert(false);
 	}
+
+	NFLogMgr::Instance()->UpdateLogEnable();
 }
 
 NFCLogModule::~NFCLogModule()
 {
+	StopBinLog();
 	NFLogMgr::Instance()->UnInit();
 	spdlog::drop_all();
 }
 
 bool NFCLogModule::Shut()
 {
+	StopBinLog();
 	return true;
 }
 
@@ -80,17 +84,13 @@ void NFCLogModule::LogDefault(NF_LOG_LEVEL log_level, const NFSourceLoc& loc, ui
 {
 	if (IsLogIdEnable(log_level, logId))
 	{
-		std::string str = fmt::format("[][] [{}:{}:{}] [{}] {}", loc.filename, loc.line, loc.funcname, guid, log);
-		auto pLogger = m_defaultLogger;
-		if (logId != NF_LOG_DEFAULT)
+		if (NFLogMgr::Instance()->LogBinaryString(NF_BIN_LOG_KIND_LOC, log_level, loc, logId, guid, 0, log))
 		{
-			pLogger = m_loggerMap[logId];
-			if (pLogger == NULL)
-			{
-				pLogger = m_defaultLogger;
-			}
+			return;
 		}
-		pLogger->log((spdlog::level::level_enum)log_level, str.c_str());
+
+		std::string str = MakeLogString(NF_BIN_LOG_KIND_LOC, loc, guid, 0, log);
+		GetLogger(logId)->log((spdlog::level::level_enum)log_level, str.c_str());
 	}
 }
 
@@ -98,17 +98,13 @@ void NFCLogModule::LogDefault(NF_LOG_LEVEL log_level, const NFSourceLoc& loc, ui
 {
 	if (IsLogIdEnable(log_level, logId))
 	{
-		std::string str = fmt::format("[{}][] [{}:{}:{}] [{}] {}", module, loc.filename, loc.line, loc.funcname, guid, log);
-		auto pLogger = m_defaultLogger;
-		if (logId != NF_LOG_DEFAULT)
+		if (NFLogMgr::Instance()->LogBinaryString(NF_BIN_LOG_KIND_MODULE, log_level, loc, logId, guid, module, log))
 		{
-			pLogger = m_loggerMap[logId];
-			if (pLogger == NULL)
-			{
-				pLogger = m_defaultLogger;
-			}
+			return;
 		}
-		pLogger->log((spdlog::level::level_enum)log_level, str.c_str());
+
+		std::string str = MakeLogString(NF_BIN_LOG_KIND_MODULE, loc, guid, module, log);
+		GetLogger(logId)->log((spdlog::level::level_enum)log_level, str.c_str());
 	}
 }
 
@@ -116,16 +112,12 @@ void NFCLogModule::LogBehaviour(NF_LOG_LEVEL log_level, uint32_t logId, const st
 {
 	if (IsLogIdEnable(log_level, logId))
 	{
-		auto pLogger = m_defaultLogger;
-		if (logId != NF_LOG_DEFAULT)
+		if (NFLogMgr::Instance()->LogBinaryString(NF_BIN_LOG_KIND_BEHAVIOUR, log_level, NFSourceLoc(), logId, 0, 0, log))
 		{
-			pLogger = m_loggerMap[logId];
-			if (pLogger == NULL)
-			{
-				pLogger = m_defaultLogger;
-			}
+			return;
 		}
-		pLogger->log((spdlog::level::level_enum)log_level, log.c_str());
+
+		GetLogger(logId)->log((spdlog::level::level_enum)log_level, log.c_str());
 	}
 }
 
@@ -142,23 +134,46 @@ void NFCLogModule::LogDefault(NF_LOG_LEVEL log_level, uint32_t logId, uint64_t g
 {
 	if (IsLogIdEnable(log_level, logId))
 	{
-		std::string str = fmt::format(" [{}] {}", guid, log);
-		auto pLogger = m_defaultLogger;
-		if (logId != NF_LOG_DEFAULT)
+		if (NFLogMgr::Instance()->LogBinaryString(NF_BIN_LOG_KIND_GUID, log_level, NFSourceLoc(), logId, guid, 0, log))
 		{
-			pLogger = m_loggerMap[logId];
-			if (pLogger == NULL)
-			{
-				pLogger = m_defaultLogger;
-			}
+			return;
 		}
-		pLogger->log((spdlog::level::level_enum)log_level, str.c_str());
+
+		std::string str = MakeLogString(NF_BIN_LOG_KIND_GUID, NFSourceLoc(), guid, 0, log);
+		GetLogger(logId)->log((spdlog::level::level_enum)log_level, str.c_str());
 	}
 }
 
+std::shared_ptr<spdlog::logger> NFCLogModule::GetLogger(uint32_t logId)
+{
+	std::lock_guard<std::mutex> lock(m_loggerMutex);
+	if (logId != NF_LOG_DEFAULT && logId < m_loggerMap.size() && m_loggerMap[logId] != NULL)
+	{
+		return m_loggerMap[logId];
+	}
+	return m_defaultLogger;
+}
+
+std::string NFCLogModule::MakeLogString(NF_BIN_LOG_STRING_KIND kind, const NFSourceLoc& loc, uint64_t guid, uint32_t module, const std::string& log)
+{
+	switch (kind)
+	{
+		case NF_BIN_LOG_KIND_LOC:
+			return fmt::format("[][] [{}:{}:{}] [{}] {}", loc.filename, loc.line, loc.funcname, guid, log);
+		case NF_BIN_LOG_KIND_MODULE:
+			return fmt::format("[{}][] [{}:{}:{}] [{}] {}", module, loc.filename, loc.line, loc.funcname, guid, log);
+		case NF_BIN_LOG_KIND_GUID:
+			return fmt::format(" [{}] {}", guid, log);
+		default:
+			break;
+	}
+	return log;
+}
+
 bool NFCLogModule::IsLogIdEnable(NF_LOG_LEVEL log_level, uint32_t logId)
 {
-	if (logId < m_logInfoConfig.size() && m_logInfoConfig[logId].mDisplay)
+	//等级和logger的set_level一致, 低于配置等级的在格式化之前就拦掉
+	if (logId < m_logInfoConfig.size() && m_logInfoConfig[logId].mDisplay && static_cast<uint32_t>(log_level) >= m_logInfoConfig[logId].mLevel)
 	{
 		return true;
 	}
@@ -191,11 +206,165 @@ void NFCLogModule::SetDefaultLogConfig()
 			pLogger->set_level((spdlog::level::level_enum)m_logInfoConfig[i].mLevel);
 		}
 	}
+
+	NFLogMgr::Instance()->UpdateLogEnable();
+
+	if (pLogConfig->mBinLogOpen)
+	{
+		StartBinLog(pLogConfig->mBinLogRingSize, pLogConfig->mBinLogPolicy);
+	}
+	else
+	{
+		StopBinLog();
+	}
+}
+
+void NFCLogModule::StartBinLog(uint32_t ringSize, uint32_t policy)
+{
+	//重载配置时线程已经在跑, 只更新参数
+	if (!m_binLogThread.joinable())
+	{
+		m_bBinLogStop = false;
+		m_binLogThread = std::thread(&NFCLogModule::BinLogThread, this);
+	}
+	NFLogMgr::Instance()->EnableBinLog(ringSize * 1024 * 1024, policy);
+}
+
+void NFCLogModule::StopBinLog()
+{
+	if (!m_binLogThread.joinable())
+	{
+		return;
+	}
+
+	//先让新的log走原来的路径, log线程再把缓冲区取完
+	NFLogMgr::Instance()->DisableBinLog();
+	m_bBinLogStop = true;
+	m_binLogThread.join();
+}
+
+void NFCLogModule::BinLogThread()
+{
+	auto func = [this](const NFBinLogRecord* pRecord) { WriteBinLog(pRecord); };
+	while (true)
+	{
+		//先读退出标记, 保证退出前最后一轮取到了所有已经写进去的记录
+		bool bStop = m_bBinLogStop;
+		int count = NFLogMgr::Instance()->ConsumeBinLog(func);
+		FlushBinLog();
+		if (count == 0)
+		{
+			if (bStop)
+			{
+				break;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+}
+
+void NFCLogModule::WriteBinLog(const NFBinLogRecord* pRecord)
+{
+	NF_LOG_LEVEL log_level = static_cast<NF_LOG_LEVEL>(pRecord->m_level);
+	const char* pData = pRecord->GetData();
+	std::string str;
+	if (pRecord->m_type == NF_BIN_LOG_RECORD_FORMAT)
+	{
+		NFSourceLoc loc(pRecord->m_file, pRecord->m_line, pRecord->m_func);
+		try
+		{
+			std::string log = fmt::format("[{}] ERR Ret:{}. ", pRecord->m_moduleId, pRecord->m_retCode);
+			log += pRecord->m_formatFunc(pData, pRecord->m_dataLen, pData + pRecord->m_dataLen);
+			str = MakeLogString(NF_BIN_LOG_KIND_LOC, loc, pRecord->m_guid, 0, log);
+		}
+		catch (fmt::format_error& error)
+		{
+			std::string log = fmt::format("log format error------------{} error:{}", std::string(pData, pRecord->m_dataLen), error.what());
+			log_level = NLL_ERROR_NORMAL;
+			str = MakeLogString(NF_BIN_LOG_KIND_LOC, loc, pRecord->m_guid, 0, log);
+		}
+	}
+	else
+	{
+		std::string file(pData, pRecord->m_fileLen);
+		std::string func(pData + pRecord->m_fileLen, pRecord->m_funcLen);
+		std::string log(pData + pRecord->m_fileLen + pRecord->m_funcLen, pRecord->m_dataLen);
+		NFSourceLoc loc(file.c_str(), pRecord->m_line, func.c_str());
+		str = MakeLogString(static_cast<NF_BIN_LOG_STRING_KIND>(pRecord->m_kind), loc, pRecord->m_guid, pRecord->m_moduleId, log);
+	}
+
+	SinkBinLog(GetLogger(pRecord->m_logId), log_level, pRecord->m_time, str);
+}
+
+void NFCLogModule::SinkBinLog(const std::shared_ptr<spdlog::logger>& pLogger, NF_LOG_LEVEL log_level, int64_t time, const std::string& str)
+{
+	if (pLogger == NULL)
+	{
+		return;
+	}
+
+	spdlog::details::log_msg msg(&pLogger->name(), (spdlog::level::level_enum)log_level, spdlog::string_view_t(str.data(), str.size()));
+	msg.time = spdlog::log_clock::time_point(spdlog::log_clock::duration(time));
+	for (auto& sink : pLogger->sinks())
+	{
+		if (sink->should_log(msg.level))
+		{
+			sink->log(msg);
+		}
+	}
+
+	if (msg.level >= pLogger->flush_level())
+	{
+		m_binLogFlush.insert(pLogger.get());
+	}
+}
+
+void NFCLogModule::FlushBinLog()
+{
+	for (auto iter = m_binLogFlush.begin(); iter != m_binLogFlush.end(); ++iter)
+	{
+		for (auto& sink : (*iter)->sinks())
+		{
+			sink->flush();
+		}
+	}
+	m_binLogFlush.clear();
+
+	//丢弃数每秒最多报告一次
+	uint64_t now = NFGetSecondTime();
+	if (now == m_binLogReportTime)
+	{
+		return;
+	}
+
+	std::shared_ptr<spdlog::logger> pDefaultLogger = GetLogger(NF_LOG_DEFAULT);
+	if (pDefaultLogger == NULL)
+	{
+		return;
+	}
+	m_binLogReportTime = now;
+
+	NFBinLogStat stat;
+	NFLogMgr::Instance()->GetBinLogStat(stat);
+	if (stat.m_dropCount > m_binLogReportDrop)
+	{
+		std::string str = MakeLogString(NF_BIN_LOG_KIND_GUID, NFSourceLoc(), 0, 0, fmt::format("bin log ring full, dropped {} records, total write:{} drop:{} ring:{}",
+		                                stat.m_dropCount - m_binLogReportDrop, stat.m_writeCount, stat.m_dropCount, stat.m_ringCount));
+		m_binLogReportDrop = stat.m_dropCount;
+		SinkBinLog(pDefaultLogger, NLL_WARING_NORMAL, std::chrono::system_clock::now().time_since_epoch().count(), str);
+		for (auto& sink : pDefaultLogger->sinks())
+		{
+			sink->flush();
+		}
+		m_binLogFlush.clear();
+	}
 }
 
 void NFCLogModule::CreateDefaultLogger()
 {
-	m_defaultLogger = CreateLogger(m_logInfoConfig[NF_LOG_DEFAULT]);
+	auto pLogger = CreateLogger(m_logInfoConfig[NF_LOG_DEFAULT]);
+	std::lock_guard<std::mutex> lock(m_loggerMutex);
+	m_defaultLogger = pLogger;
 }
 
 std::shared_ptr<spdlog::logger> NFCLogModule::CreateLogger(const LogInfoConfig& logInfo)
@@ -211,9 +380,13 @@ std::shared_ptr<spdlog::logger> NFCLogModule::CreateLogger(const LogInfoConfig&
 std::shared_ptr<spdlog::logger> NFCLogModule::CreateLogger(uint32_t logId, const std::string& logName, bool async, uint32_t level)
 {
 	CHECK_EXPR(logId < (uint32_t)m_loggerMap.size(), NULL, "logId:{}", logId);
-	if (m_loggerMap[logId] != NULL)
 	{
-		return m_loggerMap[logId];
+		//只在取和放的时候加锁, 创建过程中出错写log会走GetLogger
+		std::lock_guard<std::mutex> lock(m_loggerMutex);
+		if (m_loggerMap[logId] != NULL)
+		{
+			return m_loggerMap[logId];
+		}
 	}
 
 	std::vector<spdlog::sink_ptr> sinks_vec;
@@ -263,6 +436,7 @@ std::shared_ptr<spdlog::logger> NFCLogModule::CreateLogger(uint32_t logId, const
 	pLogger->flush_on(spdlog::level::level_enum(level));
 
 	spdlog::register_logger(pLogger);
+	std::lock_guard<std::mutex> lock(m_loggerMutex);
 	m_loggerMap[logId] = pLogger;
 	return pLogger;
 }
\ No newline at end of file
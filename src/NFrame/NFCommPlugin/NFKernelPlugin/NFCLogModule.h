@@ -8,6 +8,7 @@
 #pragma once
 
 #include "NFComm/NFPluginModule/NFILogModule.h"
+#include "NFComm/NFPluginModule/NFBinLog.h"
 #include "NFComm/NFCore/NFPlatform.h"
 
 #include "common/spdlog/spdlog.h"
@@ -15,6 +16,9 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
 
 
 class NFCLogModule : public NFILogModule
@@ -92,12 +96,55 @@ public:
 protected:
 	/*创建默认系统LOG系统*/
 	void CreateDefaultLogger();
+
+	/**
+	* @brief 找logId对应的logger, 没有就用默认的, 业务线程和log线程都会调用
+	*/
+	std::shared_ptr<spdlog::logger> GetLogger(uint32_t logId);
+
+	/**
+	* @brief 按输出接口拼出最终写进文件的内容
+	*/
+	static std::string MakeLogString(NF_BIN_LOG_STRING_KIND kind, const NFSourceLoc& loc, uint64_t guid, uint32_t module, const std::string& log);
+
+	/**
+	* @brief 启动log线程, 打开二进制log
+	*/
+	void StartBinLog(uint32_t ringSize, uint32_t policy);
+
+	/**
+	* @brief 关闭二进制log, log线程取完缓冲区后退出
+	*/
+	void StopBinLog();
+
+	void BinLogThread();
+
+	/**
+	* @brief log线程里格式化一条记录并写进logger的sink
+	*/
+	void WriteBinLog(const NFBinLogRecord* pRecord);
+
+	/**
+	* @brief 按业务线程写log时的时间写进sink, 不走logger自己的异步队列
+	*/
+	void SinkBinLog(const std::shared_ptr<spdlog::logger>& pLogger, NF_LOG_LEVEL log_level, int64_t time, const std::string& str);
+
+	/**
+	* @brief 取完一轮后统一flush, 丢弃数有变化时写一条警告
+	*/
+	void FlushBinLog();
 private:
+	std::mutex m_loggerMutex; //保护m_defaultLogger和m_loggerMap的元素, 重载配置创建logger时log线程可能正在取
 	std::shared_ptr<spdlog::logger> m_defaultLogger;
 	std::vector<std::shared_ptr<spdlog::logger>> m_loggerMap;
 	std::vector<LogInfoConfig> m_logInfoConfig;
 	NF_SHARE_PTR<spdlog::details::thread_pool> m_logThreadPool;
 	std::string m_pid;
+	std::thread m_binLogThread;
+	std::atomic<bool> m_bBinLogStop;
+	std::unordered_set<spdlog::logger*> m_binLogFlush; //这一轮写过需要flush的logger, 只在log线程里用
+	uint64_t m_binLogReportDrop; //上次报告时的丢弃数
+	uint64_t m_binLogReportTime;
 };
 
 
@@ -28,6 +28,7 @@ bool NFCTimerModule::Init()
 bool NFCTimerModule::Execute()
 {
 	mTimerAxis.Update();
+	m_pObjPluginManager->SetNextWakeupTime(mTimerAxis.GetNextUpdateTime());
 	return true;
 }
 
@@ -271,7 +271,10 @@ bool NFTaskGroup::HandlerEx(const NFTaskActorMessage& message, const int from)
 {
     if (message.nMsgType != NFTaskActorMessage::ACTOR_MSG_TYPE_COMPONENT)
     {
-        return m_mQueue.Push(message);
+        bool ret = m_mQueue.Push(message);
+        // 任务完成, 通知主线程处理回调
+        m_pObjPluginManager->Wakeup();
+        return ret;
     }
 
     return false;
@@ -10,55 +10,29 @@
 #include "NFComm/NFCore/NFPlatform.h"
 #include "NFComm/NFPluginModule/NFTimerObj.h"
 
+#include <string.h>
+
 NFTimerAxis::NFTimerAxis()
 {
-	m_TimerAxis.resize((TIME_AXIS_LENGTH + TIME_GRID - 1) / TIME_GRID);
-
-	m_nInitTick = GetTick();
-	m_nLastTick = m_nInitTick;
-	for (uint32_t i = 0; i < m_TimerAxis.size(); ++i)
-	{
-		m_TimerAxis[i] = new TIMER_LIST();
-	}
-
-	m_TimerAxisSec.resize(TIME_AXIS_SECLENGTH);
-	m_nInitSec = GetTick() / 1000;
-	m_nLastSec = m_nInitSec;
-	for (uint32_t i = 0; i < m_TimerAxisSec.size(); ++i)
-	{
-		m_TimerAxisSec[i] = new TIMER_LIST();
-	}
+	memset(m_rootWheel, 0, sizeof(m_rootWheel));
+	memset(m_levelWheel, 0, sizeof(m_levelWheel));
+	m_nRootCount = 0;
+	m_nTickOffset = 0;
+	m_nCurTick = GetTick();
+	m_nLastTick = m_nCurTick;
+	m_pRunningTimer = nullptr;
+	m_pFreeList = nullptr;
+	m_nTimerCount = 0;
 }
 
 NFTimerAxis::~NFTimerAxis()
 {
-	for (size_t i = 0; i < m_TimerAxis.size(); ++i)
+	for (size_t i = 0; i < m_vecChunk.size(); ++i)
 	{
-		TIMER_LIST* pTimerList = m_TimerAxis[i];
-		TIMER_LIST::iterator iter = pTimerList->begin();
-		for (; iter != pTimerList->end(); ++iter)
-		{
-			Timer* pTimer = (*iter);
-			NF_SAFE_DELETE(pTimer);
-		}
-		pTimerList->clear();
-		NF_SAFE_DELETE(pTimerList);
+		delete[] m_vecChunk[i];
 	}
-	m_TimerAxis.clear();
-
-	for (size_t j = 0; j < m_TimerAxisSec.size(); ++j)
-	{
-		TIMER_LIST* pTimerList = m_TimerAxisSec[j];
-		TIMER_LIST::iterator iter = pTimerList->begin();
-		for (; iter != pTimerList->end(); ++iter)
-		{
-			Timer* pTimer = (*iter);
-			NF_SAFE_DELETE(pTimer);
-		}
-		pTimerList->clear();
-		NF_SAFE_DELETE(pTimerList);
-	}
-	m_TimerAxisSec.clear();
+	m_vecChunk.clear();
+	m_pFreeList = nullptr;
 }
 
 bool NFTimerAxis::Init()
@@ -71,224 +45,290 @@ bool NFTimerAxis::UnInit()
 	return true;
 }
 
-
-//붨ʱ
-bool NFTimerAxis::SetTimerSec(uint32_t nTimerID, uint64_t nInterVal, NFTimerObjBase* handler, uint32_t nCallCount/* = INFINITY_CALL*/)
+NFTimerAxis::Timer* NFTimerAxis::AllocTimer()
 {
-	if (nullptr == handler)
+	if (nullptr == m_pFreeList)
 	{
-		return false;
+		Timer* pChunk = new Timer[TIMER_POOL_CHUNK_SIZE];
+		m_vecChunk.push_back(pChunk);
+		for (uint32_t i = 0; i < TIMER_POOL_CHUNK_SIZE; ++i)
+		{
+			pChunk[i].pNext = m_pFreeList;
+			m_pFreeList = &pChunk[i];
+		}
 	}
-	if (nCallCount == 0)
+
+	Timer* pTimer = m_pFreeList;
+	m_pFreeList = pTimer->pNext;
+	memset(pTimer, 0, sizeof(Timer));
+	m_nTimerCount++;
+	return pTimer;
+}
+
+void NFTimerAxis::FreeTimer(Timer* pTimer)
+{
+	pTimer->pHandler = nullptr;
+	pTimer->ppSlot = nullptr;
+	pTimer->pNext = m_pFreeList;
+	m_pFreeList = pTimer;
+	m_nTimerCount--;
+}
+
+void NFTimerAxis::AddToWheel(Timer* pTimer)
+{
+	uint64_t nExpireTick = pTimer->nExpireTick;
+	if (nExpireTick < m_nCurTick)
 	{
-		return false;
+		//已经过期的放到当前刻度, 下一次Update触发
+		nExpireTick = m_nCurTick;
 	}
-	if (nInterVal < 1)
+
+	uint64_t nDelta = nExpireTick - m_nCurTick;
+	if (nDelta > TIMER_WHEEL_MAX_DELTA)
 	{
-		nInterVal = 1;
+		//超出时间轮范围的先挂在最高层, 下放时会按真实的到期时间重新计算
+		nDelta = TIMER_WHEEL_MAX_DELTA;
+		nExpireTick = m_nCurTick + nDelta;
 	}
 
-	bool bNeedFind = true;
-	void** ppTimerInfo = handler->GetTimerInfoPtr();
-	TIMER_LIST* pTimerList = *(TIMER_LIST**)ppTimerInfo;
-	if (nullptr == pTimerList)
+	Timer** ppSlot = nullptr;
+	if (nDelta < TIMER_WHEEL_ROOT_SIZE)
 	{
-		pTimerList = new TIMER_LIST();
-		*ppTimerInfo = pTimerList;
-		bNeedFind = false;
+		ppSlot = &m_rootWheel[nExpireTick & TIMER_WHEEL_ROOT_MASK];
+		m_nRootCount++;
 	}
-
-	Timer* pTimer = nullptr;
-	if (bNeedFind)
+	else
 	{
-		TIMER_LIST::iterator iter = pTimerList->begin();
-		for (; iter != pTimerList->end(); ++iter)
+		for (uint32_t nLevel = 1; nLevel < TIMER_WHEEL_LEVEL; ++nLevel)
 		{
-			pTimer = (*iter);
-			if (pTimer->nTimerID == nTimerID)
+			uint32_t nBits = TIMER_WHEEL_ROOT_BITS + nLevel * TIMER_WHEEL_LEVEL_BITS;
+			if (nDelta < (1ULL << nBits) || nLevel == TIMER_WHEEL_LEVEL - 1)
 			{
-				//ʱID Ѵ
-				return false;
+				uint32_t nIndex = static_cast<uint32_t>(nExpireTick >> (nBits - TIMER_WHEEL_LEVEL_BITS)) & TIMER_WHEEL_LEVEL_MASK;
+				ppSlot = &m_levelWheel[nLevel - 1][nIndex];
+				break;
 			}
 		}
 	}
 
-	pTimer = new Timer();
-	pTimer->byType = 1;
-	pTimer->nTimerID = nTimerID;
-	pTimer->nCallCount = nCallCount;
-	pTimer->nInterVal = nInterVal;
-	pTimer->pHandler = handler;
-	pTimer->nLastTick = m_nLastSec;
-	uint32_t nTemp = (uint32_t)(pTimer->nLastTick - m_nInitSec + pTimer->nInterVal);
-	pTimer->nGridIndex = nTemp % m_TimerAxisSec.size();
+	pTimer->ppSlot = ppSlot;
+	pTimer->pPrev = nullptr;
+	pTimer->pNext = *ppSlot;
+	if (*ppSlot)
+	{
+		(*ppSlot)->pPrev = pTimer;
+	}
+	*ppSlot = pTimer;
+}
 
-	pTimerList->push_back(pTimer);
+void NFTimerAxis::RemoveFromWheel(Timer* pTimer)
+{
+	if (nullptr == pTimer->ppSlot)
+	{
+		return;
+	}
 
-	m_TimerAxisSec[pTimer->nGridIndex]->push_back(pTimer);
-	pTimer->pos = --m_TimerAxisSec[pTimer->nGridIndex]->end();
+	if (pTimer->ppSlot >= m_rootWheel && pTimer->ppSlot < m_rootWheel + TIMER_WHEEL_ROOT_SIZE)
+	{
+		m_nRootCount--;
+	}
 
-	return true;
-}
+	if (pTimer->pPrev)
+	{
+		pTimer->pPrev->pNext = pTimer->pNext;
+	}
+	else
+	{
+		*pTimer->ppSlot = pTimer->pNext;
+	}
 
+	if (pTimer->pNext)
+	{
+		pTimer->pNext->pPrev = pTimer->pPrev;
+	}
 
+	pTimer->ppSlot = nullptr;
+	pTimer->pPrev = nullptr;
+	pTimer->pNext = nullptr;
+}
 
-bool NFTimerAxis::SetTimer(uint32_t nTimerID, uint64_t nInterVal, NFTimerObjBase* handler, uint32_t nCallCount /*= INFINITY_CALL*/)
+void NFTimerAxis::AddToHandler(Timer* pTimer)
 {
-	if (nullptr == handler)
-	{
-		//󣬻صָΪգҪӡ־
-		return false;
-	}
-	if (nCallCount == 0)
+	Timer** ppHead = reinterpret_cast<Timer**>(pTimer->pHandler->GetTimerInfoPtr());
+	pTimer->pHandlerPrev = nullptr;
+	pTimer->pHandlerNext = *ppHead;
+	if (*ppHead)
 	{
-		//󣬵ôΪ0Ҫӡ־
-		nCallCount = INFINITY_CALL;
+		(*ppHead)->pHandlerPrev = pTimer;
 	}
-	if (nInterVal < TIMER_AXIS_CHECK_FREQUENCE)
+	*ppHead = pTimer;
+}
+
+void NFTimerAxis::RemoveFromHandler(Timer* pTimer)
+{
+	if (pTimer->pHandlerPrev)
 	{
-		nInterVal = TIMER_AXIS_CHECK_FREQUENCE;
+		pTimer->pHandlerPrev->pHandlerNext = pTimer->pHandlerNext;
 	}
-	if (nInterVal >= 2000)
+	else
 	{
-		//ĵ̶ʱ
-		return SetTimerSec(nTimerID, nInterVal / 1000, handler, nCallCount);
+		Timer** ppHead = reinterpret_cast<Timer**>(pTimer->pHandler->GetTimerInfoPtr());
+		*ppHead = pTimer->pHandlerNext;
 	}
 
-	bool bNeedFind = true;
-	void** ppTimerInfo = handler->GetTimerInfoPtr();
-	TIMER_LIST* pTimerList = *(TIMER_LIST**)ppTimerInfo;
-	if (nullptr == pTimerList)
+	if (pTimer->pHandlerNext)
 	{
-		pTimerList = new TIMER_LIST();
-		*ppTimerInfo = pTimerList;
-		bNeedFind = false;
+		pTimer->pHandlerNext->pHandlerPrev = pTimer->pHandlerPrev;
 	}
 
-	Timer* pTimer = nullptr;
-	if (bNeedFind)
+	pTimer->pHandlerPrev = nullptr;
+	pTimer->pHandlerNext = nullptr;
+}
+
+NFTimerAxis::Timer* NFTimerAxis::FindTimer(uint32_t nTimerID, NFTimerObjBase* handler)
+{
+	Timer* pTimer = *reinterpret_cast<Timer**>(handler->GetTimerInfoPtr());
+	while (pTimer)
 	{
-		TIMER_LIST::iterator iter = pTimerList->begin();
-		for (; iter != pTimerList->end(); ++iter)
+		if (pTimer->nTimerID == nTimerID)
 		{
-			pTimer = (*iter);
-			if (pTimer->nTimerID == nTimerID)
-			{
-				//ʱID Ѵ
-				return false;
-			}
+			return pTimer;
 		}
+		pTimer = pTimer->pHandlerNext;
 	}
+	return nullptr;
+}
 
-	CheckTick();
-	pTimer = new Timer();
+NFTimerAxis::Timer* NFTimerAxis::AddTimer(uint32_t nTimerID, uint64_t nInterVal, uint64_t nExpireTick, uint8_t byType, NFTimerObjBase* handler, uint32_t nCallCount)
+{
+	if (FindTimer(nTimerID, handler))
+	{
+		//定时器ID 已存在
+		return nullptr;
+	}
+
+	Timer* pTimer = AllocTimer();
 	pTimer->nTimerID = nTimerID;
 	pTimer->nInterVal = nInterVal;
-	pTimer->pHandler = handler;
+	pTimer->nExpireTick = nExpireTick;
 	pTimer->nCallCount = nCallCount;
-	pTimer->nLastTick = m_nLastTick;
-	pTimer->byType = 0;
-	uint64_t nTemp = pTimer->nLastTick - m_nInitTick + pTimer->nInterVal;
-	pTimer->nGridIndex = (nTemp / TIME_GRID) % m_TimerAxis.size();
-
-	pTimerList->push_back(pTimer);
-
-	m_TimerAxis[pTimer->nGridIndex]->push_back(pTimer);
-	pTimer->pos = --m_TimerAxis[pTimer->nGridIndex]->end();
+	pTimer->pHandler = handler;
+	pTimer->byType = byType;
 
-	return true;
+	AddToHandler(pTimer);
+	AddToWheel(pTimer);
+	return pTimer;
 }
 
+void NFTimerAxis::DelTimer(Timer* pTimer)
+{
+	RemoveFromHandler(pTimer);
+	RemoveFromWheel(pTimer);
+	pTimer->nCallCount = 0;
 
+	if (pTimer == m_pRunningTimer)
+	{
+		//正在回调中, 等回调返回后再释放
+		pTimer->pHandler = nullptr;
+		return;
+	}
 
+	FreeTimer(pTimer);
+}
 
-//رնʱ
-bool NFTimerAxis::KillTimer(uint32_t nTimerID, NFTimerObjBase* handler)
+//设置秒定时器
+bool NFTimerAxis::SetTimerSec(uint32_t nTimerID, uint64_t nInterVal, NFTimerObjBase* handler, uint32_t nCallCount/* = INFINITY_CALL*/)
 {
 	if (nullptr == handler)
 	{
 		return false;
 	}
-
-	void** ppTimerInfo = handler->GetTimerInfoPtr();
-	TIMER_LIST* pTimerList = *(TIMER_LIST**)ppTimerInfo;
-	if (nullptr == pTimerList)
+	if (nCallCount == 0)
 	{
 		return false;
 	}
-
-	TIMER_LIST::iterator iter = pTimerList->begin();
-	for (; iter != pTimerList->end(); ++iter)
+	if (nInterVal < 1)
 	{
-		Timer* pTimer = (*iter);
-		if (pTimer && pTimer->nTimerID == nTimerID)
-		{
-			pTimerList->erase(iter);
-			pTimer->nCallCount = 0;
-			pTimer->pHandler = nullptr;
-
-			//öʱʱϵλ
-			ResetTimerPos(pTimer);
+		nInterVal = 1;
+	}
 
-			NF_SAFE_DELETE(pTimer);
+	CheckTick();
 
-			if (pTimerList->empty())
-			{
-				NF_SAFE_DELETE(pTimerList);
-				*ppTimerInfo = nullptr;
-			}
+	//秒定时器对齐到整秒触发
+	uint64_t nExpireTick = (GetTick() / 1000 + nInterVal) * 1000 + m_nTickOffset;
+	return nullptr != AddTimer(nTimerID, nInterVal * 1000, nExpireTick, 1, handler, nCallCount);
+}
 
-			return true;
-		}
+bool NFTimerAxis::SetTimer(uint32_t nTimerID, uint64_t nInterVal, NFTimerObjBase* handler, uint32_t nCallCount /*= INFINITY_CALL*/)
+{
+	if (nullptr == handler)
+	{
+		//错误，回调指针为空，需要打印日志
+		return false;
+	}
+	if (nCallCount == 0)
+	{
+		//错误，调用次数为0，需要打印日志
+		nCallCount = INFINITY_CALL;
+	}
+	if (nInterVal < TIMER_AXIS_CHECK_FREQUENCE)
+	{
+		nInterVal = TIMER_AXIS_CHECK_FREQUENCE;
+	}
+	if (nInterVal >= 2000)
+	{
+		//间隔大于两秒的当做秒定时器
+		return SetTimerSec(nTimerID, nInterVal / 1000, handler, nCallCount);
 	}
 
-	return false;
+	CheckTick();
+
+	return nullptr != AddTimer(nTimerID, nInterVal, GetWheelTick() + nInterVal, 0, handler, nCallCount);
 }
 
-//رжʱ
-bool NFTimerAxis::KillAllTimer(NFTimerObjBase* handler)
+//关闭定时器
+bool NFTimerAxis::KillTimer(uint32_t nTimerID, NFTimerObjBase* handler)
 {
 	if (nullptr == handler)
 	{
 		return false;
 	}
 
-	void** ppTimerInfo = handler->GetTimerInfoPtr();
-	TIMER_LIST* pTimerList = *(TIMER_LIST**)ppTimerInfo;
-	if (nullptr == pTimerList)
+	Timer* pTimer = FindTimer(nTimerID, handler);
+	if (nullptr == pTimer)
 	{
 		return false;
 	}
 
-	TIMER_LIST::iterator iter = pTimerList->begin();
-	for (; iter != pTimerList->end(); ++iter)
+	DelTimer(pTimer);
+	return true;
+}
+
+//关闭所有定时器
+bool NFTimerAxis::KillAllTimer(NFTimerObjBase* handler)
+{
+	if (nullptr == handler)
 	{
-		Timer* pTimer = (*iter);
-		if (nullptr != pTimer)
-		{
-			pTimer->nCallCount = 0;
-			pTimer->pHandler = nullptr;
+		return false;
+	}
 
-			//öʱʱϵλ
-			ResetTimerPos(pTimer);
-			NF_SAFE_DELETE(pTimer);
-		}
+	Timer** ppHead = reinterpret_cast<Timer**>(handler->GetTimerInfoPtr());
+	while (*ppHead)
+	{
+		DelTimer(*ppHead);
 	}
-	pTimerList->clear();
-	NF_SAFE_DELETE(pTimerList);
-	*ppTimerInfo = nullptr;
 
 	return false;
 }
 
-//tick
+//检查tick
 void NFTimerAxis::CheckTick()
 {
-	uint64_t nowTick = GetTick();
-	if (nowTick < m_nLastTick || nowTick < m_nInitTick || m_nLastTick < m_nInitTick)
+	uint64_t nowTick = GetWheelTick();
+	if (nowTick < m_nLastTick)
 	{
-		m_nInitTick = nowTick;
-		m_nLastTick = nowTick;
+		//系统时间回拨, 内部时钟停在回拨前的位置, 已挂上的定时器剩余时间不变
+		m_nTickOffset += m_nLastTick - nowTick;
 	}
 }
 
@@ -297,7 +337,7 @@ bool NFTimerAxis::SetCalender(uint32_t nTimerID, const std::string& timeStr, NFT
 	return true;
 }
 
-//ù̶ʱĶʱ
+//设置固定时间的定时器
 bool NFTimerAxis::SetClocker(uint32_t nTimerID, uint64_t nStartTime, uint32_t nInterSec, NFTimerObjBase* handler, uint32_t nCallCount /*= INFINITY_CALL*/)
 {
 	if (nullptr == handler)
@@ -313,305 +353,147 @@ bool NFTimerAxis::SetClocker(uint32_t nTimerID, uint64_t nStartTime, uint32_t nI
 		nInterSec = 1;
 	}
 
-	bool bNeedFind = true;
-	void** ppTimerInfo = handler->GetTimerInfoPtr();
-	TIMER_LIST* pTimerList = *(TIMER_LIST**)ppTimerInfo;
-	if (nullptr == pTimerList)
-	{
-		pTimerList = new TIMER_LIST();
-		*ppTimerInfo = pTimerList;
-		bNeedFind = false;
-	}
-
-	Timer* pTimer = nullptr;
-	if (bNeedFind)
-	{
-		TIMER_LIST::iterator iter = pTimerList->begin();
-		for (; iter != pTimerList->end(); ++iter)
-		{
-			pTimer = (*iter);
-			if (pTimer->nTimerID == nTimerID)
-			{
-				//ʱID Ѵ
-				return false;
-			}
-		}
-	}
-
-	pTimer = new Timer();
-	pTimer->byType = 1;
-	pTimer->nTimerID = nTimerID;
-	pTimer->nCallCount = nCallCount;
-	pTimer->nInterVal = nInterSec;
-	pTimer->pHandler = handler;
-	pTimer->nLastTick = m_nLastSec;
+	CheckTick();
 
 	uint64_t nowTime = GetUnixSec();
 	uint64_t nowDaySecs = nowTime % nInterSec;
+	uint64_t nLastSec = 0;
 
 	if (nInterSec >= 8 * 60 * 60)
 	{
-		//תʱ
+		//转换格林威治时间
 		nStartTime += nInterSec - 8 * 60 * 60;
 		nStartTime %= nInterSec;
 
-		//ΪڽĹ̶ʱЧpTimer һλصʱ
+		//为了在接下来的固定时间点立刻生效，构造pTimer 最近一次回调时间
 		if (nStartTime < nowDaySecs)
 		{
-			//ǰѾ˹̶ʼʱ
-			pTimer->nLastTick = (nowTime / nInterSec) * nInterSec + nStartTime;
+			//当前已经过了固定开始时间
+			nLastSec = (nowTime / nInterSec) * nInterSec + nStartTime;
 		}
 		else
 		{
 			//
-			pTimer->nLastTick = (nowTime / nInterSec) * nInterSec - nInterSec + nStartTime;
+			nLastSec = (nowTime / nInterSec) * nInterSec - nInterSec + nStartTime;
 		}
 	}
 	else
 	{
-		pTimer->nLastTick = (nowTime / nInterSec) * nInterSec + nStartTime - (8 * 60 * 60 - nInterSec) % nInterSec;
+		nLastSec = (nowTime / nInterSec) * nInterSec + nStartTime - (8 * 60 * 60 - nInterSec) % nInterSec;
 	}
 
-	uint32_t nTemp = (uint32_t)(pTimer->nLastTick - m_nInitSec + pTimer->nInterVal);
-	pTimer->nGridIndex = nTemp % m_TimerAxisSec.size();
-
-	pTimerList->push_back(pTimer);
-
-	m_TimerAxisSec[pTimer->nGridIndex]->push_back(pTimer);
-	pTimer->pos = --m_TimerAxisSec[pTimer->nGridIndex]->end();
-
-	return true;
+	uint64_t nExpireTick = (nLastSec + nInterSec) * 1000 + m_nTickOffset;
+	return nullptr != AddTimer(nTimerID, static_cast<uint64_t>(nInterSec) * 1000, nExpireTick, 1, handler, nCallCount);
 }
 
-
-
-void NFTimerAxis::Update()
+uint32_t NFTimerAxis::Cascade(uint32_t nLevel)
 {
-	CheckTick();
-
-	uint64_t now = GetTick();
+	uint32_t nShift = TIMER_WHEEL_ROOT_BITS + (nLevel - 1) * TIMER_WHEEL_LEVEL_BITS;
+	uint32_t nIndex = static_cast<uint32_t>(m_nCurTick >> nShift) & TIMER_WHEEL_LEVEL_MASK;
 
-	if ((now - m_nLastTick) < TIMER_AXIS_CHECK_FREQUENCE)
+	Timer* pTimer = m_levelWheel[nLevel - 1][nIndex];
+	m_levelWheel[nLevel - 1][nIndex] = nullptr;
+	while (pTimer)
 	{
-		return;
+		Timer* pNext = pTimer->pNext;
+		pTimer->ppSlot = nullptr;
+		AddToWheel(pTimer);
+		pTimer = pNext;
 	}
 
-	uint32_t start_grid = (static_cast<uint32_t>(m_nLastTick - m_nInitTick) / TIME_GRID) % m_TimerAxis.size();
-	uint32_t cur_grid = (static_cast<uint32_t>(now - m_nInitTick) / TIME_GRID) % m_TimerAxis.size();
-
-	m_nLastTick = now;
-
-	uint32_t i = start_grid;
+	return nIndex;
+}
 
-	int iCount = 0;
-	bool bFlag = true;
-	// ʱ̶
-	do
+void NFTimerAxis::ExpireRootSlot(uint64_t now)
+{
+	Timer** ppSlot = &m_rootWheel[m_nCurTick & TIMER_WHEEL_ROOT_MASK];
+	// 每次都从刻度头部取, 回调里删除同刻度的其他定时器也是安全的
+	while (*ppSlot)
 	{
-		iCount++;
-		if (iCount == 1000)
+		Timer* pTimer = *ppSlot;
+		RemoveFromWheel(pTimer);
+
+		if (pTimer->nExpireTick > m_nCurTick)
 		{
-			//ĳһ̶ȶʱ࣬ӡһ־
+			//超出时间轮范围被截断过的定时器, 还没到真正的到期时间
+			AddToWheel(pTimer);
+			continue;
 		}
-		// ǰʱ̶едʱ
-		TIMER_LIST* TimerList = m_TimerAxis[i];
-		TIMER_LIST::iterator it = TimerList->begin();
-		for (; it != TimerList->end();)
-		{
-			Timer* pTimer = *it;
-			if (nullptr == pTimer || nullptr == pTimer->pHandler)
-			{
-				it = TimerList->erase(it);
-				continue;
-			}
-			if (pTimer->nCallCount == 0)
-			{
-				it = TimerList->erase(it);
-				NF_SAFE_DELETE(pTimer);
-				continue;
-			}
-
-			// ʱ
-			if (now < pTimer->nLastTick)
-			{
-				pTimer->nLastTick = now;
-			}
-			if (static_cast<uint32_t>(now - pTimer->nLastTick) >= pTimer->nInterVal)
-			{
-				pTimer->pHandler->OnTimer(pTimer->nTimerID);
-
-				pTimer = *it;
-				if (nullptr == pTimer || nullptr == pTimer->pHandler)
-				{
-					it = TimerList->erase(it);
-					continue;
-				}
 
-				pTimer->nLastTick = pTimer->nLastTick + ((now - pTimer->nLastTick) / pTimer->nInterVal) * pTimer->nInterVal;
-				//pTimer->nLastTick = now; //᲻ϻ
-				if (pTimer->nCallCount > 0)
-				{
-					pTimer->nCallCount -= 1;
-				}
+		m_pRunningTimer = pTimer;
+		pTimer->pHandler->OnTimer(pTimer->nTimerID);
+		m_pRunningTimer = nullptr;
 
-				if (pTimer->nCallCount == 0)
-				{
-					// ôѾ
-					KillTimer(pTimer->nTimerID, pTimer->pHandler);
-					it = TimerList->erase(it);
-					continue;
-				}
-				else
-				{
-					// Ǩһδλ
-					it = TimerList->erase(it);
-					if (pTimer->nLastTick < m_nInitTick)
-					{
-						pTimer->nLastTick = m_nLastTick;
-					}
-					uint32_t nTemp = static_cast<uint32_t>((pTimer->nLastTick - m_nInitTick) + pTimer->nInterVal);
-					pTimer->nGridIndex = (nTemp / TIME_GRID) % m_TimerAxis.size();
-					m_TimerAxis[pTimer->nGridIndex]->push_back(pTimer);
-					pTimer->pos = --m_TimerAxis[pTimer->nGridIndex]->end();
-				}
-
-				continue;
-			} // end of if ((uint32_t)(now - pTimer->nLastTick) >= pTimer->nInterVal)
-
-			++it;
+		if (nullptr == pTimer->pHandler)
+		{
+			//回调中被删除
+			FreeTimer(pTimer);
+			continue;
 		}
 
-		// ݽһ̶
-		if (i == cur_grid)
+		if (pTimer->nCallCount != INFINITY_CALL)
 		{
-			bFlag = false;
+			pTimer->nCallCount -= 1;
 		}
-		else
+
+		if (pTimer->nCallCount == 0)
 		{
-			i = (i + 1) % m_TimerAxis.size();
+			// 调用次数已经够了
+			DelTimer(pTimer);
+			continue;
 		}
-	} while (bFlag);
 
-	//붨ʱ
-	UpdateSec();
+		// 搬迁到下一次触发的位置, 错过的次数直接跳过, 不累积误差
+		pTimer->nExpireTick += pTimer->nInterVal;
+		if (pTimer->nExpireTick <= now)
+		{
+			pTimer->nExpireTick += ((now - pTimer->nExpireTick) / pTimer->nInterVal + 1) * pTimer->nInterVal;
+		}
+		AddToWheel(pTimer);
+	}
 }
 
-void NFTimerAxis::UpdateSec()
+void NFTimerAxis::Update()
 {
-	uint64_t now = GetUnixSec();
+	CheckTick();
 
-	if (now - m_nLastSec < 1)
+	uint64_t now = GetWheelTick();
+
+	if ((now - m_nLastTick) < TIMER_AXIS_CHECK_FREQUENCE)
 	{
 		return;
 	}
 
-	uint32_t start_grid = static_cast<uint32_t>(m_nLastSec - m_nInitSec) % m_TimerAxisSec.size();
-	uint32_t cur_grid = static_cast<uint32_t>(now - m_nInitSec) % m_TimerAxisSec.size();
-
-	m_nLastSec = now;
-
-	uint32_t i = start_grid;
+	m_nLastTick = now;
 
-	int iCount = 0;
-	bool bFlag = true;
-	// ʱ̶
-	do
+	while (m_nCurTick <= now)
 	{
-		iCount++;
-		if (iCount == 60)
+		if ((m_nCurTick & TIMER_WHEEL_ROOT_MASK) == 0)
 		{
-		}
-		// ǰʱ̶едʱ
-		TIMER_LIST* TimerList = m_TimerAxisSec[i];
-		TIMER_LIST::iterator it = TimerList->begin();
-		for (; it != TimerList->end();)
-		{
-			Timer* pTimer = *it;
-			if (nullptr == pTimer || nullptr == pTimer->pHandler)
-			{
-				it = TimerList->erase(it);
-				continue;
-			}
-
-			if (pTimer->nCallCount == 0)
-			{
-				it = TimerList->erase(it);
-				NF_SAFE_DELETE(pTimer);
-				continue;
-			}
-
-			// ʱ
-			if (now < pTimer->nLastTick)
+			// 第0层转完一圈, 逐级下放高层刻度
+			for (uint32_t nLevel = 1; nLevel < TIMER_WHEEL_LEVEL; ++nLevel)
 			{
-				pTimer->nLastTick = now;
-			}
-			if ((now - pTimer->nLastTick) >= pTimer->nInterVal)
-			{
-				pTimer->pHandler->OnTimer(pTimer->nTimerID);
-				//Ҫ¸ֵ£ڻصа
-				pTimer = *it;
-				if (nullptr == pTimer || nullptr == pTimer->pHandler)
-				{
-					it = TimerList->erase(it);
-					continue;
-				}
-
-				pTimer->nLastTick = pTimer->nLastTick + ((now - pTimer->nLastTick) / pTimer->nInterVal) * pTimer->nInterVal;
-				//pTimer->nLastTick = now;
-				if (pTimer->nCallCount > 0)
-				{
-					pTimer->nCallCount -= 1;
-				}
-
-				if (pTimer->nCallCount == 0)
-				{
-					// ôѾ
-					KillTimer(pTimer->nTimerID, pTimer->pHandler);
-					it = TimerList->erase(it);
-
-					continue;
-				}
-				else
+				if (Cascade(nLevel) != 0)
 				{
-					// Ǩһδλ
-					it = TimerList->erase(it);
-					if (pTimer->nLastTick < m_nInitSec)
-					{
-						pTimer->nLastTick = m_nLastSec;
-					}
-					uint64_t nTemp = (pTimer->nLastTick - m_nInitSec) + pTimer->nInterVal;
-					pTimer->nGridIndex = nTemp % m_TimerAxisSec.size();
-					m_TimerAxisSec[pTimer->nGridIndex]->push_back(pTimer);
-					pTimer->pos = --m_TimerAxisSec[pTimer->nGridIndex]->end();
+					break;
 				}
-
-				continue;
 			}
-
-			++it;
 		}
 
-		// ݽһ̶
-		if (i == cur_grid)
-		{
-			bFlag = false;
-		}
-		else
+		if (m_nRootCount == 0)
 		{
-			i = (i + 1) % m_TimerAxisSec.size();
+			// 第0层为空, 直接跳到下一次下放的位置
+			uint64_t nNextTick = (m_nCurTick | TIMER_WHEEL_ROOT_MASK) + 1;
+			if (nNextTick > now)
+			{
+				m_nCurTick = now + 1;
+				break;
+			}
+			m_nCurTick = nNextTick;
+			continue;
 		}
-	} while (bFlag);
-}
 
-//öʱʱϵλ
-bool NFTimerAxis::ResetTimerPos(Timer* pTimer)
-{
-	if (nullptr == pTimer)
-	{
-		return false;
+		ExpireRootSlot(now);
+		m_nCurTick++;
 	}
-	(*pTimer->pos) = nullptr;
-
-	return true;
 }
-
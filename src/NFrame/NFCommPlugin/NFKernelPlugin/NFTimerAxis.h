@@ -7,7 +7,6 @@
 //
 // -------------------------------------------------------------------------
 #pragma once
-#include <list>
 #include <vector>
 #include "NFComm/NFCore/NFSingleton.hpp"
 #include "NFComm/NFCore/NFPlatform.h"
@@ -16,7 +15,21 @@
 
 class NFTimerObjBase;
 
+//时间轮层级, 第0层1024个1毫秒的刻度(约1秒), 往上每层64个刻度, 依次约为1分钟, 1小时, 3天, 200天
+#define TIMER_WHEEL_LEVEL 5
+#define TIMER_WHEEL_ROOT_BITS 10
+#define TIMER_WHEEL_LEVEL_BITS 6
+#define TIMER_WHEEL_ROOT_SIZE (1 << TIMER_WHEEL_ROOT_BITS)
+#define TIMER_WHEEL_LEVEL_SIZE (1 << TIMER_WHEEL_LEVEL_BITS)
+#define TIMER_WHEEL_ROOT_MASK (TIMER_WHEEL_ROOT_SIZE - 1)
+#define TIMER_WHEEL_LEVEL_MASK (TIMER_WHEEL_LEVEL_SIZE - 1)
+#define TIMER_WHEEL_MAX_DELTA ((1ULL << (TIMER_WHEEL_ROOT_BITS + (TIMER_WHEEL_LEVEL - 1) * TIMER_WHEEL_LEVEL_BITS)) - 1)
+//定时器节点池每次扩容的节点数
+#define TIMER_POOL_CHUNK_SIZE 4096
+
 //时间轴
+//多层时间轮, 定时器节点是侵入式双向链表, 同时挂在时间轮刻度和所属对象的链表上, 节点从对象池分配
+//设置/删除/触发都是O(1), 高层刻度到期时把定时器逐级下放到低层
 class NFTimerAxis
 {
 public:
@@ -34,18 +47,58 @@ public:
 	bool KillAllTimer(NFTimerObjBase* handler);
 	//更新定时器
 	void Update();
+	//下一次检查时间轮的时间(毫秒, NF_ADJUST_TIMENOW_MS的时间)
+	uint64_t GetNextUpdateTime() const
+	{
+		return m_nLastTick + TIMER_AXIS_CHECK_FREQUENCE - m_nTickOffset;
+	}
 
 	//设置固定时间的定时器
 	bool SetClocker(uint32_t nTimerID, uint64_t nStartTime, uint32_t nInterSec, NFTimerObjBase* handler, uint32_t nCallCount = INFINITY_CALL);
 	bool SetCalender(uint32_t nTimerID, const std::string& timeStr, NFTimerObjBase* handler, uint32_t nCallCount = INFINITY_CALL);
 
+protected:
+	struct Timer
+	{
+		uint32_t nTimerID; //定时器ID
+		uint32_t nCallCount; //调用次数
+		uint64_t nInterVal; //间隔, 毫秒
+		uint64_t nExpireTick; //下一次触发的tick
+		NFTimerObjBase* pHandler;//回调指针
+		uint8_t byType; //类型 0 - 毫秒定时器， 1 - 秒定时器
+		Timer** ppSlot; //所在的时间轮刻度, 为空表示不在时间轮上
+		Timer* pPrev; //时间轮刻度链表
+		Timer* pNext;
+		Timer* pHandlerPrev; //所属对象的定时器链表
+		Timer* pHandlerNext;
+	};
+
 private:
 	//设置秒定时器
 	bool SetTimerSec(uint32_t nTimerID, uint64_t nInterVal, NFTimerObjBase* handler, uint32_t nCallCount = INFINITY_CALL);
 	//检查tick
 	void CheckTick();
-	//更新秒定时器
-	void UpdateSec();
+	//查找对象的定时器
+	static Timer* FindTimer(uint32_t nTimerID, NFTimerObjBase* handler);
+	//创建定时器并挂到对象和时间轮上
+	Timer* AddTimer(uint32_t nTimerID, uint64_t nInterVal, uint64_t nExpireTick, uint8_t byType, NFTimerObjBase* handler, uint32_t nCallCount);
+	//删除定时器
+	void DelTimer(Timer* pTimer);
+	//挂到时间轮对应的刻度上
+	void AddToWheel(Timer* pTimer);
+	//从时间轮上摘下
+	void RemoveFromWheel(Timer* pTimer);
+	//挂到对象的定时器链表上
+	static void AddToHandler(Timer* pTimer);
+	//从对象的定时器链表上摘下
+	static void RemoveFromHandler(Timer* pTimer);
+	//把高层的一个刻度下放到低层, 返回该层的刻度下标
+	uint32_t Cascade(uint32_t nLevel);
+	//触发第0层当前刻度的所有定时器
+	void ExpireRootSlot(uint64_t now);
+	//节点池
+	Timer* AllocTimer();
+	void FreeTimer(Timer* pTimer);
 
 protected:
 	static uint64_t GetTick()
@@ -58,41 +111,21 @@ protected:
 		return NF_ADJUST_TIMENOW();
 	}
 
-	struct Timer
+	//内部单调时钟, 系统时间回拨时通过偏移量保证不倒退
+	uint64_t GetWheelTick() const
 	{
-		uint32_t nTimerID; //定时器ID
-		uint64_t nInterVal; //间隔
-		uint32_t nCallCount; //调用次数
-		uint64_t nLastTick; //最后一次tick
-		NFTimerObjBase* pHandler;//回调指针
-		uint8_t byType; //类型 0 - 毫秒定时器， 1 - 秒定时器
-		uint32_t nGridIndex; //所在的时间刻度
-		std::list<Timer*>::iterator pos; //在时间轴中的位置，便于快速定位
-		Timer()
-		{
-			nTimerID = 0;
-			nInterVal = 0;
-			nCallCount = 0;
-			nLastTick = 0;
-			pHandler = nullptr;
-			byType = 0;
-			nGridIndex = 0;
-		}
-	};
-
-	//重置定时器在时间轴上的位置
-	static bool ResetTimerPos(Timer* pTimer);
-
-	typedef std::list<Timer*> TIMER_LIST; //某个刻度中定时器列表
-	typedef std::vector<TIMER_LIST*> TIMER_AXIS; //所有事件轴的定时器
+		return GetTick() + m_nTickOffset;
+	}
 
-	TIMER_AXIS m_TimerAxis; //毫秒事件轴
-	uint64_t m_nInitTick; //毫秒时间轴初始Tick
-	uint64_t m_nLastTick; //毫秒时间轴最后一次检查的tick
+	Timer* m_rootWheel[TIMER_WHEEL_ROOT_SIZE]; //第0层, 毫秒刻度
+	Timer* m_levelWheel[TIMER_WHEEL_LEVEL - 1][TIMER_WHEEL_LEVEL_SIZE]; //第1层开始的高层刻度
+	uint32_t m_nRootCount; //第0层的定时器数量, 为0时可以直接跳到下一次下放
+	uint64_t m_nCurTick; //下一个待处理的tick
+	uint64_t m_nLastTick; //最后一次Update的时间
+	uint64_t m_nTickOffset; //时间回拨的累计偏移
+	Timer* m_pRunningTimer; //正在回调的定时器, 回调中被删除时延后释放
 
-	TIMER_AXIS m_TimerAxisSec; //秒时间轴
-	uint64_t m_nInitSec; //秒时间轴初始时间
-	uint64_t m_nLastSec; //秒时间轴最后一次检查的时间
+	std::vector<Timer*> m_vecChunk; //节点池的内存块
+	Timer* m_pFreeList; //空闲节点
+	uint32_t m_nTimerCount; //正在使用的节点数
 };
-
-
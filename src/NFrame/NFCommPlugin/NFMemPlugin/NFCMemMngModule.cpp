@@ -75,6 +75,7 @@ bool NFCMemMngModule::Execute()
     if (pTimerMng)
     {
         pTimerMng->OnTick(NF_ADJUST_TIMENOW_MS());
+        m_pObjPluginManager->SetNextWakeupTime(pTimerMng->GetNextTickTime());
     }
     auto pTransManager = dynamic_cast<NFMemTransMng*>(GetHeadObj(EOT_TRANS_MNG));
     if (pTransManager)
@@ -285,6 +286,12 @@ void NFCMemMngModule::UnRegisterClassToObjSeg(int bType)
     pCounter->clear();
 }
 
+int NFCMemMngModule::AddResumeDependency(int iType, int iDependType)
+{
+    // 普通内存模式下对象不会从上次的内存里恢复, 没有恢复顺序的问题
+    return 0;
+}
+
 void NFMemObjSegSwapCounter::SetObjSeg(NFMemObjSeg* pObjSeg)
 {
     m_pObjSeg = pObjSeg;
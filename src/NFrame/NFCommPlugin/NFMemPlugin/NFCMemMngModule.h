@@ -464,6 +464,8 @@ public:
 
     void UnRegisterClassToObjSeg(int bType) override;
 
+    int AddResumeDependency(int iType, int iDependType) override;
+
     size_t GetAllObjSize() const;
 
     int InitializeAllObj();
@@ -101,6 +101,9 @@ public:
 
     void OnTick(int64_t tick);
 
+    // 下一个槽到期的时间(毫秒), 主循环空闲等待不能超过它
+    int64_t GetNextTickTime() const { return m_beforeTick + SLOT_TICK_TIME; }
+
     // 删除此定时器
     int Delete(int objectId);
 
@@ -14,6 +14,8 @@ typedef uint64_t NFDataAlignType;
 #define NFBUS_MACRO_SRC_BUS_LIMIT 512     //bus连接方最大数目
 #define NFBUS_MACRO_HUGETLB_SIZE 4194304
 #define NFBUS_MACRO_MSG_LIMIT 65536
+#define NFBUS_MACRO_BATCH_LIMIT 64       //批量发送单次最多合并的消息数
+#define NFBUS_MACRO_BATCH_SIZE 262144    //合并发送时缓存的最大字节数, 超过后立即发出
 #define NFBUS_MACRO_CONNECTION_CONFIRM_TIMEOUT 30
 #define NFBUS_MACRO_BUSID_TYPE uint64_t
 #define NFBUS_MACRO_DATA_NODE_SIZE 128
@@ -21,4 +23,4 @@ typedef uint64_t NFDataAlignType;
 #define NFBUS_MACRO_DATA_ALIGN_TYPE uint64_t
 #define NFBUS_MACRO_DATA_MAX_PROTECT_SIZE 16384
 #define SHM_CHANNEL_NAME "NFBUSMEM"
-#define SHM_CHANNEL_VERSION 2
+#define SHM_CHANNEL_VERSION 3
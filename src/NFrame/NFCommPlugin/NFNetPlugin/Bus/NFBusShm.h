@@ -181,6 +181,12 @@ typedef struct {
 } NFShmBlockHead;
 
 
+// 批量发送的消息描述
+typedef struct {
+	const void* m_pData;
+	size_t m_nLen;
+} NFShmIoVec;
+
 typedef enum {
 	NF_WRITEN = 0x00000001,
 	MF_START_NODE = 0x00000002,
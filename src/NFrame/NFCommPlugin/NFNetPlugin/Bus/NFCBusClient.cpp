@@ -144,6 +144,29 @@ uint64_t NFCBusClient::ConnectServer(const NFMessageFlag& flag, const NFMessageF
 
 bool NFCBusClient::Send(NFShmChannel* pChannel, int packetParseType, const NFDataPackage& packet, const char* msg, uint32_t nLen)
 {
+    // 合并发送只用于数据通道, 连接通道上的连接/心跳消息照常立即发出
+    // 合并期间返回true只表示消息已经缓存, 发送失败由FlushSendBatch返回
+    if (m_bSendBatch && pChannel == GetShmChannel())
+    {
+        if (m_pBatchChannel != pChannel || m_batchVec.size() >= NFBUS_MACRO_BATCH_LIMIT || m_batchBuffer.ReadableSize() >= NFBUS_MACRO_BATCH_SIZE)
+        {
+            if (!SendBatch())
+            {
+                m_bBatchFailed = true;
+            }
+        }
+
+        size_t offset = m_batchBuffer.ReadableSize();
+        NFPacketParseMgr::EnCode(packetParseType, packet, msg, nLen, m_batchBuffer, m_bindFlag.mLinkId);
+
+        NFShmIoVec vec;
+        vec.m_pData = reinterpret_cast<const void*>(offset);
+        vec.m_nLen = m_batchBuffer.ReadableSize() - offset;
+        m_batchVec.push_back(vec);
+        m_pBatchChannel = pChannel;
+        return true;
+    }
+
     m_buffer.Clear();
     NFPacketParseMgr::EnCode(packetParseType, packet, msg, nLen, m_buffer, m_bindFlag.mLinkId);
 
@@ -159,6 +182,47 @@ bool NFCBusClient::Send(NFShmChannel* pChannel, int packetParseType, const NFDat
     return false;
 }
 
+void NFCBusClient::BeginSendBatch()
+{
+    m_bSendBatch = true;
+}
+
+bool NFCBusClient::FlushSendBatch()
+{
+    bool bSuccess = SendBatch() && !m_bBatchFailed;
+    m_bSendBatch = false;
+    m_bBatchFailed = false;
+    return bSuccess;
+}
+
+bool NFCBusClient::SendBatch()
+{
+    if (m_batchVec.empty())
+    {
+        return true;
+    }
+
+    // 缓存期间m_batchBuffer可能扩容, 发送前才把偏移换成地址
+    for (size_t i = 0; i < m_batchVec.size(); i++)
+    {
+        m_batchVec[i].m_pData = m_batchBuffer.ReadAddr() + reinterpret_cast<size_t>(m_batchVec[i].m_pData);
+    }
+
+    size_t sendCount = 0;
+    int iRet = ShmSendBatch(m_pBatchChannel, m_batchVec.data(), m_batchVec.size(), &sendCount);
+    bool bSuccess = iRet == 0 && sendCount == m_batchVec.size();
+    if (!bSuccess)
+    {
+        // 和单条发送一样, 通道满了发不出去的消息直接丢弃
+        NFLogError(NF_LOG_DEFAULT, 0, "ShmSendBatch from:{} to:{} error:{}, send:{}/{}", NFServerIDUtil::GetBusNameFromBusID(m_bindFlag.mBusId), NFServerIDUtil::GetBusNameFromBusID(m_flag.mBusId), iRet, sendCount, m_batchVec.size());
+    }
+
+    m_batchVec.clear();
+    m_batchBuffer.Clear();
+    m_pBatchChannel = nullptr;
+    return bSuccess;
+}
+
 bool NFCBusClient::Send(NFDataPackage& packet, const char* msg, uint32_t nLen)
 {
     NFShmRecordType * pShmRecord = GetShmRecord();
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <map>
+#include <vector>
 #include "NFBusShm.h"
 #include "NFIBusConnection.h"
 #include "../NFINetMessage.h"
@@ -26,6 +27,9 @@ public:
         m_bindFlag = bindFlag;
         m_sendBuffer.AssureSpace(MAX_SEND_BUFFER_SIZE);
         m_isConnected = false;
+        m_bSendBatch = false;
+        m_pBatchChannel = nullptr;
+        m_bBatchFailed = false;
     }
 
     ~NFCBusClient() override;
@@ -62,7 +66,25 @@ public:
     bool Send(NFDataPackage& packet, const google::protobuf::Message& xData) override;
 
     bool Send(NFShmChannel* pChannel, int packetParseType, const NFDataPackage& packet, const char* msg, uint32_t nLen);
+
+    void BeginSendBatch() override;
+
+    bool FlushSendBatch() override;
+private:
+    /**
+     * @brief 把缓存的消息用ShmSendBatch发出
+     * @return 有消息没有发出去返回false
+     */
+    bool SendBatch();
 private:
     NFBuffer m_sendBuffer;
     bool m_isConnected;
+    /**
+     * @brief 合并发送时编码好的消息, m_batchVec里的m_pData存的是在m_batchBuffer里的偏移
+     */
+    bool m_bSendBatch;
+    NFShmChannel* m_pBatchChannel;
+    bool m_bBatchFailed; //合并期间是否有消息没有发出去
+    NFBuffer m_batchBuffer;
+    std::vector<NFShmIoVec> m_batchVec;
 };
@@ -38,7 +38,26 @@ bool NFCBusMessage::Execute()
 {
     if (m_bindConnect)
     {
+        // 处理收到的消息时发往各个bus的回包先缓存, 处理完后每个bus一次ShmSendBatch发出
+        auto pConn = m_busConnectMap.First();
+        while (pConn)
+        {
+            pConn->BeginSendBatch();
+            pConn = m_busConnectMap.Next();
+        }
+
         m_bindConnect->Execute();
+
+        // 合并期间Send总是返回true, 发不出去的消息在这里才知道, 详细原因已经在SendBatch里记录
+        pConn = m_busConnectMap.First();
+        while (pConn)
+        {
+            if (!pConn->FlushSendBatch())
+            {
+                NFLogError(NF_LOG_DEFAULT, 0, "bus flush send batch failed, some messages dropped, linkId:{}", pConn->GetLinkId());
+            }
+            pConn = m_busConnectMap.Next();
+        }
     }
     return true;
 }
@@ -21,6 +21,7 @@ NFCBusServer::NFCBusServer(NFIPluginManager* p, NF_SERVER_TYPE serverType, const
 {
     m_handleMsgNumPerFrame = NF_NO_FIX_FAME_HANDLE_MAX_MSG_COUNT;
     m_isFinishConnect = false;
+    m_peekBuffer.AssureSpace(MAX_SEND_BUFFER_SIZE);
     auto pServerConfig = FindModule<NFIConfigModule>()->GetAppConfig(m_serverType);
     if (pServerConfig)
     {
@@ -139,138 +140,124 @@ void NFCBusServer::ProcessMsgLogicThread()
         NFShmChannel* pConnectChannel = &head->m_nConnectChannel;
         NFShmChannel* pChannel = &head->m_nShmChannel;
         size_t leftTimes = maxTimes;
-        m_connectBuffer.Clear();
         while (true)
         {
+            // 无回绕的数据块原地读取, 处理完再提交读游标
+            const void* data = nullptr;
             size_t recvLen = 0;
-            int iRecvRet = ShmRecv(pConnectChannel, m_connectBuffer.WriteAddr(), m_connectBuffer.WritableSize(), &recvLen);
+            m_peekBuffer.Clear();
+            int iRecvRet = ShmPeek(pConnectChannel, m_peekBuffer.WriteAddr(), m_peekBuffer.WritableSize(), &data, &recvLen);
 
             if (iRecvRet == NFrame::ERR_CODE_NFBUS_ERR_NO_DATA)
             {
                 break;
             }
 
-            m_connectBuffer.Produce(recvLen);
-
             // 回调收到数据事件
             if (iRecvRet < 0)
             {
                 NFLogError(NF_LOG_DEFAULT, 0, "Shm Recv Error:{}", GetErrorStr(iRecvRet));
                 break;
             }
-            else
-            {
-                while (true)
-                {
-                    char* outData = nullptr;
-                    uint32_t outLen = 0;
-                    uint32_t allLen = 0;
-                    NFDataPackage dataPacket;
-                    int iRetCode = NFPacketParseMgr::DeCode(pShmRecord->m_packetParseType, m_connectBuffer.ReadAddr(), m_connectBuffer.ReadableSize(), outData, outLen, allLen, dataPacket);
-                    if (iRetCode < 0)
-                    {
-                        NFLogError(NF_LOG_DEFAULT, 0, "nfbus parse data failed!");
-                        m_connectBuffer.Clear();
-                        break;
-                    }
-                    else if (iRetCode > 0)
-                    {
-                        break;
-                    }
-                    else
-                    {
-                        m_connectBuffer.Consume(allLen);
-
-                        dataPacket.nBuffer = outData;
-                        dataPacket.nMsgLen = outLen;
-
-
-                        if (dataPacket.mModuleId == NF_MODULE_FRAME && dataPacket.nMsgId == NFrame::NF_SERVER_TO_SERVER_BUS_CONNECT_REQ)
-                        {
-                            m_busMsgPeerCb(eMsgType_CONNECTED, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
-                        }
-                        else if (dataPacket.mModuleId == NF_MODULE_FRAME && dataPacket.nMsgId == NFrame::NF_SERVER_TO_SERVER_BUS_CONNECT_RSP)
-                        {
-                            m_busMsgPeerCb(eMsgType_CONNECTED, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
-                        }
-                        else
-                        {
-                            m_busMsgPeerCb(eMsgType_RECIVEDATA, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
-                        }
-                    }
-                }
-            }
+
+            ProcessRecvData(m_connectBuffer, static_cast<const char*>(data), recvLen);
+            ShmCommit(pConnectChannel);
         }
 
-        m_buffer.Clear();
         if (!m_isFinishConnect)
         {
             m_isFinishConnect = m_pObjPluginManager->IsFinishAppTask(m_serverType, APP_INIT_TASK_GROUP_SERVER_CONNECT);
         }
-        while (leftTimes-- > 0 && m_isFinishConnect)
+        if (m_isFinishConnect && leftTimes > 0)
         {
-            size_t recvLen = 0;
-            int iRecvRet = ShmRecv(pChannel, m_buffer.WriteAddr(), m_buffer.WritableSize(), &recvLen);
-
-            if (iRecvRet == NFrame::ERR_CODE_NFBUS_ERR_NO_DATA)
+            // 批量收取, 无回绕的数据块原地回调, 整批处理完才提交一次读游标
+            size_t recvCount = 0;
+            int iRecvRet = ShmRecvBatch(pChannel, m_peekBuffer, [this](const char* data, size_t len)
             {
-                break;
-            }
-
-            m_buffer.Produce(recvLen);
+                ProcessRecvData(m_buffer, data, len);
+            }, leftTimes, &recvCount);
 
             // 回调收到数据事件
-            if (iRecvRet < 0)
-            {
-                NFLogError(NF_LOG_DEFAULT, 0, "Shm Recv Error:{}", GetErrorStr(iRecvRet))
-                break;
-            }
-            else
+            if (iRecvRet < 0 && iRecvRet != NFrame::ERR_CODE_NFBUS_ERR_NO_DATA)
             {
-                while (true)
-                {
-                    char* outData = nullptr;
-                    uint32_t outLen = 0;
-                    uint32_t allLen = 0;
-                    NFDataPackage dataPacket;
-                    int iDecodeRet = NFPacketParseMgr::DeCode(pShmRecord->m_packetParseType, m_buffer.ReadAddr(), m_buffer.ReadableSize(), outData, outLen, allLen, dataPacket);
-                    if (iDecodeRet < 0)
-                    {
-                        NFLogError(NF_LOG_DEFAULT, 0, "nfbus parse data failed!");
-                        m_buffer.Clear();
-                        break;
-                    }
-                    else if (iDecodeRet > 0)
-                    {
-                        break;
-                    }
-                    else
-                    {
-                        m_buffer.Consume(allLen);
-
-                        dataPacket.nBuffer = outData;
-                        dataPacket.nMsgLen = outLen;
-
-
-                        if (dataPacket.mModuleId == NF_MODULE_FRAME && dataPacket.nMsgId == NFrame::NF_SERVER_TO_SERVER_BUS_CONNECT_REQ)
-                        {
-                            m_busMsgPeerCb(eMsgType_CONNECTED, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
-                        }
-                        else if (dataPacket.mModuleId == NF_MODULE_FRAME && dataPacket.nMsgId == NFrame::NF_SERVER_TO_SERVER_BUS_CONNECT_RSP)
-                        {
-                            m_busMsgPeerCb(eMsgType_CONNECTED, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
-                        }
-                        else
-                        {
-                            m_busMsgPeerCb(eMsgType_RECIVEDATA, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
-                        }
-                    }
-                }
+                NFLogError(NF_LOG_DEFAULT, 0, "Shm Recv Error:{}", GetErrorStr(iRecvRet));
             }
         }
     }
 }
 
+void NFCBusServer::ProcessRecvData(NFBuffer& halfBuffer, const char* data, size_t len)
+{
+    // 没有半包时直接在通道内存上解包, 只把末尾的半包拷出来
+    if (halfBuffer.IsEmpty())
+    {
+        size_t consumed = 0;
+        if (ProcessRecvPacket(data, len, consumed) < 0)
+        {
+            return;
+        }
+
+        if (consumed < len)
+        {
+            halfBuffer.PushData(data + consumed, len - consumed);
+        }
+        return;
+    }
+
+    // 有上次留下的半包, 拼起来再解
+    halfBuffer.PushData(data, len);
+    size_t consumed = 0;
+    if (ProcessRecvPacket(halfBuffer.ReadAddr(), halfBuffer.ReadableSize(), consumed) < 0)
+    {
+        halfBuffer.Clear();
+        return;
+    }
+    halfBuffer.Consume(consumed);
+}
+
+int NFCBusServer::ProcessRecvPacket(const char* data, size_t len, size_t& consumed)
+{
+    NFShmRecordType* pShmRecord = GetShmRecord();
+    consumed = 0;
+    while (consumed < len)
+    {
+        char* outData = nullptr;
+        uint32_t outLen = 0;
+        uint32_t allLen = 0;
+        NFDataPackage dataPacket;
+        int iDecodeRet = NFPacketParseMgr::DeCode(pShmRecord->m_packetParseType, data + consumed, len - consumed, outData, outLen, allLen, dataPacket);
+        if (iDecodeRet < 0)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "nfbus parse data failed!");
+            return -1;
+        }
+        else if (iDecodeRet > 0)
+        {
+            break;
+        }
+
+        consumed += allLen;
+
+        dataPacket.nBuffer = outData;
+        dataPacket.nMsgLen = outLen;
+
+
+        if (dataPacket.mModuleId == NF_MODULE_FRAME && dataPacket.nMsgId == NFrame::NF_SERVER_TO_SERVER_BUS_CONNECT_REQ)
+        {
+            m_busMsgPeerCb(eMsgType_CONNECTED, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
+        }
+        else if (dataPacket.mModuleId == NF_MODULE_FRAME && dataPacket.nMsgId == NFrame::NF_SERVER_TO_SERVER_BUS_CONNECT_RSP)
+        {
+            m_busMsgPeerCb(eMsgType_CONNECTED, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
+        }
+        else
+        {
+            m_busMsgPeerCb(eMsgType_RECIVEDATA, dataPacket.nSendBusLinkId, dataPacket.nSendBusLinkId, dataPacket);
+        }
+    }
+    return 0;
+}
+
 bool NFCBusServer::Send(NFDataPackage& packet, const char* msg, uint32_t nLen)
 {
     NFLogError(NF_LOG_DEFAULT, 0, "Bus Server Can't Send Data............., packet:{}", packet.ToString());
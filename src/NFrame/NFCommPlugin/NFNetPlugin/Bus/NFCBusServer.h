@@ -43,10 +43,27 @@ public:
 
     bool Send(NFDataPackage& packet, const char* msg, uint32_t nLen) override;
     bool Send(NFDataPackage& packet, const google::protobuf::Message& xData) override;
+private:
+    /**
+     * @brief 处理从通道读出的一段数据, 解不完整的半包留在halfBuffer里等下一段数据
+     * @param halfBuffer 该通道的半包缓存
+     */
+    void ProcessRecvData(NFBuffer& halfBuffer, const char* data, size_t len);
+
+    /**
+     * @brief 解出data里所有完整的包并回调
+     * @param consumed 完整包占用的字节数
+     * @return 0成功, 解包出错返回-1
+     */
+    int ProcessRecvPacket(const char* data, size_t len, size_t& consumed);
 private:
     /**
      * @brief 服务器每一帧处理的消息数
      */
     uint32_t m_handleMsgNumPerFrame;
     bool m_isFinishConnect;
+    /**
+     * @brief 数据块在通道末尾回绕时的拷贝缓冲区, m_buffer/m_connectBuffer只用来存半包
+     */
+    NFBuffer m_peekBuffer;
 };
@@ -13,6 +13,7 @@
 #include <string.h>
 #include "NFBusHash.h"
 #include "NFComm/NFCore/NFPlatform.h"
+#include "NFComm/NFCore/NFHugePage.h"
 #include "NFComm/NFCore/NFServerIDUtil.h"
 #include "NFComm/NFCore/NFStringUtility.h"
 #include "NFComm/NFPluginModule/NFCheck.h"
@@ -601,18 +602,22 @@ int NFIBusConnection::OpenShmBuffer(key_t shmKey, size_t len, void** data, size_
     // linux下阻止从交换分区分配物理页
     shmflag |= SHM_NORESERVE;
 
-    // 临时关闭大页表功能，等后续增加了以下判定之后再看情况加回来
-    // 使用大页表要先判定 /proc/meminfo 内的一些字段内容，再配置大页表
-    // -- Hugepagesize: 大页表的分页大小，如果ATBUS_MACRO_HUGETLB_SIZE小于这个值，要对齐到这个值
-    // -- HugePages_Total: 大页表总大小
+    // 开启大页时先判定 /proc/meminfo 内的字段，再决定是否使用大页表
+    // -- Hugepagesize: 大页表的分页大小，如果NFBUS_MACRO_HUGETLB_SIZE小于这个值，要对齐到这个值
     // -- HugePages_Free: 大页表可用大小，如果可用值小于需要分配的空间，也不能用大页表
-    //#ifdef ATBUS_MACRO_HUGETLB_SIZE
-    //            // 如果大于4倍的大页表，则对齐到大页表并使用大页表
-    //            if (len > (4 * ATBUS_MACRO_HUGETLB_SIZE)) {
-    //                len = (len + (ATBUS_MACRO_HUGETLB_SIZE)-1) & (~((ATBUS_MACRO_HUGETLB_SIZE)-1));
-    //                shmflag |= SHM_HUGETLB;
-    //            }
-    //#endif
+    // 大于4倍的NFBUS_MACRO_HUGETLB_SIZE才对齐到大页表并使用大页表
+    size_t normal_len = len;
+    if (m_pObjPluginManager->IsShmHugePage())
+    {
+        size_t huge_page_size = NFHugePage::GetHugePageSize();
+        size_t huge_align = huge_page_size > NFBUS_MACRO_HUGETLB_SIZE ? huge_page_size : NFBUS_MACRO_HUGETLB_SIZE;
+        size_t huge_len = NFHugePage::AlignSize(len, huge_align);
+        if (huge_page_size > 0 && len > (4 * NFBUS_MACRO_HUGETLB_SIZE) && NFHugePage::GetFreeHugePageMem() >= huge_len)
+        {
+            len = huge_len;
+            shmflag |= SHM_HUGETLB;
+        }
+    }
 
 #endif
     if (false)
@@ -675,6 +680,16 @@ int NFIBusConnection::OpenShmBuffer(key_t shmKey, size_t len, void** data, size_
     {
         shm_record.m_nShmFd = 0;
         shm_record.m_nShmId = shmget(shmKey, len, shmflag);
+#ifdef __linux__
+        if (-1 == shm_record.m_nShmId && (shmflag & SHM_HUGETLB))
+        {
+            // 大页表分配失败，或者对端是用普通页创建的，退回普通页
+            NFLogWarning(NF_LOG_DEFAULT, 0, "bus shm key:{} with SHM_HUGETLB failed for error:{}, use normal page", shmKey, errno);
+            shmflag &= ~SHM_HUGETLB;
+            len = normal_len;
+            shm_record.m_nShmId = shmget(shmKey, len, shmflag);
+        }
+#endif
         if (-1 == shm_record.m_nShmId) return NFrame::ERR_CODE_NFBUS_ERR_SHM_GET_FAILED;
 
         // 获取实际长度
@@ -685,6 +700,43 @@ int NFIBusConnection::OpenShmBuffer(key_t shmKey, size_t len, void** data, size_
 
         // 获取地址
         shm_record.m_nBuffer = shmat(shm_record.m_nShmId, NULL, 0);
+
+#ifdef __linux__
+        if (shm_record.m_nBuffer != (void *) -1)
+        {
+            // 对端可能已经用另一种页创建过, 按实际映射的页大小判断
+            if (m_pObjPluginManager->IsShmHugePage() && !NFHugePage::IsHugeTlbMapping(shm_record.m_nBuffer))
+            {
+                if (NFHugePage::AdviseHugePage(shm_record.m_nBuffer, shm_record.m_nSize) != 0)
+                {
+                    NFLogWarning(NF_LOG_DEFAULT, 0, "bus shm key:{} madvise MADV_HUGEPAGE failed for error:{}, {}, use normal page", shmKey, errno, strerror(errno));
+                }
+            }
+
+            int iNumaNode = m_pObjPluginManager->GetShmNumaNode();
+            if (iNumaNode >= 0)
+            {
+                int iNodeCount = NFHugePage::GetNumaNodeCount();
+                if (iNumaNode >= iNodeCount)
+                {
+                    NFLogWarning(NF_LOG_DEFAULT, 0, "bus shm key:{} numa node:{} not exist, node count:{}, not bind", shmKey, iNumaNode, iNodeCount);
+                }
+                else if (NFHugePage::BindNumaNode(shm_record.m_nBuffer, shm_record.m_nSize, iNumaNode) != 0)
+                {
+                    NFLogWarning(NF_LOG_DEFAULT, 0, "bus shm key:{} bind numa node:{} failed for error:{}, {}", shmKey, iNumaNode, errno, strerror(errno));
+                }
+                else
+                {
+                    NFLogInfo(NF_LOG_DEFAULT, 0, "bus shm key:{} bind numa node:{}", shmKey, iNumaNode);
+                }
+            }
+
+            if (m_pObjPluginManager->IsShmPrefault())
+            {
+                NFHugePage::Prefault(shm_record.m_nBuffer, shm_record.m_nSize);
+            }
+        }
+#endif
     }
 
     shm_record.m_nReferenceCount = 1;
@@ -739,16 +791,139 @@ int NFIBusConnection::ShmRecv(NFShmChannel* channel, void* buf, size_t len, size
 {
     if (nullptr == channel) return NFrame::ERR_CODE_NFBUS_ERR_PARAMS;
 
+    const size_t ori_read_cur = channel->m_nAtomicReadCur.load();
+    size_t write_cur = channel->m_nAtomicWriteCur.load();
+    // std::atomic_thread_fence(std::memory_order_seq_cst);
+    size_t read_end_cur = ori_read_cur;
+
+    int ret = ShmRecvBlock(channel, ori_read_cur, write_cur, buf, len, recvSize, &read_end_cur, nullptr);
+
+    // 设置游标
+    if (ori_read_cur != read_end_cur)
+    {
+        channel->m_nAtomicReadCur.store(read_end_cur);
+        // 不再访问数据区和head区了，所以不再需要memory barrier了
+    }
+
+    // 用于调试的节点编号信息
+    m_nLastActionChannelBeginNodeIndex = ori_read_cur;
+    m_nLastActionChannelEndNodeIndex = read_end_cur;
+    m_nLastActionChannelPtr = channel;
+    return ret;
+}
+
+int NFIBusConnection::ShmPeek(NFShmChannel* channel, void* buf, size_t len, const void** data, size_t* dataSize)
+{
+    if (nullptr == channel || nullptr == data) return NFrame::ERR_CODE_NFBUS_ERR_PARAMS;
+
+    // 上一次Peek还没有提交
+    if (m_pPeekChannel) return NFrame::ERR_CODE_NFBUS_ERR_PARAMS;
+
+    const size_t ori_read_cur = channel->m_nAtomicReadCur.load();
+    size_t write_cur = channel->m_nAtomicWriteCur.load();
+    size_t read_end_cur = ori_read_cur;
+
+    int ret = ShmRecvBlock(channel, ori_read_cur, write_cur, buf, len, dataSize, &read_end_cur, data);
+
+    if (ret == NFrame::ERR_CODE_SVR_OK)
+    {
+        // 数据还在通道里, 等ShmCommit再移动读游标
+        m_pPeekChannel = channel;
+        m_nPeekReadEndCur = read_end_cur;
+    }
+    else if (ori_read_cur != read_end_cur)
+    {
+        // 出错时跳过的坏节点直接提交
+        channel->m_nAtomicReadCur.store(read_end_cur);
+    }
+
+    // 用于调试的节点编号信息
+    m_nLastActionChannelBeginNodeIndex = ori_read_cur;
+    m_nLastActionChannelEndNodeIndex = read_end_cur;
+    m_nLastActionChannelPtr = channel;
+    return ret;
+}
+
+int NFIBusConnection::ShmCommit(NFShmChannel* channel)
+{
+    if (nullptr == channel || m_pPeekChannel != channel) return NFrame::ERR_CODE_NFBUS_ERR_PARAMS;
+
+    // 设置屏障，保证处理函数对数据区的读取在游标移动之前完成
+    std::atomic_thread_fence(std::memory_order_release);
+    channel->m_nAtomicReadCur.store(m_nPeekReadEndCur);
+
+    m_pPeekChannel = nullptr;
+    m_nPeekReadEndCur = 0;
+    return NFrame::ERR_CODE_SVR_OK;
+}
+
+int NFIBusConnection::ShmRecvBatch(NFShmChannel* channel, NFBuffer& buffer, const ShmRecvBatchCallback& cb, size_t maxCount, size_t* recvCount)
+{
+    if (nullptr == channel) return NFrame::ERR_CODE_NFBUS_ERR_PARAMS;
+
+    if (recvCount) *recvCount = 0;
+
+    // 整批只读取一次写游标，读游标也只在最后提交一次
+    const size_t ori_read_cur = channel->m_nAtomicReadCur.load();
+    size_t write_cur = channel->m_nAtomicWriteCur.load();
+    size_t read_cur = ori_read_cur;
+
+    int ret = NFrame::ERR_CODE_SVR_OK;
+    size_t count = 0;
+    while (count < maxCount)
+    {
+        size_t recvSize = 0;
+        size_t read_end_cur = read_cur;
+        const void* data = nullptr;
+        // 无回绕的数据块直接原地回调, 只有回绕的数据块才拷贝到buffer
+        buffer.Clear();
+        ret = ShmRecvBlock(channel, read_cur, write_cur, buffer.WriteAddr(), buffer.WritableSize(), &recvSize, &read_end_cur, &data);
+        read_cur = read_end_cur;
+
+        if (ret != NFrame::ERR_CODE_SVR_OK)
+        {
+            break;
+        }
+
+        ++count;
+
+        if (cb)
+        {
+            cb(static_cast<const char*>(data), recvSize);
+        }
+    }
+
+    // 读满maxCount条也视为正常结束
+    if (ret == NFrame::ERR_CODE_NFBUS_ERR_NO_DATA && count > 0)
+    {
+        ret = NFrame::ERR_CODE_SVR_OK;
+    }
+
+    // 设置游标
+    if (ori_read_cur != read_cur)
+    {
+        channel->m_nAtomicReadCur.store(read_cur);
+    }
+
+    if (recvCount) *recvCount = count;
+
+    // 用于调试的节点编号信息
+    m_nLastActionChannelBeginNodeIndex = ori_read_cur;
+    m_nLastActionChannelEndNodeIndex = read_cur;
+    m_nLastActionChannelPtr = channel;
+    return ret;
+}
+
+int NFIBusConnection::ShmRecvBlock(NFShmChannel* channel, size_t readCur, size_t writeCur, void* buf, size_t len, size_t* recvSize, size_t* readEndCur, const void** peekData)
+{
     int ret = NFrame::ERR_CODE_SVR_OK;
 
     void *buffer_start = nullptr;
     size_t buffer_len = 0;
     NFShmBlockHead *block_head = nullptr;
-    size_t read_begin_cur = channel->m_nAtomicReadCur.load();
-    const size_t ori_read_cur = read_begin_cur;
+    size_t read_begin_cur = readCur;
     size_t read_end_cur;
-    size_t write_cur = channel->m_nAtomicWriteCur.load();
-    // std::atomic_thread_fence(std::memory_order_seq_cst);
+    size_t write_cur = writeCur;
 
     uint32_t timeout_operation_seq = 0;
 
@@ -862,8 +1037,8 @@ int NFIBusConnection::ShmRecv(NFShmChannel* channel, void* buf, size_t len, size
             continue;
         }
 
-        // 写出的缓冲区不足
-        if (block_head->m_nBufferSize > len)
+        // 写出的缓冲区不足, 原地读取的无回绕数据块不需要缓冲区
+        if (block_head->m_nBufferSize > len && !(peekData && block_head->m_nBufferSize <= buffer_len))
         {
             ret = ret ? ret : NFrame::ERR_CODE_NFBUS_ERR_BUFF_LIMIT;
             if (recvSize) *recvSize = block_head->m_nBufferSize;
@@ -926,11 +1101,18 @@ int NFIBusConnection::ShmRecv(NFShmChannel* channel, void* buf, size_t len, size
         channel->m_nFirstFailedWritingTime = 0;
 
         // 接收数据 - 无回绕
-
+        const void* data = buf;
         if (block_head->m_nBufferSize <= buffer_len)
         {
-            memcpy(buf, buffer_start, block_head->m_nBufferSize);
-
+            // 原地读取, 数据在提交读游标之前一直有效
+            if (peekData)
+            {
+                data = buffer_start;
+            }
+            else
+            {
+                memcpy(buf, buffer_start, block_head->m_nBufferSize);
+            }
         } else
         { // 接收数据 - 有回绕
             memcpy(buf, buffer_start, buffer_len);
@@ -939,7 +1121,9 @@ int NFIBusConnection::ShmRecv(NFShmChannel* channel, void* buf, size_t len, size
             GetNodeHead(channel, 0, &buffer_start, nullptr);
             memcpy((char *) buf + buffer_len, buffer_start, block_head->m_nBufferSize - buffer_len);
         }
-        NFDataAlignType fast_check = FastCheck(buf, block_head->m_nBufferSize);
+        NFDataAlignType fast_check = FastCheck(data, block_head->m_nBufferSize);
+
+        if (peekData) *peekData = data;
 
         if (recvSize) *recvSize = block_head->m_nBufferSize;
 
@@ -952,17 +1136,7 @@ int NFIBusConnection::ShmRecv(NFShmChannel* channel, void* buf, size_t len, size
 
     } while (false);
 
-    // 设置游标
-    if (ori_read_cur != read_end_cur)
-    {
-        channel->m_nAtomicReadCur.store(read_end_cur);
-        // 不再访问数据区和head区了，所以不再需要memory barrier了
-    }
-
-    // 用于调试的节点编号信息
-    m_nLastActionChannelBeginNodeIndex = ori_read_cur;
-    m_nLastActionChannelEndNodeIndex = read_end_cur;
-    m_nLastActionChannelPtr = channel;
+    if (readEndCur) *readEndCur = read_end_cur;
     return ret;
 }
 
@@ -1019,21 +1193,185 @@ int NFIBusConnection::ShmRealSend(NFShmChannel *channel, const void *buf, size_t
     m_nLastActionChannelEndNodeIndex = newWriteCur;
     m_nLastActionChannelPtr = channel;
 
+    ShmFillBlock(channel, writeCur, newWriteCur, oprSeq, buf, len);
+
+    // 设置首node header，数据写完标记
+    {
+        // 设置屏障，先保证数据区和head区内存已被刷入
+        std::atomic_thread_fence(std::memory_order_acq_rel);
+
+        volatile NFShmNodeHead *first_node_head = GetNodeHead(channel, writeCur, nullptr, nullptr);
+        first_node_head->m_nFlag = SetFlag(first_node_head->m_nFlag, NF_WRITEN);
+
+        // 设置屏障，保证head内存同步，然后复查操作序号，writen标记延迟同步没关系
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // 再检查一次，以防memcpy时发生写冲突
+        if (oprSeq != first_node_head->m_nOperationSeq)
+        {
+            ++channel->m_nWriteCheckSequenceFailedCount;
+            return NFrame::ERR_CODE_NFBUS_ERR_NODE_BAD_BLOCK_CSEQ_ID;
+        }
+    }
+
+    return NFrame::ERR_CODE_SVR_OK;
+}
+
+int NFIBusConnection::ShmSendBatch(NFShmChannel* channel, const NFShmIoVec* vec, size_t count, size_t* sendCount)
+{
+    if (nullptr == channel) return NFrame::ERR_CODE_NFBUS_ERR_PARAMS;
+
+    size_t sent = 0;
+    std::vector<size_t> vecConflict;
+    int ret = ShmRealSendBatch(channel, vec, count, &sent, &vecConflict);
+
+    // 整批消息都已经发布, 只有写冲突的块被破坏了(读端会当作坏块跳过), 只把这些块单独重发, 重发的消息会排在整批之后
+    size_t failed = 0;
+    for (size_t i = 0; i < vecConflict.size(); ++i)
+    {
+        const NFShmIoVec& conflict = vec[vecConflict[i]];
+        NFLogError(NF_LOG_DEFAULT, 0, "ShmSendBatch 原子操作序列冲突，重发第{}/{}条", vecConflict[i], count);
+        ++channel->m_nWriteRetryCount;
+        int retryRet = ShmSend(channel, conflict.m_pData, conflict.m_nLen);
+        if (retryRet != 0)
+        {
+            ++failed;
+            ret = retryRet;
+        }
+    }
+
+    if (sendCount) *sendCount = sent - failed;
+    return ret;
+}
+
+int NFIBusConnection::ShmRealSendBatch(NFShmChannel* channel, const NFShmIoVec* vec, size_t count, size_t* sendCount, std::vector<size_t>* conflictIndex)
+{
+    if (nullptr == channel || (nullptr == vec && count > 0)) return NFrame::ERR_CODE_NFBUS_ERR_PARAMS;
+
+    if (sendCount) *sendCount = 0;
+
+    if (0 == count) return NFrame::ERR_CODE_SVR_OK;
+
+    // 获取操作序号, 整批共用一个操作序号, 读端通过MF_START_NODE切分数据块
+    uint32_t oprSeq = FetchOperationSeq(channel);
+
+    // 游标操作, 一次CAS预留整批消息需要的连续节点
+    size_t readCur = 0;
+    size_t newWriteCur, writeCur = channel->m_nAtomicWriteCur.load();
+    size_t batchNum = 0;
+    size_t nodeCount = 0;
+    unsigned char retryTimes = 0;
+
+    while (true)
+    {
+        readCur = channel->m_nAtomicReadCur.load();
+
+        // 要留下一个node做tail, 所以多减1
+        size_t availableNode = GetAvailableNodeCount(channel, readCur, writeCur);
+
+        // 缓冲区放不下全部消息时只发送能放下的前缀部分
+        batchNum = 0;
+        nodeCount = 0;
+        for (; batchNum < count; ++batchNum)
+        {
+            size_t num = vec[batchNum].m_nLen > 0 ? CalcNodeNum(channel, vec[batchNum].m_nLen) : 0;
+            if (nodeCount + num > availableNode)
+            {
+                break;
+            }
+            nodeCount += num;
+        }
+
+        if (0 == batchNum)
+        {
+            return NFrame::ERR_CODE_NFBUS_ERR_BUFF_LIMIT;
+        }
+
+        if (0 == nodeCount)
+        {
+            if (sendCount) *sendCount = batchNum;
+            return NFrame::ERR_CODE_SVR_OK;
+        }
+
+        // 新的尾部node游标
+        newWriteCur = GetNextIndex(channel, writeCur, nodeCount);
+
+        bool f = channel->m_nAtomicWriteCur.compare_exchange_weak(writeCur, newWriteCur);
+
+        if (likely(f)) break;
+
+        // 发现冲突原子操作失败则重试
+        ++retryTimes;
+        __UTIL_LOCK_SPIN_LOCK_WAIT(retryTimes);
+    }
+    m_nLastActionChannelBeginNodeIndex = writeCur;
+    m_nLastActionChannelEndNodeIndex = newWriteCur;
+    m_nLastActionChannelPtr = channel;
+
+    size_t blockCur = writeCur;
+    for (size_t i = 0; i < batchNum; ++i)
+    {
+        if (0 == vec[i].m_nLen) continue;
+
+        size_t blockEndCur = GetNextIndex(channel, blockCur, CalcNodeNum(channel, vec[i].m_nLen));
+        ShmFillBlock(channel, blockCur, blockEndCur, oprSeq, vec[i].m_pData, vec[i].m_nLen);
+        blockCur = blockEndCur;
+    }
+
+    // 设置屏障，先保证数据区和head区内存已被刷入
+    std::atomic_thread_fence(std::memory_order_acq_rel);
+
+    // 设置各个块首node header，数据写完标记
+    blockCur = writeCur;
+    for (size_t i = 0; i < batchNum; ++i)
+    {
+        if (0 == vec[i].m_nLen) continue;
+
+        volatile NFShmNodeHead *first_node_head = GetNodeHead(channel, blockCur, nullptr, nullptr);
+        first_node_head->m_nFlag = SetFlag(first_node_head->m_nFlag, NF_WRITEN);
+        blockCur = GetNextIndex(channel, blockCur, CalcNodeNum(channel, vec[i].m_nLen));
+    }
+
+    // 设置屏障，保证head内存同步，然后复查操作序号
+    // 以防memcpy时发生写冲突, 每个块都要检查, 冲突的块不影响其它已经发布的块
+    std::atomic_thread_fence(std::memory_order_acquire);
+    blockCur = writeCur;
+    for (size_t i = 0; i < batchNum; ++i)
+    {
+        if (0 == vec[i].m_nLen) continue;
+
+        volatile NFShmNodeHead *first_node_head = GetNodeHead(channel, blockCur, nullptr, nullptr);
+        if (oprSeq != first_node_head->m_nOperationSeq)
+        {
+            ++channel->m_nWriteCheckSequenceFailedCount;
+            if (conflictIndex) conflictIndex->push_back(i);
+        }
+        blockCur = GetNextIndex(channel, blockCur, CalcNodeNum(channel, vec[i].m_nLen));
+    }
+
+    if (sendCount) *sendCount = batchNum;
+    return NFrame::ERR_CODE_SVR_OK;
+}
+
+/**
+ * @brief 初始化[beginCur, endCur)范围内的节点并写入一个数据块，不设置首节点的写完标记
+ */
+void NFIBusConnection::ShmFillBlock(NFShmChannel* channel, size_t beginCur, size_t endCur, uint32_t oprSeq, const void* buf, size_t len)
+{
     // 数据缓冲区操作 - 初始化
     void *bufferStart = nullptr;
     size_t bufferLen = 0;
-    NFShmBlockHead *blockHead = GetBlockHead(channel, writeCur, &bufferStart, &bufferLen);
+    NFShmBlockHead *blockHead = GetBlockHead(channel, beginCur, &bufferStart, &bufferLen);
     memset(blockHead, 0x00, sizeof(NFShmBlockHead));
 
     // 数据缓冲区操作 - 要写入的节点
     {
         blockHead->m_nBufferSize = 0;
 
-        volatile NFShmNodeHead *first_node_head = GetNodeHead(channel, writeCur, nullptr, nullptr);
+        volatile NFShmNodeHead *first_node_head = GetNodeHead(channel, beginCur, nullptr, nullptr);
         first_node_head->m_nFlag = SetFlag(0, MF_START_NODE);
         first_node_head->m_nOperationSeq = oprSeq;
 
-        for (size_t i = GetNextIndex(channel, writeCur, 1); i != newWriteCur; i = GetNextIndex(channel, i, 1))
+        for (size_t i = GetNextIndex(channel, beginCur, 1); i != endCur; i = GetNextIndex(channel, i, 1))
         {
             volatile NFShmNodeHead *thisNodeHead = GetNodeHead(channel, i, nullptr, nullptr);
             assert((char *) thisNodeHead < (char *) channel + channel->m_nAreaDataOffset);
@@ -1053,7 +1391,7 @@ int NFIBusConnection::ShmRealSend(NFShmChannel *channel, const void *buf, size_t
     // 数据写入
     // fast_memcpy
     // 数据有回绕
-    if (newWriteCur && newWriteCur < writeCur)
+    if (endCur && endCur < beginCur)
     {
         size_t copy_len = len > bufferLen ? bufferLen : len;
         memcpy(bufferStart, buf, copy_len);
@@ -1066,26 +1404,6 @@ int NFIBusConnection::ShmRealSend(NFShmChannel *channel, const void *buf, size_t
         memcpy(bufferStart, buf, len);
     }
     blockHead->m_nFastCheck = FastCheck(buf, len);
-
-    // 设置首node header，数据写完标记
-    {
-        // 设置屏障，先保证数据区和head区内存已被刷入
-        std::atomic_thread_fence(std::memory_order_acq_rel);
-
-        volatile NFShmNodeHead *first_node_head = GetNodeHead(channel, writeCur, nullptr, nullptr);
-        first_node_head->m_nFlag = SetFlag(first_node_head->m_nFlag, NF_WRITEN);
-
-        // 设置屏障，保证head内存同步，然后复查操作序号，writen标记延迟同步没关系
-        std::atomic_thread_fence(std::memory_order_acquire);
-        // 再检查一次，以防memcpy时发生写冲突
-        if (oprSeq != first_node_head->m_nOperationSeq)
-        {
-            ++channel->m_nWriteCheckSequenceFailedCount;
-            return NFrame::ERR_CODE_NFBUS_ERR_NODE_BAD_BLOCK_CSEQ_ID;
-        }
-    }
-
-    return NFrame::ERR_CODE_SVR_OK;
 }
 
 int NFIBusConnection::SetWriteTimeout(NFShmChannel *channel, uint64_t ms)
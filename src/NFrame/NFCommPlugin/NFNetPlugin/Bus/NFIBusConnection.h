@@ -10,6 +10,7 @@
 #pragma once
 
 #include <map>
+#include <vector>
 #include "NFBusDefine.h"
 #include "NFBusShm.h"
 #include "../NFINetMessage.h"
@@ -20,6 +21,7 @@
 
 struct MsgFromBusInfo;
 typedef std::function<void(eMsgType type, uint64_t connectLinkId, uint64_t objectLinkId, NFDataPackage& package)> BusMsgPeerCallback;
+typedef std::function<void(const char* data, size_t len)> ShmRecvBatchCallback;
 
 struct MsgFromBusInfo
 {
@@ -166,6 +168,17 @@ public:
     virtual bool Send(NFDataPackage& packet, const char* msg, uint32_t nLen) = 0;
     virtual bool Send(NFDataPackage& packet, const google::protobuf::Message& xData) = 0;
 
+    /**
+     * @brief 开始合并发送, 之后数据通道上的消息先缓存起来, 由FlushSendBatch一次ShmSendBatch发出
+     */
+    virtual void BeginSendBatch() {}
+
+    /**
+     * @brief 发出缓存的消息并结束合并发送
+     * @return 合并期间有消息没有发出去(通道满了等)返回false, 合并期间Send缓存消息时总是返回true, 失败只能在这里知道
+     */
+    virtual bool FlushSendBatch() { return true; }
+
 protected:
     /**
      * @brief 发送数据
@@ -179,12 +192,72 @@ protected:
      */
     int ShmRecv(NFShmChannel* channel, void* buf, size_t len, size_t* recvSize);
 
+    /**
+     * @brief 批量发送数据, 一次CAS预留整批消息的节点
+     * @param channel 内存通道
+     * @param vec 消息数组
+     * @param count 消息数量
+     * @param sendCount 实际发送的消息数量, 缓冲区不足时只发送前缀部分, 写冲突后重发失败的消息不计入
+     * @return int
+     */
+    int ShmSendBatch(NFShmChannel* channel, const NFShmIoVec* vec, size_t count, size_t* sendCount);
+
+    /**
+     * @brief 原地读取一条数据, 不移动读游标
+     * @param channel 内存通道
+     * @param buf 数据块有回绕时使用的拷贝缓冲区
+     * @param len 拷贝缓冲区长度
+     * @param data 数据地址, 无回绕时直接指向通道数据区, 在ShmCommit之前有效
+     * @param dataSize 数据长度
+     * @return int
+     */
+    int ShmPeek(NFShmChannel* channel, void* buf, size_t len, const void** data, size_t* dataSize);
+
+    /**
+     * @brief 提交ShmPeek读取的数据, 移动读游标
+     * @param channel 内存通道
+     * @return int
+     */
+    int ShmCommit(NFShmChannel* channel);
+
+    /**
+     * @brief 批量接受数据, 每条消息回调cb, 读游标只在最后提交一次
+     * @param channel 内存通道
+     * @param buffer 数据块有回绕时使用的拷贝缓冲区, 无回绕的数据块原地回调
+     * @param cb 每收到一条消息的回调
+     * @param maxCount 最多接收的消息数量
+     * @param recvCount 实际接收的消息数量
+     * @return int
+     */
+    int ShmRecvBatch(NFShmChannel* channel, NFBuffer& buffer, const ShmRecvBatchCallback& cb, size_t maxCount, size_t* recvCount);
+
     /**
      * @brief 发送数据
      * @return int
      */
     int ShmRealSend(NFShmChannel* channel, const void* buf, size_t len);
 
+    /**
+     * @brief 批量发送数据
+     * @param sendCount 已经发布的消息数量(前缀部分)
+     * @param conflictIndex 发布后复查操作序号冲突的消息下标, 这些块已被破坏, 需要调用者重发
+     * @return int
+     */
+    int ShmRealSendBatch(NFShmChannel* channel, const NFShmIoVec* vec, size_t count, size_t* sendCount, std::vector<size_t>* conflictIndex);
+
+    /**
+     * @brief 从readCur开始读取一个数据块, 不修改读游标
+     * @param readEndCur 读取后读游标应该移动到的位置
+     * @param peekData 不为空时无回绕的数据块不拷贝, 直接返回数据区地址
+     * @return int
+     */
+    int ShmRecvBlock(NFShmChannel* channel, size_t readCur, size_t writeCur, void* buf, size_t len, size_t* recvSize, size_t* readEndCur, const void** peekData);
+
+    /**
+     * @brief 初始化节点并写入一个数据块
+     */
+    static void ShmFillBlock(NFShmChannel* channel, size_t beginCur, size_t endCur, uint32_t oprSeq, const void* buf, size_t len);
+
 protected:
     std::pair<size_t, size_t> LastAction();
 
@@ -365,6 +438,12 @@ protected:
     size_t m_nLastActionChannelBeginNodeIndex = 0;
     NFShmChannel* m_nLastActionChannelPtr = nullptr;
 
+    /**
+     * @brief ShmPeek后等待ShmCommit的通道和读游标
+     */
+    NFShmChannel* m_pPeekChannel = nullptr;
+    size_t m_nPeekReadEndCur = 0;
+
 protected:
     uint32_t m_connectionType;
 
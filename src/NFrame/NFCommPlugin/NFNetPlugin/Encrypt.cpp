@@ -1,21 +1,406 @@
 #include "Encrypt.h"
 #include "NFComm/NFCore/NFPlatform.h"
+#include <string.h>
+#include <random>
 
-int8_t g_key = 87;// 01010111;
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NF_CHACHA20_USE_SSE2 1
+#endif
 
-void Encryption(char* pChar, int length)
+//AVX2只在gcc/clang下按函数单独开启, 不要求整个工程加-mavx2
+#if defined(NF_CHACHA20_USE_SSE2) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NF_CHACHA20_USE_AVX2 1
+#endif
+
+//没有配置密钥时使用
+static const char* s_defaultEncryptKey = "NFShmXFrame.Evpp.Default.Key.v1";
+
+#define NF_CHACHA20_ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define NF_CHACHA20_QR(a, b, c, d) \
+    a += b; d ^= a; d = NF_CHACHA20_ROTL(d, 16); \
+    c += d; b ^= c; b = NF_CHACHA20_ROTL(b, 12); \
+    a += b; d ^= a; d = NF_CHACHA20_ROTL(d, 8); \
+    c += d; b ^= c; b = NF_CHACHA20_ROTL(b, 7);
+
+static inline uint32_t NFChaCha20Load32(const uint8_t* p)
+{
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static inline void NFChaCha20Store32(uint8_t* p, uint32_t v)
+{
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+static inline void NFChaCha20InitState(uint32_t* state, const uint8_t* key, const uint8_t* nonce, uint32_t counter)
+{
+    //"expand 32-byte k"
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+    for (int i = 0; i < 8; i++)
+    {
+        state[4 + i] = NFChaCha20Load32(key + i * 4);
+    }
+    state[12] = counter;
+    for (int i = 0; i < 3; i++)
+    {
+        state[13 + i] = NFChaCha20Load32(nonce + i * 4);
+    }
+}
+
+//块计数用完后进位到nonce的第一个字, 同一个流不会重复密钥流
+static inline void NFChaCha20AddCounter(uint32_t* state, uint32_t blocks)
+{
+    uint32_t old = state[12];
+    state[12] += blocks;
+    if (state[12] < old)
+    {
+        state[13]++;
+    }
+}
+
+static size_t NFChaCha20XorBlocksScalar(uint32_t* state, char* pData, size_t blocks)
+{
+    uint8_t keyStream[NF_CHACHA20_BLOCK_SIZE];
+    for (size_t i = 0; i < blocks; i++)
+    {
+        NFChaCha20::Block(state, keyStream);
+        char* p = pData + i * NF_CHACHA20_BLOCK_SIZE;
+        for (int j = 0; j < NF_CHACHA20_BLOCK_SIZE; j++)
+        {
+            p[j] ^= keyStream[j];
+        }
+        NFChaCha20AddCounter(state, 1);
+    }
+    return blocks;
+}
+
+#ifdef NF_CHACHA20_USE_SSE2
+
+#define NF_CHACHA20_ROTL_SSE2(x, n) _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - (n)))
+
+#define NF_CHACHA20_QR_SSE2(a, b, c, d) \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = NF_CHACHA20_ROTL_SSE2(d, 16); \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = NF_CHACHA20_ROTL_SSE2(b, 12); \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = NF_CHACHA20_ROTL_SSE2(d, 8); \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = NF_CHACHA20_ROTL_SSE2(b, 7);
+
+/**
+ * @brief 一次4个块, 每个寄存器的4个通道分别是4个块的同一个字, 算完转置回按块排列
+ */
+static size_t NFChaCha20XorBlocksSse2(uint32_t* state, char* pData, size_t blocks)
 {
-    for (int i = 0; i < length; ++i)
+    size_t done = 0;
+    while (blocks - done >= 4 && state[12] <= 0xFFFFFFFF - 4)
     {
-        pChar[i] = static_cast<unsigned char>(pChar[i] ^ g_key);
+        __m128i orig[16];
+        __m128i x[16];
+        for (int i = 0; i < 16; i++)
+        {
+            orig[i] = _mm_set1_epi32(static_cast<int>(state[i]));
+        }
+        orig[12] = _mm_add_epi32(orig[12], _mm_set_epi32(3, 2, 1, 0));
+        for (int i = 0; i < 16; i++)
+        {
+            x[i] = orig[i];
+        }
+
+        for (int round = 0; round < 10; round++)
+        {
+            NF_CHACHA20_QR_SSE2(x[0], x[4], x[8], x[12]);
+            NF_CHACHA20_QR_SSE2(x[1], x[5], x[9], x[13]);
+            NF_CHACHA20_QR_SSE2(x[2], x[6], x[10], x[14]);
+            NF_CHACHA20_QR_SSE2(x[3], x[7], x[11], x[15]);
+            NF_CHACHA20_QR_SSE2(x[0], x[5], x[10], x[15]);
+            NF_CHACHA20_QR_SSE2(x[1], x[6], x[11], x[12]);
+            NF_CHACHA20_QR_SSE2(x[2], x[7], x[8], x[13]);
+            NF_CHACHA20_QR_SSE2(x[3], x[4], x[9], x[14]);
+        }
+
+        char* p = pData + done * NF_CHACHA20_BLOCK_SIZE;
+        for (int q = 0; q < 4; q++)
+        {
+            __m128i a = _mm_add_epi32(x[q * 4], orig[q * 4]);
+            __m128i b = _mm_add_epi32(x[q * 4 + 1], orig[q * 4 + 1]);
+            __m128i c = _mm_add_epi32(x[q * 4 + 2], orig[q * 4 + 2]);
+            __m128i d = _mm_add_epi32(x[q * 4 + 3], orig[q * 4 + 3]);
+            __m128i t0 = _mm_unpacklo_epi32(a, b);
+            __m128i t1 = _mm_unpacklo_epi32(c, d);
+            __m128i t2 = _mm_unpackhi_epi32(a, b);
+            __m128i t3 = _mm_unpackhi_epi32(c, d);
+            __m128i out[4];
+            out[0] = _mm_unpacklo_epi64(t0, t1);
+            out[1] = _mm_unpackhi_epi64(t0, t1);
+            out[2] = _mm_unpacklo_epi64(t2, t3);
+            out[3] = _mm_unpackhi_epi64(t2, t3);
+            for (int k = 0; k < 4; k++)
+            {
+                __m128i* pDst = reinterpret_cast<__m128i*>(p + k * NF_CHACHA20_BLOCK_SIZE + q * 16);
+                _mm_storeu_si128(pDst, _mm_xor_si128(_mm_loadu_si128(pDst), out[k]));
+            }
+        }
+
+        state[12] += 4;
+        done += 4;
     }
+    return done;
 }
 
-void Decryption(char* pChar, int length)
+#endif
+
+#ifdef NF_CHACHA20_USE_AVX2
+
+#define NF_CHACHA20_ROTL_AVX2(x, n) _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+
+#define NF_CHACHA20_QR_AVX2(a, b, c, d) \
+    a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = _mm256_shuffle_epi8(d, rot16); \
+    c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = NF_CHACHA20_ROTL_AVX2(b, 12); \
+    a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = _mm256_shuffle_epi8(d, rot8); \
+    c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = NF_CHACHA20_ROTL_AVX2(b, 7);
+
+/**
+ * @brief 一次8个块, 16和8位的循环移位用字节重排
+ *
+ * 128位通道内转置后, 低半边是块k, 高半边是块k+4, 再用permute2x128把两组字拼成一个块的32字节
+ */
+__attribute__((target("avx2"))) static size_t NFChaCha20XorBlocksAvx2(uint32_t* state, char* pData, size_t blocks)
 {
-    for (int i = 0; i < length; ++i)
+    const __m256i rot16 = _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2, 13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+    const __m256i rot8 = _mm256_set_epi8(14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3, 14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+
+    size_t done = 0;
+    while (blocks - done >= 8 && state[12] <= 0xFFFFFFFF - 8)
     {
-        pChar[i] = static_cast<unsigned char>(pChar[i] ^ g_key);
+        __m256i orig[16];
+        __m256i x[16];
+        for (int i = 0; i < 16; i++)
+        {
+            orig[i] = _mm256_set1_epi32(static_cast<int>(state[i]));
+        }
+        orig[12] = _mm256_add_epi32(orig[12], _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        for (int i = 0; i < 16; i++)
+        {
+            x[i] = orig[i];
+        }
+
+        for (int round = 0; round < 10; round++)
+        {
+            NF_CHACHA20_QR_AVX2(x[0], x[4], x[8], x[12]);
+            NF_CHACHA20_QR_AVX2(x[1], x[5], x[9], x[13]);
+            NF_CHACHA20_QR_AVX2(x[2], x[6], x[10], x[14]);
+            NF_CHACHA20_QR_AVX2(x[3], x[7], x[11], x[15]);
+            NF_CHACHA20_QR_AVX2(x[0], x[5], x[10], x[15]);
+            NF_CHACHA20_QR_AVX2(x[1], x[6], x[11], x[12]);
+            NF_CHACHA20_QR_AVX2(x[2], x[7], x[8], x[13]);
+            NF_CHACHA20_QR_AVX2(x[3], x[4], x[9], x[14]);
+        }
+
+        //y[q][k]: 第q组4个字, 低半边块k, 高半边块k+4
+        __m256i y[4][4];
+        for (int q = 0; q < 4; q++)
+        {
+            __m256i a = _mm256_add_epi32(x[q * 4], orig[q * 4]);
+            __m256i b = _mm256_add_epi32(x[q * 4 + 1], orig[q * 4 + 1]);
+            __m256i c = _mm256_add_epi32(x[q * 4 + 2], orig[q * 4 + 2]);
+            __m256i d = _mm256_add_epi32(x[q * 4 + 3], orig[q * 4 + 3]);
+            __m256i t0 = _mm256_unpacklo_epi32(a, b);
+            __m256i t1 = _mm256_unpacklo_epi32(c, d);
+            __m256i t2 = _mm256_unpackhi_epi32(a, b);
+            __m256i t3 = _mm256_unpackhi_epi32(c, d);
+            y[q][0] = _mm256_unpacklo_epi64(t0, t1);
+            y[q][1] = _mm256_unpackhi_epi64(t0, t1);
+            y[q][2] = _mm256_unpacklo_epi64(t2, t3);
+            y[q][3] = _mm256_unpackhi_epi64(t2, t3);
+        }
+
+        char* p = pData + done * NF_CHACHA20_BLOCK_SIZE;
+        for (int k = 0; k < 4; k++)
+        {
+            __m256i* pLow = reinterpret_cast<__m256i*>(p + k * NF_CHACHA20_BLOCK_SIZE);
+            __m256i* pHigh = reinterpret_cast<__m256i*>(p + (k + 4) * NF_CHACHA20_BLOCK_SIZE);
+            _mm256_storeu_si256(pLow, _mm256_xor_si256(_mm256_loadu_si256(pLow), _mm256_permute2x128_si256(y[0][k], y[1][k], 0x20)));
+            _mm256_storeu_si256(pLow + 1, _mm256_xor_si256(_mm256_loadu_si256(pLow + 1), _mm256_permute2x128_si256(y[2][k], y[3][k], 0x20)));
+            _mm256_storeu_si256(pHigh, _mm256_xor_si256(_mm256_loadu_si256(pHigh), _mm256_permute2x128_si256(y[0][k], y[1][k], 0x31)));
+            _mm256_storeu_si256(pHigh + 1, _mm256_xor_si256(_mm256_loadu_si256(pHigh + 1), _mm256_permute2x128_si256(y[2][k], y[3][k], 0x31)));
+        }
+
+        state[12] += 8;
+        done += 8;
+    }
+    return done;
+}
+
+#endif
+
+static int NFChaCha20DetectKernel()
+{
+#ifdef NF_CHACHA20_USE_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return NF_CHACHA20_KERNEL_AVX2;
     }
+#endif
+#ifdef NF_CHACHA20_USE_SSE2
+    return NF_CHACHA20_KERNEL_SSE2;
+#else
+    return NF_CHACHA20_KERNEL_SCALAR;
+#endif
 }
 
+static int s_chacha20MaxKernel = NFChaCha20DetectKernel();
+static int s_chacha20Kernel = s_chacha20MaxKernel;
+
+NFChaCha20::NFChaCha20() : m_keyStreamPos(NF_CHACHA20_BLOCK_SIZE)
+{
+    memset(m_state, 0, sizeof(m_state));
+    memset(m_keyStream, 0, sizeof(m_keyStream));
+}
+
+void NFChaCha20::Init(const uint8_t* key, const uint8_t* nonce, uint32_t counter)
+{
+    NFChaCha20InitState(m_state, key, nonce, counter);
+    m_keyStreamPos = NF_CHACHA20_BLOCK_SIZE;
+}
+
+void NFChaCha20::Block(const uint32_t* state, uint8_t* out)
+{
+    uint32_t x[16];
+    memcpy(x, state, sizeof(x));
+    for (int round = 0; round < 10; round++)
+    {
+        NF_CHACHA20_QR(x[0], x[4], x[8], x[12]);
+        NF_CHACHA20_QR(x[1], x[5], x[9], x[13]);
+        NF_CHACHA20_QR(x[2], x[6], x[10], x[14]);
+        NF_CHACHA20_QR(x[3], x[7], x[11], x[15]);
+        NF_CHACHA20_QR(x[0], x[5], x[10], x[15]);
+        NF_CHACHA20_QR(x[1], x[6], x[11], x[12]);
+        NF_CHACHA20_QR(x[2], x[7], x[8], x[13]);
+        NF_CHACHA20_QR(x[3], x[4], x[9], x[14]);
+    }
+
+    for (int i = 0; i < 16; i++)
+    {
+        NFChaCha20Store32(out + i * 4, x[i] + state[i]);
+    }
+}
+
+void NFChaCha20::Process(char* pData, size_t length)
+{
+    //先用完上次剩下的密钥流
+    while (length > 0 && m_keyStreamPos < NF_CHACHA20_BLOCK_SIZE)
+    {
+        *pData++ ^= m_keyStream[m_keyStreamPos++];
+        length--;
+    }
+
+    size_t blocks = length / NF_CHACHA20_BLOCK_SIZE;
+    size_t done = 0;
+#ifdef NF_CHACHA20_USE_AVX2
+    if (s_chacha20Kernel >= NF_CHACHA20_KERNEL_AVX2)
+    {
+        done += NFChaCha20XorBlocksAvx2(m_state, pData, blocks);
+    }
+#endif
+#ifdef NF_CHACHA20_USE_SSE2
+    if (s_chacha20Kernel >= NF_CHACHA20_KERNEL_SSE2)
+    {
+        done += NFChaCha20XorBlocksSse2(m_state, pData + done * NF_CHACHA20_BLOCK_SIZE, blocks - done);
+    }
+#endif
+    done += NFChaCha20XorBlocksScalar(m_state, pData + done * NF_CHACHA20_BLOCK_SIZE, blocks - done);
+
+    pData += done * NF_CHACHA20_BLOCK_SIZE;
+    length -= done * NF_CHACHA20_BLOCK_SIZE;
+    if (length > 0)
+    {
+        Block(m_state, m_keyStream);
+        NFChaCha20AddCounter(m_state, 1);
+        for (m_keyStreamPos = 0; m_keyStreamPos < length; m_keyStreamPos++)
+        {
+            pData[m_keyStreamPos] ^= m_keyStream[m_keyStreamPos];
+        }
+    }
+}
+
+int NFChaCha20::GetKernel()
+{
+    return s_chacha20Kernel;
+}
+
+int NFChaCha20::SetKernel(int kernel)
+{
+    if (kernel < NF_CHACHA20_KERNEL_SCALAR || kernel > s_chacha20MaxKernel)
+    {
+        return -1;
+    }
+    s_chacha20Kernel = kernel;
+    return 0;
+}
+
+NFEncryptKey::NFEncryptKey(const std::string& key)
+{
+    //任意长度的配置折叠成32字节, 再过一次ChaCha20打散
+    const std::string& strKey = key.empty() ? std::string(s_defaultEncryptKey) : key;
+    uint8_t rawKey[NF_CHACHA20_KEY_SIZE] = {0};
+    for (size_t i = 0; i < strKey.size(); i++)
+    {
+        rawKey[i % NF_CHACHA20_KEY_SIZE] ^= static_cast<uint8_t>(strKey[i]);
+    }
+
+    uint8_t nonce[NF_CHACHA20_NONCE_SIZE] = {0};
+    uint32_t state[16];
+    uint8_t block[NF_CHACHA20_BLOCK_SIZE];
+    NFChaCha20InitState(state, rawKey, nonce, 0);
+    NFChaCha20::Block(state, block);
+    memcpy(m_key, block, NF_CHACHA20_KEY_SIZE);
+}
+
+NFConnCipher::NFConnCipher() : m_recvDecrypted(0), m_recvReady(false)
+{
+}
+
+void NFConnCipher::InitStream(NFChaCha20& stream, const NFEncryptKey& key, const uint8_t* nonce)
+{
+    //会话密钥 = 主密钥在这个nonce下的第0块, 数据从第1块开始加密
+    uint32_t state[16];
+    uint8_t block[NF_CHACHA20_BLOCK_SIZE];
+    NFChaCha20InitState(state, key.m_key, nonce, 0);
+    NFChaCha20::Block(state, block);
+    stream.Init(block, nonce, 1);
+}
+
+void NFConnCipher::MakeHello(const NFEncryptKey& key, char* pHello)
+{
+    uint8_t nonce[NF_CHACHA20_NONCE_SIZE];
+    std::random_device rd;
+    for (int i = 0; i < NF_CHACHA20_NONCE_SIZE / 4; i++)
+    {
+        NFChaCha20Store32(nonce + i * 4, rd());
+    }
+
+    NFChaCha20Store32(reinterpret_cast<uint8_t*>(pHello), NF_ENCRYPT_HELLO_MAGIC);
+    memcpy(pHello + 4, nonce, NF_CHACHA20_NONCE_SIZE);
+    InitStream(m_send, key, nonce);
+}
+
+int NFConnCipher::OnHello(const NFEncryptKey& key, const char* pHello)
+{
+    if (NFChaCha20Load32(reinterpret_cast<const uint8_t*>(pHello)) != NF_ENCRYPT_HELLO_MAGIC)
+    {
+        return -1;
+    }
+
+    InitStream(m_recv, key, reinterpret_cast<const uint8_t*>(pHello + 4));
+    m_recvReady = true;
+    m_recvDecrypted = 0;
+    return 0;
+}
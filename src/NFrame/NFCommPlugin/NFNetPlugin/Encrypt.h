@@ -9,6 +9,109 @@
 
 #pragma once
 
-//先用简单的处理吧，后续看有没需要加其它算法
-void Encryption(char* pChar, int length);
-void Decryption(char* pChar, int length);
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#define NF_CHACHA20_KEY_SIZE 32
+#define NF_CHACHA20_NONCE_SIZE 12
+#define NF_CHACHA20_BLOCK_SIZE 64
+
+//连接建立后双方先明文发送的握手包: 4字节魔数 + 12字节nonce
+#define NF_ENCRYPT_HELLO_MAGIC 0x3148434E
+#define NF_ENCRYPT_HELLO_SIZE 16
+
+/**
+ * @brief ChaCha20批量生成密钥流的实现
+ */
+enum NF_CHACHA20_KERNEL
+{
+    NF_CHACHA20_KERNEL_SCALAR = 0,
+    NF_CHACHA20_KERNEL_SSE2 = 1, //一次4个块
+    NF_CHACHA20_KERNEL_AVX2 = 2, //一次8个块
+};
+
+/**
+ * @brief ChaCha20流加密(RFC 7539), 原地异或, 可以分多次处理同一个流
+ *
+ * 整块的部分按运行时选出的SSE2/AVX2实现一次生成多个块, 不足一块的密钥流留到下次调用接着用
+ */
+class NFChaCha20
+{
+public:
+    NFChaCha20();
+
+    void Init(const uint8_t* key, const uint8_t* nonce, uint32_t counter = 0);
+
+    void Process(char* pData, size_t length);
+
+    /**
+     * @brief 生成一个块的密钥流
+     */
+    static void Block(const uint32_t* state, uint8_t* out);
+
+    static int GetKernel();
+
+    /**
+     * @brief 指定实现, 测试用, CPU不支持时返回-1
+     */
+    static int SetKernel(int kernel);
+
+private:
+    uint32_t m_state[16];
+    uint8_t m_keyStream[NF_CHACHA20_BLOCK_SIZE];
+    uint32_t m_keyStreamPos;
+};
+
+/**
+ * @brief 安全连接的主密钥, 来自服务器配置EncryptConfig.EncrypyKey, 为空时用内置密钥
+ */
+class NFEncryptKey
+{
+public:
+    explicit NFEncryptKey(const std::string& key);
+
+    uint8_t m_key[NF_CHACHA20_KEY_SIZE];
+};
+
+/**
+ * @brief 一条安全连接的加解密状态, 只在网络线程使用
+ *
+ * 连接建立后双方各自生成随机nonce, 用主密钥和nonce派生本方向的会话密钥, nonce通过握手包发给对端。
+ * 两个方向的密钥流互相独立, 收包缓冲区里可能留有半个包, 已经解密的长度记在m_recvDecrypted里避免重复解密
+ */
+class NFConnCipher
+{
+public:
+    NFConnCipher();
+
+    /**
+     * @brief 初始化发送方向, 生成握手包
+     * @param pHello 输出NF_ENCRYPT_HELLO_SIZE字节
+     */
+    void MakeHello(const NFEncryptKey& key, char* pHello);
+
+    /**
+     * @brief 收到对端握手包, 初始化接收方向
+     * @return 0成功, 魔数不对返回-1
+     */
+    int OnHello(const NFEncryptKey& key, const char* pHello);
+
+    bool IsRecvReady() const { return m_recvReady; }
+
+    void Encrypt(char* pData, size_t length) { m_send.Process(pData, length); }
+
+    void Decrypt(char* pData, size_t length) { m_recv.Process(pData, length); }
+
+    /**
+     * @brief 收包缓冲区开头已经解密的字节数
+     */
+    size_t m_recvDecrypted;
+
+private:
+    static void InitStream(NFChaCha20& stream, const NFEncryptKey& key, const uint8_t* nonce);
+
+    NFChaCha20 m_send;
+    NFChaCha20 m_recv;
+    bool m_recvReady;
+};
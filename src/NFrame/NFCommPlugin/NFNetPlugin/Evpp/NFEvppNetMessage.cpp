@@ -8,6 +8,7 @@
 
 #include "NFEvppNetMessage.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <list>
 #include <string>
@@ -24,7 +25,6 @@
 #include "NFComm/NFPluginModule/NFCodeQueue.h"
 #include "NFComm/NFPluginModule/NFIMessageModule.h"
 #include "NFComm/NFPluginModule/NFLogMgr.h"
-#include "NFCommPlugin/NFNetPlugin/Encrypt.h"
 
 NFEvppNetMessage::NFEvppNetMessage(NFIPluginManager* p, NF_SERVER_TYPE serverType) : NFINetMessage(p, serverType), m_netObjectPool(1000, false)
 {
@@ -74,6 +74,7 @@ NFEvppNetMessage::NFEvppNetMessage(NFIPluginManager* p, NF_SERVER_TYPE serverTyp
     m_handleMsgNumPerFrame = NF_NO_FIX_FAME_HANDLE_MAX_MSG_COUNT;
 
     m_curHandleMsgNum = 0;
+    m_internalPendingCount = 0;
     m_loopSendCount = 0;
 }
 
@@ -122,6 +123,7 @@ void NFEvppNetMessage::ProcessMsgLogicThread()
                             {
                                 pObject = AddNetObject(pMsg->m_objectLinkId, pMsg->m_tcpConPtr, m_connectionList[i]->GetPacketParseType(), m_connectionList[i]->IsSecurity());
                                 CHECK_EXPR_ASSERT_NOT_RET(pObject != NULL, "AddNetObject Failed");
+                                pObject->SetCompress(m_connectionList[i]->GetCompressType(), m_connectionList[i]->GetCompressMinSize());
                             }
                             CHECK_EXPR_ASSERT_NOT_RET(m_connectionList[i]->GetLinkId() == pObject->m_usLinkId, "m_connectionList[i]->GetLinkId() != pObject->m_usLinkId, Error..........");
 
@@ -136,6 +138,7 @@ void NFEvppNetMessage::ProcessMsgLogicThread()
                             CHECK_EXPR_ASSERT_NOT_RET(pObject == NULL, "GetNetObject(pMsg->m_objectLinkId:{}) Exist", pMsg->m_objectLinkId);
                             pObject = AddNetObject(pMsg->m_objectLinkId, pMsg->m_tcpConPtr, m_connectionList[i]->GetPacketParseType(), m_connectionList[i]->IsSecurity());
                             CHECK_EXPR_ASSERT_NOT_RET(pObject != NULL, "AddNetObject Failed");
+                            pObject->SetCompress(m_connectionList[i]->GetCompressType(), m_connectionList[i]->GetCompressMinSize());
 
                             NFDataPackage tmpPacket;
                             OnHandleMsgPeer(eMsgType_CONNECTED, m_connectionList[i]->GetLinkId(), pObject->m_usLinkId, tmpPacket);
@@ -185,10 +188,11 @@ void NFEvppNetMessage::ProcessMsgLogicThread()
     }
 }
 
-void NFEvppNetMessage::ProcessCodeQueue(NFCodeQueue* pRecvQueue)
+void NFEvppNetMessage::ProcessCodeQueue(NFCodeQueue* pRecvQueue, int32_t& stageNum)
 {
     NF_ASSERT_MSG(pRecvQueue != NULL, "pRecvQueue == NULL");
-    while (pRecvQueue->HasCode() && m_curHandleMsgNum >= 0)
+    uint32_t highWater = m_handleMsgNumPerFrame * EVPP_PENDING_HIGH_WATER_FACTOR;
+    while (pRecvQueue->HasCode() && stageNum > 0 && m_internalPendingCount < highWater)
     {
         m_recvBuffer.Clear();
         int iCodeLen = 0;
@@ -208,34 +212,195 @@ void NFEvppNetMessage::ProcessCodeQueue(NFCodeQueue* pRecvQueue)
                        sizeof(NFDataPackage), pCodePackage->nMsgLen);
             continue;
         }
-        pCodePackage->nBuffer = m_recvBuffer.ReadAddr() + sizeof(NFDataPackage);
+        stageNum--;
 
         NetEvppObject* pObject = GetNetObject(pCodePackage->nObjectLinkId);
-        if (pObject)
+        if (pObject == nullptr)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "net server recv data, tcp context error");
+            continue;
+        }
+
+        pObject->m_recvMsgCount++;
+        if (!pObject->IsInternal() && pObject->m_pendingCount >= EVPP_LINK_MAX_PENDING_EXTERNAL)
+        {
+            pObject->m_dropMsgCount++;
+            continue;
+        }
+
+        size_t alignLen = EVPP_PENDING_ALIGN(static_cast<size_t>(iCodeLen));
+        pObject->m_pendingBuffer.AssureSpace(alignLen);
+        memcpy(pObject->m_pendingBuffer.WriteAddr(), m_recvBuffer.ReadAddr(), iCodeLen);
+        pObject->m_pendingBuffer.Produce(alignLen);
+        pObject->m_pendingCount++;
+        if (pObject->IsInternal())
+        {
+            m_internalPendingCount++;
+        }
+        if (pObject->m_pendingCount > pObject->m_maxPendingCount)
+        {
+            pObject->m_maxPendingCount = pObject->m_pendingCount;
+        }
+
+        if (!pObject->m_scheduled)
+        {
+            pObject->m_scheduled = true;
+            pObject->m_deficit = pObject->IsInternal() ? EVPP_LINK_QUANTUM_INTERNAL : EVPP_LINK_QUANTUM_EXTERNAL;
+            m_activeLinks.push_back(pObject);
+        }
+    }
+}
+
+void NFEvppNetMessage::HandlePendingMsg(NetEvppObject* pObject)
+{
+    // 处理过程中不会向该连接追加消息, 也不会释放网络对象, 可以直接使用待处理队列中的数据
+    auto pCodePackage = reinterpret_cast<NFDataPackage*>(pObject->m_pendingBuffer.ReadAddr());
+    size_t codeLen = sizeof(NFDataPackage) + pCodePackage->nMsgLen;
+    pCodePackage->nBuffer = pObject->m_pendingBuffer.ReadAddr() + sizeof(NFDataPackage);
+
+    OnHandleMsgPeer(eMsgType_RECIVEDATA, pCodePackage->nServerLinkId, pCodePackage->nObjectLinkId, *pCodePackage);
+
+    pObject->m_pendingBuffer.Consume(EVPP_PENDING_ALIGN(codeLen));
+    pObject->m_pendingCount--;
+    if (pObject->IsInternal())
+    {
+        m_internalPendingCount--;
+    }
+}
+
+void NFEvppNetMessage::ScheduleLinkMsg()
+{
+    while (m_curHandleMsgNum > 0 && !m_activeLinks.empty())
+    {
+        NetEvppObject* pObject = m_activeLinks.front();
+        uint32_t frameMax = pObject->IsInternal() ? static_cast<uint32_t>(m_handleMsgNumPerFrame) : EVPP_LINK_FRAME_MAX_EXTERNAL;
+        while (pObject->m_pendingCount > 0 && pObject->m_deficit > 0 && pObject->m_frameHandleNum < frameMax && m_curHandleMsgNum > 0)
         {
-            OnHandleMsgPeer(eMsgType_RECIVEDATA, pCodePackage->nServerLinkId, pCodePackage->nObjectLinkId, *pCodePackage);
+            HandlePendingMsg(pObject);
+            pObject->m_deficit--;
+            pObject->m_frameHandleNum++;
+            m_curHandleMsgNum--;
+        }
+
+        if (pObject->m_pendingCount == 0)
+        {
+            m_activeLinks.pop_front();
+            pObject->m_scheduled = false;
+            pObject->m_deficit = 0;
+            pObject->m_frameHandleNum = 0;
+        }
+        else if (pObject->m_frameHandleNum >= frameMax)
+        {
+            m_activeLinks.pop_front();
+            m_frameFullLinks.push_back(pObject);
+        }
+        else if (pObject->m_deficit <= 0)
+        {
+            m_activeLinks.pop_front();
+            pObject->m_deficit += pObject->IsInternal() ? EVPP_LINK_QUANTUM_INTERNAL : EVPP_LINK_QUANTUM_EXTERNAL;
+            m_activeLinks.push_back(pObject);
         }
         else
         {
-            NFLogError(NF_LOG_DEFAULT, 0, "net server recv data, tcp context error");
+            // 本帧预算用完, 下一帧从这个连接继续
+            break;
         }
-        m_curHandleMsgNum--;
+    }
+
+    for (size_t i = 0; i < m_frameFullLinks.size(); i++)
+    {
+        m_frameFullLinks[i]->m_deficit = m_frameFullLinks[i]->IsInternal() ? EVPP_LINK_QUANTUM_INTERNAL : EVPP_LINK_QUANTUM_EXTERNAL;
+        m_activeLinks.push_back(m_frameFullLinks[i]);
+    }
+    m_frameFullLinks.clear();
+
+    for (auto iter = m_activeLinks.begin(); iter != m_activeLinks.end(); ++iter)
+    {
+        NetEvppObject* pObject = *iter;
+        pObject->m_deferMsgCount += pObject->m_pendingCount;
+        pObject->m_frameHandleNum = 0;
     }
 }
 
+void NFEvppNetMessage::FlushPendingMsg(NetEvppObject* pObject)
+{
+    if (!pObject->IsInternal() || pObject->m_pendingCount == 0)
+    {
+        return;
+    }
+
+    // 服务器之间的消息不能丢, 不受本帧预算限制, 积压的总量有高水位限制
+    NFLogInfo(NF_LOG_DEFAULT, 0, "net object:{} ip:{} disconnect, handle pending msg:{}", pObject->m_usLinkId, pObject->m_strIp, pObject->m_pendingCount);
+    while (pObject->m_pendingCount > 0)
+    {
+        HandlePendingMsg(pObject);
+    }
+}
+
+void NFEvppNetMessage::ClearPendingMsg(NetEvppObject* pObject)
+{
+    if (pObject->m_scheduled)
+    {
+        m_activeLinks.erase(std::remove(m_activeLinks.begin(), m_activeLinks.end(), pObject), m_activeLinks.end());
+        pObject->m_scheduled = false;
+    }
+
+    if (pObject->m_pendingCount > 0 || pObject->m_dropMsgCount > 0)
+    {
+        NFLogWarning(NF_LOG_DEFAULT, 0, "net object:{} ip:{} released, discard pending msg:{}, drop msg:{}", pObject->m_usLinkId, pObject->m_strIp, pObject->m_pendingCount,
+                     pObject->m_dropMsgCount);
+    }
+    if (pObject->IsInternal())
+    {
+        m_internalPendingCount -= pObject->m_pendingCount;
+    }
+    pObject->m_pendingBuffer.Clear();
+    pObject->m_pendingCount = 0;
+}
+
+void NFEvppNetMessage::CheckLinkMsgStat()
+{
+    for (auto iter = m_netObjectMap.begin(); iter != m_netObjectMap.end(); ++iter)
+    {
+        NetEvppObject* pObject = iter->second;
+        if (pObject == nullptr)
+        {
+            continue;
+        }
+
+        if (pObject->m_dropMsgCount > 0 || pObject->m_deferMsgCount > 0)
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "net object:{} ip:{} internal:{} recv msg:{} drop msg:{} defer msg:{} max pending:{} cur pending:{}", pObject->m_usLinkId,
+                         pObject->m_strIp, pObject->IsInternal(), pObject->m_recvMsgCount, pObject->m_dropMsgCount, pObject->m_deferMsgCount, pObject->m_maxPendingCount,
+                         pObject->m_pendingCount);
+        }
+
+        pObject->m_recvMsgCount = 0;
+        pObject->m_dropMsgCount = 0;
+        pObject->m_deferMsgCount = 0;
+        pObject->m_maxPendingCount = pObject->m_pendingCount;
+        if (pObject->m_pendingCount == 0)
+        {
+            pObject->m_pendingBuffer.Shrink();
+        }
+    }
+}
 
 void NFEvppNetMessage::ProcessCodeQueue()
 {
     m_curHandleMsgNum = m_handleMsgNumPerFrame;
+    int32_t stageNum = m_handleMsgNumPerFrame * EVPP_STAGE_FRAME_FACTOR;
     for (size_t i = 0; i < m_recvCodeQueueList.size(); i++)
     {
         NF_SHARE_PTR<NFBuffer> pRecvBuffer = m_recvCodeQueueList[i];
         if (pRecvBuffer)
         {
             auto pQueue = reinterpret_cast<NFCodeQueue*>(pRecvBuffer->ReadAddr());
-            ProcessCodeQueue(pQueue);
+            ProcessCodeQueue(pQueue, stageNum);
         }
     }
+
+    ScheduleLinkMsg();
 }
 
 /**
@@ -243,7 +408,7 @@ void NFEvppNetMessage::ProcessCodeQueue()
 *
 * @return
 */
-void NFEvppNetMessage::ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t serverLinkId)
+void NFEvppNetMessage::ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t serverLinkId, const NF_SHARE_PTR<NFEncryptKey>& pKey)
 {
     if (conn->loop()->context(EVPP_LOOP_CONTEXT_0_MAIN_THREAD_RECV).IsEmpty())
     {
@@ -262,6 +427,7 @@ void NFEvppNetMessage::ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t
         while (!m_msgQueue.Enqueue(msg))
         {
         }
+        m_pObjPluginManager->Wakeup();
     }
 
     if (conn->loop()->context(EVPP_LOOP_CONTEXT_1_MAIN_THREAD_SEND).IsEmpty())
@@ -340,9 +506,22 @@ void NFEvppNetMessage::ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t
             pConnMap->emplace(msg.m_objectLinkId, msg.m_tcpConPtr);
         }
 
+        /**
+         * @brief 安全连接双方各自发送握手包, 之后发送的数据都用本方向的会话密钥加密
+         */
+        if (pKey)
+        {
+            NF_SHARE_PTR<NFConnCipher> pCipher = std::make_shared<NFConnCipher>();
+            char hello[NF_ENCRYPT_HELLO_SIZE];
+            pCipher->MakeHello(*pKey, hello);
+            conn->set_context(EVPP_CONN_CONTEXT_2_CIPHER, evpp::Any(pCipher));
+            conn->Send(hello, sizeof(hello));
+        }
+
         while (!m_msgQueue.Enqueue(msg))
         {
         }
+        m_pObjPluginManager->Wakeup();
     }
     else
     {
@@ -355,6 +534,7 @@ void NFEvppNetMessage::ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t
         msg.m_tcpConPtr = conn;
         msg.m_serverLinkId = serverLinkId;
         msg.m_type = eMsgType_DISCONNECTED;
+        conn->set_context(EVPP_CONN_CONTEXT_2_CIPHER, evpp::Any());
         /**
          * @brief 处理客户端连接服务器掉线
          */
@@ -405,6 +585,7 @@ void NFEvppNetMessage::ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t
         while (!m_msgQueue.Enqueue(msg))
         {
         }
+        m_pObjPluginManager->Wakeup();
     }
 }
 
@@ -413,13 +594,48 @@ void NFEvppNetMessage::ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t
 *
 * @return 消息回调
 */
-void NFEvppNetMessage::MessageCallback(const evpp::TCPConnPtr& conn, evpp::Buffer* msg, uint64_t serverLinkId, uint32_t packetParse, bool bSecurity)
+void NFEvppNetMessage::MessageCallback(const evpp::TCPConnPtr& conn, evpp::Buffer* msg, uint64_t serverLinkId, uint32_t packetParse, const NF_SHARE_PTR<NFEncryptKey>& pKey)
 {
     if (msg)
     {
-        if (bSecurity)
+        NF_SHARE_PTR<NFConnCipher> pCipher;
+        if (pKey)
         {
-            Decryption(const_cast<char*>(msg->data()), msg->size());
+            if (conn->context(EVPP_CONN_CONTEXT_2_CIPHER).IsEmpty())
+            {
+                NFLogError(NF_LOG_DEFAULT, 0, "security conn:{} has no cipher, drop data", conn->remote_addr());
+                msg->Reset();
+                return;
+            }
+
+            pCipher = evpp::any_cast<NF_SHARE_PTR<NFConnCipher>>(conn->context(EVPP_CONN_CONTEXT_2_CIPHER));
+            if (!pCipher->IsRecvReady())
+            {
+                if (msg->size() < NF_ENCRYPT_HELLO_SIZE)
+                {
+                    return;
+                }
+
+                if (pCipher->OnHello(*pKey, msg->data()) != 0)
+                {
+                    NFLogError(NF_LOG_DEFAULT, 0, "security conn:{} recv invalid hello, close it", conn->remote_addr());
+                    msg->Reset();
+                    conn->Close();
+                    return;
+                }
+                msg->Skip(NF_ENCRYPT_HELLO_SIZE);
+                if (msg->size() <= 0)
+                {
+                    return;
+                }
+            }
+
+            //上次剩下的半个包已经解密过, 只解密新收到的部分
+            if (msg->size() > pCipher->m_recvDecrypted)
+            {
+                pCipher->Decrypt(const_cast<char*>(msg->data()) + pCipher->m_recvDecrypted, msg->size() - pCipher->m_recvDecrypted);
+            }
+            pCipher->m_recvDecrypted = msg->size();
         }
 
         while (true)
@@ -462,6 +678,7 @@ void NFEvppNetMessage::MessageCallback(const evpp::TCPConnPtr& conn, evpp::Buffe
                         continue;
                     }
                     pComBuffer->Produce(decompressLen);
+                    codePackage.bCompress = false;
 
                     CHECK_EXPR_ASSERT_NOT_RET(!conn->loop()->context(EVPP_LOOP_CONTEXT_0_MAIN_THREAD_RECV).IsEmpty(), "conn->loop()->context(EVPP_LOOP_CONTEXT_0_MAIN_THREAD_RECV).IsEmpty(), Recv Code Queue Not Exist, Can't Parse Data");
                     NF_SHARE_PTR<NFBuffer> pRecvBuffer = evpp::any_cast<NF_SHARE_PTR<NFBuffer>>(conn->loop()->context(EVPP_LOOP_CONTEXT_0_MAIN_THREAD_RECV));
@@ -535,6 +752,14 @@ void NFEvppNetMessage::MessageCallback(const evpp::TCPConnPtr& conn, evpp::Buffe
                 }
             }
         }
+
+        if (pCipher)
+        {
+            pCipher->m_recvDecrypted = msg->size();
+        }
+
+        // 通知主线程有新消息
+        m_pObjPluginManager->Wakeup();
     }
 }
 
@@ -555,11 +780,16 @@ uint64_t NFEvppNetMessage::BindServer(const NFMessageFlag& flag)
 
         uint64_t unLinkId = GetFreeUnLinkId();
         pServer->SetLinkId(unLinkId);
+        NF_SHARE_PTR<NFEncryptKey> pKey;
+        if (flag.mSecurity)
+        {
+            pKey = std::make_shared<NFEncryptKey>(flag.mSecurityKey);
+        }
         pServer->SetConnCallback(
-            std::bind(&NFEvppNetMessage::ConnectionCallback, this, std::placeholders::_1, unLinkId));
+            std::bind(&NFEvppNetMessage::ConnectionCallback, this, std::placeholders::_1, unLinkId, pKey));
         pServer->SetMessageCallback(
             std::bind(&NFEvppNetMessage::MessageCallback, this, std::placeholders::_1, std::placeholders::_2,
-                      unLinkId, flag.mPacketParseType, flag.mSecurity));
+                      unLinkId, flag.mPacketParseType, pKey));
         if (pServer->Init())
         {
             m_connectionList.push_back(pServer);
@@ -602,8 +832,13 @@ uint64_t NFEvppNetMessage::ConnectServer(const NFMessageFlag& flag)
     {
         uint64_t unLinkId = GetFreeUnLinkId();
         pClient->SetLinkId(unLinkId);
-        pClient->SetConnCallback(std::bind(&NFEvppNetMessage::ConnectionCallback, this, std::placeholders::_1, unLinkId));
-        pClient->SetMessageCallback(std::bind(&NFEvppNetMessage::MessageCallback, this, std::placeholders::_1, std::placeholders::_2, unLinkId, flag.mPacketParseType, flag.mSecurity));
+        NF_SHARE_PTR<NFEncryptKey> pKey;
+        if (flag.mSecurity)
+        {
+            pKey = std::make_shared<NFEncryptKey>(flag.mSecurityKey);
+        }
+        pClient->SetConnCallback(std::bind(&NFEvppNetMessage::ConnectionCallback, this, std::placeholders::_1, unLinkId, pKey));
+        pClient->SetMessageCallback(std::bind(&NFEvppNetMessage::MessageCallback, this, std::placeholders::_1, std::placeholders::_2, unLinkId, flag.mPacketParseType, pKey));
 
         if (m_pObjPluginManager->IsLoadAllServer() && m_connectionThreadPool)
         {
@@ -719,6 +954,14 @@ NetEvppObject* NFEvppNetMessage::GetNetObject(uint64_t linkId) const
     return nullptr;
 }
 
+int NFEvppNetMessage::SetLinkCompress(uint64_t usLinkId, uint32_t compressType, uint32_t minSize)
+{
+    NetEvppObject* pObject = GetNetObject(usLinkId);
+    CHECK_EXPR(pObject, -1, "GetNetObject Failed, usLinkId:{}", usLinkId);
+    pObject->SetCompress(compressType, minSize);
+    return 0;
+}
+
 void NFEvppNetMessage::CloseLinkId(uint64_t usLinkId)
 {
     auto pObject = GetNetObject(usLinkId);
@@ -836,6 +1079,8 @@ bool NFEvppNetMessage::Finalize()
     }
 
     m_recvCodeQueueList.clear();
+    m_activeLinks.clear();
+    m_frameFullLinks.clear();
 
     return true;
 }
@@ -952,6 +1197,20 @@ void NFEvppNetMessage::OnHandleMsgPeer(eMsgType type, uint64_t serverLinkId, uin
         break;
     case eMsgType_DISCONNECTED:
         {
+            // 断开前已经收到的内网消息先交给逻辑处理, 保证断开事件在这些消息之后
+            if (objectLinkId > 0)
+            {
+                uint32_t linkIndex = GetServerIndexFromUnlinkId(objectLinkId);
+                if (linkIndex > 0)
+                {
+                    NetEvppObject* pLinkObject = GetNetObject(objectLinkId);
+                    if (pLinkObject)
+                    {
+                        FlushPendingMsg(pLinkObject);
+                    }
+                }
+            }
+
             if (m_eventCb)
             {
                 m_eventCb(type, serverLinkId, objectLinkId);
@@ -977,6 +1236,7 @@ void NFEvppNetMessage::OnHandleMsgPeer(eMsgType type, uint64_t serverLinkId, uin
                     CHECK_EXPR_ASSERT_NOT_RET(index > 0 && index < m_netObjectArray.size(), "unLinkId:{} index:{} Error", objectLinkId, index);
                     CHECK_EXPR_ASSERT_NOT_RET(m_netObjectMap.find(objectLinkId) != m_netObjectMap.end(), "unLinkId:{} index:{} Error", objectLinkId, index);
                     m_netObjectArray[index] = nullptr;
+                    ClearPendingMsg(pObject);
                     m_netObjectPool.FreeObj(pObject);
                     m_netObjectMap.erase(objectLinkId);
                     while (!m_freeLinks.Enqueue(objectLinkId))
@@ -1001,6 +1261,8 @@ bool NFEvppNetMessage::Send(NetEvppObject* pObject, NFDataPackage& packet, const
     {
         packet.nPacketParseType = pObject->m_packetParseType;
         packet.isSecurity = pObject->IsSecurity();
+        packet.nCompressType = pObject->GetCompressType();
+        packet.bCompress = packet.nCompressType != NF_PACKET_COMPRESS_NONE && nLen >= pObject->GetCompressMinSize();
         packet.nObjectLinkId = pObject->GetLinkId();
         packet.nMsgLen = nLen;
         CHECK_EXPR_ASSERT(!pObject->m_connPtr->loop()->context(EVPP_LOOP_CONTEXT_1_MAIN_THREAD_SEND).IsEmpty(), false, "pConn->loop()->context(EVPP_LOOP_CONTEXT_1_MAIN_THREAD_SEND).IsEmpty() ERROR");
@@ -1044,6 +1306,7 @@ int NFEvppNetMessage::OnTimer(uint32_t timerId)
     else if (timerId == ENUM_SERVER_TIMER_CHECK_HEART)
     {
         CheckServerHeartBeat();
+        CheckLinkMsgStat();
     }
     return 0;
 }
@@ -1186,9 +1449,17 @@ void NFEvppNetMessage::LoopSend(evpp::EventLoop* loop)
         NFPacketParseMgr::EnCode(parsePackageType, *pCodePackage, pCodeQueueBuffer->ReadAddr() + sizeof(NFDataPackage), pCodePackage->nMsgLen, *pComBuffer);
         pCodeQueueBuffer->Clear();
 
+        //在压缩缓冲区上原地加密, 不再拷贝一次
         if (isSecurity)
         {
-            Encryption(pComBuffer->ReadAddr(), pComBuffer->ReadableSize());
+            if (pConn->context(EVPP_CONN_CONTEXT_2_CIPHER).IsEmpty())
+            {
+                NFLogError(NF_LOG_DEFAULT, 0, "security objectLinkId:{} has no cipher, drop msg", iter->first);
+                pComBuffer->Clear();
+                continue;
+            }
+            NF_SHARE_PTR<NFConnCipher> pCipher = evpp::any_cast<NF_SHARE_PTR<NFConnCipher>>(pConn->context(EVPP_CONN_CONTEXT_2_CIPHER));
+            pCipher->Encrypt(pComBuffer->ReadAddr(), pComBuffer->ReadableSize());
         }
 
         pConn->Send(pComBuffer->ReadAddr(), pComBuffer->ReadableSize());
@@ -28,6 +28,8 @@
 // -------------------------------------------------------------------------
 #pragma once
 
+#include <deque>
+
 #include "NetEvppObject.h"
 #include "NFCHttpClient.h"
 #include "NFCHttpServer.h"
@@ -40,6 +42,7 @@
 #include "NFComm/NFCore/NFQueue.hpp"
 #include "NFComm/NFPluginModule/NFCodeQueue.h"
 #include "NFComm/NFPluginModule/NFNetDefine.h"
+#include "NFCommPlugin/NFNetPlugin/Encrypt.h"
 
 #define EVPP_LOOP_CONTEXT_0_MAIN_THREAD_RECV 0
 #define EVPP_LOOP_CONTEXT_1_MAIN_THREAD_SEND 1
@@ -47,6 +50,23 @@
 #define EVPP_LOOP_CONTEXT_3_CONNPTR_MAP 3
 #define EVPP_LOOP_CONTEXT_4_CODE_QUEUE_BUFFER 4
 
+//连接上的context, 0是linkId, 1用来标记GetFreeUnLinkId失败
+#define EVPP_CONN_CONTEXT_2_CIPHER 2
+
+//主线程按连接做差额轮询(DRR), 每轮内网连接(服务器之间)可处理的消息数高于外网连接
+#define EVPP_LINK_QUANTUM_INTERNAL 64
+#define EVPP_LINK_QUANTUM_EXTERNAL 4
+//单个外网连接每帧最多处理的消息数, 内网连接只受整帧预算限制
+#define EVPP_LINK_FRAME_MAX_EXTERNAL 32
+//单个外网连接最多积压的消息数, 超出后丢弃新消息
+#define EVPP_LINK_MAX_PENDING_EXTERNAL 1024
+//每帧从网络线程收包队列最多分拣的消息数 = 每帧处理的消息数 * 该倍数
+#define EVPP_STAGE_FRAME_FACTOR 4
+//内网连接积压的消息总数达到 每帧处理的消息数 * 该倍数 时暂停分拣, 剩下的留在收包队列里, 由收包队列反压网络线程
+#define EVPP_PENDING_HIGH_WATER_FACTOR 8
+//连接待处理队列中每条消息的对齐
+#define EVPP_PENDING_ALIGN(len) (((len) + 7) & ~static_cast<size_t>(7))
+
 
 struct MsgFromNetInfo final
 {
@@ -158,18 +178,19 @@ public:
     uint64_t BindHttpServer(uint32_t listenPort, uint32_t netThreadNum);
 
     /**
-    * @brief 连接回调
+    * @brief 连接回调, 安全连接建立后先发送握手包
     *
+    * @param pKey 安全连接的主密钥, 非安全连接为空
     * @return
     */
-    void ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t serverLinkId);
+    void ConnectionCallback(const evpp::TCPConnPtr& conn, uint64_t serverLinkId, const NF_SHARE_PTR<NFEncryptKey>& pKey);
 
     /**
     * @brief 消息回调
     *
     * @return 消息回调
     */
-    void MessageCallback(const evpp::TCPConnPtr& conn, evpp::Buffer* msg, uint64_t serverLinkId, uint32_t packetParse, bool bSecurity);
+    void MessageCallback(const evpp::TCPConnPtr& conn, evpp::Buffer* msg, uint64_t serverLinkId, uint32_t packetParse, const NF_SHARE_PTR<NFEncryptKey>& pKey);
 
     /**
     * @brief	关闭客户端
@@ -209,6 +230,8 @@ public:
     */
     void CloseLinkId(uint64_t usLinkId) override;
 
+    int SetLinkCompress(uint64_t usLinkId, uint32_t compressType, uint32_t minSize) override;
+
     /**
      * @brief 获得一个可用的ID
      *
@@ -311,22 +334,54 @@ protected:
     void ProcessMsgLogicThread();
 
     /**
-     * @brief 处理代码队列的默认函数。
+     * @brief 处理所有网络线程的收包队列。
      *
-     * 该函数用于处理默认的代码队列。它不接收任何参数，也不返回任何值。
-     * 通常用于处理全局或默认的代码队列。
+     * 先把收包队列中的消息分拣到各连接的待处理队列, 再按连接做差额轮询,
+     * 单个连接刷包时不会占满整帧的预算, 内网连接优先于外网连接。
      */
     void ProcessCodeQueue();
 
     /**
-     * @brief 处理指定的代码队列。
+     * @brief 把指定收包队列中的消息分拣到各连接的待处理队列。
+     *
+     * 外网连接积压超过EVPP_LINK_MAX_PENDING_EXTERNAL时丢弃新消息, 内网连接不丢弃,
+     * 内网连接积压的总数达到高水位时停止分拣。
+     *
+     * @param pRecvQueue 网络线程的收包队列
+     * @param stageNum 本帧还可以分拣的消息数
+     */
+    void ProcessCodeQueue(NFCodeQueue* pRecvQueue, int32_t& stageNum);
+
+    /**
+     * @brief 按差额轮询处理各连接积压的消息, 直到队列为空或本帧预算用完
+     */
+    void ScheduleLinkMsg();
+
+    /**
+     * @brief 处理连接待处理队列中的第一条消息
      *
-     * 该函数用于处理传入的特定代码队列。它接收一个指向NFCodeQueue结构的指针作为参数，
-     * 并对该队列中的代码进行处理。函数不返回任何值。
+     * @param pObject 网络对象
+     */
+    void HandlePendingMsg(NetEvppObject* pObject);
+
+    /**
+     * @brief 内网连接断开时, 先把积压的消息全部交给逻辑处理, 再通知断开
      *
-     * @param pRecvQueue 指向要处理的NFCodeQueue结构的指针。该队列包含待处理的代码。
+     * @param pObject 网络对象
      */
-    void ProcessCodeQueue(NFCodeQueue* pRecvQueue);
+    void FlushPendingMsg(NetEvppObject* pObject);
+
+    /**
+     * @brief 网络对象释放前, 丢弃未处理的消息并移出调度队列
+     *
+     * @param pObject 网络对象
+     */
+    void ClearPendingMsg(NetEvppObject* pObject);
+
+    /**
+     * @brief 输出统计周期内有丢弃或延后处理的连接, 并重置统计
+     */
+    void CheckLinkMsgStat();
 
     /**
      * @brief	对解析出来的数据进行处理
@@ -437,5 +492,20 @@ private:
      */
     int32_t m_curHandleMsgNum;
 
+    /**
+     * @brief 有待处理消息的连接, 按差额轮询调度
+     */
+    std::deque<NetEvppObject*> m_activeLinks;
+
+    /**
+     * @brief 本帧已达到单连接上限的连接, 帧末放回调度队列
+     */
+    std::vector<NetEvppObject*> m_frameFullLinks;
+
+    /**
+     * @brief 所有内网连接积压的消息数, 用来判断分拣的高水位
+     */
+    uint32_t m_internalPendingCount;
+
     std::atomic<int> m_loopSendCount;
 };
@@ -64,6 +64,10 @@ public:
 
 	virtual bool IsSecurity() const { return m_flag.mSecurity; }
 
+	virtual uint32_t GetCompressType() const { return m_flag.mCompressType; }
+
+	virtual uint32_t GetCompressMinSize() const { return m_flag.mCompressMinSize; }
+
 	virtual uint32_t GetConnectionType() { return m_connectionType; }
 
 	virtual void SetConnectionType(uint32_t type) { m_connectionType = type; }
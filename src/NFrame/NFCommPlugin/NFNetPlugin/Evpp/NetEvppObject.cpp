@@ -18,6 +18,16 @@ NetEvppObject::NetEvppObject(const evpp::TCPConnPtr& conn) : m_usLinkId(0), m_ne
 	m_lastHeartBeatTime = NFGetTime();
 	m_port = 0;
 	m_security = false;
+	m_compressType = NF_PACKET_COMPRESS_NONE;
+	m_compressMinSize = NF_PACKET_COMPRESS_MIN_SIZE;
+	m_pendingCount = 0;
+	m_deficit = 0;
+	m_scheduled = false;
+	m_frameHandleNum = 0;
+	m_recvMsgCount = 0;
+	m_dropMsgCount = 0;
+	m_deferMsgCount = 0;
+	m_maxPendingCount = 0;
 }
 
 NetEvppObject::~NetEvppObject()
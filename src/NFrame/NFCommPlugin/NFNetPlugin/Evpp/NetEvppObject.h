@@ -30,6 +30,7 @@
 
 #include <cstdint>
 
+#include "NFComm/NFCore/NFBuffer.h"
 #include "NFComm/NFPluginModule/NFNetDefine.h"
 #include "evpp/tcp_conn.h"
 #include "evpp/event_loop.h"
@@ -137,6 +138,20 @@ public:
 
     bool IsSecurity() const { return m_security; }
 
+    /**
+    * @brief 设置发送压缩算法, 大于等于minSize的包在网络线程编码时压缩
+    */
+    void SetCompress(uint32_t compressType, uint32_t minSize) { m_compressType = compressType; m_compressMinSize = minSize; }
+
+    uint32_t GetCompressType() const { return m_compressType; }
+
+    uint32_t GetCompressMinSize() const { return m_compressMinSize; }
+
+    /**
+    * @brief 是否是内网连接(服务器之间), 调度时优先
+    */
+    bool IsInternal() const { return m_packetParseType == PACKET_PARSE_TYPE_INTERNAL; }
+
 protected:
     /**
      * @brief	代表客户端连接的唯一ID
@@ -175,4 +190,43 @@ protected:
     uint64_t m_lastHeartBeatTime;
 
     bool m_security;
+
+    /**
+    * @brief 发送压缩算法和压缩的最小包长
+    */
+    uint32_t m_compressType;
+    uint32_t m_compressMinSize;
+
+    /**
+    * @brief 已从网络线程收包队列取出, 等待主线程处理的消息, 每条按8字节对齐
+    */
+    NFBuffer m_pendingBuffer;
+
+    /**
+    * @brief 待处理的消息数
+    */
+    uint32_t m_pendingCount;
+
+    /**
+    * @brief 差额轮询的剩余额度
+    */
+    int32_t m_deficit;
+
+    /**
+    * @brief 是否在调度队列中
+    */
+    bool m_scheduled;
+
+    /**
+    * @brief 当前帧已处理的消息数
+    */
+    uint32_t m_frameHandleNum;
+
+    /**
+    * @brief 统计周期内收到/丢弃/延后到下一帧的消息数, 以及最大积压
+    */
+    uint64_t m_recvMsgCount;
+    uint64_t m_dropMsgCount;
+    uint64_t m_deferMsgCount;
+    uint32_t m_maxPendingCount;
 };
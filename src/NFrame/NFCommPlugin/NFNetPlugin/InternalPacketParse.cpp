@@ -9,6 +9,7 @@
 #include "InternalPacketParse.h"
 #include "NFComm/NFPluginModule/NFNetDefine.h"
 #include "NFComm/NFPluginModule/NFLogMgr.h"
+#include "NFPacketCompress.h"
 
 #pragma pack(push)
 #pragma pack(1)
@@ -128,6 +129,7 @@ int InternalPacketParse::DeCodeImpl(const char* strData, uint32_t unLen, char*&
     recvPackage.nDstId = packHead->m_dstId;
     recvPackage.nErrCode = packHead->m_errCode;
     recvPackage.nSendBusLinkId = packHead->m_sendBusLinkId;
+    recvPackage.bCompress = packHead->IsCompressed();
     allLen = sizeof(InternalMsg) + msgSize;
     return 0;
 }
@@ -145,8 +147,41 @@ int InternalPacketParse::EnCodeImpl(const NFDataPackage& recvPackage, const char
     packHead.m_sendBusLinkId = nSendBusLinkId;
     packHead.m_errCode = recvPackage.nErrCode;
 
+    //直接压缩到输出缓冲区的包头后面, 压不小就发原始数据
+    if (recvPackage.bCompress)
+    {
+        buffer.AssureSpace(sizeof(InternalMsg) + unLen);
+        int compressLen = CompressImpl(recvPackage.nCompressType, strData, unLen, buffer.WriteAddr() + sizeof(InternalMsg), unLen);
+        if (compressLen > 0)
+        {
+            packHead.SetCompress();
+            packHead.SetLength(compressLen);
+            memcpy(buffer.WriteAddr(), &packHead, sizeof(InternalMsg));
+            buffer.Produce(sizeof(InternalMsg) + compressLen);
+            return packHead.m_length;
+        }
+    }
+
     buffer.PushData(&packHead, sizeof(InternalMsg));
     buffer.PushData(strData, unLen);
 
     return packHead.m_length;
 }
+
+int InternalPacketParse::CompressImpl(uint32_t compressType, const char* inBuffer, int inLen, void* outBuffer, unsigned int outSize)
+{
+    if (inLen <= 0)
+    {
+        return -1;
+    }
+    return NFPacketCompress::Compress(compressType, inBuffer, inLen, static_cast<char*>(outBuffer), outSize);
+}
+
+int InternalPacketParse::DecompressImpl(const char* inBuffer, int inLen, void* outBuffer, int outSize)
+{
+    if (inLen <= 0 || outSize <= 0)
+    {
+        return -1;
+    }
+    return NFPacketCompress::Decompress(inBuffer, inLen, static_cast<char*>(outBuffer), outSize);
+}
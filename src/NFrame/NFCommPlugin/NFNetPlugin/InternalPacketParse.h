@@ -17,4 +17,7 @@ public:
 	////////////////////////////////////////////////////////////////////
 	int DeCodeImpl(const char* strData, uint32_t unLen, char*& outData, uint32_t& outLen, uint32_t& allLen, NFDataPackage& recvPackage) override;
 	int EnCodeImpl(const NFDataPackage& recvPackage, const char* strData, uint32_t unLen, NFBuffer& buffer, uint64_t nSendBusLinkId = 0) override;
+
+	int CompressImpl(uint32_t compressType, const char* inBuffer, int inLen, void* outBuffer, unsigned int outSize) override;
+	int DecompressImpl(const char* inBuffer, int inLen, void* outBuffer, int outSize) override;
 };
@@ -12,6 +12,7 @@
 
 #include "NFEmailSender.h"
 #include "NFPacketParseMgr.h"
+#include "NFPacketCompress.h"
 #include "Bus/NFCBusMessage.h"
 #include "Enet/NFEnetMessage.h"
 #include "Evpp/NFEvppNetMessage.h"
@@ -214,6 +215,8 @@ uint64_t NFCNetModule::ConnectServer(NF_SERVER_TYPE serverType, const std::strin
 			flag.nPort = addr.mPort;
 			flag.mPacketParseType = packetParseType;
 			flag.mSecurity = security;
+			flag.mSecurityKey = GetSecurityKey(serverType);
+			flag.mCompressType = GetCompressPolicy(serverType);
 
 			NFINetMessage* pServer = m_evppServerArray[serverType];
 			if (!pServer)
@@ -323,6 +326,8 @@ uint64_t NFCNetModule::BindServer(NF_SERVER_TYPE serverType, const std::string&
 			flag.nNetThreadNum = netThreadNum;
 			flag.mMaxConnectNum = maxConnectNum;
 			flag.mSecurity = security;
+			flag.mSecurityKey = GetSecurityKey(serverType);
+			flag.mCompressType = GetCompressPolicy(serverType);
 			if (addr.mScheme == "http")
 			{
 				flag.bHttp = true;
@@ -560,6 +565,39 @@ void NFCNetModule::CloseLinkId(uint64_t linkId)
 	NFLogError(NF_LOG_DEFAULT, 0, "CloseLinkId error, usLinkId:{} not exist!", linkId);
 }
 
+int NFCNetModule::SetLinkCompress(uint64_t linkId, uint32_t compressType, uint32_t minSize)
+{
+	CHECK_EXPR(compressType == NF_PACKET_COMPRESS_NONE || NFPacketCompress::IsValidType(compressType), -1, "compressType:{} error", compressType);
+	uint32_t serverType = GetServerTypeFromUnlinkId(linkId);
+	CHECK_EXPR(serverType > NF_ST_NONE && serverType < NF_ST_MAX, -1, "usLinkId:{} serverType:{} error", linkId, serverType);
+	uint32_t linkMode = GetServerLinkModeFromUnlinkId(linkId);
+	CHECK_EXPR(linkMode == NF_IS_NET, -1, "usLinkId:{} is not tcp link, can't compress", linkId);
+
+	auto pServer = m_evppServerArray[serverType];
+	CHECK_EXPR(pServer, -1, "SetLinkCompress error, usLinkId:{} not exist!", linkId);
+	return pServer->SetLinkCompress(linkId, compressType, minSize);
+}
+
+uint32_t NFCNetModule::GetCompressPolicy(NF_SERVER_TYPE serverType)
+{
+	NFServerConfig* pConfig = FindModule<NFIConfigModule>()->GetAppConfig(serverType);
+	if (pConfig && NFPacketCompress::IsValidType(pConfig->EncryptConfig.CompressPolicy))
+	{
+		return pConfig->EncryptConfig.CompressPolicy;
+	}
+	return NF_PACKET_COMPRESS_NONE;
+}
+
+std::string NFCNetModule::GetSecurityKey(NF_SERVER_TYPE serverType)
+{
+	NFServerConfig* pConfig = FindModule<NFIConfigModule>()->GetAppConfig(serverType);
+	if (pConfig)
+	{
+		return pConfig->EncryptConfig.EncrypyKey;
+	}
+	return std::string();
+}
+
 void NFCNetModule::Send(uint64_t linkId, uint32_t moduleId, uint32_t msgId, const std::string& strData, uint64_t param1, uint64_t param2, uint64_t srcId, uint64_t dstId)
 {
 	NFDataPackage packet;
@@ -184,6 +184,8 @@ public:
 	*/
 	void CloseLinkId(uint64_t linkId) override;
 
+	int SetLinkCompress(uint64_t linkId, uint32_t compressType, uint32_t minSize = NF_PACKET_COMPRESS_MIN_SIZE) override;
+
 	void Send(uint64_t linkId, uint32_t moduleId, uint32_t msgId, const std::string& strData, uint64_t param1, uint64_t param2 = 0, uint64_t srcId = 0, uint64_t dstId = 0) override;
 
 	void Send(uint64_t linkId, uint32_t moduleId, uint32_t msgId, const char* msg, uint32_t len, uint64_t param1, uint64_t param2 = 0, uint64_t srcId = 0, uint64_t dstId = 0) override;
@@ -219,6 +221,16 @@ protected:
 	bool Send(NFINetMessage* pServer, uint64_t linkId, NFDataPackage& packet, const char* msg, uint32_t len);
 	bool Send(NFINetMessage* pServer, uint64_t linkId, NFDataPackage& packet, const google::protobuf::Message& data);
 
+	/**
+	 * @brief 服务器配置EncryptConfig.CompressPolicy指定的tcp链接默认压缩算法
+	 */
+	uint32_t GetCompressPolicy(NF_SERVER_TYPE serverType);
+
+	/**
+	 * @brief 服务器配置EncryptConfig.EncrypyKey, 安全连接的主密钥
+	 */
+	std::string GetSecurityKey(NF_SERVER_TYPE serverType);
+
 private:
 	/**
 	 * @brief	处理接受数据的回调
@@ -194,6 +194,16 @@ public:
      */
     virtual void CloseLinkId(uint64_t linkId) = 0;
 
+    /**
+     * 设置指定链接发送时的压缩算法, 一般在握手协商之后调用
+     *
+     * @param linkId 链接ID
+     * @param compressType 压缩算法, NF_PACKET_COMPRESS_TYPE, NF_PACKET_COMPRESS_NONE表示不压缩
+     * @param minSize 小于这个长度的包不压缩
+     * @return 0成功, 不支持压缩的链接返回-1
+     */
+    virtual int SetLinkCompress(uint64_t linkId, uint32_t compressType, uint32_t minSize) { return -1; }
+
     /**
      * 获取服务器类型
      *
@@ -0,0 +1,327 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFPacketCompress.cpp
+//    @Author           :    gaoyi
+//    @Date             :   2025-05-20
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFNetPlugin
+//
+// -------------------------------------------------------------------------
+
+#include "NFPacketCompress.h"
+#include <string.h>
+#include <zlib.h>
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include "lzf/lzf.h"
+
+std::string NFPacketCompress::m_zlibDict;
+
+//训练字典时的短串长度和片段长度
+#define NF_PACKET_COMPRESS_TRAIN_GRAM 8
+#define NF_PACKET_COMPRESS_TRAIN_SEGMENT 64
+
+/**
+ * @brief 每个线程一份zlib流, 初始化一次, 之后每个包只Reset
+ */
+struct NFZlibContext
+{
+    NFZlibContext() : m_deflateInit(false), m_inflateInit(false)
+    {
+        memset(&m_deflate, 0, sizeof(m_deflate));
+        memset(&m_inflate, 0, sizeof(m_inflate));
+    }
+
+    ~NFZlibContext()
+    {
+        if (m_deflateInit)
+        {
+            deflateEnd(&m_deflate);
+        }
+        if (m_inflateInit)
+        {
+            inflateEnd(&m_inflate);
+        }
+    }
+
+    z_stream* GetDeflate()
+    {
+        if (!m_deflateInit)
+        {
+            if (deflateInit(&m_deflate, NF_PACKET_COMPRESS_ZLIB_LEVEL) != Z_OK)
+            {
+                return nullptr;
+            }
+            m_deflateInit = true;
+        }
+        else if (deflateReset(&m_deflate) != Z_OK)
+        {
+            return nullptr;
+        }
+        return &m_deflate;
+    }
+
+    z_stream* GetInflate()
+    {
+        if (!m_inflateInit)
+        {
+            if (inflateInit(&m_inflate) != Z_OK)
+            {
+                return nullptr;
+            }
+            m_inflateInit = true;
+        }
+        else if (inflateReset(&m_inflate) != Z_OK)
+        {
+            return nullptr;
+        }
+        return &m_inflate;
+    }
+
+    z_stream m_deflate;
+    z_stream m_inflate;
+    bool m_deflateInit;
+    bool m_inflateInit;
+};
+
+static thread_local NFZlibContext s_zlibContext;
+
+int NFPacketCompress::Compress(uint32_t type, const char* inBuffer, uint32_t inLen, char* outBuffer, uint32_t outSize)
+{
+    if (inBuffer == nullptr || outBuffer == nullptr || inLen == 0 || outSize <= sizeof(NFPacketCompressHead) + 1)
+    {
+        return -1;
+    }
+
+    //压缩后至少要比outSize小一个字节才划算
+    uint32_t bodySize = outSize - sizeof(NFPacketCompressHead) - 1;
+    char* pBody = outBuffer + sizeof(NFPacketCompressHead);
+    uint32_t bodyLen = 0;
+    switch (type)
+    {
+        case NF_PACKET_COMPRESS_LZF:
+        {
+            bodyLen = lzf_compress(inBuffer, inLen, pBody, bodySize);
+            if (bodyLen == 0)
+            {
+                return -1;
+            }
+        }
+        break;
+        case NF_PACKET_COMPRESS_ZLIB:
+        {
+            z_stream* pStream = s_zlibContext.GetDeflate();
+            if (pStream == nullptr)
+            {
+                return -1;
+            }
+
+            if (!m_zlibDict.empty() && deflateSetDictionary(pStream, reinterpret_cast<const Bytef*>(m_zlibDict.data()), m_zlibDict.size()) != Z_OK)
+            {
+                return -1;
+            }
+
+            pStream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(inBuffer));
+            pStream->avail_in = inLen;
+            pStream->next_out = reinterpret_cast<Bytef*>(pBody);
+            pStream->avail_out = bodySize;
+            if (deflate(pStream, Z_FINISH) != Z_STREAM_END)
+            {
+                return -1;
+            }
+            bodyLen = pStream->total_out;
+        }
+        break;
+        default:
+            return -1;
+    }
+
+    NFPacketCompressHead head;
+    head.m_type = type;
+    head.m_rawLen = inLen;
+    memcpy(outBuffer, &head, sizeof(head));
+    return sizeof(NFPacketCompressHead) + bodyLen;
+}
+
+int NFPacketCompress::Decompress(const char* inBuffer, uint32_t inLen, char* outBuffer, uint32_t outSize)
+{
+    if (inBuffer == nullptr || outBuffer == nullptr || inLen <= sizeof(NFPacketCompressHead))
+    {
+        return -1;
+    }
+
+    NFPacketCompressHead head;
+    memcpy(&head, inBuffer, sizeof(head));
+    if (head.m_rawLen > outSize)
+    {
+        return -1;
+    }
+
+    const char* pBody = inBuffer + sizeof(NFPacketCompressHead);
+    uint32_t bodyLen = inLen - sizeof(NFPacketCompressHead);
+    switch (head.m_type)
+    {
+        case NF_PACKET_COMPRESS_LZF:
+        {
+            if (lzf_decompress(pBody, bodyLen, outBuffer, head.m_rawLen) != head.m_rawLen)
+            {
+                return -1;
+            }
+        }
+        break;
+        case NF_PACKET_COMPRESS_ZLIB:
+        {
+            z_stream* pStream = s_zlibContext.GetInflate();
+            if (pStream == nullptr)
+            {
+                return -1;
+            }
+
+            pStream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(pBody));
+            pStream->avail_in = bodyLen;
+            pStream->next_out = reinterpret_cast<Bytef*>(outBuffer);
+            pStream->avail_out = head.m_rawLen;
+            int ret = inflate(pStream, Z_FINISH);
+            if (ret == Z_NEED_DICT)
+            {
+                //字典的adler32校验由zlib完成, 两端字典不一致这里会失败
+                if (m_zlibDict.empty() || inflateSetDictionary(pStream, reinterpret_cast<const Bytef*>(m_zlibDict.data()), m_zlibDict.size()) != Z_OK)
+                {
+                    return -1;
+                }
+                ret = inflate(pStream, Z_FINISH);
+            }
+
+            if (ret != Z_STREAM_END || pStream->total_out != head.m_rawLen)
+            {
+                return -1;
+            }
+        }
+        break;
+        default:
+            return -1;
+    }
+
+    return head.m_rawLen;
+}
+
+int NFPacketCompress::SetZlibDict(const std::string& dict)
+{
+    if (dict.size() > NF_PACKET_COMPRESS_MAX_DICT_SIZE)
+    {
+        return -1;
+    }
+
+    m_zlibDict = dict;
+    return 0;
+}
+
+std::string NFPacketCompress::TrainZlibDict(const std::vector<std::string>& vecSample, uint32_t dictSize)
+{
+    if (dictSize > NF_PACKET_COMPRESS_MAX_DICT_SIZE)
+    {
+        dictSize = NF_PACKET_COMPRESS_MAX_DICT_SIZE;
+    }
+
+    //短串出现在多少个样本里, second记录最后一次计数的样本, 同一个样本只算一次
+    std::unordered_map<uint64_t, std::pair<uint32_t, uint32_t>> mapGram;
+    for (uint32_t i = 0; i < vecSample.size(); i++)
+    {
+        const std::string& sample = vecSample[i];
+        for (size_t pos = 0; pos + NF_PACKET_COMPRESS_TRAIN_GRAM <= sample.size(); pos++)
+        {
+            uint64_t gram = 0;
+            memcpy(&gram, sample.data() + pos, NF_PACKET_COMPRESS_TRAIN_GRAM);
+            auto iter = mapGram.find(gram);
+            if (iter == mapGram.end())
+            {
+                mapGram.emplace(gram, std::make_pair(1u, i));
+            }
+            else if (iter->second.second != i)
+            {
+                iter->second.first++;
+                iter->second.second = i;
+            }
+        }
+    }
+
+    //只在一个样本里出现的短串对字典没有用处
+    auto scoreFunc = [&mapGram](const char* pData, size_t len) -> uint64_t
+    {
+        uint64_t score = 0;
+        for (size_t pos = 0; pos + NF_PACKET_COMPRESS_TRAIN_GRAM <= len; pos++)
+        {
+            uint64_t gram = 0;
+            memcpy(&gram, pData + pos, NF_PACKET_COMPRESS_TRAIN_GRAM);
+            auto iter = mapGram.find(gram);
+            if (iter != mapGram.end() && iter->second.first > 1)
+            {
+                score += iter->second.first;
+            }
+        }
+        return score;
+    };
+
+    //(得分, 样本, 偏移), 选中一个片段后其他片段的得分只会变小, 取出时重新计算, 变小了就放回去
+    typedef std::pair<uint64_t, std::pair<uint32_t, uint32_t>> SegmentScore;
+    std::priority_queue<SegmentScore> queSegment;
+    for (uint32_t i = 0; i < vecSample.size(); i++)
+    {
+        const std::string& sample = vecSample[i];
+        for (size_t pos = 0; pos < sample.size(); pos += NF_PACKET_COMPRESS_TRAIN_SEGMENT)
+        {
+            size_t len = std::min<size_t>(NF_PACKET_COMPRESS_TRAIN_SEGMENT, sample.size() - pos);
+            uint64_t score = scoreFunc(sample.data() + pos, len);
+            if (score > 0)
+            {
+                queSegment.push(SegmentScore(score, std::make_pair(i, static_cast<uint32_t>(pos))));
+            }
+        }
+    }
+
+    std::vector<std::string> vecSelect;
+    uint32_t totalSize = 0;
+    while (!queSegment.empty() && totalSize < dictSize)
+    {
+        SegmentScore top = queSegment.top();
+        queSegment.pop();
+
+        const std::string& sample = vecSample[top.second.first];
+        size_t pos = top.second.second;
+        size_t len = std::min<size_t>(NF_PACKET_COMPRESS_TRAIN_SEGMENT, sample.size() - pos);
+        uint64_t score = scoreFunc(sample.data() + pos, len);
+        if (score == 0)
+        {
+            continue;
+        }
+
+        if (score < top.first && !queSegment.empty() && score < queSegment.top().first)
+        {
+            queSegment.push(SegmentScore(score, top.second));
+            continue;
+        }
+
+        len = std::min<size_t>(len, dictSize - totalSize);
+        vecSelect.push_back(sample.substr(pos, len));
+        totalSize += len;
+
+        for (size_t i = pos; i + NF_PACKET_COMPRESS_TRAIN_GRAM <= pos + len; i++)
+        {
+            uint64_t gram = 0;
+            memcpy(&gram, sample.data() + i, NF_PACKET_COMPRESS_TRAIN_GRAM);
+            auto iter = mapGram.find(gram);
+            if (iter != mapGram.end())
+            {
+                iter->second.first = 0;
+            }
+        }
+    }
+
+    std::string dict;
+    dict.reserve(totalSize);
+    for (auto iter = vecSelect.rbegin(); iter != vecSelect.rend(); ++iter)
+    {
+        dict.append(*iter);
+    }
+    return dict;
+}
@@ -0,0 +1,81 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFPacketCompress.h
+//    @Author           :    gaoyi
+//    @Date             :   2025-05-20
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFNetPlugin
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "NFComm/NFPluginModule/NFServerDefine.h"
+
+#define NF_PACKET_COMPRESS_ZLIB_LEVEL 6
+
+//zlib的窗口只有32K, 再大的字典也用不上
+#define NF_PACKET_COMPRESS_MAX_DICT_SIZE (32 * 1024)
+
+#pragma pack(push)
+#pragma pack(1)
+
+/**
+ * @brief 压缩数据头, 放在压缩后的包体前面, 解压时据此选择算法
+ */
+struct NFPacketCompressHead
+{
+    uint8_t m_type;
+    uint32_t m_rawLen;
+};
+
+#pragma pack(pop)
+
+/**
+ * @brief 网络包压缩
+ *
+ * 压缩后的数据 = NFPacketCompressHead + 算法输出。压缩在网络线程上进行, zlib的流对象每个线程一份, 复用不重复分配。
+ * zlib字典需要收发两端一致, 必须在网络线程启动之前设置, 运行中不能修改
+ */
+class NFPacketCompress
+{
+public:
+    /**
+     * @brief 压缩
+     * @param type NF_PACKET_COMPRESS_TYPE
+     * @param outSize 输出缓冲区大小, 压缩后不小于这个长度就算失败
+     * @return 压缩后的长度(含压缩头), 失败或者压缩后不比outSize小返回-1, 调用方直接发原始数据
+     */
+    static int Compress(uint32_t type, const char* inBuffer, uint32_t inLen, char* outBuffer, uint32_t outSize);
+
+    /**
+     * @brief 解压
+     * @return 解压后的长度, 失败返回-1
+     */
+    static int Decompress(const char* inBuffer, uint32_t inLen, char* outBuffer, uint32_t outSize);
+
+    static bool IsValidType(uint32_t type) { return type > NF_PACKET_COMPRESS_NONE && type < NF_PACKET_COMPRESS_MAX; }
+
+    /**
+     * @brief 设置zlib预置字典, 空字符串表示不用字典
+     * @return 0成功
+     */
+    static int SetZlibDict(const std::string& dict);
+
+    static const std::string& GetZlibDict() { return m_zlibDict; }
+
+    /**
+     * @brief 用样本包训练zlib字典
+     *
+     * 每个样本按固定长度切成片段, 片段得分是其中各个短串出现在多少个样本里的和, 按得分从高到低选片段,
+     * 选中片段包含的短串不再计分, 避免字典里放重复内容。得分高的片段放在字典末尾, 离待压缩数据最近
+     * @param vecSample 样本包
+     * @param dictSize 字典大小, 不超过NF_PACKET_COMPRESS_MAX_DICT_SIZE
+     */
+    static std::string TrainZlibDict(const std::vector<std::string>& vecSample, uint32_t dictSize);
+
+private:
+    static std::string m_zlibDict;
+};
@@ -73,12 +73,11 @@ int NFPacketParseMgr::EnCode(uint32_t packetType, const NFDataPackage& recvPacka
 	return m_pPacketParse[packetType]->EnCodeImpl(recvPackage, strData, unLen, buffer, nSendBusLinkId);
 }
 
-// 使用 lzf 算法 压缩、解压
-int NFPacketParseMgr::Compress(uint32_t packetType, const char* inBuffer, int inLen, void* outBuffer, unsigned int outSize)
+int NFPacketParseMgr::Compress(uint32_t packetType, uint32_t compressType, const char* inBuffer, int inLen, void* outBuffer, unsigned int outSize)
 {
 	CHECK_EXPR(packetType < m_pPacketParse.size(), -1, "packetType:{}", packetType);
 	CHECK_NULL(0, m_pPacketParse[packetType]);
-	return m_pPacketParse[packetType]->CompressImpl(inBuffer, inLen, outBuffer, outSize);
+	return m_pPacketParse[packetType]->CompressImpl(compressType, inBuffer, inLen, outBuffer, outSize);
 }
 
 int NFPacketParseMgr::Decompress(uint32_t packetType, const char* inBuffer, int inLen, void* outBuffer, int outSize)
@@ -53,21 +53,22 @@ public:
 	/**
 	 * 压缩函数
 	 *
-	 * 使用 lzf 算法对输入的数据进行压缩
+	 * 使用指定算法对输入的数据进行压缩, 压缩后不比原数据小算失败
 	 *
 	 * @param packetType 包类型，用于区分不同的数据包格式
+	 * @param compressType 压缩算法, NF_PACKET_COMPRESS_TYPE
 	 * @param inBuffer 输入的数据缓冲区指针
 	 * @param inLen 输入数据的长度
 	 * @param outBuffer 压缩后的数据输出缓冲区指针
 	 * @param outSize 压缩后的数据输出缓冲区大小
 	 * @return 返回压缩后的数据长度，如果压缩失败则返回负值
 	 */
-	static int Compress(uint32_t packetType, const char* inBuffer, int inLen, void* outBuffer, unsigned int outSize);
+	static int Compress(uint32_t packetType, uint32_t compressType, const char* inBuffer, int inLen, void* outBuffer, unsigned int outSize);
 
 	/**
 	 * 解压缩函数
 	 *
-	 * 使用 lzf 算法对输入的压缩数据进行解压缩
+	 * 对输入的压缩数据进行解压缩, 算法由压缩数据自带的头决定
 	 *
 	 * @param packetType 包类型，用于区分不同的数据包格式
 	 * @param inBuffer 输入的压缩数据缓冲区指针
@@ -14,6 +14,9 @@
 #include <errno.h>
 #include "NFComm/NFCore/NFStringUtility.h"
 #include "NFComm/NFCore/NFFileUtility.h"
+#include "NFComm/NFCore/NFHugePage.h"
+#include "NFComm/NFCore/NFCRC32.h"
+#include "NFShmCheckpoint.h"
 #include "NFShmGlobalId.h"
 #include "NFShmObjSeg.h"
 #include "NFComm/NFObjCommon/NFShmMgr.h"
@@ -28,6 +31,49 @@
 #include "NFShmTimer.h"
 #include "NFShmTimerMng.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief 热重启恢复对象时每个任务大概处理的对象内存大小
+ */
+#define NF_SHM_RESUME_TASK_MEM_SIZE (8 * 1024 * 1024)
+
+/**
+ * @brief 热重启恢复对象的任务, 恢复一个对象段里[m_iBegin, m_iEnd)这一段对象
+ */
+struct NFShmResumeTask
+{
+    int m_iType;
+    int m_iBegin;
+    int m_iEnd;
+};
+
+/**
+ * @brief 热重启时一个对象类型的恢复状态和耗时
+ */
+struct NFShmResumeTypeInfo
+{
+    NFShmResumeTypeInfo() : m_iType(INVALID_ID), m_iWaitCount(0), m_iLeftTask(0), m_iObjCount(0), m_bStart(false), m_ullWallTime(0), m_ullTaskTime(0)
+    {
+    }
+
+    int m_iType;
+    int m_iWaitCount; //还没恢复完的依赖类型数
+    int m_iLeftTask; //还没执行完的任务数
+    int m_iObjCount;
+    bool m_bStart;
+    std::chrono::steady_clock::time_point m_startTime;
+    uint64_t m_ullWallTime; //第一个任务开始到最后一个任务结束(微秒)
+    uint64_t m_ullTaskTime; //所有任务耗时之和(微秒)
+    std::vector<int> m_afterType; //依赖本类型的类型
+    std::vector<NFShmResumeTask> m_task;
+};
+
 NFCShmMngModule::NFCShmMngModule(NFIPluginManager* p) : NFIMemMngModule(p)
 {
     m_pObjPluginManager = p;
@@ -41,6 +87,8 @@ NFCShmMngModule::NFCShmMngModule(NFIPluginManager* p) : NFIMemMngModule(p)
     m_iTotalObjCount = 0;
     m_nObjSegSwapCounter.resize(EOT_MAX_TYPE);
     m_pGlobalId = nullptr;
+    m_pCheckpoint = nullptr;
+    m_bCheckpointRecover = false;
 }
 
 NFCShmMngModule::~NFCShmMngModule()
@@ -85,17 +133,27 @@ bool NFCShmMngModule::Execute()
     if (pTimerMng)
     {
         pTimerMng->OnTick(NF_ADJUST_TIMENOW_MS());
+        m_pObjPluginManager->SetNextWakeupTime(pTimerMng->GetNextTickTime());
     }
     auto pTransManager = dynamic_cast<NFShmTransMng*>(GetHeadObj(EOT_TRANS_MNG));
     if (pTransManager)
     {
         pTransManager->TickNow(m_pObjPluginManager->GetCurFrameCount());
     }
+    if (m_pCheckpoint)
+    {
+        m_pCheckpoint->Tick();
+    }
     return true;
 }
 
 bool NFCShmMngModule::Finalize()
 {
+    if (m_pCheckpoint)
+    {
+        delete m_pCheckpoint;
+        m_pCheckpoint = nullptr;
+    }
     DestroyShareMem();
     return true;
 }
@@ -145,6 +203,7 @@ int NFCShmMngModule::AllocShm(int iKey, size_t siShmSize)
 
     m_enRunMode = m_pSharedMemMgr->m_enRunMode;
     NFShmMgr::Instance()->SetRunMode(m_enRunMode);
+    NFShmMgr::Instance()->SetCheckpointRecover(m_bCheckpointRecover);
 
     NFLogInfo(NF_LOG_DEFAULT, 0, "--end-- ret {}", iRet);
 
@@ -249,11 +308,12 @@ void NFCShmMngModule::SetShmInitSuccessFlag()
     if (m_pSharedMemMgr)
     {
         m_pSharedMemMgr->SetShmInitSuccessFlag();
+        InitCheckpoint();
     }
     NF_ASSERT_MSG(m_pSharedMemMgr, "m_pSharedMemMgr == nullptr");
 }
 
-NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MODE enInitFlag, bool bCheckShmInitSuccessFlag) const
+NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MODE enInitFlag, bool bCheckShmInitSuccessFlag)
 {
     NFCSharedMem* pShm = nullptr;
     size_t siTempShmSize = 0;
@@ -322,9 +382,72 @@ NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MO
 
 #else
 
+    /**
+     * @brief 大页: 大页池够用时用SHM_HUGETLB创建, 大小对齐到大页, 不够时退回普通页, attach后再建议透明大页
+     * 恢复模式下按上次创建时的大小attach, 所以普通页大小和大页对齐后的大小都认
+     */
+    int iHugeFlag = 0;
+    size_t siNormalShmSize = siTempShmSize;
+    size_t siHugeShmSize = siTempShmSize;
+    size_t siHugePageSize = NFHugePage::GetHugePageSize();
+    if (siHugePageSize > 0)
+    {
+        siHugeShmSize = NFHugePage::AlignSize(siTempShmSize, siHugePageSize);
+    }
+
+    //已经有同key的共享内存时先看它的大小, 它占着的大页已经不算在大页池的空闲里, 不能按空闲大页判断
+    size_t siExistShmSize = 0;
+    int iExistShmId = shmget(iKey, 0, 0666);
+    if (iExistShmId >= 0)
+    {
+        struct shmid_ds stExistDs;
+        if (shmctl(iExistShmId, IPC_STAT, &stExistDs) == 0)
+        {
+            siExistShmSize = stExistDs.shm_segsz;
+        }
+    }
+
+    if (siExistShmSize > 0 && siExistShmSize == siHugeShmSize && siHugeShmSize != siNormalShmSize)
+    {
+        //只有大页模式会按大页对齐的大小创建
+        NFLogInfo(NF_LOG_DEFAULT, 0, "exist shm size:{}M is huge page aligned, use SHM_HUGETLB", siExistShmSize / 1024.0 / 1024.0);
+        iHugeFlag = SHM_HUGETLB;
+        siTempShmSize = siHugeShmSize;
+    }
+    else if (siExistShmSize == siNormalShmSize)
+    {
+        NFLogInfo(NF_LOG_DEFAULT, 0, "exist shm size:{}M, page mode follow the exist shm", siExistShmSize / 1024.0 / 1024.0);
+    }
+    else if (m_pObjPluginManager->IsShmHugePage())
+    {
+        size_t siFreeHugeMem = NFHugePage::GetFreeHugePageMem();
+        if (siHugePageSize > 0 && siFreeHugeMem >= siHugeShmSize)
+        {
+            iHugeFlag = SHM_HUGETLB;
+            siTempShmSize = siHugeShmSize;
+        }
+        else
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "huge page not enough, need:{}M free:{}M hugepagesize:{}K, use normal page", siHugeShmSize / 1024.0 / 1024.0,
+                         siFreeHugeMem / 1024.0 / 1024.0, siHugePageSize / 1024);
+        }
+    }
+
+    //共享内存是这次新建的, 机器重启过, 可以从写盘镜像恢复
+    bool bNewShm = false;
+
     //注意_bCreate的赋值位置:保证多线程用一个对象的时候也不会有问题
     //试图创建
-    if ((hShmId = shmget(iKey, siTempShmSize, IPC_CREAT | IPC_EXCL | 0666)) < 0)
+    hShmId = shmget(iKey, siTempShmSize, IPC_CREAT | IPC_EXCL | 0666 | iHugeFlag);
+    if (hShmId < 0 && iHugeFlag != 0 && errno != EEXIST)
+    {
+        NFLogWarning(NF_LOG_DEFAULT, 0, "CreateShareMem with SHM_HUGETLB failed for error:{}, {}, use normal page", errno, strerror(errno));
+        iHugeFlag = 0;
+        siTempShmSize = siNormalShmSize;
+        hShmId = shmget(iKey, siTempShmSize, IPC_CREAT | IPC_EXCL | 0666);
+    }
+
+    if (hShmId < 0)
     {
         NFLogInfo(NF_LOG_DEFAULT, 0, "CreateShareMem failed for error:{}, {}, server will try to attach it", errno, strerror(errno));
         //no space left
@@ -337,7 +460,20 @@ NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MO
 
         //有可能是已经存在同样的key_shm,则试图连接
         NFLogInfo(NF_LOG_DEFAULT, 0, "same shm  exist, now try to attach it ... ");
-        if ((hShmId = shmget(iKey, siTempShmSize, 0666)) < 0)
+        hShmId = shmget(iKey, siTempShmSize, 0666);
+        if (hShmId < 0 && siTempShmSize != siNormalShmSize)
+        {
+            //上次是用普通页创建的, 按普通页的大小attach
+            int iNormalShmId = shmget(iKey, siNormalShmSize, 0666);
+            if (iNormalShmId >= 0)
+            {
+                hShmId = iNormalShmId;
+                iHugeFlag = 0;
+                siTempShmSize = siNormalShmSize;
+            }
+        }
+
+        if (hShmId < 0)
         {
             NFLogError(NF_LOG_DEFAULT, 0, "CreateShareMem failed for error:{}, {}", errno, strerror(errno));
             if ((hShmId = shmget(iKey, 0, 0666)) < 0)
@@ -358,7 +494,7 @@ NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MO
                         exit(-1);
                     }
 
-                    if ((hShmId = shmget(iKey, siTempShmSize, IPC_CREAT | IPC_EXCL | 0666)) < 0)
+                    if ((hShmId = shmget(iKey, siTempShmSize, IPC_CREAT | IPC_EXCL | 0666 | iHugeFlag)) < 0)
                     {
                         NFLogError(NF_LOG_DEFAULT, 0, "CreateShareMem alloc failed for  {}, {}", errno, strerror(errno));
                         NFSLEEP(1000);
@@ -383,6 +519,7 @@ NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MO
     {
         NFLogInfo(NF_LOG_DEFAULT, 0, "shm ori mode {} change to mode {}(mode 1:Init, 2:Recover)", enInitFlag, EN_OBJ_MODE_INIT);
         enInitFlag = EN_OBJ_MODE_INIT;
+        bNewShm = true;
     }
 
     struct shmid_ds stDs;
@@ -394,6 +531,13 @@ NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MO
         return nullptr;
     }
 
+    if (siTempShmSize != stDs.shm_segsz && (stDs.shm_segsz == siNormalShmSize || stDs.shm_segsz == siHugeShmSize))
+    {
+        //上次和这次的大页设置不一样, 用上次创建时的大小
+        NFLogInfo(NF_LOG_DEFAULT, 0, "CSharedMem ReqShmSize:{} change to ActShmSize:{}", siTempShmSize, stDs.shm_segsz);
+        siTempShmSize = stDs.shm_segsz;
+    }
+
     if (siTempShmSize != stDs.shm_segsz)
     {
         NFLogError(NF_LOG_DEFAULT, 0, "CSharedMem Invalid ReqShmSize With Shm, ReqShmSize:{}  ActShmSize:{} ShmID:{} ShmKey:{}", siTempShmSize,
@@ -415,6 +559,18 @@ NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MO
 
     if (pAddr != (void *) -1)
     {
+        //普通页大小和大页对齐后一样时分不出来, attach以后按实际映射的页大小算
+        bool bHugeTlb = NFHugePage::IsHugeTlbMapping(pAddr);
+        if (bHugeTlb != (iHugeFlag != 0))
+        {
+            NFLogInfo(NF_LOG_DEFAULT, 0, "shm actual hugetlb:{} not same as request, follow the exist shm", bHugeTlb);
+        }
+        InitShmPage(pAddr, siTempShmSize, bHugeTlb);
+        //从镜像恢复要显式打开, 默认新建的共享内存照常从DB加载
+        if (bNewShm && !m_pObjPluginManager->IsInitShm() && m_pObjPluginManager->IsShmCheckpointRestore() && LoadCheckpoint(pAddr, siNormalShmSize) == 0)
+        {
+            enInitFlag = EN_OBJ_MODE_RECOVER;
+        }
         NFCSharedMem::pbCurrentShm = (char *) pAddr;
         NFCSharedMem::s_bCheckInitSuccessFlag = enInitFlag;
         pShm = new NFCSharedMem(iKey, siTempShmSize, enInitFlag, hShmId);
@@ -432,6 +588,124 @@ NFCSharedMem* NFCShmMngModule::CreateShareMem(int iKey, size_t siSize, EN_OBJ_MO
     return pShm;
 }
 
+void NFCShmMngModule::InitShmPage(void* pAddr, size_t siSize, bool bHugeTlb) const
+{
+    if (m_pObjPluginManager->IsShmHugePage() && !bHugeTlb)
+    {
+        if (NFHugePage::AdviseHugePage(pAddr, siSize) == 0)
+        {
+            NFLogInfo(NF_LOG_DEFAULT, 0, "shm use transparent huge page, size:{}M", siSize / 1024.0 / 1024.0);
+        }
+        else
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "shm madvise MADV_HUGEPAGE failed for error:{}, {}, use normal page", errno, strerror(errno));
+        }
+    }
+
+    int iNumaNode = m_pObjPluginManager->GetShmNumaNode();
+    if (iNumaNode >= 0)
+    {
+        int iNodeCount = NFHugePage::GetNumaNodeCount();
+        if (iNumaNode >= iNodeCount)
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "shm numa node:{} not exist, node count:{}, not bind", iNumaNode, iNodeCount);
+        }
+        else if (NFHugePage::BindNumaNode(pAddr, siSize, iNumaNode) != 0)
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "shm bind numa node:{} failed for error:{}, {}", iNumaNode, errno, strerror(errno));
+        }
+        else
+        {
+            NFLogInfo(NF_LOG_DEFAULT, 0, "shm bind numa node:{}", iNumaNode);
+        }
+    }
+
+    if (m_pObjPluginManager->IsShmPrefault())
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        NFHugePage::Prefault(pAddr, siSize);
+        NFLogInfo(NF_LOG_DEFAULT, 0, "shm prefault size:{}M use {}ms", siSize / 1024.0 / 1024.0,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+    }
+}
+
+std::string NFCShmMngModule::GetCheckpointPath() const
+{
+    //AllMoreServer的所有服务器用同一个启动参数, 按服务器区分, 不然会写同一个文件
+    const std::string& strPath = m_pObjPluginManager->GetShmCheckpointPath();
+    if (strPath.empty() || m_pObjPluginManager->GetBusName().empty())
+    {
+        return strPath;
+    }
+    return strPath + "." + m_pObjPluginManager->GetBusName();
+}
+
+int NFCShmMngModule::LoadCheckpoint(void* pAddr, size_t siSize)
+{
+    std::string strPath = GetCheckpointPath();
+    if (strPath.empty())
+    {
+        return -1;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    uint64_t ullGeneration = 0;
+    int iRet = NFShmCheckpoint::Load(strPath, static_cast<char*>(pAddr), siSize, GetLayoutHash(), ullGeneration);
+    if (iRet != 0)
+    {
+        NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint {} not usable, run by INIT mode and load from db", strPath);
+        return -1;
+    }
+
+    //之后走热重启的恢复流程, ResumeAllObjSeg会再输出恢复对象的耗时; 镜像之后DB里的数据可能更新过, 存DB的对象要重新加载
+    m_bCheckpointRecover = true;
+    NFLogInfo(NF_LOG_DEFAULT, 0, "shm recover from checkpoint {} generation:{} size:{}M load use {}ms, run by RECOVER mode", strPath, ullGeneration,
+              siSize / 1024.0 / 1024.0, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+    return 0;
+}
+
+int NFCShmMngModule::InitCheckpoint()
+{
+    std::string strPath = GetCheckpointPath();
+    if (strPath.empty() || m_pCheckpoint)
+    {
+        return 0;
+    }
+
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    //和CreateShareMem里普通页的大小一致, 用大页时多出来的部分没有用到, 不写盘
+    size_t siSize = NFHugePage::AlignSize(m_siShmSize + sizeof(NFCSharedMem), static_cast<size_t>(getpagesize()));
+    m_pCheckpoint = new NFShmCheckpoint();
+    int iRet = m_pCheckpoint->Init(strPath, NFCSharedMem::pbCurrentShm, siSize, GetLayoutHash(), m_pObjPluginManager->GetShmCheckpointInterval());
+    if (iRet != 0)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint init failed, path:{}", strPath);
+        delete m_pCheckpoint;
+        m_pCheckpoint = nullptr;
+        return iRet;
+    }
+#else
+    NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint only support linux, path:{} ignored", strPath);
+#endif
+    return 0;
+}
+
+uint32_t NFCShmMngModule::GetLayoutHash() const
+{
+    //对象段按类型顺序从共享内存里分配, 类型/大小/个数都一样时每个对象的位置才一样
+    std::string strLayout = NF_FORMAT("shm:{}:{};", m_iObjSegSizeTotal, sizeof(NFCSharedMem));
+    for (int i = 0; i < static_cast<int>(m_nObjSegSwapCounter.size()); i++)
+    {
+        const NFShmObjSegSwapCounter& counter = m_nObjSegSwapCounter[i];
+        if (counter.m_nObjSize > 0 && counter.m_iItemCount > 0)
+        {
+            strLayout += NF_FORMAT("{}:{}:{}:{}:{}:{};", i, counter.m_szClassName, counter.m_nObjSize, counter.m_iItemCount, counter.m_iUseHash,
+                                   counter.m_singleton);
+        }
+    }
+    return NFCRC32::Sum(strLayout);
+}
+
 /**
 * 摧毁共享内存
 */
@@ -537,6 +811,264 @@ int NFCShmMngModule::InitAllObjSeg()
         }
     }
 
+    if (GetInitMode() == EN_OBJ_MODE_RECOVER)
+    {
+        iRet = ResumeAllObjSeg();
+        if (iRet)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "ResumeAllObjSeg failed!");
+            return iRet;
+        }
+    }
+
+    return 0;
+}
+
+int NFCShmMngModule::ResumeAllObjSeg()
+{
+    auto beginTime = std::chrono::steady_clock::now();
+    std::vector<NFShmResumeTypeInfo> vecInfo(m_nObjSegSwapCounter.size());
+    std::vector<int> vecType;
+    size_t iTaskCount = 0;
+    int iObjCount = 0;
+    for (int i = 0; i < static_cast<int>(m_nObjSegSwapCounter.size()); i++)
+    {
+        NFShmObjSegSwapCounter* pCounter = &m_nObjSegSwapCounter[i];
+        NFShmObjSeg* pObjSeg = pCounter->m_pObjSeg;
+        if (pObjSeg == nullptr)
+        {
+            continue;
+        }
+
+        NFShmResumeTypeInfo& info = vecInfo[i];
+        info.m_iType = i;
+        info.m_iObjCount = pObjSeg->GetUsedCount();
+        int iFormatCount = pObjSeg->GetFormatCount();
+        int iStep = static_cast<int>(std::max<size_t>(1, NF_SHM_RESUME_TASK_MEM_SIZE / std::max<size_t>(1, pCounter->m_nObjSize)));
+        for (int iBegin = 0; iBegin < iFormatCount; iBegin += iStep)
+        {
+            NFShmResumeTask task;
+            task.m_iType = i;
+            task.m_iBegin = iBegin;
+            task.m_iEnd = std::min(iFormatCount, iBegin + iStep);
+            info.m_task.push_back(task);
+        }
+        info.m_iLeftTask = static_cast<int>(info.m_task.size());
+        iTaskCount += info.m_task.size();
+        iObjCount += info.m_iObjCount;
+        vecType.push_back(i);
+    }
+
+    for (int i = 0; i < static_cast<int>(vecType.size()); i++)
+    {
+        int iType = vecType[i];
+        for (auto iter = m_nObjSegSwapCounter[iType].m_resumeDependType.begin(); iter != m_nObjSegSwapCounter[iType].m_resumeDependType.end(); ++iter)
+        {
+            int iDependType = *iter;
+            if (iDependType < 0 || iDependType >= static_cast<int>(vecInfo.size()) || vecInfo[iDependType].m_iType == INVALID_ID)
+            {
+                NFLogWarning(NF_LOG_DEFAULT, 0, "class {} resume after type {}, but the type has no obj seg, ignore it", m_nObjSegSwapCounter[iType].m_szClassName, iDependType);
+                continue;
+            }
+            vecInfo[iType].m_iWaitCount++;
+            vecInfo[iDependType].m_afterType.push_back(iType);
+        }
+    }
+
+    /**
+     * @brief 先检查恢复依赖有没有环, 有环的话所有线程都会一直等下去
+     */
+    {
+        std::vector<int> vecWait(vecInfo.size(), 0);
+        std::vector<int> vecReady;
+        for (int i = 0; i < static_cast<int>(vecType.size()); i++)
+        {
+            vecWait[vecType[i]] = vecInfo[vecType[i]].m_iWaitCount;
+            if (vecWait[vecType[i]] == 0)
+            {
+                vecReady.push_back(vecType[i]);
+            }
+        }
+
+        size_t iSortCount = 0;
+        while (!vecReady.empty())
+        {
+            int iType = vecReady.back();
+            vecReady.pop_back();
+            iSortCount++;
+            for (int i = 0; i < static_cast<int>(vecInfo[iType].m_afterType.size()); i++)
+            {
+                int iAfterType = vecInfo[iType].m_afterType[i];
+                if (--vecWait[iAfterType] == 0)
+                {
+                    vecReady.push_back(iAfterType);
+                }
+            }
+        }
+
+        if (iSortCount != vecType.size())
+        {
+            for (int i = 0; i < static_cast<int>(vecType.size()); i++)
+            {
+                if (vecWait[vecType[i]] > 0)
+                {
+                    NFLogError(NF_LOG_DEFAULT, 0, "class {} resume dependency circle dead", m_nObjSegSwapCounter[vecType[i]].m_szClassName);
+                }
+            }
+            return -1;
+        }
+    }
+
+    int iThreadNum = m_pObjPluginManager->GetShmResumeThreadNum();
+    if (iThreadNum <= 0)
+    {
+        iThreadNum = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    iThreadNum = std::min<int>(iThreadNum, static_cast<int>(iTaskCount));
+    iThreadNum = std::max(iThreadNum, 1);
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<NFShmResumeTask> queTask;
+    int iLeftType = static_cast<int>(vecType.size());
+    int iRet = 0;
+
+    /**
+     * @brief 一个类型恢复完后, 把等它的类型里依赖都满足的任务放进队列, 调用时要持有mutex
+     */
+    auto finishType = [&](int iFinishType)
+    {
+        std::vector<int> vecFinish(1, iFinishType);
+        while (!vecFinish.empty())
+        {
+            NFShmResumeTypeInfo& info = vecInfo[vecFinish.back()];
+            vecFinish.pop_back();
+            if (info.m_bStart)
+            {
+                info.m_ullWallTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - info.m_startTime).count();
+            }
+            iLeftType--;
+
+            for (int i = 0; i < static_cast<int>(info.m_afterType.size()); i++)
+            {
+                NFShmResumeTypeInfo& afterInfo = vecInfo[info.m_afterType[i]];
+                if (--afterInfo.m_iWaitCount > 0)
+                {
+                    continue;
+                }
+
+                if (afterInfo.m_task.empty())
+                {
+                    vecFinish.push_back(afterInfo.m_iType);
+                }
+                else
+                {
+                    queTask.insert(queTask.end(), afterInfo.m_task.begin(), afterInfo.m_task.end());
+                }
+            }
+        }
+    };
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            cond.wait(lock, [&]() { return !queTask.empty() || iLeftType == 0 || iRet != 0; });
+            if (iRet != 0 || queTask.empty())
+            {
+                break;
+            }
+
+            NFShmResumeTask task = queTask.front();
+            queTask.pop_front();
+            NFShmResumeTypeInfo& info = vecInfo[task.m_iType];
+            if (!info.m_bStart)
+            {
+                info.m_bStart = true;
+                info.m_startTime = std::chrono::steady_clock::now();
+            }
+            lock.unlock();
+
+            auto taskTime = std::chrono::steady_clock::now();
+            int iTaskRet = m_nObjSegSwapCounter[task.m_iType].m_pObjSeg->FormatObj(task.m_iBegin, task.m_iEnd);
+            uint64_t ullUseTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - taskTime).count();
+
+            lock.lock();
+            info.m_ullTaskTime += ullUseTime;
+            if (iTaskRet != 0)
+            {
+                NFLogError(NF_LOG_DEFAULT, 0, "class {} FormatObj [{}, {}) failed, ret:{}", m_nObjSegSwapCounter[task.m_iType].m_szClassName, task.m_iBegin, task.m_iEnd, iTaskRet);
+                iRet = iTaskRet;
+            }
+            else if (--info.m_iLeftTask == 0)
+            {
+                finishType(task.m_iType);
+            }
+            cond.notify_all();
+        }
+    };
+
+    {
+        std::vector<int> vecReady;
+        for (int i = 0; i < static_cast<int>(vecType.size()); i++)
+        {
+            if (vecInfo[vecType[i]].m_iWaitCount == 0)
+            {
+                vecReady.push_back(vecType[i]);
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        for (int i = 0; i < static_cast<int>(vecReady.size()); i++)
+        {
+            NFShmResumeTypeInfo& info = vecInfo[vecReady[i]];
+            if (info.m_task.empty())
+            {
+                finishType(info.m_iType);
+            }
+            else
+            {
+                queTask.insert(queTask.end(), info.m_task.begin(), info.m_task.end());
+            }
+        }
+    }
+
+    std::vector<std::thread> vecThread;
+    for (int i = 1; i < iThreadNum; i++)
+    {
+        vecThread.emplace_back(worker);
+    }
+    worker();
+    for (int i = 0; i < static_cast<int>(vecThread.size()); i++)
+    {
+        vecThread[i].join();
+    }
+
+    CHECK_EXPR(iRet == 0, iRet, "ResumeAllObjSeg failed, ret:{}", iRet);
+
+    /**
+     * @brief 按耗时从大到小输出每个类型的恢复时间
+     */
+    std::sort(vecType.begin(), vecType.end(), [&vecInfo](int a, int b)
+    {
+        return vecInfo[a].m_ullWallTime > vecInfo[b].m_ullWallTime;
+    });
+
+    for (int i = 0; i < static_cast<int>(vecType.size()); i++)
+    {
+        const NFShmResumeTypeInfo& info = vecInfo[vecType[i]];
+        if (info.m_iObjCount <= 0)
+        {
+            continue;
+        }
+
+        NFLogInfo(NF_LOG_DEFAULT, 0, "resume class {} count {} task {} use {}ms, all task use {}ms", m_nObjSegSwapCounter[info.m_iType].m_szClassName, info.m_iObjCount,
+                  info.m_task.size(), info.m_ullWallTime / 1000.0, info.m_ullTaskTime / 1000.0);
+    }
+
+    uint64_t ullUseTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - beginTime).count();
+    NFLogInfo(NF_LOG_DEFAULT, 0, "resume all obj seg, class {} obj {} task {} thread {} use {}ms", vecType.size(), iObjCount, iTaskCount, iThreadNum, ullUseTime / 1000.0);
     return 0;
 }
 
@@ -739,6 +1271,16 @@ void NFCShmMngModule::UnRegisterClassToObjSeg(int bType)
     pCounter->clear();
 }
 
+int NFCShmMngModule::AddResumeDependency(int iType, int iDependType)
+{
+    CHECK_EXPR(iType >= 0 && iType < static_cast<int>(m_nObjSegSwapCounter.size()), -1, "iType:{} error", iType);
+    CHECK_EXPR(iDependType >= 0 && iDependType < static_cast<int>(m_nObjSegSwapCounter.size()), -1, "iDependType:{} error", iDependType);
+    CHECK_EXPR(iType != iDependType, -1, "class {} can't resume after itself", m_nObjSegSwapCounter[iType].m_szClassName);
+
+    m_nObjSegSwapCounter[iType].m_resumeDependType.insert(iDependType);
+    return 0;
+}
+
 void NFShmObjSegSwapCounter::SetObjSeg(NFShmObjSeg* pObjSeg)
 {
     m_pObjSeg = pObjSeg;
@@ -21,6 +21,8 @@ class NFCShmMngModule;
 
 class NFShmObjSeg;
 
+class NFShmCheckpoint;
+
 class NFShmObjSegSwapCounter
 {
     friend class NFCShmMngModule;
@@ -49,6 +51,7 @@ public:
         m_pDestroyFn = nullptr;
         m_pObjSeg = nullptr;
         m_pParent = nullptr;
+        m_resumeDependType.clear();
     }
 public:
     std::string m_szClassName;
@@ -66,6 +69,7 @@ public:
     NFShmObjSegSwapCounter* m_pParent;
     std::unordered_set<int> m_childrenObjType;
     std::unordered_set<int> m_parentObjType;
+    std::unordered_set<int> m_resumeDependType; //热重启时要先恢复完的类型
 };
 
 class NFCShmMngModule final : public NFIMemMngModule
@@ -475,7 +479,33 @@ public:
     /**
     * 创建共享内存
     */
-    NFCSharedMem* CreateShareMem(int iKey, size_t siSize, EN_OBJ_MODE enInitFlag, bool bCheckShmInitSuccessFlag) const;
+    NFCSharedMem* CreateShareMem(int iKey, size_t siSize, EN_OBJ_MODE enInitFlag, bool bCheckShmInitSuccessFlag);
+
+    /**
+    * 共享内存attach后按启动参数设置透明大页, 绑定NUMA节点, 预先触发缺页
+    */
+    void InitShmPage(void* pAddr, size_t siSize, bool bHugeTlb) const;
+
+    /**
+    * 写盘镜像路径, 启动参数的路径后面加上服务器的BusName
+    */
+    std::string GetCheckpointPath() const;
+
+    /**
+    * 新建的共享内存从写盘镜像恢复, 成功后按恢复模式启动
+    * @return 0成功, 没有配置镜像或者没有可用的镜像返回-1
+    */
+    int LoadCheckpoint(void* pAddr, size_t siSize);
+
+    /**
+    * 共享内存初始化成功后开始定期写盘
+    */
+    int InitCheckpoint();
+
+    /**
+    * 对象类型/大小/个数和共享内存总大小算出来的hash, 写盘镜像用来拒绝不兼容的布局
+    */
+    uint32_t GetLayoutHash() const;
 
     /**
     * 摧毁共享内存
@@ -498,6 +528,14 @@ public:
 
     void UnRegisterClassToObjSeg(int bType) override;
 
+    int AddResumeDependency(int iType, int iDependType) override;
+
+    /**
+     * @brief 恢复模式下所有对象段分配完后, 把每个段的FormatObj切成小段, 按恢复依赖多线程执行, 最后输出每个类型的恢复耗时
+     * @return 0成功
+     */
+    int ResumeAllObjSeg();
+
     size_t GetAllObjSize() const;
 
     int InitializeAllObj();
@@ -516,4 +554,6 @@ private:
     size_t m_siShmSize;
     NFShmGlobalId* m_pGlobalId;
     uint32_t m_nRunTimeFileId;
+    NFShmCheckpoint* m_pCheckpoint;
+    bool m_bCheckpointRecover;
 };
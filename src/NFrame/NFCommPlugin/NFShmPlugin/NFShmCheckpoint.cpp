@@ -0,0 +1,820 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFShmCheckpoint.cpp
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/29
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFShmPlugin
+//
+// -------------------------------------------------------------------------
+
+#include "NFShmCheckpoint.h"
+#include "NFComm/NFPluginModule/NFCheck.h"
+#include "NFComm/NFPluginModule/NFLogMgr.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <zlib.h>
+
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * @brief 镜像用的CRC32, 用zlib的查表实现, 比逐字节计算的NFCRC32快一个数量级
+ */
+static uint32_t CheckpointCrc32(const void* pData, size_t siLen)
+{
+    return static_cast<uint32_t>(crc32(0L, static_cast<const Bytef*>(pData), static_cast<uInt>(siLen)));
+}
+
+/**
+ * @brief /proc/self/pagemap每一项的标志位
+ */
+#define NF_PAGEMAP_SOFT_DIRTY (1ULL << 55)
+#define NF_PAGEMAP_SWAPPED (1ULL << 62)
+#define NF_PAGEMAP_PRESENT (1ULL << 63)
+
+/**
+ * @brief 一次读pagemap的项数
+ */
+#define NF_PAGEMAP_BATCH 8192
+
+std::mutex NFShmCheckpoint::s_softDirtyMutex;
+int NFShmCheckpoint::s_iInstanceCount = 0;
+uint64_t NFShmCheckpoint::s_ullClearRefsCount = 0;
+
+static size_t NFShmCheckpointCount(const std::vector<uint64_t>& vecPage)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < vecPage.size(); i++)
+    {
+        uint64_t word = vecPage[i];
+        while (word)
+        {
+            word &= word - 1;
+            count++;
+        }
+    }
+    return count;
+}
+
+static void NFShmCheckpointOr(std::vector<uint64_t>& vecDst, const std::vector<uint64_t>& vecSrc)
+{
+    for (size_t i = 0; i < vecDst.size() && i < vecSrc.size(); i++)
+    {
+        vecDst[i] |= vecSrc[i];
+    }
+}
+
+static uint64_t NFShmCheckpointUs(const std::chrono::steady_clock::time_point& begin)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+NFShmCheckpoint::NFShmCheckpoint()
+{
+    m_pAddr = nullptr;
+    m_siSize = 0;
+    m_siPageSize = 4096;
+    m_uiLayoutHash = 0;
+    m_iIntervalSec = 0;
+    m_bSoftDirty = false;
+    m_iPageMapFd = -1;
+    m_iClearRefsFd = -1;
+    m_iFileFd[0] = -1;
+    m_iFileFd[1] = -1;
+    m_bRegistered = false;
+    m_ullClearRefsCount = 0;
+    m_enState = NF_SHM_CHECKPOINT_IDLE;
+    m_iFileIndex = 0;
+    m_iLastFileIndex = 1;
+    m_iRound = 0;
+    m_ullGeneration = 0;
+    m_ullStallUs = 0;
+    m_ullLastWriteSize = 0;
+    m_ullLastCostUs = 0;
+    m_ullLastStallUs = 0;
+    m_bStop = false;
+    m_bHasJob = false;
+    m_job.m_bStaging = false;
+    m_job.m_bBegin = false;
+    m_job.m_bCommit = false;
+    m_bJobRunning = false;
+    m_iJobRet = 0;
+    m_ullJobWriteSize = 0;
+    m_ullWriteSize = 0;
+    m_siStagingSize = 0;
+}
+
+NFShmCheckpoint::~NFShmCheckpoint()
+{
+    Stop();
+}
+
+int NFShmCheckpoint::Init(const std::string& strPath, char* pAddr, size_t siSize, uint32_t uiLayoutHash, int iIntervalSec)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    CHECK_EXPR(m_pAddr == nullptr, -1, "shm checkpoint already init");
+    CHECK_EXPR(!strPath.empty() && pAddr != nullptr && siSize > 0, -1, "shm checkpoint param error, path:{} size:{}", strPath, siSize);
+
+    m_siPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    CHECK_EXPR(reinterpret_cast<size_t>(pAddr) % m_siPageSize == 0, -1, "shm checkpoint addr:{} not page align", static_cast<void*>(pAddr));
+
+    m_strPath = strPath;
+    m_pAddr = pAddr;
+    m_siSize = siSize;
+    m_uiLayoutHash = uiLayoutHash;
+    m_iIntervalSec = iIntervalSec;
+
+    //两个文件都轮流写, 新的写在序号小的那个上
+    uint64_t ullGeneration[2] = {0, 0};
+    for (int i = 0; i < 2; i++)
+    {
+        std::string strFile = GetImageFile(m_strPath, i);
+        NFShmCheckpointHeader header;
+        if (ReadHeader(strFile, header) && header.m_uiCommitted)
+        {
+            ullGeneration[i] = header.m_ullGeneration;
+        }
+
+        m_iFileFd[i] = open(strFile.c_str(), O_RDWR | O_CREAT, 0644);
+        if (m_iFileFd[i] < 0 || ftruncate(m_iFileFd[i], GetPageCrcOffset(m_siSize) + GetPageCount() * sizeof(uint32_t)) != 0)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint open {} failed for error:{}, {}", strFile, errno, strerror(errno));
+            Stop();
+            return -1;
+        }
+    }
+    m_ullGeneration = std::max(ullGeneration[0], ullGeneration[1]);
+    m_iLastFileIndex = ullGeneration[0] > ullGeneration[1] ? 0 : 1;
+
+    //文件里的内容和现在的共享内存对不上, 头两次都要整块写, 每页的CRC32也跟着全部重算
+    SetAllPage(m_vecPending[0]);
+    SetAllPage(m_vecPending[1]);
+    m_vecPageCrc[0].assign(GetPageCount(), 0);
+    m_vecPageCrc[1].assign(GetPageCount(), 0);
+    m_pWriteBuf.reset(new char[NF_SHM_CHECKPOINT_WRITE_CHUNK]);
+
+    {
+        //探测本身也会清一次整个进程的soft-dirty
+        std::lock_guard<std::mutex> lock(s_softDirtyMutex);
+        s_iInstanceCount++;
+        m_bRegistered = true;
+        m_bSoftDirty = CheckSoftDirty();
+        s_ullClearRefsCount++;
+        m_ullClearRefsCount = s_ullClearRefsCount;
+    }
+
+    if (m_bSoftDirty)
+    {
+        m_iPageMapFd = open("/proc/self/pagemap", O_RDONLY);
+        m_iClearRefsFd = open("/proc/self/clear_refs", O_WRONLY);
+        if (m_iPageMapFd < 0 || m_iClearRefsFd < 0)
+        {
+            m_bSoftDirty = false;
+        }
+    }
+
+    if (!m_bSoftDirty)
+    {
+        NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint kernel not support soft-dirty, every checkpoint will copy whole shm:{}M in main thread",
+                     m_siSize / 1024.0 / 1024.0);
+    }
+    else if (!IsSoftDirty())
+    {
+        NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint more than one instance in process, clear_refs is process wide, every checkpoint will copy whole shm:{}M in main thread",
+                     m_siSize / 1024.0 / 1024.0);
+    }
+
+    m_lastTime = std::chrono::steady_clock::now();
+    m_bStop = false;
+    m_thread = std::thread(&NFShmCheckpoint::WorkThread, this);
+
+    NFLogInfo(NF_LOG_DEFAULT, 0, "shm checkpoint init path:{} size:{}M interval:{}s generation:{} soft-dirty:{}", m_strPath, m_siSize / 1024.0 / 1024.0,
+              m_iIntervalSec, m_ullGeneration, IsSoftDirty());
+    return 0;
+#else
+    NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint only support linux");
+    return -1;
+#endif
+}
+
+void NFShmCheckpoint::Stop()
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    if (m_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bStop = true;
+        }
+        m_cond.notify_all();
+        m_thread.join();
+    }
+
+    if (m_bRegistered)
+    {
+        std::lock_guard<std::mutex> lock(s_softDirtyMutex);
+        s_iInstanceCount--;
+        m_bRegistered = false;
+    }
+
+    if (m_enState != NF_SHM_CHECKPOINT_IDLE)
+    {
+        NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint stop while writing {}, the image is discarded", GetImageFile(m_strPath, m_iFileIndex));
+        m_enState = NF_SHM_CHECKPOINT_IDLE;
+    }
+
+    int* pFd[] = {&m_iPageMapFd, &m_iClearRefsFd, &m_iFileFd[0], &m_iFileFd[1]};
+    for (size_t i = 0; i < sizeof(pFd) / sizeof(pFd[0]); i++)
+    {
+        if (*pFd[i] >= 0)
+        {
+            close(*pFd[i]);
+            *pFd[i] = -1;
+        }
+    }
+    m_pAddr = nullptr;
+#endif
+}
+
+int NFShmCheckpoint::Tick()
+{
+    if (m_pAddr == nullptr)
+    {
+        return 0;
+    }
+
+    if (m_enState == NF_SHM_CHECKPOINT_IDLE)
+    {
+        if (m_iIntervalSec > 0 && std::chrono::steady_clock::now() - m_lastTime >= std::chrono::seconds(m_iIntervalSec))
+        {
+            Start();
+        }
+        return 0;
+    }
+
+    if (m_bJobRunning.load(std::memory_order_acquire))
+    {
+        return 0;
+    }
+
+    m_ullWriteSize += m_ullJobWriteSize;
+    if (m_iJobRet != 0)
+    {
+        Abort();
+        return -1;
+    }
+
+    if (m_enState == NF_SHM_CHECKPOINT_COMMIT)
+    {
+        Finish();
+        return 0;
+    }
+
+    //上一轮是直接从共享内存写的, 写的过程中改过的页要重写
+    auto beginTime = std::chrono::steady_clock::now();
+    std::vector<uint64_t> vecDirty;
+    size_t siDirty = CollectDirty(vecDirty);
+    NFShmCheckpointOr(m_vecPending[1 - m_iFileIndex], vecDirty);
+    m_iRound++;
+
+    if (siDirty * m_siPageSize <= NF_SHM_CHECKPOINT_FINAL_SIZE || m_iRound >= NF_SHM_CHECKPOINT_MAX_ROUND)
+    {
+        PostCommit(vecDirty, siDirty, false);
+    }
+    else
+    {
+        PostJob(vecDirty, false, false, false);
+    }
+    m_ullStallUs += NFShmCheckpointUs(beginTime);
+    return 0;
+}
+
+int NFShmCheckpoint::Start()
+{
+    if (m_pAddr == nullptr || m_enState != NF_SHM_CHECKPOINT_IDLE)
+    {
+        return -1;
+    }
+
+    m_beginTime = std::chrono::steady_clock::now();
+    m_ullStallUs = 0;
+    m_ullWriteSize = 0;
+    m_iRound = 0;
+    m_iFileIndex = 1 - m_iLastFileIndex;
+
+    //上次写盘以后改过的页两个文件都要记下来, 这次只写其中一个文件落下的页
+    std::vector<uint64_t> vecDirty;
+    CollectDirty(vecDirty);
+    NFShmCheckpointOr(m_vecPending[0], vecDirty);
+    NFShmCheckpointOr(m_vecPending[1], vecDirty);
+
+    std::vector<uint64_t> vecPage(GetWordCount(), 0);
+    vecPage.swap(m_vecPending[m_iFileIndex]);
+    size_t siPage = NFShmCheckpointCount(vecPage);
+
+    if (!IsSoftDirty() || siPage * m_siPageSize <= NF_SHM_CHECKPOINT_FINAL_SIZE)
+    {
+        PostCommit(vecPage, siPage, true);
+    }
+    else
+    {
+        PostJob(vecPage, false, true, false);
+    }
+    m_ullStallUs += NFShmCheckpointUs(m_beginTime);
+    return 0;
+}
+
+bool NFShmCheckpoint::IsSoftDirty() const
+{
+    std::lock_guard<std::mutex> lock(s_softDirtyMutex);
+    return m_bSoftDirty && s_iInstanceCount <= 1;
+}
+
+size_t NFShmCheckpoint::CollectDirty(std::vector<uint64_t>& vecDirty)
+{
+    size_t siPageCount = GetPageCount();
+    std::lock_guard<std::mutex> lock(s_softDirtyMutex);
+    if (!m_bSoftDirty || s_iInstanceCount > 1)
+    {
+        SetAllPage(vecDirty);
+        return siPageCount;
+    }
+
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    //上次取脏页以后别的实例清过soft-dirty, 这期间的脏页位已经丢了
+    bool bLost = s_ullClearRefsCount != m_ullClearRefsCount;
+    vecDirty.assign(GetWordCount(), 0);
+    size_t siDirty = 0;
+    size_t siFirstPage = reinterpret_cast<size_t>(m_pAddr) / m_siPageSize;
+    uint64_t entry[NF_PAGEMAP_BATCH];
+    for (size_t i = 0; i < siPageCount; i += NF_PAGEMAP_BATCH)
+    {
+        size_t n = std::min(static_cast<size_t>(NF_PAGEMAP_BATCH), siPageCount - i);
+        ssize_t ret = pread(m_iPageMapFd, entry, n * sizeof(uint64_t), static_cast<off_t>((siFirstPage + i) * sizeof(uint64_t)));
+        size_t siRead = ret > 0 ? static_cast<size_t>(ret) / sizeof(uint64_t) : 0;
+        for (size_t j = 0; j < n; j++)
+        {
+            //没有映射的页可能是被换出去了, soft-dirty位不可靠, 当成脏页
+            bool bDirty = bLost || j >= siRead || (entry[j] & NF_PAGEMAP_SOFT_DIRTY) || !(entry[j] & (NF_PAGEMAP_PRESENT | NF_PAGEMAP_SWAPPED));
+            if (bDirty)
+            {
+                vecDirty[(i + j) / 64] |= 1ULL << ((i + j) % 64);
+                siDirty++;
+            }
+        }
+    }
+
+    //清掉整个进程的soft-dirty, 之后第一次写每一页都会多一次缺页
+    if (write(m_iClearRefsFd, "4", 1) != 1)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint clear soft-dirty failed for error:{}, {}", errno, strerror(errno));
+    }
+    s_ullClearRefsCount++;
+    m_ullClearRefsCount = s_ullClearRefsCount;
+    return siDirty;
+#else
+    return 0;
+#endif
+}
+
+void NFShmCheckpoint::PostCommit(std::vector<uint64_t>& vecPage, size_t siPageCount, bool bBegin)
+{
+    //拷贝的这一刻就是镜像对应的时间点
+    if (m_siStagingSize < siPageCount * m_siPageSize)
+    {
+        m_siStagingSize = siPageCount * m_siPageSize;
+        m_pStaging.reset(new char[m_siStagingSize]);
+    }
+    char* pStaging = m_pStaging.get();
+    size_t siTotalPage = GetPageCount();
+    for (size_t page = 0; page < siTotalPage; page++)
+    {
+        if (vecPage[page / 64] & (1ULL << (page % 64)))
+        {
+            size_t len = std::min(m_siPageSize, m_siSize - page * m_siPageSize);
+            memcpy(pStaging, m_pAddr + page * m_siPageSize, len);
+            pStaging += m_siPageSize;
+        }
+    }
+    PostJob(vecPage, true, bBegin, true);
+}
+
+void NFShmCheckpoint::PostJob(std::vector<uint64_t>& vecPage, bool bStaging, bool bBegin, bool bCommit)
+{
+    m_enState = bCommit ? NF_SHM_CHECKPOINT_COMMIT : NF_SHM_CHECKPOINT_ROUND;
+    m_iJobRet = 0;
+    m_ullJobWriteSize = 0;
+    m_bJobRunning.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job.m_vecPage.swap(vecPage);
+        m_job.m_bStaging = bStaging;
+        m_job.m_bBegin = bBegin;
+        m_job.m_bCommit = bCommit;
+        m_bHasJob = true;
+    }
+    m_cond.notify_one();
+}
+
+void NFShmCheckpoint::WorkThread()
+{
+    while (true)
+    {
+        NFShmCheckpointJob job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]() { return m_bStop || m_bHasJob; });
+            if (m_bStop)
+            {
+                return;
+            }
+            job.m_vecPage.swap(m_job.m_vecPage);
+            job.m_bStaging = m_job.m_bStaging;
+            job.m_bBegin = m_job.m_bBegin;
+            job.m_bCommit = m_job.m_bCommit;
+            m_bHasJob = false;
+        }
+
+        uint64_t ullWriteSize = 0;
+        m_iJobRet = DoJob(job, ullWriteSize);
+        m_ullJobWriteSize = ullWriteSize;
+        m_bJobRunning.store(false, std::memory_order_release);
+    }
+}
+
+int NFShmCheckpoint::DoJob(NFShmCheckpointJob& job, uint64_t& ullWriteSize)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    int iFd = m_iFileFd[m_iFileIndex];
+    if (job.m_bBegin && WriteHeader(iFd, false) != 0)
+    {
+        return -1;
+    }
+
+    //连续的脏页合成一次写, 暂存区里脏页也是按页号顺序挨着放的
+    const char* pStaging = m_pStaging.get();
+    size_t siPageCount = GetPageCount();
+    size_t page = 0;
+    while (page < siPageCount)
+    {
+        if (!(job.m_vecPage[page / 64] & (1ULL << (page % 64))))
+        {
+            if (job.m_vecPage[page / 64] == 0)
+            {
+                page = (page / 64 + 1) * 64;
+            }
+            else
+            {
+                page++;
+            }
+            continue;
+        }
+
+        size_t end = page + 1;
+        while (end < siPageCount && (end - page) * m_siPageSize < NF_SHM_CHECKPOINT_WRITE_CHUNK && (job.m_vecPage[end / 64] & (1ULL << (end % 64))))
+        {
+            end++;
+        }
+
+        size_t offset = page * m_siPageSize;
+        size_t len = std::min(end * m_siPageSize, m_siSize) - offset;
+        if (m_bStop.load(std::memory_order_relaxed))
+        {
+            return -1;
+        }
+
+        //直接从共享内存读的时候主线程可能正在改, 读到一半的数据由下一轮脏页覆盖; 先拷出来, 保证CRC32和写进文件的内容一致
+        const char* pSrc = pStaging;
+        if (!job.m_bStaging)
+        {
+            memcpy(m_pWriteBuf.get(), m_pAddr + offset, len);
+            pSrc = m_pWriteBuf.get();
+        }
+        UpdatePageCrc(pSrc, page, len);
+
+        size_t done = 0;
+        while (done < len)
+        {
+            ssize_t ret = pwrite(iFd, pSrc + done, len - done, static_cast<off_t>(NF_SHM_CHECKPOINT_HEADER_SIZE + offset + done));
+            if (ret < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (ret <= 0)
+            {
+                NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint write {} failed for error:{}, {}", GetImageFile(m_strPath, m_iFileIndex), errno,
+                           strerror(errno));
+                return -1;
+            }
+            done += static_cast<size_t>(ret);
+        }
+
+        ullWriteSize += len;
+        if (job.m_bStaging)
+        {
+            pStaging += (end - page) * m_siPageSize;
+        }
+        page = end;
+    }
+
+    if (job.m_bCommit)
+    {
+        const std::vector<uint32_t>& vecPageCrc = m_vecPageCrc[m_iFileIndex];
+        size_t siCrcSize = vecPageCrc.size() * sizeof(uint32_t);
+        if (pwrite(iFd, vecPageCrc.data(), siCrcSize, static_cast<off_t>(GetPageCrcOffset(m_siSize))) != static_cast<ssize_t>(siCrcSize))
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint write page crc {} failed for error:{}, {}", GetImageFile(m_strPath, m_iFileIndex), errno,
+                       strerror(errno));
+            return -1;
+        }
+
+        //数据先落盘再写提交标记, 中途宕机这个文件就是未提交的, 恢复时用另一个
+        if (fdatasync(iFd) != 0 || WriteHeader(iFd, true) != 0)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint commit {} failed for error:{}, {}", GetImageFile(m_strPath, m_iFileIndex), errno,
+                       strerror(errno));
+            return -1;
+        }
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+int NFShmCheckpoint::WriteHeader(int iFd, bool bCommitted)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    NFShmCheckpointHeader header;
+    memset(&header, 0, sizeof(header));
+    header.m_uiMagic = NF_SHM_CHECKPOINT_MAGIC;
+    header.m_uiVersion = NF_SHM_CHECKPOINT_VERSION;
+    header.m_uiLayoutHash = m_uiLayoutHash;
+    header.m_uiPageSize = static_cast<uint32_t>(m_siPageSize);
+    header.m_ullShmSize = m_siSize;
+    header.m_ullGeneration = m_ullGeneration + 1;
+    header.m_ullCommitTime = bCommitted ? static_cast<uint64_t>(time(nullptr)) : 0;
+    header.m_uiCommitted = bCommitted ? 1 : 0;
+    if (bCommitted)
+    {
+        const std::vector<uint32_t>& vecPageCrc = m_vecPageCrc[m_iFileIndex];
+        header.m_uiDataCheckSum = CheckpointCrc32(vecPageCrc.data(), vecPageCrc.size() * sizeof(uint32_t));
+    }
+    header.m_uiCheckSum = GetHeaderCheckSum(header);
+
+    if (pwrite(iFd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) || fdatasync(iFd) != 0)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint write header failed for error:{}, {}", errno, strerror(errno));
+        return -1;
+    }
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+void NFShmCheckpoint::UpdatePageCrc(const char* pSrc, size_t page, size_t len)
+{
+    std::vector<uint32_t>& vecPageCrc = m_vecPageCrc[m_iFileIndex];
+    for (size_t offset = 0; offset < len; offset += m_siPageSize, page++)
+    {
+        vecPageCrc[page] = CheckpointCrc32(pSrc + offset, std::min(m_siPageSize, len - offset));
+    }
+}
+
+void NFShmCheckpoint::Finish()
+{
+    m_ullGeneration++;
+    m_iLastFileIndex = m_iFileIndex;
+    m_enState = NF_SHM_CHECKPOINT_IDLE;
+    m_lastTime = std::chrono::steady_clock::now();
+    m_ullLastCostUs = NFShmCheckpointUs(m_beginTime);
+    m_ullLastWriteSize = m_ullWriteSize;
+    m_ullLastStallUs = m_ullStallUs;
+    ReleaseStaging();
+
+    double costSec = m_ullLastCostUs / 1000000.0;
+    NFLogInfo(NF_LOG_DEFAULT, 0, "shm checkpoint {} generation:{} round:{} write:{}M of {}M cost:{}ms {}M/s main thread stall:{}us",
+              GetImageFile(m_strPath, m_iFileIndex), m_ullGeneration, m_iRound + 1, m_ullLastWriteSize / 1024.0 / 1024.0, m_siSize / 1024.0 / 1024.0,
+              m_ullLastCostUs / 1000, costSec > 0 ? m_ullLastWriteSize / 1024.0 / 1024.0 / costSec : 0, m_ullLastStallUs);
+}
+
+void NFShmCheckpoint::Abort()
+{
+    //这个文件已经改成未提交, 下次要整块重写
+    SetAllPage(m_vecPending[m_iFileIndex]);
+    m_enState = NF_SHM_CHECKPOINT_IDLE;
+    m_lastTime = std::chrono::steady_clock::now();
+    ReleaseStaging();
+    NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint {} failed, generation:{} still usable", GetImageFile(m_strPath, m_iFileIndex), m_ullGeneration);
+}
+
+int NFShmCheckpoint::Load(const std::string& strPath, char* pAddr, size_t siSize, uint32_t uiLayoutHash, uint64_t& ullGeneration)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    NFShmCheckpointHeader header[2];
+    bool bValid[2] = {false, false};
+    ullGeneration = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        std::string strFile = GetImageFile(strPath, i);
+        if (!ReadHeader(strFile, header[i]))
+        {
+            continue;
+        }
+
+        if (!header[i].m_uiCommitted)
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint {} not committed, skip", strFile);
+            continue;
+        }
+
+        if (header[i].m_uiLayoutHash != uiLayoutHash || header[i].m_ullShmSize != siSize ||
+            header[i].m_uiPageSize != static_cast<uint32_t>(sysconf(_SC_PAGESIZE)))
+        {
+            NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint {} not match, layout hash:{} size:{} page size:{}, need layout hash:{} size:{}", strFile,
+                         header[i].m_uiLayoutHash, header[i].m_ullShmSize, header[i].m_uiPageSize, uiLayoutHash, siSize);
+            continue;
+        }
+        bValid[i] = true;
+    }
+
+    //先用序号大的, 数据校验不过再用另一个
+    int iFirst = header[0].m_ullGeneration > header[1].m_ullGeneration ? 0 : 1;
+    int iOrder[2] = {iFirst, 1 - iFirst};
+    for (int i = 0; i < 2; i++)
+    {
+        int iIndex = iOrder[i];
+        if (bValid[iIndex] && LoadImage(GetImageFile(strPath, iIndex), header[iIndex], pAddr, siSize) == 0)
+        {
+            ullGeneration = header[iIndex].m_ullGeneration;
+            return 0;
+        }
+    }
+    return -1;
+#else
+    return -1;
+#endif
+}
+
+int NFShmCheckpoint::LoadImage(const std::string& strFile, const NFShmCheckpointHeader& header, char* pAddr, size_t siSize)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    int iFd = open(strFile.c_str(), O_RDONLY);
+    CHECK_EXPR(iFd >= 0, -1, "shm checkpoint open {} failed for error:{}, {}", strFile, errno, strerror(errno));
+
+    size_t siPageSize = header.m_uiPageSize;
+    size_t siPageCount = (siSize + siPageSize - 1) / siPageSize;
+    std::vector<uint32_t> vecPageCrc(siPageCount);
+    size_t siCrcSize = siPageCount * sizeof(uint32_t);
+    struct stat st;
+    if (fstat(iFd, &st) != 0 || static_cast<size_t>(st.st_size) < GetPageCrcOffset(siSize) + siCrcSize ||
+        pread(iFd, vecPageCrc.data(), siCrcSize, static_cast<off_t>(GetPageCrcOffset(siSize))) != static_cast<ssize_t>(siCrcSize))
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint {} size error", strFile);
+        close(iFd);
+        return -1;
+    }
+
+    if (CheckpointCrc32(vecPageCrc.data(), siCrcSize) != header.m_uiDataCheckSum)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint {} page crc table check sum error", strFile);
+        close(iFd);
+        return -1;
+    }
+
+    void* pImage = mmap(nullptr, NF_SHM_CHECKPOINT_HEADER_SIZE + siSize, PROT_READ, MAP_PRIVATE, iFd, 0);
+    close(iFd);
+    CHECK_EXPR(pImage != MAP_FAILED, -1, "shm checkpoint mmap {} failed for error:{}, {}", strFile, errno, strerror(errno));
+
+    madvise(pImage, NF_SHM_CHECKPOINT_HEADER_SIZE + siSize, MADV_SEQUENTIAL);
+    const char* pData = static_cast<const char*>(pImage) + NF_SHM_CHECKPOINT_HEADER_SIZE;
+    for (size_t page = 0; page < siPageCount; page++)
+    {
+        size_t offset = page * siPageSize;
+        size_t len = std::min(siPageSize, siSize - offset);
+        if (CheckpointCrc32(pData + offset, len) != vecPageCrc[page])
+        {
+            //共享内存已经拷了一部分, 调用方会按初始化模式重新初始化, 或者用另一个镜像整块覆盖
+            NFLogError(NF_LOG_DEFAULT, 0, "shm checkpoint {} page:{} crc error", strFile, page);
+            munmap(pImage, NF_SHM_CHECKPOINT_HEADER_SIZE + siSize);
+            return -1;
+        }
+        memcpy(pAddr + offset, pData + offset, len);
+    }
+    munmap(pImage, NF_SHM_CHECKPOINT_HEADER_SIZE + siSize);
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+void NFShmCheckpoint::ReleaseStaging()
+{
+    //最后一轮一般只有少量脏页, 留着下次用; 整块拷贝时和共享内存一样大, 用完就还
+    if (m_siStagingSize > NF_SHM_CHECKPOINT_FINAL_SIZE)
+    {
+        m_pStaging.reset();
+        m_siStagingSize = 0;
+    }
+}
+
+void NFShmCheckpoint::SetAllPage(std::vector<uint64_t>& vecPage) const
+{
+    size_t siPageCount = GetPageCount();
+    vecPage.assign(GetWordCount(), ~0ULL);
+    if (siPageCount % 64)
+    {
+        vecPage.back() = (1ULL << (siPageCount % 64)) - 1;
+    }
+}
+
+std::string NFShmCheckpoint::GetImageFile(const std::string& strPath, int iIndex)
+{
+    return strPath + "." + std::to_string(iIndex);
+}
+
+bool NFShmCheckpoint::ReadHeader(const std::string& strFile, NFShmCheckpointHeader& header)
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    int iFd = open(strFile.c_str(), O_RDONLY);
+    if (iFd < 0)
+    {
+        return false;
+    }
+
+    ssize_t ret = pread(iFd, &header, sizeof(header), 0);
+    close(iFd);
+    if (ret != static_cast<ssize_t>(sizeof(header)))
+    {
+        return false;
+    }
+
+    if (header.m_uiMagic != NF_SHM_CHECKPOINT_MAGIC || header.m_uiVersion != NF_SHM_CHECKPOINT_VERSION || header.m_uiCheckSum != GetHeaderCheckSum(header))
+    {
+        NFLogWarning(NF_LOG_DEFAULT, 0, "shm checkpoint {} header error, magic:{} version:{}", strFile, header.m_uiMagic, header.m_uiVersion);
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t NFShmCheckpoint::GetHeaderCheckSum(const NFShmCheckpointHeader& header)
+{
+    return CheckpointCrc32(&header, offsetof(NFShmCheckpointHeader, m_uiCheckSum));
+}
+
+bool NFShmCheckpoint::CheckSoftDirty()
+{
+#if NF_PLATFORM == NF_PLATFORM_LINUX
+    //用一页共享匿名内存(和共享内存一样是shmem)试一下: 清掉后没写过的页不脏, 写过的页脏
+    size_t siPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    char* pProbe = static_cast<char*>(mmap(nullptr, siPageSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0));
+    if (pProbe == MAP_FAILED)
+    {
+        return false;
+    }
+
+    bool bSupport = false;
+    int iPageMapFd = open("/proc/self/pagemap", O_RDONLY);
+    int iClearRefsFd = open("/proc/self/clear_refs", O_WRONLY);
+    if (iPageMapFd >= 0 && iClearRefsFd >= 0)
+    {
+        off_t offset = static_cast<off_t>(reinterpret_cast<size_t>(pProbe) / siPageSize * sizeof(uint64_t));
+        uint64_t clean = 0;
+        uint64_t dirty = 0;
+        pProbe[0] = 1;
+        if (write(iClearRefsFd, "4", 1) == 1 && pread(iPageMapFd, &clean, sizeof(clean), offset) == sizeof(clean))
+        {
+            pProbe[0] = 2;
+            if (pread(iPageMapFd, &dirty, sizeof(dirty), offset) == sizeof(dirty))
+            {
+                bSupport = !(clean & NF_PAGEMAP_SOFT_DIRTY) && (dirty & NF_PAGEMAP_SOFT_DIRTY);
+            }
+        }
+    }
+
+    if (iPageMapFd >= 0)
+    {
+        close(iPageMapFd);
+    }
+    if (iClearRefsFd >= 0)
+    {
+        close(iClearRefsFd);
+    }
+    munmap(pProbe, siPageSize);
+    return bSupport;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,305 @@
+// -------------------------------------------------------------------------
+//    @FileName         :    NFShmCheckpoint.h
+//    @Author           :    gaoyi
+//    @Date             :    2025/5/29
+//    @Email            :    445267987@qq.com
+//    @Module           :    NFShmPlugin
+//
+// -------------------------------------------------------------------------
+
+#pragma once
+
+#include "NFComm/NFCore/NFPlatform.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief 镜像文件头的魔数"NFCK"
+ */
+#define NF_SHM_CHECKPOINT_MAGIC 0x4B43464E
+
+/**
+ * @brief 镜像文件格式版本, 文件头或者数据排布改了要加1
+ */
+#define NF_SHM_CHECKPOINT_VERSION 3
+
+/**
+ * @brief 镜像文件头占用的大小, 共享内存数据从这个偏移开始, 按页对齐方便mmap
+ */
+#define NF_SHM_CHECKPOINT_HEADER_SIZE 4096
+
+/**
+ * @brief 脏页少于这个大小时在主线程拷到暂存区做最后一轮, 决定了一次写盘主线程最多卡多久
+ */
+#define NF_SHM_CHECKPOINT_FINAL_SIZE (16 * 1024 * 1024)
+
+/**
+ * @brief 后台追脏页的最大轮数, 超过后不管剩多少脏页都在主线程拷贝
+ */
+#define NF_SHM_CHECKPOINT_MAX_ROUND 5
+
+/**
+ * @brief 后台线程一次pwrite的最大长度
+ */
+#define NF_SHM_CHECKPOINT_WRITE_CHUNK (1024 * 1024)
+
+/**
+ * @brief 镜像文件头
+ */
+struct NFShmCheckpointHeader
+{
+    uint32_t m_uiMagic;
+    uint32_t m_uiVersion;
+    uint32_t m_uiLayoutHash; //对象类型/大小/个数算出来的hash, 不一致的镜像不能恢复
+    uint32_t m_uiPageSize;
+    uint64_t m_ullShmSize;
+    uint64_t m_ullGeneration; //第几次写盘, 两个文件取大的
+    uint64_t m_ullCommitTime;
+    uint32_t m_uiCommitted; //写完并且落盘后才置1, 写一半宕机的文件不会被使用
+    uint32_t m_uiDataCheckSum; //每页CRC32表的CRC32, 表放在数据后面, 恢复时逐页校验
+    uint32_t m_uiCheckSum; //前面字段的CRC32
+};
+
+enum NFShmCheckpointState
+{
+    NF_SHM_CHECKPOINT_IDLE = 0, //空闲, 等下一次写盘
+    NF_SHM_CHECKPOINT_ROUND = 1, //后台线程在直接从共享内存写脏页, 写的过程中主线程还在改, 写完要再追一轮
+    NF_SHM_CHECKPOINT_COMMIT = 2, //最后一轮脏页已经拷到暂存区, 后台线程写完后落盘提交
+};
+
+/**
+ * @brief 共享内存增量写盘, 机器重启/迁移后共享内存没了, 用镜像恢复, 不用再从DB全部加载
+ *
+ * 做法:
+ * 1. 写两个镜像文件path.0和path.1轮流写, 任何时候至少有一个是完整的
+ * 2. 用/proc/self/clear_refs和/proc/self/pagemap的soft-dirty位跟踪脏页, 每个文件只写上次写它以后改过的页
+ * 3. 后台线程直接从共享内存写脏页, 主线程照常运行; 写完一轮后主线程取这期间的脏页, 脏页足够少时在主线程拷到暂存区,
+ *    这一刻就是镜像对应的时间点, 后台线程写完暂存区后落盘提交. 主线程只在取脏页和拷最后一轮时停一下
+ * 4. 内核不支持soft-dirty(CONFIG_MEM_SOFT_DIRTY)时每次都在主线程整块拷贝, 会卡一下, 启动时打警告
+ * 5. 文件布局: 4K文件头 + 共享内存数据 + 每页一个CRC32的表, 写盘时按实际写进文件的内容算, 恢复时校验不过就用另一个镜像
+ *
+ * 限制: 只跟踪主线程对共享内存的修改; 共享内存页被换出到swap后soft-dirty位会丢, 所以没有映射的页都当成脏页
+ * clear_refs是整个进程一起清的, 一个进程里有多个实例(AllMoreServer)时互相会清掉对方的脏页位,
+ * 所以同时有多个实例时不用soft-dirty, 每次整块拷贝; 别的实例清过以后自己第一次取脏页也按全脏处理
+ *
+ * 恢复要启动时带--CheckpointRestore, 默认新建的共享内存不从镜像恢复
+ * DB一致性: 镜像之后DB还会继续更新, 恢复出来的存DB的对象可能比DB旧, 以DB为准. 恢复后NFShmMgr::IsCheckpointRecover()为true,
+ * NFBaseDBObj/NFISaveDb对象被标记为要重新从DB加载, 重新加载之前不会存盘; NFBaseDBObj由NFDBObjMgr::Tick重新加载,
+ * 自己存DB的模块要自己检查这个标记
+ */
+class NFShmCheckpoint
+{
+public:
+    NFShmCheckpoint();
+
+    virtual ~NFShmCheckpoint();
+
+    /**
+     * @brief 初始化, 打开镜像文件, 启动后台线程
+     * @param strPath 镜像路径, 实际文件是strPath.0和strPath.1
+     * @param pAddr 共享内存起始地址, 按页对齐
+     * @param siSize 共享内存大小
+     * @param uiLayoutHash 对象布局hash
+     * @param iIntervalSec 写盘间隔(秒), 0表示只在调用Start时写
+     * @return 0成功
+     */
+    int Init(const std::string& strPath, char* pAddr, size_t siSize, uint32_t uiLayoutHash, int iIntervalSec);
+
+    /**
+     * @brief 停止后台线程, 正在写的镜像作废, 另一个镜像不受影响
+     */
+    void Stop();
+
+    /**
+     * @brief 主线程每帧调用, 推进写盘状态, 不会阻塞等待磁盘
+     * @return 0正常, 写盘失败返回-1
+     */
+    int Tick();
+
+    /**
+     * @brief 立即开始一次写盘
+     * @return 0成功, 正在写或者没有初始化返回-1
+     */
+    int Start();
+
+    NFShmCheckpointState GetState() const { return m_enState; }
+
+    /**
+     * @brief 是否按soft-dirty增量写盘, 内核不支持或者进程里同时有多个实例时为false
+     */
+    bool IsSoftDirty() const;
+
+    /**
+     * @brief 最后一次提交成功的镜像序号
+     */
+    uint64_t GetGeneration() const { return m_ullGeneration; }
+
+    /**
+     * @brief 最后一次写盘写了多少字节
+     */
+    uint64_t GetLastWriteSize() const { return m_ullLastWriteSize; }
+
+    /**
+     * @brief 最后一次写盘从开始到提交的耗时(微秒)
+     */
+    uint64_t GetLastCostUs() const { return m_ullLastCostUs; }
+
+    /**
+     * @brief 最后一次写盘主线程的停顿耗时之和(微秒)
+     */
+    uint64_t GetLastStallUs() const { return m_ullLastStallUs; }
+
+public:
+    /**
+     * @brief 从镜像恢复共享内存, 取两个镜像里有效并且序号大的一个, mmap后拷到共享内存
+     * @param ullGeneration 恢复的镜像序号
+     * @return 0成功, 没有可用的镜像返回-1
+     */
+    static int Load(const std::string& strPath, char* pAddr, size_t siSize, uint32_t uiLayoutHash, uint64_t& ullGeneration);
+
+    /**
+     * @brief 从一个镜像文件恢复, 先校验每页CRC32表, 再逐页校验数据后拷到共享内存
+     * @return 0成功
+     */
+    static int LoadImage(const std::string& strFile, const NFShmCheckpointHeader& header, char* pAddr, size_t siSize);
+
+    /**
+     * @brief 镜像文件名, strPath.0或者strPath.1
+     */
+    static std::string GetImageFile(const std::string& strPath, int iIndex);
+
+    /**
+     * @brief 读镜像文件头, 检查魔数/版本/校验和, 不检查是否提交
+     */
+    static bool ReadHeader(const std::string& strFile, NFShmCheckpointHeader& header);
+
+    static uint32_t GetHeaderCheckSum(const NFShmCheckpointHeader& header);
+
+    /**
+     * @brief 检查内核是否支持共享内存的soft-dirty跟踪
+     */
+    static bool CheckSoftDirty();
+
+protected:
+    /**
+     * @brief 取出上次取以后改过的页, 并清掉soft-dirty, 只能在主线程调用
+     * @return 脏页数
+     */
+    virtual size_t CollectDirty(std::vector<uint64_t>& vecDirty);
+
+    size_t GetPageCount() const { return (m_siSize + m_siPageSize - 1) / m_siPageSize; }
+
+    size_t GetWordCount() const { return (GetPageCount() + 63) / 64; }
+
+    /**
+     * @brief 每页CRC32表在镜像文件里的偏移
+     */
+    static size_t GetPageCrcOffset(size_t siSize) { return NF_SHM_CHECKPOINT_HEADER_SIZE + siSize; }
+
+    /**
+     * @brief 所有页都置为要写
+     */
+    void SetAllPage(std::vector<uint64_t>& vecPage) const;
+
+private:
+    /**
+     * @brief 后台线程要做的事
+     */
+    struct NFShmCheckpointJob
+    {
+        std::vector<uint64_t> m_vecPage; //要写的页的位图
+        bool m_bStaging; //数据在暂存区里按页号顺序紧挨着放, 否则直接从共享内存读
+        bool m_bBegin; //先把文件头改成未提交
+        bool m_bCommit; //写完后落盘并提交
+    };
+
+    /**
+     * @brief 把脏页拷到暂存区, 交给后台线程落盘提交
+     */
+    void PostCommit(std::vector<uint64_t>& vecPage, size_t siPageCount, bool bBegin);
+
+    void PostJob(std::vector<uint64_t>& vecPage, bool bStaging, bool bBegin, bool bCommit);
+
+    void WorkThread();
+
+    int DoJob(NFShmCheckpointJob& job, uint64_t& ullWriteSize);
+
+    int WriteHeader(int iFd, bool bCommitted);
+
+    /**
+     * @brief 把数据按页算CRC32记到正在写的文件的表里, pSrc是实际写进文件的内容
+     */
+    void UpdatePageCrc(const char* pSrc, size_t page, size_t len);
+
+    void Finish();
+
+    void Abort();
+
+    void ReleaseStaging();
+
+protected:
+    std::string m_strPath;
+    char* m_pAddr;
+    size_t m_siSize;
+    size_t m_siPageSize;
+    uint32_t m_uiLayoutHash;
+    int m_iIntervalSec;
+    bool m_bSoftDirty;
+
+private:
+    int m_iPageMapFd;
+    int m_iClearRefsFd;
+    int m_iFileFd[2];
+    bool m_bRegistered; //已经算进进程里的实例数
+    uint64_t m_ullClearRefsCount; //自己最后一次清soft-dirty后进程里的清除次数, 不相等说明别的实例清过
+
+    /**
+     * @brief 每个文件里每页的CRC32, 只在后台线程里改
+     */
+    std::vector<uint32_t> m_vecPageCrc[2];
+    std::unique_ptr<char[]> m_pWriteBuf; //直接从共享内存写时先拷出来, 算CRC32和写进文件的是同一份内容
+
+    /**
+     * @brief 每个文件上次提交以后改过的页, 取到脏页时两个都要记
+     */
+    std::vector<uint64_t> m_vecPending[2];
+
+    NFShmCheckpointState m_enState;
+    int m_iFileIndex; //正在写的文件
+    int m_iLastFileIndex; //最后一次提交的文件
+    int m_iRound;
+    uint64_t m_ullGeneration;
+    std::chrono::steady_clock::time_point m_lastTime; //上次写盘结束的时间
+    std::chrono::steady_clock::time_point m_beginTime;
+    uint64_t m_ullStallUs;
+    uint64_t m_ullLastWriteSize;
+    uint64_t m_ullLastCostUs;
+    uint64_t m_ullLastStallUs;
+    std::unique_ptr<char[]> m_pStaging; //最后一轮脏页的拷贝, 不用vector避免多一遍清零
+    size_t m_siStagingSize;
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::atomic<bool> m_bStop;
+    bool m_bHasJob;
+    NFShmCheckpointJob m_job;
+    std::atomic<bool> m_bJobRunning;
+    int m_iJobRet;
+    uint64_t m_ullJobWriteSize;
+    uint64_t m_ullWriteSize;
+
+    /**
+     * @brief 进程里所有实例共用, 取脏页和清soft-dirty都要加锁
+     */
+    static std::mutex s_softDirtyMutex;
+    static int s_iInstanceCount;
+    static uint64_t s_ullClearRefsCount;
+};
@@ -207,7 +207,7 @@ int NFShmObjSeg::SetAndInitObj(NFCShmMngModule* pShmModule, size_t nObjSize, int
         }
 #endif
 
-        FormatObj();
+        //对象区的FormatObj由NFCShmMngModule::ResumeAllObjSeg在所有段分配完后分块并行执行
 
         if (m_iUseHash)
         {
@@ -251,22 +251,42 @@ NFObject* NFShmObjSeg::GetObj(int iIdx)
 }
 
 int NFShmObjSeg::FormatObj()
+{
+    return FormatObj(0, GetFormatCount());
+}
+
+int NFShmObjSeg::GetFormatCount() const
 {
 #ifdef SHM_OBJ_SEQ_USE_VECTOR_INDEX
-    for (auto iter = m_idxVec.begin(); iter != m_idxVec.end(); ++iter)
+    return m_idxVec.size();
+#else
+    return m_iItemCount;
+#endif
+}
+
+int NFShmObjSeg::FormatObj(int iBegin, int iEnd)
+{
+    CHECK_EXPR(iBegin >= 0 && iBegin <= iEnd && iEnd <= GetFormatCount(), -1, "iBegin:{} iEnd:{} count:{} error", iBegin, iEnd, GetFormatCount());
+#ifdef SHM_OBJ_SEQ_USE_VECTOR_INDEX
+    for (int i = iBegin; i < iEnd; i++)
     {
-        CHECK_EXPR(iter->GetIndex() >= 0 && iter->GetIndex() < m_iItemCount, -1, "iter->GetIndex():{} error stack:{}", iter->GetIndex(), TRACE_STACK());
-        char* p = m_pObjs + (sizeof(int) + m_nObjSize) * iter->GetIndex();
+        NFShmIdx& idx = m_idxVec[i];
+        CHECK_EXPR(idx.GetIndex() >= 0 && idx.GetIndex() < m_iItemCount, -1, "idx.GetIndex():{} error stack:{}", idx.GetIndex(), TRACE_STACK());
+        char* p = m_pObjs + (sizeof(int) + m_nObjSize) * idx.GetIndex();
         char* buf = p + sizeof(int);
-        iter->SetObjBuf(buf);
+        idx.SetObjBuf(buf);
         m_pCreateFn(buf);
     }
 #else
-    for (auto iter = m_idxLst.begin(); iter != m_idxLst.end(); ++iter)
+    for (int i = iBegin; i < iEnd; i++)
     {
-        void* p = m_pObjs + m_nObjSize * iter.m_node->m_self;
-        iter->SetObjBuf(p);
-        m_pCreateFn(p);
+        auto pNode = m_idxLst.GetNode(i);
+        if (pNode && pNode->m_valid)
+        {
+            void* p = m_pObjs + m_nObjSize * i;
+            pNode->m_data.SetObjBuf(p);
+            m_pCreateFn(p);
+        }
     }
 #endif
 
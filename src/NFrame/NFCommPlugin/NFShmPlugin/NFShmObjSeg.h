@@ -46,6 +46,19 @@ public:
 public:
     int FormatObj();                        //格式化对象区
 
+    /**
+     * @brief 格式化对象区的一段, 恢复时按段分给多个线程并行执行
+     * @param iBegin 起始位置(包含), 取值范围[0, GetFormatCount()]
+     * @param iEnd 结束位置(不包含)
+     * @return 0成功
+     */
+    int FormatObj(int iBegin, int iEnd);
+
+    /**
+     * @brief FormatObj(iBegin, iEnd)的位置总数, vector索引下为已使用对象数, list索引下为对象总数
+     */
+    int GetFormatCount() const;
+
     void *AllocMemForObject();
 
     int FreeMemForObject(void *pMem);
@@ -95,5 +95,8 @@ bool NFShmPlugin::InitShmObjectRegister()
     REGISTER_SINGLETON_SHM_OBJ(NFShmEventMgr);
     REGISTER_SINGLETON_SHM_OBJ(NFShmTransMng);
     REGISTER_SHM_OBJ(NFTransBase, 0);
+
+    //NFShmTimerMng::ResumeInit要遍历所有NFShmTimer
+    REGISTER_SHM_OBJ_RESUME_AFTER(NFShmTimerMng, NFShmTimer);
 	return true;
 }
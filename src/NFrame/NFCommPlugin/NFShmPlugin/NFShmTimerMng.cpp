@@ -90,7 +90,7 @@ void NFShmTimerSlot::ClearRunStatus(uint32_t seq)
     m_slotSeq = seq;
 }
 
-bool NFShmTimerSlot::OnTick(NFShmTimerMng* pTimerManager, int64_t tick, list<NFShmTimer*>& timeoutList, uint32_t seq, NFTimerIdData* allIdData)
+bool NFShmTimerSlot::OnTick(NFShmTimerMng* pTimerManager, int64_t tick, int* timeoutList, int& timeoutCount, uint32_t seq, NFTimerIdData* allIdData)
 {
     if (seq == m_slotSeq)
     {
@@ -163,8 +163,8 @@ bool NFShmTimerSlot::OnTick(NFShmTimerMng* pTimerManager, int64_t tick, list<NFS
                 ++curCount;
                 // 这个会自动返回一个tmpData
                 tmpData = UnBindListTimer(pTimerManager, pTimer, tmpData, allIdData);
-                //超时的定时器
-                timeoutList.push_back(pTimer);
+                //超时的定时器, curCount不超过CUR_SLOT_TICK_MAX, 超时列表不会越界
+                timeoutList[timeoutCount++] = pTimer->GetObjId();
             }
         }
         else
@@ -196,6 +196,38 @@ bool NFShmTimerSlot::OnTick(NFShmTimerMng* pTimerManager, int64_t tick, list<NFS
     return false;
 }
 
+int NFShmTimerSlot::Cascade(NFShmTimerMng* pTimerManager, NFTimerIdData* allIdData)
+{
+    int count = 0;
+
+    // 每次都摘头节点, 重新挂载的定时器一定在更低的层, 不会再回到这个槽
+    while (m_headData.m_nextIndex != -1)
+    {
+        if (m_headData.m_nextIndex < 0 || m_headData.m_nextIndex >= ALL_TIMER_COUNT)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "cascade slot head index error:{} {}", m_headData.m_nextIndex, m_index);
+            m_headData.m_nextIndex = -1;
+            m_headData.m_preIndex = -1;
+            m_count = 0;
+            break;
+        }
+
+        NFTimerIdData* tmpData = &allIdData[m_headData.m_nextIndex];
+        NFShmTimer* pTimer = pTimerManager->GetTimer(tmpData->m_objId);
+        if (!pTimer)
+        {
+            NFLogError(NF_LOG_DEFAULT, 0, "cascade slot timer error : {} {} {}", m_index, tmpData->m_curIndex, tmpData->m_objId);
+        }
+
+        UnBindListTimer(pTimerManager, pTimer, tmpData, allIdData);
+        pTimerManager->CascadeTimer(pTimer);
+        ++count;
+    }
+
+    m_curRunIndex = -1;
+    return count;
+}
+
 NFTimerIdData* NFShmTimerSlot::UnBindListTimer(NFShmTimerMng* pTimerManager, NFShmTimer* timer, const NFTimerIdData* tmpData, NFTimerIdData* allIdData)
 {
     if (!tmpData || !allIdData)
@@ -292,7 +324,7 @@ NFShmTimerMng::~NFShmTimerMng()
 
 int NFShmTimerMng::CreateInit()
 {
-    for (int i = 0; i < SLOT_COUNT; ++i)
+    for (int i = 0; i < SHM_TIMER_ALL_SLOT_COUNT; ++i)
     {
         m_slots[i].CreateInit();
         m_slots[i].SetIndex(i);
@@ -300,7 +332,9 @@ int NFShmTimerMng::CreateInit()
 
     NFLogInfo(NF_LOG_DEFAULT, 0, " init timer manager : {}", NF_ADJUST_TIMENOW_MS());
     m_currSlot = 0;
+    m_wheelRound = 0;
     m_beforeTick = NF_ADJUST_TIMENOW_MS();
+    m_timeoutCount = 0;
     m_iFreeIndex = 0;
     m_timerSeq = 1;
     for (int i = 0; i < ALL_TIMER_COUNT; ++i)
@@ -378,7 +412,7 @@ int NFShmTimerMng::Delete(int objectId)
     NFLogTrace(NF_LOG_DEFAULT, 0, "--delete timer : {}", timer->GetDetailStructMsg());
 
     int index = timer->GetSlotIndex();
-    if (index >= 0 && index < SLOT_COUNT)
+    if (index >= 0 && index < SHM_TIMER_ALL_SLOT_COUNT)
     {
         if (!m_slots[index].DeleteTimer(this, timer, m_timerIdData))
         {
@@ -422,30 +456,35 @@ void NFShmTimerMng::OnTick(int64_t tick)
             return;
         }
 
-        list<NFShmTimer*> lRetsetTimer;
+        m_timeoutCount = 0;
 
         // m_currSlot的里面，是时间在m_beforeTick ~ （m_beforeTick + SLOT_TICK_TIME）区间的timer
-        bool isNext = m_slots[m_currSlot].OnTick(this, m_beforeTick + SLOT_TICK_TIME, lRetsetTimer, m_timerSeq,
+        bool isNext = m_slots[m_currSlot].OnTick(this, m_beforeTick + SLOT_TICK_TIME, m_timeoutTimer, m_timeoutCount, m_timerSeq,
                                                  m_timerIdData);
 
-        list<NFShmTimer*>::iterator it;
-        for (it = lRetsetTimer.begin(); it != lRetsetTimer.end(); ++it)
+        for (int i = 0; i < m_timeoutCount; ++i)
         {
-            //(*it)->PrintfDebug();
+            NFShmTimer* pTimer = GetTimer(m_timeoutTimer[i]);
+            if (!pTimer)
+            {
+                continue;
+            }
+
+            //pTimer->PrintfDebug();
 
             bool isDel = true;
 
-            if (!(*it)->IsWaitDelete())
+            if (!pTimer->IsWaitDelete())
             {
-                if (E_TIMER_HANDLER_NULL != (*it)->OnTick(m_beforeTick + SLOT_TICK_TIME))
+                if (E_TIMER_HANDLER_NULL != pTimer->OnTick(m_beforeTick + SLOT_TICK_TIME))
                 {
                     // 如果不是一次性的定时器，就又加入槽
-                    if ((*it)->GetType() != NFShmTimer::ONCE_TIMER &&
-                        ((*it)->GetCallCount() > 0 || (*it)->GetCallCount() == static_cast<int32_t>(NFSHM_INFINITY_CALL)))
+                    if (pTimer->GetType() != NFShmTimer::ONCE_TIMER &&
+                        (pTimer->GetCallCount() > 0 || pTimer->GetCallCount() == static_cast<int32_t>(NFSHM_INFINITY_CALL)))
                     {
                         // 一定要确保用了m_currSlot就必须是m_beforeTick作为时间，这样才能一致
                         // 由于attacktimer里面用的是m_currSLot作为起始点，那么时间传m_beforeTick
-                        if (AttachTimer(*it, m_beforeTick, false))
+                        if (AttachTimer(pTimer, m_beforeTick, false))
                         {
                             isDel = false;
                         }
@@ -453,13 +492,14 @@ void NFShmTimerMng::OnTick(int64_t tick)
                 }
             }
 
-            if (isDel && !(*it)->IsDelete())
+            if (isDel && !pTimer->IsDelete())
             {
-                //				LOGSVR_TRACE("--delete timer tick : "<< tick << (*it)->GetDetailStructMsg());
-                (*it)->SetDelete();
-                FindModule<NFIMemMngModule>()->DestroyObj(*it);
+                //				LOGSVR_TRACE("--delete timer tick : "<< tick << pTimer->GetDetailStructMsg());
+                pTimer->SetDelete();
+                FindModule<NFIMemMngModule>()->DestroyObj(pTimer);
             }
         }
+        m_timeoutCount = 0;
 
         ++tickCount;
         if (isNext)
@@ -467,7 +507,11 @@ void NFShmTimerMng::OnTick(int64_t tick)
             m_beforeTick += SLOT_TICK_TIME;
             ++m_timerSeq;
             if (++m_currSlot >= static_cast<uint32_t>(SLOT_COUNT))
+            {
                 m_currSlot = 0;
+                ++m_wheelRound;
+                CascadeWheel();
+            }
         }
 
         if (tickCount >= 10000 || (tick - m_beforeTick) < 2 * SLOT_TICK_TIME)
@@ -497,7 +541,7 @@ int NFShmTimerMng::AddTimer(NFShmTimer* timer, int64_t tick, bool isNewTimer)
 
 int NFShmTimerMng::AddTimer(NFShmTimer* timer, int slot)
 {
-    if (slot < 0 || SLOT_COUNT <= slot)
+    if (slot < 0 || SHM_TIMER_ALL_SLOT_COUNT <= slot)
     {
         NFLogError(NF_LOG_DEFAULT, 0, "slot index error : {} {}", slot, timer->GetDetailStructMsg());
         return -1;
@@ -650,9 +694,7 @@ bool NFShmTimerMng::AttachTimer(NFShmTimer* timer, int64_t tick, bool isNewTimer
         }
     }
 
-    slotNum = (m_currSlot + ticks % SLOT_COUNT) % SLOT_COUNT;
-    timer->SetRound(ticks / SLOT_COUNT + 1);
-    slotNum = AddTimer(timer, slotNum);
+    slotNum = AddTimerToWheel(timer, ticks);
     if (slotNum < 0)
     {
         NFLogError(NF_LOG_DEFAULT, 0, "--add timer to slot but slot is less than 0 : {}",
@@ -663,6 +705,82 @@ bool NFShmTimerMng::AttachTimer(NFShmTimer* timer, int64_t tick, bool isNewTimer
     return true;
 }
 
+int NFShmTimerMng::AddTimerToWheel(NFShmTimer* timer, int64_t ticks)
+{
+    if (ticks < 0)
+    {
+        ticks = 0;
+    }
+
+    if (ticks < SLOT_COUNT)
+    {
+        timer->SetRound(1);
+        return AddTimer(timer, static_cast<int>((m_currSlot + ticks) % SLOT_COUNT));
+    }
+
+    // 高层的槽按绝对槽号计算, 第L层的一个槽覆盖SLOT_COUNT * SHM_TIMER_LEVEL_SLOT_COUNT^(L-1)个第0层的槽
+    int64_t curTicks = static_cast<int64_t>(m_wheelRound) * SLOT_COUNT + m_currSlot;
+    int64_t unit = SLOT_COUNT;
+    for (int level = 1; level < SHM_TIMER_WHEEL_LEVEL; ++level)
+    {
+        int64_t span = unit * SHM_TIMER_LEVEL_SLOT_COUNT;
+        if (ticks < span || level == SHM_TIMER_WHEEL_LEVEL - 1)
+        {
+            if (ticks >= span)
+            {
+                // 超出时间轮范围的先挂在最高层, 下放时按真实的执行时间重新计算
+                ticks = span - 1;
+            }
+
+            int index = static_cast<int>(((curTicks + ticks) / unit) % SHM_TIMER_LEVEL_SLOT_COUNT);
+            timer->SetRound(static_cast<int>(ticks / SLOT_COUNT + 1));
+            return AddTimer(timer, SLOT_COUNT + (level - 1) * SHM_TIMER_LEVEL_SLOT_COUNT + index);
+        }
+        unit = span;
+    }
+
+    return -1;
+}
+
+void NFShmTimerMng::CascadeWheel()
+{
+    int64_t unit = 1;
+    for (int level = 1; level < SHM_TIMER_WHEEL_LEVEL; ++level)
+    {
+        int index = static_cast<int>((m_wheelRound / unit) % SHM_TIMER_LEVEL_SLOT_COUNT);
+        m_slots[SLOT_COUNT + (level - 1) * SHM_TIMER_LEVEL_SLOT_COUNT + index].Cascade(this, m_timerIdData);
+        if (index != 0)
+        {
+            break;
+        }
+        unit *= SHM_TIMER_LEVEL_SLOT_COUNT;
+    }
+}
+
+void NFShmTimerMng::CascadeTimer(NFShmTimer* pTimer)
+{
+    if (!pTimer || pTimer->IsDelete())
+    {
+        return;
+    }
+
+    if (pTimer->IsWaitDelete())
+    {
+        // 挂在高层时已经被删除, 不需要再下放
+        pTimer->SetDelete();
+        FindModule<NFIMemMngModule>()->DestroyObj(pTimer);
+        return;
+    }
+
+    int64_t ticks = (pTimer->GetNextRun() - m_beforeTick) / SLOT_TICK_TIME;
+    if (AddTimerToWheel(pTimer, ticks) < 0)
+    {
+        NFLogError(NF_LOG_DEFAULT, 0, "cascade timer error:{}", pTimer->GetDetailStructMsg());
+        pTimer->SetDelete();
+        FindModule<NFIMemMngModule>()->DestroyObj(pTimer);
+    }
+}
+
 bool NFShmTimerMng::SetDistanceTime(NFShmTimer* stime, int hour, int minutes, int second, int microSec, int interval, int callCount)
 {
     int64_t start = static_cast<int64_t>(hour) * 3600 * 1000 + static_cast<int64_t>(minutes) * 60 * 1000 + static_cast<int64_t>(second) * 1000 + static_cast<int64_t>(microSec);
@@ -12,7 +12,6 @@
 #include "NFShmTimer.h"
 #include "NFComm/NFShmStl/NFShmHashMap.h"
 #include "NFComm/NFObjCommon/NFNodeList.h"
-#include <list>
 
 #define SLOT_COUNT 600
 #define SLOT_TICK_TIME 32
@@ -20,6 +19,12 @@
 #define ALL_TIMER_COUNT 30000
 #define CUR_SLOT_TICK_MAX 500
 
+// 多层时间轮, 第0层是SLOT_COUNT个SLOT_TICK_TIME的槽(约19秒), 往上每层SHM_TIMER_LEVEL_SLOT_COUNT个槽, 依次约为20分钟, 21小时, 58天
+// 远期的定时器(天/周/月循环)挂在高层的粗粒度槽上, 只有快到期时才逐层下放到第0层, 不会每转一圈都被扫描一次
+#define SHM_TIMER_WHEEL_LEVEL 4
+#define SHM_TIMER_LEVEL_SLOT_COUNT 64
+#define SHM_TIMER_ALL_SLOT_COUNT (SLOT_COUNT + (SHM_TIMER_WHEEL_LEVEL - 1) * SHM_TIMER_LEVEL_SLOT_COUNT)
+
 struct NFTimerIdData
 {
     int m_preIndex;
@@ -46,7 +51,13 @@ public:
 
     int AddTimer(NFShmTimer* timer, NFTimerIdData* idData, NFTimerIdData* allIdData);
 
-    bool OnTick(NFShmTimerMng* pTimerManager, int64_t tick, std::list<NFShmTimer*>& timeoutList, uint32_t seq, NFTimerIdData* allIdData);
+    bool OnTick(NFShmTimerMng* pTimerManager, int64_t tick, int* timeoutList, int& timeoutCount, uint32_t seq, NFTimerIdData* allIdData);
+
+    /**
+     * @brief 把高层槽里的所有定时器摘下来, 交给定时器管理器重新挂到低层
+     * @return 下放的定时器个数
+     */
+    int Cascade(NFShmTimerMng* pTimerManager, NFTimerIdData* allIdData);
 
     bool DeleteTimer(NFShmTimerMng* pTimerManager, NFShmTimer* timer, NFTimerIdData* allIdData);
 
@@ -79,6 +90,9 @@ public:
 
     void OnTick(int64_t tick);
 
+    // 下一个槽到期的时间(毫秒), 主循环空闲等待不能超过它
+    int64_t GetNextTickTime() const { return m_beforeTick + SLOT_TICK_TIME; }
+
     // 删除此定时器
     int Delete(int objectId);
 
@@ -86,6 +100,9 @@ public:
 
     void ReleaseTimerIdData(int index);
 
+    // 高层槽下放时, 把定时器重新挂到对应的槽上
+    void CascadeTimer(NFShmTimer* pTimer);
+
     //注册距离现在多少时间执行一次的定时器(hour  minutes  second  microSec为第一次执行距离现在的时分秒毫秒, 只执行一次)
     int SetTimer(const NFObject* pObj, int hour, int minutes, int second, int microSec, const NFRawObject* pRawShmObj = nullptr);
 
@@ -129,6 +146,12 @@ private:
 
     int AddTimer(NFShmTimer* timer, int slot);
 
+    // 根据距离m_beforeTick的槽数选择所在层和槽
+    int AddTimerToWheel(NFShmTimer* timer, int64_t ticks);
+
+    // 第0层转完一圈, 逐层下放高层槽
+    void CascadeWheel();
+
     bool SetDistanceTime(NFShmTimer* stime, int hour, int minutes, int second, int microSec, int interval = 0, int callCount = 1);
 
     bool SetDayTime(NFShmTimer* stime, int hour, int minutes, int second, int interval = 0, int callCount = 1);
@@ -145,10 +168,14 @@ private:
     bool CheckFull() const;
 
 private:
-    NFShmTimerSlot m_slots[SLOT_COUNT];
+    NFShmTimerSlot m_slots[SHM_TIMER_ALL_SLOT_COUNT]; //前SLOT_COUNT个是第0层, 后面依次是高层的槽
     uint32_t m_currSlot;
+    uint32_t m_wheelRound; //第0层转过的圈数, 用来计算高层当前的槽
     int64_t m_beforeTick; //上一次执行的tick数
 
+    int m_timeoutTimer[CUR_SLOT_TICK_MAX]; //预分配的超时列表, 存放本次tick超时的定时器objid
+    int m_timeoutCount;
+
     NFTimerIdData m_timerIdData[ALL_TIMER_COUNT + 1];
     int m_iFreeIndex;
     uint32_t m_timerSeq; // 每次tick的seq,只有当前m_currSlot已经遍历完了，才会++
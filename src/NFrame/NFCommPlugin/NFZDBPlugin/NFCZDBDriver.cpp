@@ -2694,6 +2694,9 @@ int NFCZDBDriver::CreateSql(const NFrame::storesvr_modobj &select, std::map<std:
     NFProtobufCommon::GetMapDBFieldsFromMessage(*pMessageObject, keyMap, kevValueMap);
     delete pMessageObject;
 
+    // 按字段增量存储, 只更新修改过的列
+    NFProtobufCommon::FilterDBFieldsByTopFields(select.baseinfo().sel_fields(), keyMap, kevValueMap);
+
     NFLogTrace(NF_LOG_DEFAULT, 0, "--- end -- ");
     return 0;
 }
@@ -71,6 +71,14 @@ NFCPluginManager::NFCPluginManager() : m_appInited(this)
 	m_isDaemon = false;
 	// 共享内存初始化状态（默认未初始化）
 	m_bInitShm = false;
+	// 共享内存恢复线程数（默认按CPU核数）
+	m_iShmResumeThreadNum = 0;
+	// 共享内存大页、预缺页、NUMA节点（默认都不开）
+	m_bShmHugePage = false;
+	m_bShmPrefault = false;
+	m_iShmNumaNode = -1;
+	m_iShmCheckpointInterval = 300;
+	m_bShmCheckpointRestore = false;
 	// 是否杀死前一个应用实例（默认关闭）
 	m_isKillPreApp = false;
 	// 配置重载状态（默认关闭）
@@ -93,6 +101,10 @@ NFCPluginManager::NFCPluginManager() : m_appInited(this)
 	// 设置空闲状态休眠微秒数
 	m_idleSleepUs = 1000;
 
+	// 事件唤醒模式（默认关闭）
+	m_bWakeupMode = false;
+	m_nNextWakeupTime = 0;
+
 	// 初始化服务器时间系统
 	NFServerTime::Instance()->Init(static_cast<int>(m_nFrame));
 
@@ -127,6 +139,76 @@ void NFCPluginManager::SetInitShm()
 	m_bInitShm = true;
 }
 
+int NFCPluginManager::GetShmResumeThreadNum() const
+{
+	return m_iShmResumeThreadNum;
+}
+
+void NFCPluginManager::SetShmResumeThreadNum(int num)
+{
+	m_iShmResumeThreadNum = num;
+}
+
+bool NFCPluginManager::IsShmHugePage() const
+{
+	return m_bShmHugePage;
+}
+
+void NFCPluginManager::SetShmHugePage(bool bHugePage)
+{
+	m_bShmHugePage = bHugePage;
+}
+
+bool NFCPluginManager::IsShmPrefault() const
+{
+	return m_bShmPrefault;
+}
+
+void NFCPluginManager::SetShmPrefault(bool bPrefault)
+{
+	m_bShmPrefault = bPrefault;
+}
+
+int NFCPluginManager::GetShmNumaNode() const
+{
+	return m_iShmNumaNode;
+}
+
+void NFCPluginManager::SetShmNumaNode(int node)
+{
+	m_iShmNumaNode = node;
+}
+
+const std::string& NFCPluginManager::GetShmCheckpointPath() const
+{
+	return m_strShmCheckpointPath;
+}
+
+void NFCPluginManager::SetShmCheckpointPath(const std::string& path)
+{
+	m_strShmCheckpointPath = path;
+}
+
+int NFCPluginManager::GetShmCheckpointInterval() const
+{
+	return m_iShmCheckpointInterval;
+}
+
+void NFCPluginManager::SetShmCheckpointInterval(int interval)
+{
+	m_iShmCheckpointInterval = interval;
+}
+
+bool NFCPluginManager::IsShmCheckpointRestore() const
+{
+	return m_bShmCheckpointRestore;
+}
+
+void NFCPluginManager::SetShmCheckpointRestore(bool restore)
+{
+	m_bShmCheckpointRestore = restore;
+}
+
 bool NFCPluginManager::IsLoadAllServer() const
 {
 	return m_isAllServer;
@@ -418,6 +500,12 @@ bool NFCPluginManager::Execute()
 		}
 	}
 
+	// 所有插件都Execute完了, 再发送本帧攒下的数据(比如合批的转发消息), 不管插件的先后顺序
+	for (auto it = m_nPluginInstanceMap.begin(); it != m_nPluginInstanceMap.end(); ++it)
+	{
+		it->second->AfterExecute();
+	}
+
 	// 结束主循环性能分析
 	EndProfiler();
 
@@ -431,7 +519,7 @@ bool NFCPluginManager::Execute()
 		if (sleepTime > 0)
 		{
 			// 如果还有剩余时间则休眠
-			NFSLEEP(sleepTime*1000);
+			IdleWait(sleepTime*1000);
 		}
 		else
 		{
@@ -483,11 +571,14 @@ bool NFCPluginManager::Execute()
 			}
 			else
 			{
-				NFSLEEP(m_idleSleepUs);
+				// 唤醒模式下同样最多等待m_idleSleepUs, 总线消息没有唤醒事件, 只能靠轮询收取
+				IdleWait(m_idleSleepUs);
 			}
 		}
 	}
 
+	m_wakeupEvent.RecordLatency();
+
 	// 定期打印性能分析结果
 	if (m_bFixedFrame)
 	{
@@ -900,6 +991,64 @@ void NFCPluginManager::SetIdleSleepUs(uint32_t time)
 	m_idleSleepUs = time;
 }
 
+bool NFCPluginManager::IsWakeupMode() const
+{
+	return m_bWakeupMode;
+}
+
+void NFCPluginManager::SetWakeupMode(bool wakeup)
+{
+	if (IsLoadAllServer()) return;
+
+	if (wakeup && !m_wakeupEvent.Init())
+	{
+		NFLogError(NF_LOG_DEFAULT, 0, "init wakeup event failed, keep sleep mode");
+		return;
+	}
+
+	m_bWakeupMode = wakeup;
+}
+
+void NFCPluginManager::SetNextWakeupTime(uint64_t timeMs)
+{
+	if (m_nNextWakeupTime == 0 || timeMs < m_nNextWakeupTime)
+	{
+		m_nNextWakeupTime = timeMs;
+	}
+}
+
+void NFCPluginManager::Wakeup()
+{
+	m_wakeupEvent.Notify();
+}
+
+void NFCPluginManager::IdleWait(uint32_t timeUs)
+{
+	if (m_bWakeupMode)
+	{
+		// 不能睡过最近的定时器到期时间
+		if (m_nNextWakeupTime > 0)
+		{
+			uint64_t now = NF_ADJUST_TIMENOW_MS();
+			uint64_t leftUs = m_nNextWakeupTime > now ? (m_nNextWakeupTime - now) * 1000 : 0;
+			if (leftUs < timeUs)
+			{
+				timeUs = static_cast<uint32_t>(leftUs);
+			}
+			m_nNextWakeupTime = 0;
+		}
+
+		if (timeUs > 0)
+		{
+			m_wakeupEvent.Wait(timeUs);
+		}
+	}
+	else
+	{
+		NFSLEEP(timeUs);
+	}
+}
+
 uint64_t NFCPluginManager::GetInitTime() const
 {
 	return m_nInitTime;
@@ -1025,8 +1174,17 @@ bool NFCPluginManager::UnLoadPluginLibrary(const std::string& strPluginDLLName)
 			pFunc(this);
 		}
 
-		// 卸载动态库
-		pLib->UnLoad();
+		// 二进制log的记录里存的是这个库里的文件名, 函数名和格式化函数指针, 等log线程处理完再卸载
+		if (NFLogMgr::Instance()->WaitBinLogConsumed(NF_BIN_LOG_DRAIN_TIMEOUT_MS))
+		{
+			// 卸载动态库
+			pLib->UnLoad();
+		}
+		else
+		{
+			// 等不到就不卸载, 留着库比log线程访问已卸载的内存好
+			NFLogError(NF_LOG_DEFAULT, 0, "UnLoadPlugin:{} bin log not consumed in {}ms, keep the library loaded", strPluginDLLName, NF_BIN_LOG_DRAIN_TIMEOUT_MS);
+		}
 		// 删除动态库对象
 		delete pLib;
 		// 从映射表中移除
@@ -1111,6 +1269,8 @@ void NFCPluginManager::PrintProfiler()
 	{
 		std::string str = m_profilerMgr.OutputTopProfilerTimer();
 		LOG_STATISTIC("{}", str);
+		LOG_STATISTIC("{} mode {}", m_bWakeupMode ? "wakeup" : "sleep", m_wakeupEvent.GetLatencyHistogram());
+		m_wakeupEvent.ClearLatencyHistogram();
 	}
 }
 
@@ -15,6 +15,7 @@
 #include <atomic>
 #include "NFComm/NFPluginModule/NFIPluginManager.h"
 #include "NFComm/NFCore/NFRandom.hpp"
+#include "NFComm/NFCore/NFWakeupEvent.h"
 #include "NFCDynLib.h"
 #include "NFComm/NFPluginModule/NFProfiler.h"
 #include "NFCAppInited.h"
@@ -437,6 +438,35 @@ public:
 	 */
 	void SetIdleSleepUs(uint32_t time) override;
 
+	/**
+	 * @brief 是否开启事件唤醒模式。
+	 * @return 返回是否开启事件唤醒模式。
+	 */
+	bool IsWakeupMode() const override;
+
+	/**
+	 * @brief 设置是否开启事件唤醒模式。
+	 * @param wakeup 是否开启事件唤醒模式。
+	 */
+	void SetWakeupMode(bool wakeup) override;
+
+	/**
+	 * @brief 唤醒主循环。
+	 */
+	void Wakeup() override;
+
+	/**
+	 * @brief 登记下一次需要主循环处理的时间点，一帧内取最早的。
+	 * @param timeMs 时间点（毫秒）。
+	 */
+	void SetNextWakeupTime(uint64_t timeMs) override;
+
+	/**
+	 * @brief 帧末空闲等待，唤醒模式下阻塞在唤醒事件上，否则休眠。
+	 * @param timeUs 最长等待时间（微秒）。
+	 */
+	void IdleWait(uint32_t timeUs);
+
 	/**
 	 * @brief 获取服务器初始化时间（毫秒）。
 	 * @return 返回服务器初始化时间（毫秒）。
@@ -471,6 +501,77 @@ public:
 	 */
 	void SetInitShm() override;
 
+	/**
+	 * @brief 获取共享内存恢复对象的线程数。
+	 * @return 0表示按CPU核数自动选择。
+	 */
+	int GetShmResumeThreadNum() const override;
+
+	/**
+	 * @brief 设置共享内存恢复对象的线程数。
+	 */
+	void SetShmResumeThreadNum(int num) override;
+
+	/**
+	 * @brief 共享内存和bus通道是否使用大页。
+	 */
+	bool IsShmHugePage() const override;
+
+	/**
+	 * @brief 设置共享内存和bus通道使用大页。
+	 */
+	void SetShmHugePage(bool bHugePage) override;
+
+	/**
+	 * @brief 共享内存创建后是否预先触发缺页。
+	 */
+	bool IsShmPrefault() const override;
+
+	/**
+	 * @brief 设置共享内存创建后预先触发缺页。
+	 */
+	void SetShmPrefault(bool bPrefault) override;
+
+	/**
+	 * @brief 获取共享内存绑定的NUMA节点，小于0表示不绑定。
+	 */
+	int GetShmNumaNode() const override;
+
+	/**
+	 * @brief 设置共享内存绑定的NUMA节点。
+	 */
+	void SetShmNumaNode(int node) override;
+
+	/**
+	 * @brief 获取共享内存写盘镜像的路径，为空表示不写盘。
+	 */
+	const std::string& GetShmCheckpointPath() const override;
+
+	/**
+	 * @brief 设置共享内存写盘镜像的路径。
+	 */
+	void SetShmCheckpointPath(const std::string& path) override;
+
+	/**
+	 * @brief 获取共享内存写盘间隔(秒)。
+	 */
+	int GetShmCheckpointInterval() const override;
+
+	/**
+	 * @brief 设置共享内存写盘间隔(秒)。
+	 */
+	void SetShmCheckpointInterval(int interval) override;
+
+	/**
+	 * @brief 新建共享内存时是否从写盘镜像恢复。
+	 */
+	bool IsShmCheckpointRestore() const override;
+
+	/**
+	 * @brief 设置新建共享内存时是否从写盘镜像恢复。
+	 */
+	void SetShmCheckpointRestore(bool restore) override;
+
 	/**
 	 * @brief 设置 PID 文件名。
 	 */
@@ -719,6 +820,9 @@ private:
 	uint32_t m_nCurFrameCount = 0;
 	bool m_bFixedFrame;
 	uint32_t m_idleSleepUs;
+	bool m_bWakeupMode;
+	NFWakeupEvent m_wakeupEvent;
+	uint64_t m_nNextWakeupTime; //本帧登记的最早定时器到期时间(毫秒), 0表示没有
 
 private:
 	int m_nAppID;
@@ -832,6 +936,20 @@ private:
 	std::atomic_bool m_bHotfixServer{};
 	//是否初始化共享内存
 	bool m_bInitShm;
+	//共享内存热重启时恢复对象的线程数, 0按CPU核数自动选择
+	int m_iShmResumeThreadNum;
+	//共享内存和bus通道使用大页
+	bool m_bShmHugePage;
+	//共享内存创建后预先触发缺页
+	bool m_bShmPrefault;
+	//共享内存绑定的NUMA节点, 小于0不绑定
+	int m_iShmNumaNode;
+	//共享内存写盘镜像的路径, 为空不写盘
+	std::string m_strShmCheckpointPath;
+	//共享内存写盘间隔(秒)
+	int m_iShmCheckpointInterval;
+	//新建共享内存时是否从写盘镜像恢复
+	bool m_bShmCheckpointRestore;
 	bool m_isKillPreApp; //是否杀掉上一个应用程序，
 	bool m_isDaemon;
 
@@ -102,6 +102,14 @@ void ProcessParameter(int argc, char* argv[])
 		cmdParser.Add("Restart", 0, "Close the run server, restart new proc, only on linux");
 		cmdParser.Add("Start", 0, "Start the run server, only on linux");
 		cmdParser.Add("Init", 0, "Change shm mode to init, only on linux");
+		cmdParser.Add<int>("ResumeThread", 0, "Shm resume thread num, 0 use cpu core num, only on linux", false, 0);
+		cmdParser.Add("HugePage", 0, "Use huge page for shm and bus channel, only on linux");
+		cmdParser.Add("Prefault", 0, "Prefault all shm pages after create, only on linux");
+		cmdParser.Add<int>("NumaNode", 0, "Bind shm to the numa node, -1 not bind, only on linux", false, -1);
+		cmdParser.Add<std::string>("Checkpoint", 0, "Shm checkpoint image path, every server writes <path>.<BusName>.0/1 in background for recovery after host reboot, only on linux", false, "");
+		cmdParser.Add<int>("CheckpointInterval", 0, "Shm checkpoint interval seconds, only on linux", false, 300);
+		cmdParser.Add("CheckpointRestore", 0, "Restore a new shm from the checkpoint image, db objects are reloaded from db before they can save again, only on linux");
+		cmdParser.Add("Wakeup", 0, "Wait on eventfd when idle, wake up as soon as net/task messages arrive, bus is still polled every IdleSleepUS(server config, default 1ms) and timers are not delayed, only on linux, not for AllServer");
 		cmdParser.Add("Kill", 0, "Kill the run server, only on linux");
 		cmdParser.Add<std::string>("Param", 0, "Temp Param, You love to use it", false, "Param");
 
@@ -145,6 +153,34 @@ void ProcessParameter(int argc, char* argv[])
 				vecParam.push_back("--Plugin=" + strPlugin);
 				vecParam.push_back("--Game=" + strGame);
 				vecParam.push_back("--restart");
+				if (cmdParser.Exist("ResumeThread"))
+				{
+					vecParam.push_back("--ResumeThread=" + NFCommon::tostr(cmdParser.Get<int>("ResumeThread")));
+				}
+				if (cmdParser.Exist("HugePage"))
+				{
+					vecParam.push_back("--HugePage");
+				}
+				if (cmdParser.Exist("Prefault"))
+				{
+					vecParam.push_back("--Prefault");
+				}
+				if (cmdParser.Exist("NumaNode"))
+				{
+					vecParam.push_back("--NumaNode=" + NFCommon::tostr(cmdParser.Get<int>("NumaNode")));
+				}
+				if (cmdParser.Exist("Checkpoint"))
+				{
+					vecParam.push_back("--Checkpoint=" + cmdParser.Get<std::string>("Checkpoint"));
+				}
+				if (cmdParser.Exist("CheckpointInterval"))
+				{
+					vecParam.push_back("--CheckpointInterval=" + NFCommon::tostr(cmdParser.Get<int>("CheckpointInterval")));
+				}
+				if (cmdParser.Exist("CheckpointRestore"))
+				{
+					vecParam.push_back("--CheckpointRestore");
+				}
 
 				// 创建新的插件管理器并处理参数
 				NFIPluginManager* pPluginManager = NF_NEW NFCPluginManager();
@@ -228,6 +264,14 @@ void ProcessParameter(NFIPluginManager* pPluginManager, const std::vector<std::s
 		cmdParser.Add("Restart", 0, "Close the run server, restart new proc, only on linux");
 		cmdParser.Add("Start", 0, "Start the run server, only on linux");
 		cmdParser.Add("Init", 0, "Change shm mode to init, only on linux");
+		cmdParser.Add<int>("ResumeThread", 0, "Shm resume thread num, 0 use cpu core num, only on linux", false, 0);
+		cmdParser.Add("HugePage", 0, "Use huge page for shm and bus channel, only on linux");
+		cmdParser.Add("Prefault", 0, "Prefault all shm pages after create, only on linux");
+		cmdParser.Add<int>("NumaNode", 0, "Bind shm to the numa node, -1 not bind, only on linux", false, -1);
+		cmdParser.Add<std::string>("Checkpoint", 0, "Shm checkpoint image path, every server writes <path>.<BusName>.0/1 in background for recovery after host reboot, only on linux", false, "");
+		cmdParser.Add<int>("CheckpointInterval", 0, "Shm checkpoint interval seconds, only on linux", false, 300);
+		cmdParser.Add("CheckpointRestore", 0, "Restore a new shm from the checkpoint image, db objects are reloaded from db before they can save again, only on linux");
+		cmdParser.Add("Wakeup", 0, "Wait on eventfd when idle, wake up as soon as net/task messages arrive, bus is still polled every IdleSleepUS(server config, default 1ms) and timers are not delayed, only on linux, not for AllServer");
 		cmdParser.Add("Kill", 0, "Kill the run server, only on linux");
 		cmdParser.Add<std::string>("Param", 0, "Temp Param, You love to use it", false, "Param");
 
@@ -412,6 +456,44 @@ void ProcessParameter(NFIPluginManager* pPluginManager, const std::vector<std::s
             pPluginManager->SetInitShm();
         }
 
+        // 共享内存热重启时恢复对象的线程数
+        if (cmdParser.Exist("ResumeThread"))
+        {
+            pPluginManager->SetShmResumeThreadNum(cmdParser.Get<int>("ResumeThread"));
+        }
+
+        // 共享内存和bus通道使用大页
+        if (cmdParser.Exist("HugePage"))
+        {
+            pPluginManager->SetShmHugePage(true);
+        }
+
+        // 共享内存创建后预先触发缺页
+        if (cmdParser.Exist("Prefault"))
+        {
+            pPluginManager->SetShmPrefault(true);
+        }
+
+        // 共享内存绑定的NUMA节点
+        if (cmdParser.Exist("NumaNode"))
+        {
+            pPluginManager->SetShmNumaNode(cmdParser.Get<int>("NumaNode"));
+        }
+
+        // 共享内存定期写盘, 机器重启后从镜像恢复
+        if (cmdParser.Exist("Checkpoint"))
+        {
+            pPluginManager->SetShmCheckpointPath(cmdParser.Get<std::string>("Checkpoint"));
+            pPluginManager->SetShmCheckpointInterval(cmdParser.Get<int>("CheckpointInterval"));
+            pPluginManager->SetShmCheckpointRestore(cmdParser.Exist("CheckpointRestore"));
+        }
+
+        // 空闲时等待eventfd, 有网络/bus/任务消息时立即唤醒
+        if (cmdParser.Exist("Wakeup"))
+        {
+            pPluginManager->SetWakeupMode(true);
+        }
+
         // 检查命令行参数中是否存在 "Kill" 选项
         if (cmdParser.Exist("Kill"))
         {
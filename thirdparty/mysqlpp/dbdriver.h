@@ -382,6 +382,13 @@ public:
 		return mysql_insert_id(&mysql_);
 	}
 
+	/// \brief Return the underlying C API connection handle
+	///
+	/// Needed for APIs MySQL++ does not wrap, such as the
+	/// \c mysql_stmt_*() prepared statement family.  Don't close the
+	/// handle or change its options behind MySQL++'s back.
+	MYSQL* mysql_handle() { return &mysql_; }
+
 	/// \brief Kill a MySQL server thread
 	///
 	/// \param tid ID of thread to kill
@@ -89,6 +89,27 @@ datatypes = {
 	FieldD.TYPE_UINT64: ('uint64_t', 'UINT64', 10, True)
 }
 
+# change-begin wire format
+# pbtype => (NFWireWriter/NFWireReader function suffix, wire type)
+wiretypes = {
+	'BOOL': ('Bool', 'NF_WIRE_TYPE_VARINT'),
+	'DOUBLE': ('Double', 'NF_WIRE_TYPE_FIXED64'),
+	'FIXED32': ('Fixed32', 'NF_WIRE_TYPE_FIXED32'),
+	'FIXED64': ('Fixed64', 'NF_WIRE_TYPE_FIXED64'),
+	'FLOAT': ('Float', 'NF_WIRE_TYPE_FIXED32'),
+	'INT32': ('Int32', 'NF_WIRE_TYPE_VARINT'),
+	'INT64': ('Int64', 'NF_WIRE_TYPE_VARINT'),
+	'SFIXED32': ('SFixed32', 'NF_WIRE_TYPE_FIXED32'),
+	'SFIXED64': ('SFixed64', 'NF_WIRE_TYPE_FIXED64'),
+	'SINT32': ('SInt32', 'NF_WIRE_TYPE_VARINT'),
+	'SINT64': ('SInt64', 'NF_WIRE_TYPE_VARINT'),
+	'UINT32': ('UInt32', 'NF_WIRE_TYPE_VARINT'),
+	'UINT64': ('UInt64', 'NF_WIRE_TYPE_VARINT'),
+	'ENUM': ('Enum', 'NF_WIRE_TYPE_VARINT'),
+	'UENUM': ('Enum', 'NF_WIRE_TYPE_VARINT'),
+}
+# change-end
+
 # Integer size overrides (from .proto settings)
 intsizes = {
 	nanopb_pb2.IS_8: 'int8_t',
@@ -338,6 +359,13 @@ class Field:
 		self.ctype = None
 		self.fixed_count = False
 		self.type_name = desc.type_name
+		# change-begin wire format
+		self.proto3 = field_options.proto3
+		if desc.options.HasField('packed'):
+			self.packed = desc.options.packed
+		else:
+			self.packed = field_options.proto3
+		# change-end
 
 		if field_options.type == nanopb_pb2.FT_INLINE:
 			# Before nanopb-0.3.8, fixed length bytes arrays were specified
@@ -1450,6 +1478,203 @@ class Field:
 			result += '    assert(false); //%s is not a POD type\n' % self.name
 		return result
 
+	# change-begin wire format
+	def wire_supported(self):
+		'''Fields that SerializeTo/MergeFrom can handle directly, other messages fall back to ToPb/FromPb'''
+		if self.allocation != 'STATIC' or self.is_std_stl:
+			return False
+		if self.pbtype == 'STRING' or self.pbtype == 'BYTES':
+			if not self.use_stl_string:
+				return False
+		elif self.pbtype != 'MESSAGE' and self.pbtype not in wiretypes:
+			return False
+		if self.rules == 'REPEATED':
+			return self.use_stl == nanopb_pb2.STL_VECTOR or self.use_stl == nanopb_pb2.STL_LIST \
+				or self.use_stl == nanopb_pb2.STL_UNORDERED_SET or self.use_stl == nanopb_pb2.STL_MULTI_UNORDERED_SET
+		return True
+
+	def wire_value_str(self, value):
+		if self.pbtype in ('ENUM', 'UENUM'):
+			return 'static_cast<int32_t>(%s)' % value
+		return value
+
+	def serialize_to_str(self):
+		result = ''
+		if self.rules == 'REPEATED':
+			if self.pbtype in wiretypes and self.packed:
+				result += '    if (!%s.empty())\n' % self.name
+				result += '    {\n'
+				result += '        size_t start = writer.BeginLength(%d);\n' % self.tag
+				result += '        for (auto iter = %s.begin(); iter != %s.end(); ++iter)\n' % (self.name, self.name)
+				result += '        {\n'
+				result += '            writer.Write%sNoTag(%s);\n' % (wiretypes[self.pbtype][0], self.wire_value_str('*iter'))
+				result += '        }\n'
+				result += '        writer.EndLength(start);\n'
+				result += '    }\n'
+				return result
+
+			result += '    for (auto iter = %s.begin(); iter != %s.end(); ++iter)\n' % (self.name, self.name)
+			result += '    {\n'
+			if self.pbtype == 'STRING' or self.pbtype == 'BYTES':
+				result += '        writer.WriteBytes(%d, iter->data(), iter->length());\n' % self.tag
+			elif self.pbtype == 'MESSAGE':
+				result += '        size_t start = writer.BeginLength(%d);\n' % self.tag
+				result += '        iter->SerializeTo(writer);\n'
+				result += '        writer.EndLength(start);\n'
+			else:
+				result += '        writer.Write%s(%d, %s);\n' % (wiretypes[self.pbtype][0], self.tag, self.wire_value_str('*iter'))
+			result += '    }\n'
+		else:
+			if self.pbtype == 'MESSAGE':
+				result += '    {\n'
+				result += '        size_t start = writer.BeginLength(%d);\n' % self.tag
+				result += '        %s.SerializeTo(writer);\n' % self.name
+				result += '        writer.EndLength(start);\n'
+				result += '    }\n'
+				return result
+
+			if self.pbtype == 'STRING' or self.pbtype == 'BYTES':
+				write = 'writer.WriteBytes(%d, %s.data(), %s.length());\n' % (self.tag, self.name, self.name)
+				check = '!%s.empty()' % self.name
+			else:
+				write = 'writer.Write%s(%d, %s);\n' % (wiretypes[self.pbtype][0], self.tag, self.wire_value_str(self.name))
+				if self.pbtype == 'FLOAT' or self.pbtype == 'DOUBLE':
+					# compare raw bits so that -0.0 is still written
+					check = 'NFWireWriter::IsNonZeroBits(%s)' % self.name
+				else:
+					check = '%s != 0' % self.name
+
+			# proto3 only writes non-default values, the same as ToPb followed by SerializeToString
+			if self.proto3:
+				result += '    if (%s)\n' % check
+				result += '    {\n'
+				result += '        ' + write
+				result += '    }\n'
+			else:
+				result += '    ' + write
+		return result
+
+	def merge_from_count_check_str(self, indent):
+		result = indent + 'if (%s.size() >= %s.max_size())\n' % (self.name, self.name)
+		result += indent + '{\n'
+		result += indent + '    if (NULL != g_nanopb_frompb_log_handle)\n'
+		if self.max_count_enum is not None:
+			result += indent + '        g_nanopb_frompb_log_handle("struct:%s, field:%s, cur count:%%d, max count:%%d", static_cast<int>(%s.size()), %s);\n' % (self.struct_name, self.name, self.name, self.max_count_enum)
+		else:
+			result += indent + '        g_nanopb_frompb_log_handle("struct:%s, field:%s, cur count:%%d, max count:%s", static_cast<int>(%s.size()));\n' % (self.struct_name, self.name, self.max_count, self.name)
+		result += indent + '    return false;\n'
+		result += indent + '}\n'
+		return result
+
+	def merge_from_size_check_str(self, indent):
+		# same limits as FromPb
+		if self.pbtype == 'STRING':
+			what = 'length'
+			op = '>='
+		else:
+			what = 'size'
+			op = '>=' if self.rules == 'REPEATED' else '>'
+		if self.rules == 'REPEATED' and self.max_size_enum is not None:
+			limit = self.max_size_enum
+		else:
+			limit = '%u' % self.max_size
+		result = indent + 'if (length %s %s)\n' % (op, limit)
+		result += indent + '{\n'
+		result += indent + '    if (NULL != g_nanopb_frompb_log_handle)\n'
+		if self.pbtype == 'STRING':
+			if self.rules == 'REPEATED' and self.max_size_enum is not None:
+				result += indent + '        g_nanopb_frompb_log_handle("struct:%s, field:%s, cur length:%%d, max length:%%d", static_cast<int>(length), %s-1);\n' % (self.struct_name, self.name, self.max_size_enum)
+			else:
+				result += indent + '        g_nanopb_frompb_log_handle("struct:%s, field:%s, cur length:%%d, max length:%s", static_cast<int>(length));\n' % (self.struct_name, self.name, self.max_size - 1)
+		else:
+			if self.rules == 'REPEATED' and self.max_size_enum is not None:
+				result += indent + '        g_nanopb_frompb_log_handle("struct:%s, field:%s, cur %s:%%d, max %s:%%d", static_cast<int>(length), %s);\n' % (self.struct_name, self.name, what, what, self.max_size_enum)
+			else:
+				result += indent + '        g_nanopb_frompb_log_handle("struct:%s, field:%s, cur %s:%%d, max %s:%s", static_cast<int>(length));\n' % (self.struct_name, self.name, what, what, self.max_size)
+		result += indent + '    return false;\n'
+		result += indent + '}\n'
+		return result
+
+	def merge_from_add_str(self, indent, value):
+		if self.use_stl == nanopb_pb2.STL_UNORDERED_SET or self.use_stl == nanopb_pb2.STL_MULTI_UNORDERED_SET:
+			return indent + '%s.insert(%s);\n' % (self.name, value)
+		return indent + '%s.push_back(%s);\n' % (self.name, value)
+
+	def merge_from_str(self):
+		indent = '                '
+		result = '            case %d:\n' % self.tag
+		if self.pbtype == 'STRING' or self.pbtype == 'BYTES':
+			result += '                if (wireType == NF_WIRE_TYPE_LENGTH)\n'
+			result += '                {\n'
+			result += '                    const char* pData = NULL;\n'
+			result += '                    size_t length = 0;\n'
+			result += '                    if (!reader.ReadBytes(pData, length)) return false;\n'
+			if self.rules == 'REPEATED':
+				result += self.merge_from_count_check_str(indent + '    ')
+				result += self.merge_from_size_check_str(indent + '    ')
+				if self.use_stl == nanopb_pb2.STL_VECTOR:
+					result += '                    %s.emplace_back();\n' % self.name
+					result += '                    %s.back().assign(pData, length);\n' % self.name
+				else:
+					result += '                    %s temp;\n' % self.ctype
+					result += '                    temp.assign(pData, length);\n'
+					result += self.merge_from_add_str('                    ', 'temp')
+			else:
+				result += self.merge_from_size_check_str(indent + '    ')
+				result += '                    %s.assign(pData, length);\n' % self.name
+			result += '                    continue;\n'
+			result += '                }\n'
+		elif self.pbtype == 'MESSAGE':
+			result += '                if (wireType == NF_WIRE_TYPE_LENGTH)\n'
+			result += '                {\n'
+			result += '                    NFWireReader sub;\n'
+			result += '                    if (!reader.ReadSubReader(sub)) return false;\n'
+			if self.rules == 'REPEATED':
+				result += self.merge_from_count_check_str(indent + '    ')
+				if self.use_stl == nanopb_pb2.STL_VECTOR:
+					result += '                    %s.emplace_back();\n' % self.name
+					result += '                    if (!%s.back().ParseFrom(sub)) return false;\n' % self.name
+				else:
+					result += '                    %s temp;\n' % self.ctype
+					result += '                    if (!temp.ParseFrom(sub)) return false;\n'
+					result += self.merge_from_add_str('                    ', 'temp')
+			else:
+				result += '                    if (!%s.MergeFrom(sub)) return false;\n' % self.name
+			result += '                    continue;\n'
+			result += '                }\n'
+		else:
+			func, wiretype = wiretypes[self.pbtype]
+			value = 'static_cast<%s>(%%s.Read%s())' % (self.ctype, func)
+			if self.rules == 'REPEATED':
+				# accept both packed and unpacked encoding, like protobuf
+				result += '                if (wireType == NF_WIRE_TYPE_LENGTH)\n'
+				result += '                {\n'
+				result += '                    NFWireReader sub;\n'
+				result += '                    if (!reader.ReadSubReader(sub)) return false;\n'
+				result += '                    while (!sub.IsEnd())\n'
+				result += '                    {\n'
+				result += self.merge_from_count_check_str(indent + '        ')
+				result += self.merge_from_add_str(indent + '        ', value % 'sub')
+				result += '                    }\n'
+				result += '                    if (sub.IsError()) return false;\n'
+				result += '                    continue;\n'
+				result += '                }\n'
+				result += '                if (wireType == %s)\n' % wiretype
+				result += '                {\n'
+				result += self.merge_from_count_check_str(indent + '    ')
+				result += self.merge_from_add_str(indent + '    ', value % 'reader')
+				result += '                    continue;\n'
+				result += '                }\n'
+			else:
+				result += '                if (wireType == %s)\n' % wiretype
+				result += '                {\n'
+				result += '                    %s = %s;\n' % (self.name, value % 'reader')
+				result += '                    continue;\n'
+				result += '                }\n'
+		result += '                break;\n'
+		return result
+	# change-end
+
 	def destruct_str(self):
 		return ""
 
@@ -2023,6 +2248,11 @@ class OneOf(Field):
 	def is_static(self):
 		return self.is_all_field_static
 
+	# change-begin wire format
+	def wire_supported(self):
+		return False
+	# change-end
+
 	def __str__(self):
 		result = ''
 		if self.fields:
@@ -2774,6 +3004,7 @@ class Message:
 			result += self.init_declaration_str()
 			result += self.from_pb_declaration_str()
 			result += self.to_pb_declaration_str()
+			result += self.wire_declaration_str()
 			result += self.short_debug_string_declaration_str()
 			result += self.get_which_declaration_str()
 
@@ -2977,6 +3208,92 @@ class Message:
 		result += '}\n\n'
 		return result
 
+	# change-begin wire format
+	def wire_supported(self):
+		if self.is_std_stl or len(self.oneofs) > 0:
+			return False
+		for f in self.fields:
+			if not f.wire_supported():
+				return False
+		return True
+
+	def wire_declaration_str(self):
+		result = '    bool SerializeTo(NFWireWriter& writer) const;\n'
+		result += '    int SerializeTo(uint8_t* pBuf, size_t size) const;\n'
+		result += '    bool ParseFrom(NFWireReader& reader);\n'
+		result += '    bool ParseFrom(const uint8_t* pBuf, size_t size);\n'
+		result += '    bool MergeFrom(NFWireReader& reader);\n'
+		return result
+
+	def wire_definition_str(self):
+		result = 'bool %s::SerializeTo(NFWireWriter& writer) const\n' % self.name
+		result += '{\n'
+		if self.wire_supported():
+			result += ''.join([f.serialize_to_str() for f in self.ordered_fields])
+			result += '    return !writer.IsOverflow();\n'
+		else:
+			result += '    %s cc;\n' % self.cctype
+			result += '    ToPb(&cc);\n'
+			result += '    size_t length = cc.ByteSizeLong();\n'
+			result += '    uint8_t* pBuf = writer.Reserve(length);\n'
+			result += '    if (NULL == pBuf) return false;\n'
+			result += '    cc.SerializeWithCachedSizesToArray(pBuf);\n'
+			result += '    return true;\n'
+		result += '}\n\n'
+
+		result += 'int %s::SerializeTo(uint8_t* pBuf, size_t size) const\n' % self.name
+		result += '{\n'
+		result += '    NFWireWriter writer(pBuf, size);\n'
+		result += '    if (!SerializeTo(writer)) return -1;\n'
+		result += '    return static_cast<int>(writer.GetLength());\n'
+		result += '}\n\n'
+
+		result += 'bool %s::ParseFrom(NFWireReader& reader)\n' % self.name
+		result += '{\n'
+		if self.wire_supported():
+			# missing fields get the same values as FromPb of an empty message
+			result += '    if (!FromPb(%s::default_instance())) return false;\n' % self.cctype
+			result += '    return MergeFrom(reader);\n'
+		else:
+			result += '    %s cc;\n' % self.cctype
+			result += '    if (!cc.ParsePartialFromArray(reader.GetPos(), static_cast<int>(reader.GetLeft()))) return false;\n'
+			result += '    reader.SkipAll();\n'
+			result += '    return FromPb(cc);\n'
+		result += '}\n\n'
+
+		result += 'bool %s::ParseFrom(const uint8_t* pBuf, size_t size)\n' % self.name
+		result += '{\n'
+		result += '    NFWireReader reader(pBuf, size);\n'
+		result += '    return ParseFrom(reader);\n'
+		result += '}\n\n'
+
+		result += 'bool %s::MergeFrom(NFWireReader& reader)\n' % self.name
+		result += '{\n'
+		if self.wire_supported():
+			result += '    uint32_t field = 0;\n'
+			result += '    uint32_t wireType = 0;\n'
+			result += '    while (reader.ReadTag(field, wireType))\n'
+			result += '    {\n'
+			result += '        switch (field)\n'
+			result += '        {\n'
+			result += ''.join([f.merge_from_str() for f in self.ordered_fields])
+			result += '            default:\n'
+			result += '                break;\n'
+			result += '        }\n'
+			result += '        if (!reader.SkipField(field, wireType)) return false;\n'
+			result += '    }\n'
+			result += '    return !reader.IsError();\n'
+		else:
+			result += '    %s cc;\n' % self.cctype
+			result += '    ToPb(&cc);\n'
+			result += '    ::google::protobuf::io::CodedInputStream input(reader.GetPos(), static_cast<int>(reader.GetLeft()));\n'
+			result += '    if (!cc.MergePartialFromCodedStream(&input)) return false;\n'
+			result += '    reader.SkipAll();\n'
+			result += '    return FromPb(cc);\n'
+		result += '}\n\n'
+		return result
+	# change-end
+
 	def short_debug_string_declaration_str(self):
 		return '    std::string ShortDebugString() const;\n'
 
@@ -3288,6 +3605,7 @@ const pb_field_t* get_nanopb_field_t(const char* type_name)
 		yield '#include <unordered_map>\n'
 		yield '#include <map>\n'
 		yield '#include <NFComm/NFCore/NFHash.hpp>\n'
+		yield '#include "NFComm/NFCore/NFWireFormat.h"\n'
 
 
 		for incfile in nfshmHeaderFileList:
@@ -3459,6 +3777,7 @@ const pb_field_t* get_nanopb_field_t(const char* type_name)
 				yield msg.init_definition_str()
 				yield msg.from_pb_definition_str()
 				yield msg.to_pb_definition_str()
+				yield msg.wire_definition_str()
 				yield msg.short_debug_string_definition_str()
 				yield msg.get_which_definition_str()
 